@@ -0,0 +1,28 @@
+-- Script to compare render times with and without frame independent effects being rendered in parallel.
+-- Intended to be run on a sequence with a single 200x100 matrix using effects such as Bars, Butterfly and Plasma.
+
+seqs = PromptSequences()
+for i,seq in ipairs(seqs) do
+    properties = {}
+    properties['seq'] = seq
+	properties['promptIssues'] = 'false'
+    RunCommand('openSequence', properties)
+
+    properties = {}
+	properties['highdef'] = 'true'
+	properties['parallelFrames'] = 'false'
+	result = RunCommand('renderAll', properties)
+	sequential = tonumber(result['render'])
+
+	properties['parallelFrames'] = 'true'
+	result = RunCommand('renderAll', properties)
+	parallel = tonumber(result['render'])
+
+	Log(seq)
+	Log(string.format("Sequential render %0.3fs, parallel frame render %0.3fs", sequential, parallel))
+	if parallel > 0 then
+		Log(string.format("Speedup %0.2fx", sequential / parallel))
+	end
+
+    RunCommand('closeSequence', {})
+end
@@ -0,0 +1,631 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "CaptureEngine.h"
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+#include <wx/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <log4cpp/Category.hh>
+
+#ifndef __WXMSW__
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#ifdef __LINUX__
+#include <sys/socket.h>
+#include <poll.h>
+#include <time.h>
+#endif
+#else
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#endif
+
+// packets read from the socket in one call on Linux
+#define CAPTURE_RECEIVE_BATCH 64
+
+// the kernel receive buffer we ask for so a burst of universes is not dropped before we get to read it
+#define CAPTURE_SOCKET_BUFFER (8 * 1024 * 1024)
+
+// the writer gathers this much before writing to the file
+#define CAPTURE_WRITE_BUFFER (1024 * 1024)
+
+// pcap with nanosecond timestamps holding raw IPv4 packets so the file opens in wireshark
+#define PCAP_MAGIC_NS 0xa1b23c4d
+#define PCAP_MAGIC_US 0xa1b2c3d4
+#define PCAP_LINKTYPE_IPV4 228
+#define PCAP_IPUDP_HEADER 28
+
+#pragma region CaptureRing
+
+CaptureRing::CaptureRing(size_t size) :
+    _packets(size)
+{
+    _head = 0;
+    _tail = 0;
+    _dropped = 0;
+}
+
+CapturedPacket* CaptureRing::Reserve()
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= _packets.size()) return nullptr;
+    return &_packets[head % _packets.size()];
+}
+
+void CaptureRing::Commit()
+{
+    _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+const CapturedPacket* CaptureRing::Peek()
+{
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) return nullptr;
+    return &_packets[tail % _packets.size()];
+}
+
+void CaptureRing::Release()
+{
+    _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+#pragma endregion
+
+#pragma region Threads
+
+class CaptureReceiverThread : public wxThread
+{
+    CaptureEngine* _engine = nullptr;
+    wxDatagramSocket* _socket = nullptr;
+    int _port = 0;
+    volatile bool _stop = false;
+
+public:
+
+    CaptureReceiverThread(CaptureEngine* engine, wxDatagramSocket* socket, int port) : wxThread(wxTHREAD_JOINABLE)
+    {
+        _engine = engine;
+        _socket = socket;
+        _port = port;
+    }
+
+    void Stop()
+    {
+        _stop = true;
+    }
+
+    virtual void* Entry() override
+    {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        logger_base.debug("Capture receive thread started for port %d.", _port);
+
+#ifdef __LINUX__
+        int fd = _socket->GetSocket();
+
+        // have the kernel stamp each packet as it arrives so the times do not include our scheduling delays
+        int on = 1;
+        bool kernelTimestamps = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) == 0;
+        if (!kernelTimestamps)
+        {
+            logger_base.warn("Capture could not enable kernel timestamps on port %d, using receive time.", _port);
+        }
+
+        uint8_t buffers[CAPTURE_RECEIVE_BATCH][CAPTURE_MAX_PACKET];
+        uint8_t controls[CAPTURE_RECEIVE_BATCH][CMSG_SPACE(sizeof(struct timespec))];
+        struct sockaddr_in addrs[CAPTURE_RECEIVE_BATCH];
+        struct iovec iovecs[CAPTURE_RECEIVE_BATCH];
+        struct mmsghdr msgs[CAPTURE_RECEIVE_BATCH];
+        memset(msgs, 0x00, sizeof(msgs));
+        for (int i = 0; i < CAPTURE_RECEIVE_BATCH; i++)
+        {
+            iovecs[i].iov_base = buffers[i];
+            iovecs[i].iov_len = sizeof(buffers[i]);
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        while (!_stop)
+        {
+            struct pollfd pfd;
+            pfd.fd = fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, 100) <= 0) continue;
+
+            // the kernel shrinks these to what it used so they need resetting every call
+            for (int i = 0; i < CAPTURE_RECEIVE_BATCH; i++)
+            {
+                msgs[i].msg_hdr.msg_name = &addrs[i];
+                msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+                msgs[i].msg_hdr.msg_control = controls[i];
+                msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+            }
+
+            int count = recvmmsg(fd, msgs, CAPTURE_RECEIVE_BATCH, MSG_DONTWAIT, nullptr);
+            int64_t now = CaptureEngine::Now();
+            for (int i = 0; i < count; i++)
+            {
+                int64_t timeNS = now;
+                if (kernelTimestamps)
+                {
+                    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg))
+                    {
+                        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+                        {
+                            struct timespec ts;
+                            memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                            timeNS = (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+                        }
+                    }
+                }
+                _engine->Receive(_port, buffers[i], msgs[i].msg_len, addrs[i].sin_addr.s_addr, timeNS);
+            }
+        }
+#else
+        uint8_t buffer[CAPTURE_MAX_PACKET];
+        wxIPV4address addr;
+
+        while (!_stop)
+        {
+            size_t n = _socket->RecvFrom(addr, buffer, sizeof(buffer)).LastCount();
+            if (n > 0 && !_stop)
+            {
+                _engine->Receive(_port, buffer, n, inet_addr(addr.IPAddress().c_str()), CaptureEngine::Now());
+            }
+        }
+#endif
+
+        logger_base.debug("Capture receive thread for port %d exiting.", _port);
+        return nullptr;
+    }
+};
+
+class CaptureWriterThread : public wxThread
+{
+    CaptureEngine* _engine = nullptr;
+    FILE* _file = nullptr;
+    volatile bool _stop = false;
+    std::atomic<bool> _flush;
+    std::vector<uint8_t> _buffer;
+
+    static void Put16BE(uint8_t* p, uint16_t v)
+    {
+        p[0] = v >> 8;
+        p[1] = v & 0xFF;
+    }
+
+    void AppendRecord(const CapturedPacket& packet)
+    {
+        uint32_t header[4];
+        header[0] = (uint32_t)(packet.timeNS / 1000000000LL);
+        header[1] = (uint32_t)(packet.timeNS % 1000000000LL);
+        header[2] = PCAP_IPUDP_HEADER + packet.length;
+        header[3] = header[2];
+
+        size_t start = _buffer.size();
+        _buffer.resize(start + sizeof(header) + PCAP_IPUDP_HEADER + packet.length);
+        uint8_t* p = &_buffer[start];
+        memcpy(p, header, sizeof(header));
+        p += sizeof(header);
+
+        // IPv4 header, we only know where it came from and the port so the destination is left blank
+        memset(p, 0x00, PCAP_IPUDP_HEADER);
+        p[0] = 0x45;
+        Put16BE(p + 2, PCAP_IPUDP_HEADER + packet.length);
+        p[6] = 0x40; // dont fragment
+        p[8] = 64; // ttl
+        p[9] = 17; // udp
+        memcpy(p + 12, &packet.sourceIP, 4);
+        uint32_t sum = 0;
+        for (int i = 0; i < 20; i += 2)
+        {
+            sum += ((uint32_t)p[i] << 8) + p[i + 1];
+        }
+        while (sum >> 16) sum = (sum & 0xFFFF) + (sum >> 16);
+        Put16BE(p + 10, (uint16_t)~sum);
+
+        // UDP header, a zero checksum means none
+        Put16BE(p + 20, packet.port);
+        Put16BE(p + 22, packet.port);
+        Put16BE(p + 24, 8 + packet.length);
+
+        memcpy(p + PCAP_IPUDP_HEADER, packet.data, packet.length);
+    }
+
+    void Write()
+    {
+        if (!_buffer.empty())
+        {
+            fwrite(_buffer.data(), 1, _buffer.size(), _file);
+            _buffer.clear();
+        }
+    }
+
+public:
+
+    CaptureWriterThread(CaptureEngine* engine, FILE* file) : wxThread(wxTHREAD_JOINABLE)
+    {
+        _engine = engine;
+        _file = file;
+        _flush = false;
+        _buffer.reserve(CAPTURE_WRITE_BUFFER + 256 * (16 + PCAP_IPUDP_HEADER + CAPTURE_MAX_PACKET));
+
+        uint32_t header[6];
+        header[0] = PCAP_MAGIC_NS;
+        header[1] = 2 | (4 << 16); // version 2.4
+        header[2] = 0; // utc
+        header[3] = 0;
+        header[4] = 65535; // snap length
+        header[5] = PCAP_LINKTYPE_IPV4;
+        fwrite(header, 1, sizeof(header), _file);
+    }
+
+    void Stop()
+    {
+        _stop = true;
+    }
+
+    void RequestFlush()
+    {
+        _flush = true;
+    }
+
+    bool IsFlushPending() const
+    {
+        return _flush;
+    }
+
+    virtual void* Entry() override
+    {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        logger_base.debug("Capture writer thread started.");
+
+        CaptureRing* rings[] = { &_engine->GetRing(E131PORT), &_engine->GetRing(ARTNETPORT) };
+
+        for (;;)
+        {
+            bool any = false;
+            for (auto ring : rings)
+            {
+                // take a bounded number from each so one protocol cannot hold up the other
+                for (int i = 0; i < 256; i++)
+                {
+                    const CapturedPacket* packet = ring->Peek();
+                    if (packet == nullptr) break;
+                    AppendRecord(*packet);
+                    ring->Release();
+                    any = true;
+                }
+                if (_buffer.size() >= CAPTURE_WRITE_BUFFER) Write();
+            }
+
+            if (!any)
+            {
+                Write();
+                if (_flush)
+                {
+                    fflush(_file);
+                    _flush = false;
+                }
+                if (_stop) break;
+                wxMilliSleep(1);
+            }
+        }
+
+        Write();
+        logger_base.debug("Capture writer thread exiting.");
+        return nullptr;
+    }
+};
+
+#pragma endregion
+
+CaptureEngine::CaptureEngine() :
+    _e131Ring(CAPTURE_RING_PACKETS),
+    _artNETRing(CAPTURE_RING_PACKETS),
+    _universeFilter(65536)
+{
+    _captureAllUniverses = true;
+    _recording = false;
+    _triggerEnabled = false;
+    _triggerUniverse = 0;
+    _triggerChannel = 1;
+    _triggerLevel = 0;
+    _captured = 0;
+}
+
+CaptureEngine::~CaptureEngine()
+{
+    StopCapture();
+    StopListening(E131PORT);
+    StopListening(ARTNETPORT);
+}
+
+bool CaptureEngine::StartListening(int port, const std::string& localIP, const std::list<int>& multicastUniverses)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (IsListening(port)) return true;
+
+    wxIPV4address addr;
+    addr.AnyAddress();
+    addr.Service(port);
+    // blocking because it is read from the receive thread rather than through events
+    wxDatagramSocket* socket = new wxDatagramSocket(addr, wxSOCKET_BLOCK);
+    if (!socket->IsOk())
+    {
+        delete socket;
+        logger_base.warn("Error opening socket to listen on port %d.", port);
+        return false;
+    }
+
+    logger_base.debug("Listening on port %d on %s", port, (const char*)localIP.c_str());
+
+    int bufferSize = CAPTURE_SOCKET_BUFFER;
+    if (!socket->SetOption(SOL_SOCKET, SO_RCVBUF, (const char*)&bufferSize, sizeof(bufferSize)))
+    {
+        logger_base.warn("    Could not increase the receive buffer on port %d.", port);
+    }
+
+    for (const auto& u : multicastUniverses)
+    {
+        struct ip_mreq mreq;
+        wxString ip = wxString::Format("239.255.%d.%d", u >> 8, u & 0xFF);
+        logger_base.debug("Registering for multicast on %s.", (const char*)ip.c_str());
+        mreq.imr_multiaddr.s_addr = inet_addr(ip.c_str());
+        mreq.imr_interface.s_addr = inet_addr(localIP.c_str()); // this will only listen on the default interface
+        if (!socket->SetOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&mreq, sizeof(mreq)))
+        {
+            logger_base.warn("    Error opening multicast listener %s.", (const char*)ip.c_str());
+        }
+    }
+
+    socket->Notify(false);
+    socket->SetTimeout(1);
+
+    CaptureReceiverThread* thread = new CaptureReceiverThread(this, socket, port);
+    if (thread->Run() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("Failed to start the capture receive thread for port %d.", port);
+        delete thread;
+        delete socket;
+        return false;
+    }
+
+    if (port == E131PORT)
+    {
+        _e131Thread = thread;
+        _e131Socket = socket;
+    }
+    else
+    {
+        _artNETThread = thread;
+        _artNETSocket = socket;
+    }
+    return true;
+}
+
+void CaptureEngine::StopListening(int port)
+{
+    CaptureReceiverThread*& thread = port == E131PORT ? _e131Thread : _artNETThread;
+    wxDatagramSocket*& socket = port == E131PORT ? _e131Socket : _artNETSocket;
+
+    if (thread != nullptr)
+    {
+        thread->Stop();
+        thread->Wait();
+        delete thread;
+        thread = nullptr;
+    }
+
+    if (socket != nullptr)
+    {
+        socket->Close();
+        delete socket;
+        socket = nullptr;
+    }
+}
+
+bool CaptureEngine::IsListening(int port) const
+{
+    return (port == E131PORT ? _e131Thread : _artNETThread) != nullptr;
+}
+
+bool CaptureEngine::StartCapture(const std::string& file, const std::list<std::pair<int, int>>& universes)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    StopCapture();
+
+    FILE* f = fopen(file.c_str(), "wb");
+    if (f == nullptr)
+    {
+        logger_base.error("Unable to create capture file %s.", (const char*)file.c_str());
+        return false;
+    }
+    setvbuf(f, nullptr, _IOFBF, CAPTURE_WRITE_BUFFER);
+
+    _file = file;
+    _captured = 0;
+    _captureAllUniverses = universes.empty();
+    for (auto& it : _universeFilter)
+    {
+        it = false;
+    }
+    for (const auto& it : universes)
+    {
+        for (int u = std::max(0, it.first); u <= it.second && u < (int)_universeFilter.size(); u++)
+        {
+            _universeFilter[u] = true;
+        }
+    }
+    _e131Ring.Clear();
+    _artNETRing.Clear();
+
+    _captureFile = f;
+    _writerThread = new CaptureWriterThread(this, f);
+    if (_writerThread->Run() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("Failed to start the capture writer thread.");
+        delete _writerThread;
+        _writerThread = nullptr;
+        fclose(f);
+        _captureFile = nullptr;
+        return false;
+    }
+
+    logger_base.debug("Capturing to %s.", (const char*)file.c_str());
+    return true;
+}
+
+void CaptureEngine::StopCapture()
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _recording = false;
+    _triggerEnabled = false;
+
+    if (_writerThread != nullptr)
+    {
+        _writerThread->Stop();
+        _writerThread->Wait();
+        delete _writerThread;
+        _writerThread = nullptr;
+    }
+
+    if (_captureFile != nullptr)
+    {
+        fclose(_captureFile);
+        _captureFile = nullptr;
+        logger_base.debug("Capture file closed. Packets %llu, dropped %llu.", (unsigned long long)GetCapturedPackets(), (unsigned long long)GetDroppedPackets());
+    }
+}
+
+void CaptureEngine::Flush()
+{
+    if (_writerThread == nullptr) return;
+
+    _writerThread->RequestFlush();
+    while (_writerThread->IsFlushPending())
+    {
+        wxMilliSleep(1);
+    }
+}
+
+void CaptureEngine::SetTrigger(bool enabled, int universe, int channel, int level)
+{
+    _triggerUniverse = universe;
+    _triggerChannel = channel;
+    _triggerLevel = level;
+    _triggerEnabled = enabled;
+}
+
+void CaptureEngine::Receive(int port, const uint8_t* packet, int len, uint32_t sourceIP, int64_t timeNS)
+{
+    if (len <= 0 || len > CAPTURE_MAX_PACKET) return;
+
+    int universe = GetUniverse(port, packet, len);
+    if (universe < 0) return;
+
+    if (_triggerEnabled && universe == _triggerUniverse)
+    {
+        int offset = (port == E131PORT ? E131_PACKET_HEADERLEN : ARTNET_PACKET_HEADERLEN) - 1 + _triggerChannel;
+        if (offset < len)
+        {
+            _recording = packet[offset] >= _triggerLevel;
+        }
+    }
+
+    if (!_recording) return;
+    if (!_captureAllUniverses && !_universeFilter[universe]) return;
+
+    CaptureRing& ring = GetRing(port);
+    CapturedPacket* p = ring.Reserve();
+    if (p == nullptr)
+    {
+        ring.CountDropped();
+        return;
+    }
+    p->timeNS = timeNS;
+    p->sourceIP = sourceIP;
+    p->port = port;
+    p->length = len;
+    memcpy(p->data, packet, len);
+    ring.Commit();
+    _captured++;
+}
+
+int CaptureEngine::GetUniverse(int port, const uint8_t* packet, int len)
+{
+    if (port == E131PORT)
+    {
+        if (len < E131_PACKET_HEADERLEN) return -1;
+        return ((int)packet[113] << 8) + (int)packet[114];
+    }
+    else if (port == ARTNETPORT)
+    {
+        // we only handle artdmx packets
+        if (len < ARTNET_PACKET_HEADERLEN || packet[9] != 0x50) return -1;
+        return ((int)packet[15] << 8) + (int)packet[14];
+    }
+    return -1;
+}
+
+int64_t CaptureEngine::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+bool CaptureEngine::ReadCaptureFile(const std::string& file, const std::function<void(int port, const uint8_t* packet, int len, int64_t timeNS)>& callback)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    FILE* f = fopen(file.c_str(), "rb");
+    if (f == nullptr)
+    {
+        logger_base.error("Unable to open capture file %s.", (const char*)file.c_str());
+        return false;
+    }
+    setvbuf(f, nullptr, _IOFBF, CAPTURE_WRITE_BUFFER);
+
+    uint32_t header[6];
+    if (fread(header, 1, sizeof(header), f) != sizeof(header) ||
+        (header[0] != PCAP_MAGIC_NS && header[0] != PCAP_MAGIC_US) ||
+        header[5] != PCAP_LINKTYPE_IPV4)
+    {
+        logger_base.error("%s is not an xCapture pcap file.", (const char*)file.c_str());
+        fclose(f);
+        return false;
+    }
+    int64_t fractionScale = header[0] == PCAP_MAGIC_NS ? 1 : 1000;
+
+    std::vector<uint8_t> buffer(65536);
+    uint32_t record[4];
+    while (fread(record, 1, sizeof(record), f) == sizeof(record))
+    {
+        uint32_t size = record[2];
+        if (size > buffer.size() || fread(buffer.data(), 1, size, f) != size) break;
+
+        int ipHeader = (buffer[0] & 0x0F) * 4;
+        if (size < (uint32_t)ipHeader + 8 || buffer[9] != 17) continue;
+        int port = ((int)buffer[ipHeader + 2] << 8) + buffer[ipHeader + 3];
+        int64_t timeNS = (int64_t)record[0] * 1000000000LL + (int64_t)record[1] * fractionScale;
+        callback(port, &buffer[ipHeader + 8], size - ipHeader - 8, timeNS);
+    }
+
+    fclose(f);
+    return true;
+}
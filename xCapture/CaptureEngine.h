@@ -0,0 +1,127 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#define E131PORT 5568
+#define ARTNETPORT 0x1936
+
+#define E131_PACKET_HEADERLEN 126
+#define ARTNET_PACKET_HEADERLEN 18
+#define CAPTURE_MAX_PACKET (E131_PACKET_HEADERLEN + 512)
+
+// packets each receiver can have waiting for the writer, about 0.4s of a 1000 universe show at 40fps
+#define CAPTURE_RING_PACKETS 16384
+
+class CaptureReceiverThread;
+class CaptureWriterThread;
+class wxDatagramSocket;
+
+struct CapturedPacket
+{
+    int64_t timeNS; // since the epoch
+    uint32_t sourceIP; // network byte order
+    uint16_t port; // the port it was received on which identifies the protocol
+    uint16_t length;
+    uint8_t data[CAPTURE_MAX_PACKET];
+};
+
+// Fixed size single producer single consumer queue of packets. All the memory is allocated up front so nothing is
+// allocated while capturing. When it is full new packets are dropped and counted.
+class CaptureRing
+{
+    std::vector<CapturedPacket> _packets;
+    std::atomic<size_t> _head; // next slot the producer writes
+    std::atomic<size_t> _tail; // next slot the consumer reads
+    std::atomic<uint64_t> _dropped;
+
+public:
+    CaptureRing(size_t size);
+
+    // producer side, returns nullptr when full
+    CapturedPacket* Reserve();
+    void Commit();
+
+    // consumer side, returns nullptr when empty
+    const CapturedPacket* Peek();
+    void Release();
+
+    void CountDropped() { _dropped++; }
+    uint64_t GetDropped() const { return _dropped; }
+    void Clear() { _tail = _head.load(); _dropped = 0; }
+};
+
+// Captures E1.31 and ArtNET packets off the network and streams them to a pcap file.
+//
+// Each protocol has its own receive thread which reads packets in batches (recvmmsg on Linux) with kernel timestamps
+// where available, and its own ring. A writer thread drains the rings to disk so the receive threads only ever copy
+// the packet and never wait on the disk or the user interface. Packets are only kept while recording, either because
+// recording was switched on or because the trigger channel is at or above the trigger level.
+class CaptureEngine
+{
+    CaptureReceiverThread* _e131Thread = nullptr;
+    CaptureReceiverThread* _artNETThread = nullptr;
+    CaptureWriterThread* _writerThread = nullptr;
+    wxDatagramSocket* _e131Socket = nullptr;
+    wxDatagramSocket* _artNETSocket = nullptr;
+    FILE* _captureFile = nullptr;
+    CaptureRing _e131Ring;
+    CaptureRing _artNETRing;
+    std::string _file;
+    std::vector<std::atomic<bool>> _universeFilter; // indexed by universe number
+    std::atomic<bool> _captureAllUniverses;
+    std::atomic<bool> _recording;
+    std::atomic<bool> _triggerEnabled;
+    std::atomic<int> _triggerUniverse;
+    std::atomic<int> _triggerChannel;
+    std::atomic<int> _triggerLevel;
+    std::atomic<uint64_t> _captured;
+
+public:
+    CaptureEngine();
+    virtual ~CaptureEngine();
+
+    bool StartListening(int port, const std::string& localIP, const std::list<int>& multicastUniverses);
+    void StopListening(int port);
+    bool IsListening(int port) const;
+
+    // Opens the file and starts the writer, nothing is kept until recording is switched on or the trigger fires.
+    // An empty list of universe ranges captures every universe.
+    bool StartCapture(const std::string& file, const std::list<std::pair<int, int>>& universes);
+    void StopCapture();
+    // waits until everything received so far is in the file
+    void Flush();
+    bool IsCaptureOpen() const { return _writerThread != nullptr; }
+    const std::string& GetFile() const { return _file; }
+
+    void SetRecording(bool recording) { _recording = recording; }
+    bool IsRecording() const { return _recording; }
+    void SetTrigger(bool enabled, int universe, int channel, int level);
+
+    uint64_t GetCapturedPackets() const { return _captured; }
+    uint64_t GetDroppedPackets() const { return _e131Ring.GetDropped() + _artNETRing.GetDropped(); }
+
+    // called on the receive threads
+    void Receive(int port, const uint8_t* packet, int len, uint32_t sourceIP, int64_t timeNS);
+    // called on the writer thread
+    CaptureRing& GetRing(int port) { return port == E131PORT ? _e131Ring : _artNETRing; }
+
+    static int GetUniverse(int port, const uint8_t* packet, int len);
+    static int64_t Now();
+    static bool ReadCaptureFile(const std::string& file, const std::function<void(int port, const uint8_t* packet, int len, int64_t timeNS)>& callback);
+};
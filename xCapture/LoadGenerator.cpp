@@ -0,0 +1,274 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "LoadGenerator.h"
+#include "CaptureEngine.h"
+#include "../xLights/FSEQFile.h"
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+#include <wx/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <log4cpp/Category.hh>
+
+#ifdef __LINUX__
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#endif
+
+#define XLIGHTS_UUID "c0de0080-c69b-11e0-9572-0800200c9a66"
+
+// Writes an E1.31 data packet header for the given number of channels, only the sequence number and the data
+// change from frame to frame
+static void InitialiseE131Header(uint8_t* data, int universe, int channels)
+{
+    memset(data, 0x00, E131_PACKET_HEADERLEN);
+    data[1] = 0x10; // RLP preamble size (low)
+    memcpy(&data[4], "ASC-E1.17", 9);
+
+    int len = E131_PACKET_HEADERLEN - 16 + channels;
+    data[16] = 0x70 + (len >> 8); // RLP Protocol flags and length
+    data[17] = len & 0xFF;
+    data[21] = 0x04;
+
+    wxString id = XLIGHTS_UUID;
+    id.Replace("-", "");
+    for (int i = 0, j = 22; i < 32; i += 2)
+    {
+        data[j++] = (uint8_t)wxHexToDec(id.Mid(i, 2));
+    }
+
+    len = E131_PACKET_HEADERLEN - 38 + channels;
+    data[38] = 0x70 + (len >> 8); // Framing Protocol flags and length
+    data[39] = len & 0xFF;
+    data[43] = 0x02;
+    strcpy((char*)&data[44], "xCapture Load Test"); // Source Name (64 bytes)
+    data[108] = 100; // Priority
+    data[113] = universe >> 8;
+    data[114] = universe & 0xFF;
+
+    len = E131_PACKET_HEADERLEN - 115 + channels;
+    data[115] = 0x70 + (len >> 8); // DMP Protocol flags and length
+    data[116] = len & 0xFF;
+    data[117] = 0x02; // DMP Vector (Identifies DMP Set Property Message PDU)
+    data[118] = 0xa1; // DMP Address Type & Data Type
+    data[122] = 0x01; // Address Increment (low)
+    data[123] = (channels + 1) >> 8; // Property value count
+    data[124] = (channels + 1) & 0xFF;
+}
+
+class LoadGeneratorThread : public wxThread
+{
+    LoadGenerator* _generator = nullptr;
+    std::unique_ptr<FSEQFile> _fseq;
+    std::string _ip;
+    uint32_t _channels = 0;
+    uint32_t _frames = 0;
+    int _fps = 40;
+    int _startUniverse = 1;
+    volatile bool _stop = false;
+
+public:
+
+    LoadGeneratorThread(LoadGenerator* generator, FSEQFile* fseq, const std::string& ip, int fps, int startUniverse) :
+        wxThread(wxTHREAD_JOINABLE), _fseq(fseq)
+    {
+        _generator = generator;
+        _channels = fseq->getChannelCount();
+        _frames = fseq->getNumFrames();
+        _ip = ip;
+        _fps = fps;
+        _startUniverse = startUniverse;
+    }
+
+    void Stop()
+    {
+        _stop = true;
+    }
+
+    virtual void* Entry() override
+    {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+        int universes = (_channels + 511) / 512;
+        logger_base.debug("Load test sending %d universes at %d fps to %s.", universes, _fps, (const char*)_ip.c_str());
+
+        wxIPV4address localaddr;
+        localaddr.AnyAddress();
+        wxDatagramSocket socket(localaddr, wxSOCKET_BLOCK);
+        if (!socket.IsOk())
+        {
+            logger_base.error("Load test could not open a socket to send on.");
+            return nullptr;
+        }
+
+        wxIPV4address remoteaddr;
+        remoteaddr.Hostname(_ip);
+        remoteaddr.Service(E131PORT);
+
+        // every packet is built once and then only the data and sequence number are updated
+        std::vector<uint8_t> frame(_channels);
+        _fseq->prepareRead({ { 0, _channels } }, 0);
+        std::vector<uint8_t> packets((size_t)universes * CAPTURE_MAX_PACKET);
+        std::vector<int> lengths(universes);
+        for (int u = 0; u < universes; u++)
+        {
+            int channels = std::min(512, (int)_channels - u * 512);
+            InitialiseE131Header(&packets[(size_t)u * CAPTURE_MAX_PACKET], _startUniverse + u, channels);
+            lengths[u] = E131_PACKET_HEADERLEN + channels;
+        }
+
+#ifdef __LINUX__
+        // hand the whole frame to the kernel in one call
+        int fd = socket.GetSocket();
+        struct sockaddr_in dest;
+        memset(&dest, 0x00, sizeof(dest));
+        dest.sin_family = AF_INET;
+        dest.sin_port = htons(E131PORT);
+        dest.sin_addr.s_addr = inet_addr(remoteaddr.IPAddress().c_str());
+        std::vector<struct iovec> iovecs(universes);
+        std::vector<struct mmsghdr> msgs(universes);
+        memset(msgs.data(), 0x00, msgs.size() * sizeof(struct mmsghdr));
+        for (int u = 0; u < universes; u++)
+        {
+            iovecs[u].iov_base = &packets[(size_t)u * CAPTURE_MAX_PACKET];
+            iovecs[u].iov_len = lengths[u];
+            msgs[u].msg_hdr.msg_name = &dest;
+            msgs[u].msg_hdr.msg_namelen = sizeof(dest);
+            msgs[u].msg_hdr.msg_iov = &iovecs[u];
+            msgs[u].msg_hdr.msg_iovlen = 1;
+        }
+#endif
+
+        auto frameTime = std::chrono::nanoseconds(1000000000LL / _fps);
+        auto next = std::chrono::steady_clock::now();
+        uint8_t seq = 0;
+        uint32_t f = 0;
+
+        while (!_stop)
+        {
+            // FSEQFile takes care of compression and sparse ranges, it reads blocks ahead so the decode
+            // mostly stays out of the frame timing
+            std::unique_ptr<FSEQFile::FrameData> fd(_fseq->getFrame(f));
+            if (fd == nullptr || !fd->readFrame(frame.data(), _channels))
+            {
+                logger_base.error("Load test failed to read frame %u.", f);
+                break;
+            }
+
+            seq++;
+            for (int u = 0; u < universes; u++)
+            {
+                uint8_t* p = &packets[(size_t)u * CAPTURE_MAX_PACKET];
+                p[111] = seq;
+                memcpy(p + E131_PACKET_HEADERLEN, &frame[(size_t)u * 512], lengths[u] - E131_PACKET_HEADERLEN);
+            }
+
+#ifdef __LINUX__
+            int sent = 0;
+            while (sent < universes)
+            {
+                int n = sendmmsg(fd, &msgs[sent], universes - sent, 0);
+                if (n <= 0) break;
+                sent += n;
+            }
+#else
+            int sent = 0;
+            for (int u = 0; u < universes; u++)
+            {
+                socket.SendTo(remoteaddr, &packets[(size_t)u * CAPTURE_MAX_PACKET], lengths[u]);
+                if (!socket.Error()) sent++;
+            }
+#endif
+
+            next += frameTime;
+            auto now = std::chrono::steady_clock::now();
+            bool late = now > next;
+            _generator->FrameSent(sent, late);
+            if (late)
+            {
+                // more than a frame behind so start the schedule again from now rather than bursting to catch up
+                if (now - next > frameTime) next = now;
+            }
+            else
+            {
+                std::this_thread::sleep_until(next);
+            }
+
+            f = (f + 1) % _frames;
+        }
+
+        logger_base.debug("Load test stopped.");
+        return nullptr;
+    }
+};
+
+LoadGenerator::LoadGenerator()
+{
+    _sent = 0;
+    _frames = 0;
+    _lateFrames = 0;
+}
+
+LoadGenerator::~LoadGenerator()
+{
+    Stop();
+}
+
+bool LoadGenerator::Start(const std::string& fseqFile, const std::string& ip, int fps, int startUniverse)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    Stop();
+
+    std::unique_ptr<FSEQFile> fseq(FSEQFile::openFSEQFile(fseqFile));
+    if (fseq == nullptr)
+    {
+        logger_base.error("Load test could not open %s as a FSEQ file.", (const char*)fseqFile.c_str());
+        return false;
+    }
+    if (fseq->getChannelCount() == 0 || fseq->getNumFrames() == 0 || fps <= 0)
+    {
+        logger_base.error("Load test %s has no data to send.", (const char*)fseqFile.c_str());
+        return false;
+    }
+
+    _sent = 0;
+    _frames = 0;
+    _lateFrames = 0;
+    _thread = new LoadGeneratorThread(this, fseq.release(), ip, fps, startUniverse);
+    if (_thread->Run() != wxTHREAD_NO_ERROR)
+    {
+        logger_base.error("Load test thread failed to start.");
+        delete _thread;
+        _thread = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void LoadGenerator::Stop()
+{
+    if (_thread != nullptr)
+    {
+        _thread->Stop();
+        _thread->Wait();
+        delete _thread;
+        _thread = nullptr;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+class LoadGeneratorThread;
+
+// Replays a FSEQ as unicast E1.31 at a fixed frame rate, 512 channels per universe, so capture
+// performance can be measured on one machine without a show player.
+class LoadGenerator
+{
+    LoadGeneratorThread* _thread = nullptr;
+    std::atomic<uint64_t> _sent;
+    std::atomic<uint32_t> _frames;
+    std::atomic<uint32_t> _lateFrames;
+
+public:
+    LoadGenerator();
+    virtual ~LoadGenerator();
+
+    bool Start(const std::string& fseqFile, const std::string& ip, int fps, int startUniverse);
+    void Stop();
+    bool IsRunning() const { return _thread != nullptr; }
+
+    uint64_t GetSentPackets() const { return _sent; }
+    uint32_t GetFrames() const { return _frames; }
+    uint32_t GetLateFrames() const { return _lateFrames; }
+
+    // called on the generator thread
+    void FrameSent(int packets, bool late) { _sent += packets; _frames++; if (late) _lateFrames++; }
+};
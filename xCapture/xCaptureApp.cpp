@@ -43,6 +43,7 @@
         #pragma comment(lib, "wxexpatd.lib")
         #pragma comment(lib, "msvcprtd.lib")
         #pragma comment(lib, "log4cpplibd.lib")
+        #pragma comment(lib, "libzstdd_static_VS.lib")
     #else
         #pragma comment(lib, "wxbase"WXWIDGETS_VERSION"u.lib")
         #pragma comment(lib, "wxbase"WXWIDGETS_VERSION"u_net.lib")
@@ -58,6 +59,7 @@
         #pragma comment(lib, "wxexpat.lib")
         #pragma comment(lib, "msvcprt.lib")
         #pragma comment(lib, "log4cpplib.lib")
+        #pragma comment(lib, "libzstd_static_VS.lib")
     #endif
     #pragma comment(lib, "libcurl.dll.a")
     #pragma comment(lib, "ImageHlp.Lib")
@@ -8,10 +8,10 @@
  **************************************************************/
 
 #define ZERO 0
-#define E131PORT 5568
-#define ARTNETPORT 0x1936
 
 #include "xCaptureMain.h"
+#include "CaptureEngine.h"
+#include "LoadGenerator.h"
 #include <wx/msgdlg.h>
 #include <wx/config.h>
 #include <log4cpp/Category.hh>
@@ -23,6 +23,7 @@
 #include "UniverseEntryDialog.h"
 #include <wx/filedlg.h>
 #include <wx/numdlg.h>
+#include <map>
 #include "ResultDialog.h"
 #include "../xLights/IPEntryDialog.h"
 
@@ -82,8 +83,7 @@ const long xCaptureFrame::ID_STATUSBAR1 = wxNewId();
 const long xCaptureFrame::ID_TIMER1 = wxNewId();
 //*)
 
-const long xCaptureFrame::ID_E131SOCKET = wxNewId();
-const long xCaptureFrame::ID_ARTNETSOCKET = wxNewId();
+const long xCaptureFrame::ID_MNU_LOADTEST = wxNewId();
 
 BEGIN_EVENT_TABLE(xCaptureFrame,wxFrame)
     //(*EventTable(xCaptureFrame)
@@ -100,63 +100,69 @@ void xCaptureFrame::PurgeCollectedData()
     }
 }
 
-void xCaptureFrame::StashPacket(long type, wxByte* packet, int len)
+// Rebuilds the collectors from the capture file once the engine has stopped recording
+void xCaptureFrame::LoadCapture()
 {
-    int universe = -1;
-    if (type == ID_E131SOCKET)
-    {
-        universe = ((int)packet[113] << 8) + (int)packet[114];
-    }
-    else if (type == ID_ARTNETSOCKET)
-    {
-        // we only handle artdmx packets
-        if (packet[9] != 0x50) return;
-
-        universe = ((int)packet[15] << 8) + (int)packet[14];
-    }
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-    if (universe == -1) return;
+    PurgeCollectedData();
 
-    if (CheckBox_TriggerOnChannel->GetValue())
-    {
-        if (universe == SpinCtrl_Universe->GetValue())
+    std::map<std::pair<long, int>, Collector*> collectors;
+    CaptureEngine::ReadCaptureFile(_engine->GetFile(), [this, &collectors](int port, const uint8_t* packet, int len, int64_t timeNS)
         {
-            wxByte c = packet[125 + SpinCtrl_Channel->GetValue()];
+            int universe = CaptureEngine::GetUniverse(port, packet, len);
+            if (universe < 0) return;
 
-            if (c >= SpinCtrl_TriggerStart->GetValue())
+            auto key = std::make_pair((long)port, universe);
+            auto it = collectors.find(key);
+            if (it == collectors.end())
             {
-                _capturing = true;
-                _capturedDesc = "";
-                ValidateWindow();
-            }
-            else
-            {
-                _capturing = false;
-                UpdateCaptureDesc();
-                ValidateWindow();
+                Collector* c = new Collector(port, universe);
+                _capturedData.push_back(c);
+                it = collectors.emplace(key, c).first;
             }
-        }
-    }
+            it->second->AddPacket(port, (wxByte*)packet, len, wxDateTime(wxLongLong(timeNS / 1000000)));
+        });
 
-    if (!_capturing) return;
+    _capturedPackets = (long)_engine->GetCapturedPackets();
+    logger_base.debug("Loaded %ld packets in %d universes from the capture file. %llu packets were dropped.",
+        _capturedPackets, (int)_capturedData.size(), (unsigned long long)_engine->GetDroppedPackets());
+}
 
-    for (const auto& it : _capturedData)
+std::string xCaptureFrame::GetCaptureFile() const
+{
+    return (wxFileName::GetTempDir() + wxFileName::GetPathSeparator() + "xCapture.pcap").ToStdString();
+}
+
+// an empty list means all universes
+std::list<std::pair<int, int>> xCaptureFrame::GetUniverseRanges()
+{
+    std::list<std::pair<int, int>> res;
+    if (IsUniverseToBeCaptured(-1)) return res;
+
+    for (int i = 0; i < ListView_Universes->GetItemCount(); i++)
+    {
+        res.push_back({ wxAtoi(ListView_Universes->GetItemText(i)), wxAtoi(ListView_Universes->GetItemText(i, 1)) });
+    }
+    return res;
+}
+
+std::list<int> xCaptureFrame::GetMulticastUniverses()
+{
+    std::list<int> res;
+    for (int i = 0; i < ListView_Universes->GetItemCount(); i++)
     {
-        if (it->_protocol == type && it->_universe == universe)
+        if (ListView_Universes->GetItemText(i) != "All")
         {
-            _capturedPackets++;
-            it->AddPacket(type, packet, len);
-            return;
+            int start = wxAtoi(ListView_Universes->GetItemText(i));
+            int end = wxAtoi(ListView_Universes->GetItemText(i, 1));
+            for (int u = start; u <= end; u++)
+            {
+                res.push_back(u);
+            }
         }
     }
-
-    // Doing thise here means we only need to check the list when it isnt already captured
-    if (!IsUniverseToBeCaptured(universe)) return;
-
-    Collector* c = new Collector(type, universe);
-    _capturedData.push_back(c);
-    c->AddPacket(type, packet, len);
-    _capturedPackets++;
+    return res;
 }
 
 bool xCaptureFrame::IsUniverseToBeCaptured(int universe, bool ignoreall /*= false*/)
@@ -215,8 +221,8 @@ xCaptureFrame::xCaptureFrame(wxWindow* parent, const std::string& showdir, const
 {
     // static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-    _e131Socket = nullptr;
-    _artNETSocket = nullptr;
+    _engine = new CaptureEngine();
+    _loadGenerator = new LoadGenerator();
     _capturing = false;
     _capturedPackets = 0;
     _capturedDesc = "";
@@ -381,8 +387,11 @@ xCaptureFrame::xCaptureFrame(wxWindow* parent, const std::string& showdir, const
     FileMenu->Append(quitMenItem1);
     Connect(wxID_EXIT,wxEVT_COMMAND_MENU_SELECTED,(wxObjectEventFunction)&xCaptureFrame::OnQuit);
 #endif
-    Connect(ID_E131SOCKET, wxEVT_SOCKET, (wxObjectEventFunction)&xCaptureFrame::OnE131SocketEvent);
-    Connect(ID_ARTNETSOCKET, wxEVT_SOCKET, (wxObjectEventFunction)&xCaptureFrame::OnArtNETSocketEvent);
+
+    wxMenu* toolsMenu = new wxMenu();
+    toolsMenu->AppendCheckItem(ID_MNU_LOADTEST, _("Load Test..."), _("Replay a FSEQ to this machine as E1.31 to check capture keeps up"));
+    MainMenuBar->Insert(MainMenuBar->GetMenuCount() - 1, toolsMenu, _("&Tools"));
+    Connect(ID_MNU_LOADTEST, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&xCaptureFrame::OnMenuLoadTest);
 
     SetTitle("xLights Capture " + GetDisplayVersionString());
 
@@ -497,7 +506,12 @@ xCaptureFrame::~xCaptureFrame()
 {
     SaveState();
 
+    delete _loadGenerator;
+    _loadGenerator = nullptr;
+
     CloseSockets(true);
+    delete _engine;
+    _engine = nullptr;
 
     PurgeCollectedData();
 
@@ -570,22 +584,12 @@ void xCaptureFrame::CloseSockets(bool force)
 {
     if (force || !CheckBox_E131->GetValue())
     {
-        if (_e131Socket != nullptr)
-        {
-            _e131Socket->Close();
-            delete _e131Socket;
-            _e131Socket = nullptr;
-        }
+        _engine->StopListening(E131PORT);
     }
 
     if (force || !CheckBox_ArtNET->GetValue())
     {
-        if (_artNETSocket != nullptr)
-        {
-            _artNETSocket->Close();
-            delete _artNETSocket;
-            _artNETSocket = nullptr;
-        }
+        _engine->StopListening(ARTNETPORT);
     }
 }
 
@@ -595,16 +599,16 @@ void xCaptureFrame::OnAbout(wxCommandEvent& event)
     wxMessageBox(about, _("Welcome to..."));
 }
 
-PacketData::PacketData(long type, wxByte* packet, int len)
+PacketData::PacketData(long type, wxByte* packet, int len, wxDateTime timeStamp)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    _timeStamp = wxDateTime::UNow();
+    _timeStamp = timeStamp;
     _frameTimeMS = -1;
     _seq = 0;
     _length = 0;
     _pdata = nullptr;
 
-    if (type == xCaptureFrame::ID_E131SOCKET)
+    if (type == E131PORT)
     {
         // validate the packet
         if (len < 126) return;
@@ -630,7 +634,7 @@ PacketData::PacketData(long type, wxByte* packet, int len)
         _pdata = (wxByte*)malloc(_length);
         memcpy(_pdata, &packet[126], _length);
     }
-    else if (type == xCaptureFrame::ID_ARTNETSOCKET)
+    else if (type == ARTNETPORT)
     {
         // validate the packet
         if (len < 18) return;
@@ -750,7 +754,7 @@ bool Collector::operator<(const Collector& c) const
 {
     if (_universe == c._universe)
     {
-        if (_protocol == xCaptureFrame::ID_E131SOCKET)
+        if (_protocol == E131PORT)
         {
             return true;
         }
@@ -838,7 +842,7 @@ void xCaptureFrame::ValidateWindow()
         Button_StartStop->Enable(true);
     }
 
-    if (_artNETSocket == nullptr && _e131Socket == nullptr)
+    if (!_engine->IsListening(ARTNETPORT) && !_engine->IsListening(E131PORT))
     {
         Button_StartStop->Enable(false);
     }
@@ -877,107 +881,21 @@ void xCaptureFrame::ValidateWindow()
 
 void xCaptureFrame::CreateE131Listener()
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    if (_e131Socket != nullptr) return;
-
-    //Local address to bind to
-    wxIPV4address addr;
-    addr.AnyAddress();
-    addr.Service(E131PORT);
-    //create and bind to the address above
-    _e131Socket = new wxDatagramSocket(addr);
-
-    if (_e131Socket->IsOk())
-    {
-        logger_base.debug("E131 listening on %s", (const char*)_localIP.c_str());
-
-        for (int i = 0; i < ListView_Universes->GetItemCount(); i++)
-        {
-            if (ListView_Universes->GetItemText(i) != "All")
-            {
-                int start = wxAtoi(ListView_Universes->GetItemText(i));
-                int end = wxAtoi(ListView_Universes->GetItemText(i, 1));
-                for (int u = start; u <= end; u++)
-                {
-                    struct ip_mreq mreq;
-                    wxString ip = wxString::Format("239.255.%d.%d", u >> 8, u & 0xFF);
-                    logger_base.debug("E131 registering for multicast on %s.", (const char *)ip.c_str());
-                    mreq.imr_multiaddr.s_addr = inet_addr(ip.c_str());
-                    mreq.imr_interface.s_addr = inet_addr(_localIP.c_str()); // this will only listen on the default interface
-                    if (!_e131Socket->SetOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&mreq, sizeof(mreq)))
-                    {
-                        logger_base.warn("    Error opening E131 multicast listener %s.", (const char *)ip.c_str());
-                    }
-                }
-            }
-        }
+    if (_engine->IsListening(E131PORT)) return;
 
-        //enable event handling
-        _e131Socket->SetEventHandler(*this, ID_E131SOCKET);
-        //Notify us about incomming data
-        _e131Socket->SetNotify(wxSOCKET_INPUT_FLAG);
-        //enable event handling
-        _e131Socket->Notify(true);
-    }
-    else
+    if (!_engine->StartListening(E131PORT, _localIP.ToStdString(), GetMulticastUniverses()))
     {
-        delete _e131Socket;
-        _e131Socket = nullptr;
-        logger_base.warn("Error opening socket to listen for e131 data");
         wxMessageBox("Error listening for E1.31 data.");
     }
 }
 
 void xCaptureFrame::CreateArtNETListener()
 {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    if (_artNETSocket != nullptr) return;
+    if (_engine->IsListening(ARTNETPORT)) return;
 
-    //Local address to bind to
-    wxIPV4address addr;
-    addr.AnyAddress();
-    addr.Service(ARTNETPORT);
-    //create and bind to the address above
-    _artNETSocket = new wxDatagramSocket(addr);
-
-    if (_artNETSocket->IsOk())
+    if (!_engine->StartListening(ARTNETPORT, _localIP.ToStdString(), GetMulticastUniverses()))
     {
-        logger_base.debug("ARTNet listening on %s", (const char*)_localIP.c_str());
-
-        for (int i = 0; i < ListView_Universes->GetItemCount(); i++)
-        {
-            if (ListView_Universes->GetItemText(i) != "All")
-            {
-                int start = wxAtoi(ListView_Universes->GetItemText(i));
-                int end = wxAtoi(ListView_Universes->GetItemText(i, 1));
-                for (int u = start; u <= end; u++)
-                {
-                    struct ip_mreq mreq;
-                    wxString ip = wxString::Format("239.255.%d.%d", u >> 8, u & 0xFF);
-                    logger_base.debug("ARTNet registering for multicast on %s.", (const char *)ip.c_str());
-                    mreq.imr_multiaddr.s_addr = inet_addr(ip.c_str());
-                    mreq.imr_interface.s_addr = inet_addr(_localIP.c_str()); // this will only listen on the default interface
-                    if (!_artNETSocket->SetOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&mreq, sizeof(mreq)))
-                    {
-                        logger_base.warn("    Error opening ARTNet multicast listener %s.", (const char *)ip.c_str());
-                    }
-                }
-            }
-        }
-
-        //enable event handling
-        _artNETSocket->SetEventHandler(*this, ID_ARTNETSOCKET);
-        //Notify us about incomming data
-        _artNETSocket->SetNotify(wxSOCKET_INPUT_FLAG);
-        //enable event handling
-        _artNETSocket->Notify(true);
-    }
-    else
-    {
-        delete _artNETSocket;
-        _artNETSocket = nullptr;
-        logger_base.warn("Error opening socket to listen for ArtNET data");
-        wxMessageBox("Error listening for E1.ArtNET data.");
+        wxMessageBox("Error listening for ArtNET data.");
     }
 }
 
@@ -1083,11 +1001,22 @@ void xCaptureFrame::OnButton_StartStopClick(wxCommandEvent& event)
         _capturedDesc = "";
         _capturedPackets = 0;
         PurgeCollectedData();
+        if (!_engine->StartCapture(GetCaptureFile(), GetUniverseRanges()))
+        {
+            _capturing = false;
+            wxMessageBox("Unable to create the capture file " + GetCaptureFile());
+            ValidateWindow();
+            return;
+        }
+        _engine->SetRecording(true);
         Button_StartStop->SetLabel("Stop");
         _capturedDesc = "";
     }
     else
     {
+        _engine->StopCapture();
+        LoadCapture();
+
         Button_StartStop->SetLabel("Start");
         UpdateCaptureDesc();
 
@@ -1107,7 +1036,7 @@ void xCaptureFrame::OnButton_StartStopClick(wxCommandEvent& event)
         for (const auto& it : _capturedData)
         {
             logger_base.debug("    Protocol %s, Universe %d, Size %d, Frames %d",
-                it->_protocol == ID_E131SOCKET ? "E131" : "ArtNET",
+                it->_protocol == E131PORT ? "E131" : "ArtNET",
                 it->_universe,
                 it->_packets.size() > 0 ? it->_packets.front()->_length : 0,
                 (int)it->_packets.size()
@@ -1138,10 +1067,20 @@ void xCaptureFrame::OnButton_SaveClick(wxCommandEvent& event)
     _capturedData.sort(cmp);
 
     wxFileDialog dlg(this, _("Save sequence"), "", "",
-        "FSEQ (*.fseq)|*.fseq|ESEQ (*.eseq)|*.eseq", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+        "FSEQ (*.fseq)|*.fseq|ESEQ (*.eseq)|*.eseq|PCAP (*.pcap)|*.pcap", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
     if (dlg.ShowModal() == wxID_OK)
     {
         wxFileName fn(dlg.GetDirectory() + "/" + dlg.GetFilename());
+        if (fn.GetExt().Lower() == "pcap")
+        {
+            // the raw capture with its packet timestamps, can be opened in wireshark
+            if (!wxCopyFile(_engine->GetFile(), fn.GetFullPath()))
+            {
+                wxMessageBox("Unable to save " + fn.GetFullPath());
+            }
+            return;
+        }
+
         wxString log = "Saving to "+ fn.GetExt().Upper() + " file " + fn.GetFullName() + "\n";
 
         int frameMS = GuessFrameMS();
@@ -1163,7 +1102,7 @@ void xCaptureFrame::OnButton_SaveClick(wxCommandEvent& event)
             it->CalculateFrames(startTime, frameMS);
 
             log += wxString::Format("Channel %ld, Protocol %s, Universe %d, Size %d, Frames %d, StartFrameMS %dms, EndFrameMS %dms\n",
-                it->_startChannel, it->_protocol == ID_E131SOCKET ? "E131" : "ArtNET",
+                it->_startChannel, it->_protocol == E131PORT ? "E131" : "ArtNET",
                 it->_universe, it->_packets.size() > 0 ? it->_packets.front()->_length : 0,
                 (int)it->_packets.size(), it->_packets.size() > 0 ? it->_packets.front()->_frameTimeMS : -1,
                 it->_packets.size() > 0 ? it->_packets.back()->_frameTimeMS : -1);
@@ -1220,6 +1159,29 @@ wxDateTime xCaptureFrame::GetStartTime()
 
 void xCaptureFrame::OnCheckBox_TriggerOnChannelClick(wxCommandEvent& event)
 {
+    if (CheckBox_TriggerOnChannel->GetValue())
+    {
+        // arm the engine, it starts and stops recording itself as the trigger channel changes
+        _capturedDesc = "";
+        _capturedPackets = 0;
+        PurgeCollectedData();
+        if (_engine->StartCapture(GetCaptureFile(), GetUniverseRanges()))
+        {
+            _engine->SetTrigger(true, SpinCtrl_Universe->GetValue(), SpinCtrl_Channel->GetValue(), SpinCtrl_TriggerStart->GetValue());
+        }
+        else
+        {
+            wxMessageBox("Unable to create the capture file " + GetCaptureFile());
+            CheckBox_TriggerOnChannel->SetValue(false);
+        }
+    }
+    else if (_engine->IsCaptureOpen())
+    {
+        _engine->StopCapture();
+        _capturing = false;
+        LoadCapture();
+        UpdateCaptureDesc();
+    }
     ValidateWindow();
 }
 
@@ -1284,62 +1246,6 @@ void xCaptureFrame::OnCheckBox_ArtNETClick(wxCommandEvent& event)
     ValidateWindow();
 }
 
-void xCaptureFrame::OnE131SocketEvent(wxSocketEvent& event)
-{
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-
-    wxIPV4address addr;
-    addr.Service(E131PORT);
-    wxByte buf[126+512];
-    switch (event.GetSocketEvent())
-    {
-    case wxSOCKET_INPUT:
-    {
-        _e131Socket->Notify(false);
-        size_t n = _e131Socket->RecvFrom(addr, buf, sizeof(buf)).LastCount();
-        if (!n) {
-            logger_base.error("ERROR: failed to receive E131 data");
-            return;
-        }
-        //logger_base.debug("E131 packet received.");
-        StashPacket(ID_E131SOCKET, buf, n);
-        _e131Socket->Notify(true);
-    }
-        break;
-    default:
-        logger_base.warn("OnE131SocketEvent: Unexpected event !");
-        break;
-    }
-}
-
-void xCaptureFrame::OnArtNETSocketEvent(wxSocketEvent & event)
-{
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-
-    wxIPV4address addr;
-    addr.Service(ARTNETPORT);
-    wxByte buf[18 + 512];
-    switch (event.GetSocketEvent())
-    {
-    case wxSOCKET_INPUT:
-    {
-        _artNETSocket->Notify(false);
-        size_t n = _artNETSocket->RecvFrom(addr, buf, sizeof(buf)).LastCount();
-        if (!n) {
-            logger_base.error("ERROR: failed to receive ArtNET data");
-            return;
-        }
-        //logger_base.debug("ArtNet packet received.");
-        StashPacket(ID_ARTNETSOCKET, buf, n);
-        _artNETSocket->Notify(true);
-    }
-        break;
-    default:
-        logger_base.warn("OnArtNETSocketEvent: Unexpected event !");
-        break;
-    }
-}
-
 void xCaptureFrame::OnButton_AddClick(wxCommandEvent& event)
 {
     UniverseEntryDialog dlg(this, -1, -1);
@@ -1374,7 +1280,63 @@ void xCaptureFrame::OnButton_DeleteClick(wxCommandEvent& event)
 
 void xCaptureFrame::OnUITimerTrigger(wxTimerEvent& event)
 {
-    StatusBar1->SetStatusText(wxString::Format("Universes: %d Total Packets: %ld %s", (int)_capturedData.size(), _capturedPackets, _capturedDesc));
+    if (CheckBox_TriggerOnChannel->GetValue() && _engine->IsCaptureOpen())
+    {
+        _engine->SetTrigger(true, SpinCtrl_Universe->GetValue(), SpinCtrl_Channel->GetValue(), SpinCtrl_TriggerStart->GetValue());
+
+        // the trigger is evaluated on the receive thread so pick up its changes here
+        if (_engine->IsRecording() != _capturing)
+        {
+            _capturing = _engine->IsRecording();
+            if (_capturing)
+            {
+                _capturedDesc = "";
+            }
+            else
+            {
+                _engine->Flush();
+                LoadCapture();
+                UpdateCaptureDesc();
+            }
+            ValidateWindow();
+        }
+    }
+
+    wxString status;
+    if (_capturing)
+    {
+        status = wxString::Format("Capturing Packets: %llu Dropped: %llu", (unsigned long long)_engine->GetCapturedPackets(), (unsigned long long)_engine->GetDroppedPackets());
+    }
+    else
+    {
+        status = wxString::Format("Universes: %d Total Packets: %ld %s", (int)_capturedData.size(), _capturedPackets, _capturedDesc);
+    }
+    if (_loadGenerator->IsRunning())
+    {
+        status += wxString::Format(" | Load Test Frames: %u Late: %u Packets: %llu", _loadGenerator->GetFrames(), _loadGenerator->GetLateFrames(), (unsigned long long)_loadGenerator->GetSentPackets());
+    }
+    StatusBar1->SetStatusText(status);
+}
+
+void xCaptureFrame::OnMenuLoadTest(wxCommandEvent& event)
+{
+    if (_loadGenerator->IsRunning())
+    {
+        _loadGenerator->Stop();
+        return;
+    }
+
+    wxFileDialog dlg(this, _("Choose sequence to replay"), "", "", "FSEQ (*.fseq)|*.fseq", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+    if (dlg.ShowModal() == wxID_OK)
+    {
+        long fps = wxGetNumberFromUser("Frames per second to send", "", "Load Test", 40, 1, 1000, this);
+        if (fps > 0 && _loadGenerator->Start(dlg.GetPath().ToStdString(), "127.0.0.1", fps, 1))
+        {
+            return;
+        }
+        if (fps > 0) wxMessageBox("Unable to replay " + dlg.GetPath() + ", check the log for details.");
+    }
+    GetMenuBar()->Check(ID_MNU_LOADTEST, false);
 }
 
 void xCaptureFrame::SaveFSEQ(wxString file, int frameMS, long channelsPerFrame, int frames, wxString& log)
@@ -1634,7 +1596,7 @@ void xCaptureFrame::OnButton_AnalyseClick(wxCommandEvent& event)
         it->CalculateFrames(startTime, frameMS);
 
         log += wxString::Format("Channel %ld, Protocol %s, Universe %d, Size %d, Frames %d, StartFrameMS %dms, EndFrameMS %dms\n",
-            it->_startChannel, it->_protocol == ID_E131SOCKET ? "E131" : "ArtNET",
+            it->_startChannel, it->_protocol == E131PORT ? "E131" : "ArtNET",
             it->_universe, it->_packets.size() > 0 ? it->_packets.front()->_length : 0,
             (int)it->_packets.size(), it->_packets.size() > 0 ? it->_packets.front()->_frameTimeMS : -1,
             it->_packets.size() > 0 ? it->_packets.back()->_frameTimeMS : -1);
@@ -43,7 +43,8 @@
 #include <wx/socket.h>
 
 class wxDebugReportCompress;
-class wxDatagramSocket;
+class CaptureEngine;
+class LoadGenerator;
 
 class PacketData
 {
@@ -54,7 +55,7 @@ public:
     wxByte* _pdata;
     int _frameTimeMS;
     virtual ~PacketData() { if (_pdata != nullptr) free(_pdata); }
-    PacketData(long type, wxByte* packet, int len);
+    PacketData(long type, wxByte* packet, int len, wxDateTime timeStamp);
     PacketData(PacketData& pd, int seq, int time);
 };
 
@@ -69,7 +70,7 @@ public:
     std::list<PacketData*> _packets;
     virtual ~Collector();
     Collector(long type, int universe) { _startChannel = -1; _universe = universe; _protocol = type; }
-    void AddPacket(long type, wxByte* packet, int len) { _packets.push_back(new PacketData(type, packet, len)); }
+    void AddPacket(long type, wxByte* packet, int len, wxDateTime timeStamp) { _packets.push_back(new PacketData(type, packet, len, timeStamp)); }
     void CalculateFrames(wxDateTime startTime, int frameMS);
     PacketData* GetPacket(long ms);
     bool operator<(const Collector& c) const;
@@ -81,8 +82,8 @@ class xCaptureFrame : public xlFrame
     void ValidateWindow();
 
     std::list<Collector*> _capturedData;
-    wxDatagramSocket* _e131Socket;
-    wxDatagramSocket* _artNETSocket;
+    CaptureEngine* _engine;
+    LoadGenerator* _loadGenerator;
     bool _capturing;
     long _capturedPackets;
     std::string _capturedDesc;
@@ -95,7 +96,10 @@ class xCaptureFrame : public xlFrame
     void CreateArtNETListener();
     void AddUniverseRange(int low, int high);
     void PurgeCollectedData();
-    void StashPacket(long type, wxByte* packet, int len);
+    void LoadCapture();
+    std::string GetCaptureFile() const;
+    std::list<std::pair<int, int>> GetUniverseRanges();
+    std::list<int> GetMulticastUniverses();
     bool IsUniverseToBeCaptured(int universe, bool ignoreall = false);
     int GuessFrameMS();
     long GetChannelsPerFrame();
@@ -114,8 +118,7 @@ public:
         virtual ~xCaptureFrame();
         virtual void CreateDebugReport(xlCrashHandler* crashHandler) override;
 
-        static const long ID_E131SOCKET;
-        static const long ID_ARTNETSOCKET;
+        static const long ID_MNU_LOADTEST;
 
 private:
 
@@ -221,8 +224,7 @@ private:
 
         DECLARE_EVENT_TABLE()
 
-        void OnE131SocketEvent(wxSocketEvent& event);
-        void OnArtNETSocketEvent(wxSocketEvent& event);
+        void OnMenuLoadTest(wxCommandEvent& event);
 };
 
 #endif // xCAPTUREMAIN_H
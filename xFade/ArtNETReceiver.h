@@ -3,6 +3,7 @@
 #include <string>
 #include <mutex>
 #include <map>
+#include <vector>
 #include <atomic>
 
 #include "PacketData.h"
@@ -15,7 +16,8 @@ class ArtNETReceiver
     std::atomic<uint32_t> _leftReceived; // = 0;
     std::atomic<uint32_t> _rightReceived; // = 0;
     ArtNETReceiverThread* _receiverThread = nullptr;
-    std::map<int, UniverseData*> _universes;
+    std::vector<UniverseData*> _universes; // indexed by universe number
+    int _firstUniverse = 0;
     bool _stop = false;
     std::atomic<bool> _suspend; // = false;
     wxWindow* _frame = nullptr;
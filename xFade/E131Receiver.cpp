@@ -15,6 +15,10 @@
 #ifndef __WXMSW__
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#ifdef __LINUX__
+#include <sys/socket.h>
+#include <poll.h>
+#endif
 #else
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -114,6 +118,37 @@ public:
         e131SocketReceive->Notify(false);
         e131SocketReceive->SetTimeout(1);
 
+#ifdef __LINUX__
+        // pull everything queued on the socket in one call rather than one read per packet which with a few
+        // hundred universes a side is a lot of system calls every frame
+        int fd = e131SocketReceive->GetSocket();
+        uint8_t buffers[RECEIVE_BATCH][E131_PACKET_HEADERLEN + 512];
+        struct mmsghdr msgs[RECEIVE_BATCH];
+        struct iovec iovecs[RECEIVE_BATCH];
+        memset(msgs, 0x00, sizeof(msgs));
+        for (int i = 0; i < RECEIVE_BATCH; i++)
+        {
+            iovecs[i].iov_base = buffers[i];
+            iovecs[i].iov_len = sizeof(buffers[i]);
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        while (!_stop)
+        {
+            struct pollfd pfd;
+            pfd.fd = fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, 100) <= 0) continue;
+
+            int count = recvmmsg(fd, msgs, RECEIVE_BATCH, MSG_DONTWAIT, nullptr);
+            for (int i = 0; i < count && !_stop; i++)
+            {
+                if (msgs[i].msg_len > 0) _receiver->StashPacket(buffers[i], msgs[i].msg_len);
+            }
+        }
+#else
         uint8_t buffer[E131_PACKET_HEADERLEN + 512];
 
         while (!_stop)
@@ -128,6 +163,7 @@ public:
                 if (read > 0) _receiver->StashPacket(buffer, read);
             }
         }
+#endif
 
         if (e131SocketReceive != nullptr)
         {
@@ -186,11 +222,8 @@ bool E131Receiver::IsRight(uint8_t* packet)
 
 UniverseData* E131Receiver::GetUniverseData(int universe)
 {
-    if (_universes.find(universe) != _universes.end())
-    {
-        return _universes[universe];
-    }
-    return nullptr;
+    if (universe < 0 || universe >= (int)_universes.size()) return nullptr;
+    return _universes[universe];
 }
 
 void E131Receiver::StashPacket(uint8_t* buffer, int size)
@@ -229,9 +262,9 @@ void E131Receiver::StashPacket(uint8_t* buffer, int size)
         {
             _leftReceived++;
             // only flash the LED based on receipt of data for the first universe
-            if (universe == _universes.begin()->second->GetUniverse())
+            if (universe == _firstUniverse)
             {
-                if (ud->GetLeftSequenceNum() % 20 == 0)
+                if (buffer[111] % 20 == 0)
                 {
                     wxCommandEvent e(EVT_FLASH);
                     e.SetInt(0);
@@ -251,9 +284,9 @@ void E131Receiver::StashPacket(uint8_t* buffer, int size)
         {
             _rightReceived++;
             // only flash the LED based on receipt of data for the first universe
-            if (universe == _universes.begin()->second->GetUniverse())
+            if (universe == _firstUniverse)
             {
-                if (ud->GetRightSequenceNum() % 20 == 0)
+                if (buffer[111] % 20 == 0)
                 {
                     wxCommandEvent e(EVT_FLASH);
                     e.SetInt(1);
@@ -271,16 +304,19 @@ void E131Receiver::StashPacket(uint8_t* buffer, int size)
 E131Receiver::E131Receiver(wxWindow* frame, const std::map<int, UniverseData*>& universes, const std::string& localInputIP)
 {
     _frame = frame;
-    _universes = universes;
     ZeroReceived();
     _stop = false;
     _suspend = false;
 
+    // a flat table so a packet's universe is found without searching
     std::list<int> unums;
-    for (auto it : _universes)
+    for (const auto& it : universes)
     {
+        if (it.first >= (int)_universes.size()) _universes.resize(it.first + 1, nullptr);
+        _universes[it.first] = it.second;
         unums.push_back(it.first);
     }
+    if (!universes.empty()) _firstUniverse = universes.begin()->first;
     _receiverThread = new E131ReceiverThread(this, localInputIP, unums);
     _receiverThread->Create();
     _receiverThread->Run();
@@ -3,6 +3,7 @@
 #include <string>
 #include <mutex>
 #include <map>
+#include <vector>
 #include <atomic>
 
 #include "PacketData.h"
@@ -16,7 +17,8 @@ class E131Receiver
     std::atomic<uint32_t> _leftReceived; // = 0;
     std::atomic<uint32_t> _rightReceived; // = 0;
     E131ReceiverThread* _receiverThread = nullptr;
-    std::map<int, UniverseData*> _universes;
+    std::vector<UniverseData*> _universes; // indexed by universe number
+    int _firstUniverse = 0;
     bool _stop = false;
     std::atomic<bool> _suspend; // = false;
     wxWindow* _frame = nullptr;
@@ -7,6 +7,7 @@
 #include "xFadeMain.h"
 #include "Settings.h"
 #include "PacketData.h"
+#include "UniverseData.h"
 #include "../xLights/UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -96,7 +97,7 @@ public:
         }
 
         PacketData sendData;
-        auto universes = _emitter->GetUniverses();
+        const auto& universes = _emitter->GetUniverses();
 
         while (!_stop)
         {
@@ -114,8 +115,8 @@ public:
             // output the frames now
             for (const auto& it : universes)
             {
-                it.second->GetOutput(&sendData, lb, rb, pos);
-                sendData.Send(e131SocketSend, artNETSocketSend, it.second->GetTargetIP());
+                it->GetOutput(&sendData, lb, rb, pos);
+                sendData.Send(e131SocketSend, artNETSocketSend, it->GetTargetIP());
                 _emitter->IncrementSent();
             }
 
@@ -147,7 +148,11 @@ public:
 
 Emitter::Emitter(const std::map<int, UniverseData*>& universes, std::string localIP, Settings* settings)
 {
-    _universes = universes;
+    _universes.reserve(universes.size());
+    for (const auto& it : universes)
+    {
+        _universes.push_back(it.second);
+    }
     _settings = settings;
     _sent = 0;
     _pos = 0.0;
@@ -180,3 +185,32 @@ void Emitter::Stop()
         _emitterThread = nullptr;
     }
 }
+
+void Emitter::ZeroSent()
+{
+    _sent = 0;
+    for (const auto& it : _universes)
+    {
+        it->ZeroPacketCounts();
+    }
+}
+
+uint32_t Emitter::GetLatePackets() const
+{
+    uint32_t late = 0;
+    for (const auto& it : _universes)
+    {
+        late += it->GetLatePackets();
+    }
+    return late;
+}
+
+uint32_t Emitter::GetDroppedPackets() const
+{
+    uint32_t dropped = 0;
+    for (const auto& it : _universes)
+    {
+        dropped += it->GetDroppedPackets();
+    }
+    return dropped;
+}
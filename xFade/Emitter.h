@@ -3,6 +3,7 @@
 #include <string>
 #include <mutex>
 #include <map>
+#include <vector>
 #include <atomic>
 #include "PacketData.h"
 
@@ -18,7 +19,7 @@ class Emitter
 {
     std::atomic<uint32_t> _sent; // = 0;
     EmitterThread* _emitterThread = nullptr;
-    std::map<int, UniverseData*> _universes;
+    std::vector<UniverseData*> _universes;
     std::atomic<int> _frameMS; // = 50;
     std::atomic<float> _pos; // = 0.0;
     bool _stop = false;
@@ -36,7 +37,7 @@ class Emitter
     float GetPos() const { return _pos; }
     void SetFrameMS(int ms) { _frameMS = ms; }
     void SetPos(float pos) { _pos = pos; }
-    std::map<int, UniverseData*> GetUniverses() const { return _universes; }
+    const std::vector<UniverseData*>& GetUniverses() const { return _universes; }
     std::string GetLocalIP() const { return _localIP; }
     void SetLocalIP(std::string localIP) { _localIP = localIP; }
     void SetLeftBrightness(int brightness) { _leftBrightness = brightness; }
@@ -45,7 +46,9 @@ class Emitter
     int GetRightBrightness() const { return _rightBrightness; }
     uint32_t GetSent() const { return _sent; }
     void IncrementSent() { _sent++; }
-    void ZeroSent() { _sent = 0; }
+    void ZeroSent();
+    uint32_t GetLatePackets() const;
+    uint32_t GetDroppedPackets() const;
     Settings* GetSettings() const { return _settings; }
 };
 
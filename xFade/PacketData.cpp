@@ -289,38 +289,6 @@ void PacketData::InitialiseLength(long type, int length, int universe)
     }
 }
 
-void PacketData::ApplyBrightness(int brightness, const std::list<int>& excludeChannels)
-{
-    if (brightness == 100) return;
-
-    if (excludeChannels.size() == 0)
-    {
-        if (brightness == 0)
-        {
-            memset(GetDataPtr(), 0x00, GetDataLength());
-        }
-        else
-        {
-            uint8_t* p = GetDataPtr();
-            for (int i = 0; i < GetDataLength(); i++)
-            {
-                *(p + i) = (uint8_t)((int)*(p + i) * brightness / 100);
-            }
-        }
-    }
-    else
-    {
-        uint8_t* p = GetDataPtr();
-        for (int i = 0; i < GetDataLength(); i++)
-        {
-            if (std::find(excludeChannels.begin(), excludeChannels.end(), i + 1) == excludeChannels.end())
-            {
-                *(p + i) = (uint8_t)((int)*(p + i) * brightness / 100);
-            }
-        }
-    }
-}
-
 void PacketData::CopyFrom(PacketData* source, long targetType)
 {
     wxASSERT(source != nullptr);
@@ -355,7 +323,7 @@ void PacketData::CopyFrom(PacketData* source, long targetType)
             // converting from ARTNET
             _length = E131_PACKET_HEADERLEN + source->GetDataLength();
             InitialiseE131Header();
-            memcpy(source->GetDataPtr(), GetDataPtr(), GetDataLength());
+            memcpy(GetDataPtr(), source->GetDataPtr(), GetDataLength());
             memset(&_data[44], 0x00, 64);
             strncpy((char*)&_data[44], _tag.c_str(), 64);
             _data[111] = GetNextSequenceNum(_universe);
@@ -365,7 +333,7 @@ void PacketData::CopyFrom(PacketData* source, long targetType)
             // converting from E131
             _length = ARTNET_PACKET_HEADERLEN + source->GetDataLength();
             InitialiseArtNETHeader();
-            memcpy(source->GetDataPtr(), GetDataPtr(), GetDataLength());
+            memcpy(GetDataPtr(), source->GetDataPtr(), GetDataLength());
             _data[12] = GetNextSequenceNum(_universe);
         }
     }
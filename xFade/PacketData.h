@@ -13,6 +13,9 @@
 #define E131_PACKET_HEADERLEN 126
 #define E131_PACKET_LEN (E131_PACKET_HEADERLEN + 512)
 
+// packets read from the socket in one call where the platform supports it
+#define RECEIVE_BATCH 32
+
 class wxDatagramSocket;
 
 class PacketData
@@ -41,7 +44,6 @@ public:
     void InitialiseE131Header();
     int GetSequenceNum() const;
     void InitialiseLength(long type, int length, int universe);
-    void ApplyBrightness(int brightness, const std::list<int>& excludeChannels);
 };
 
 #endif 
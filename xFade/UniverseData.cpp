@@ -1,13 +1,193 @@
 #include "UniverseData.h"
 
+#include <algorithm>
+#include <cstring>
+
+// SSE2 is always there on x64 and NEON on arm64 so neither needs a runtime check
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FADE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define FADE_NEON
+#include <arm_neon.h>
+#endif
+
 std::string UniverseData::__leftTag = "";
 std::string UniverseData::__rightTag = "";
 
-UniverseData::UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, std::list<int> excludedChannels) :
+// for brightness 0-99 the high half of v * ceil(brightness * 65536 / 100) is exactly v * brightness / 100
+static inline uint16_t BrightnessMultiplier(int brightness)
+{
+    return (uint16_t)((brightness * 65536 + 99) / 100);
+}
+
+#ifdef FADE_NEON
+static inline uint16x8_t MulHi(uint16x8_t a, uint16x8_t b)
+{
+    uint32x4_t lo = vmull_u16(vget_low_u16(a), vget_low_u16(b));
+    uint32x4_t hi = vmull_u16(vget_high_u16(a), vget_high_u16(b));
+    return vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+}
+#endif
+
+// data = data * brightness / 100 on the channels set in the mask
+static void FadeChannels(uint8_t* data, size_t channels, int brightness, const uint8_t* mask)
+{
+    if (brightness >= 100) return;
+
+    uint16_t m = BrightnessMultiplier(std::max(0, brightness));
+    size_t i = 0;
+#if defined(FADE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mult = _mm_set1_epi16((short)m);
+    for (; i + 16 <= channels; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i k = _mm_loadu_si128((const __m128i*)(mask + i));
+        __m128i lo = _mm_mulhi_epu16(_mm_unpacklo_epi8(v, zero), mult);
+        __m128i hi = _mm_mulhi_epu16(_mm_unpackhi_epi8(v, zero), mult);
+        __m128i faded = _mm_packus_epi16(lo, hi);
+        _mm_storeu_si128((__m128i*)(data + i), _mm_or_si128(_mm_and_si128(k, faded), _mm_andnot_si128(k, v)));
+    }
+#elif defined(FADE_NEON)
+    const uint16x8_t mult = vdupq_n_u16(m);
+    for (; i + 16 <= channels; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t k = vld1q_u8(mask + i);
+        uint16x8_t lo = MulHi(vmovl_u8(vget_low_u8(v)), mult);
+        uint16x8_t hi = MulHi(vmovl_u8(vget_high_u8(v)), mult);
+        vst1q_u8(data + i, vbslq_u8(k, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)), v));
+    }
+#endif
+    for (; i < channels; ++i)
+    {
+        if (mask[i] != 0)
+        {
+            data[i] = (uint8_t)((data[i] * m) >> 16);
+        }
+    }
+}
+
+// Mixes other into data by pos. Channels not set in the mask are not faded but switch over at the half way point.
+static void CrossFadeChannels(uint8_t* data, const uint8_t* other, size_t channels, float pos, const uint8_t* mask)
+{
+    uint16_t w = (uint16_t)std::clamp((int)(pos * 256.0f + 0.5f), 0, 256);
+    bool useOther = pos >= 0.5;
+    size_t i = 0;
+#if defined(FADE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wb = _mm_set1_epi16((short)w);
+    const __m128i wa = _mm_set1_epi16((short)(256 - w));
+    for (; i + 16 <= channels; i += 16)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(other + i));
+        __m128i k = _mm_loadu_si128((const __m128i*)(mask + i));
+        // a * (256 - w) + b * w is at most 255 * 256 so stays inside 16 bits
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), wa), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wb));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), wa), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), wb));
+        __m128i mixed = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+        __m128i excluded = useOther ? b : a;
+        _mm_storeu_si128((__m128i*)(data + i), _mm_or_si128(_mm_and_si128(k, mixed), _mm_andnot_si128(k, excluded)));
+    }
+#elif defined(FADE_NEON)
+    const uint16x8_t wb = vdupq_n_u16(w);
+    const uint16x8_t wa = vdupq_n_u16(256 - w);
+    for (; i + 16 <= channels; i += 16)
+    {
+        uint8x16_t a = vld1q_u8(data + i);
+        uint8x16_t b = vld1q_u8(other + i);
+        uint8x16_t k = vld1q_u8(mask + i);
+        uint16x8_t lo = vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(a)), wa), vmovl_u8(vget_low_u8(b)), wb);
+        uint16x8_t hi = vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(a)), wa), vmovl_u8(vget_high_u8(b)), wb);
+        uint8x16_t mixed = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        vst1q_u8(data + i, vbslq_u8(k, mixed, useOther ? b : a));
+    }
+#endif
+    for (; i < channels; ++i)
+    {
+        if (mask[i] != 0)
+        {
+            data[i] = (uint8_t)((data[i] * (256 - w) + other[i] * w) >> 8);
+        }
+        else if (useOther)
+        {
+            data[i] = other[i];
+        }
+    }
+}
+
+// returns -1 if the packet does not carry a sequence number
+static int GetPacketSequenceNum(int type, const uint8_t* buffer, int size)
+{
+    if (type == E131PORT)
+    {
+        if (size <= E131_PACKET_HEADERLEN) return -1;
+        return buffer[111];
+    }
+    else if (type == ARTNETPORT)
+    {
+        // artnet uses 0 to mean sequencing is disabled
+        if (size <= ARTNET_PACKET_HEADERLEN || buffer[12] == 0) return -1;
+        return buffer[12];
+    }
+    return -1;
+}
+
+bool UniverseData::Side::Update(UniverseData* universe, int type, uint8_t* buffer, int size)
+{
+    // artnet packets other than DMX data are accepted but there is nothing to publish
+    if (type == ARTNETPORT && size >= ARTNET_PACKET_HEADERLEN && buffer[9] != 0x50) return true;
+
+    if (!_slots[_back].Update(type, buffer, size)) return false;
+
+    int seq = GetPacketSequenceNum(type, buffer, size);
+    if (seq >= 0 && _lastSequenceNum >= 0)
+    {
+        // as per E1.31 a packet up to 20 behind the last one is out of order and should be ignored
+        int diff = (int8_t)(uint8_t)(seq - _lastSequenceNum);
+        if (diff <= 0 && diff > -20)
+        {
+            universe->_latePackets++;
+            return true;
+        }
+        if (diff > 1)
+        {
+            universe->_droppedPackets += diff - 1;
+        }
+    }
+    _lastSequenceNum = seq;
+
+    _back = _latest.exchange(_back | FRESH) & ~FRESH;
+    return true;
+}
+
+PacketData& UniverseData::Side::GetLatest()
+{
+    if (_latest.load() & FRESH)
+    {
+        _front = _latest.exchange(_front) & ~FRESH;
+    }
+    return _slots[_front];
+}
+
+UniverseData::UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, const std::list<int>& excludedChannels) :
     _universe(universe),
-    _targetIP(targetIP),
-    _excludedChannels(excludedChannels)
+    _targetIP(targetIP)
 {
+    _latePackets = 0;
+    _droppedPackets = 0;
+
+    memset(_fadeMask, 0xFF, sizeof(_fadeMask));
+    for (const auto& it : excludedChannels)
+    {
+        if (it >= 1 && it <= (int)sizeof(_fadeMask))
+        {
+            _fadeMask[it - 1] = 0x00;
+        }
+    }
+
     if (targetProtocol == "As per input")
     {
         _targetProtocol = 0;
@@ -26,89 +206,61 @@ UniverseData::UniverseData(int universe, const std::string& targetIP, const std:
     }
 }
 
-int UniverseData::GetLeftSequenceNum()
-{
-    std::unique_lock<std::mutex> lock(_lock);
-    return _left.GetSequenceNum();
-}
-
-int UniverseData::GetRightSequenceNum()
-{
-    std::unique_lock<std::mutex> lock(_lock);
-    return _right.GetSequenceNum();
-}
-
 bool UniverseData::UpdateLeft(int type, uint8_t* buffer, int size)
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _left.Update(type, buffer, size);
+    return _left.Update(this, type, buffer, size);
 }
 
 bool UniverseData::UpdateRight(int type, uint8_t* buffer, int size)
 {
-    std::unique_lock<std::mutex> lock(_lock);
-    return _right.Update(type, buffer, size);
+    return _right.Update(this, type, buffer, size);
 }
 
 PacketData* UniverseData::GetOutput(PacketData* output, int leftBrightness, int rightBrightness, float pos)
 {
-    std::unique_lock<std::mutex> lock(_lock);
+    PacketData& left = _left.GetLatest();
+    PacketData& right = _right.GetLatest();
 
-    if (_left._length == 0 && _right._length > 0)
+    if (left._length == 0 && right._length > 0)
     {
-        _left.InitialiseLength(_right._type, _right._length, _universe);
+        left.InitialiseLength(right._type, right._length, _universe);
     }
-    else if (_right._length == 0 && _left._length > 0)
+    else if (right._length == 0 && left._length > 0)
     {
-        _right.InitialiseLength(_left._type, _left._length, _universe);
+        right.InitialiseLength(left._type, left._length, _universe);
     }
 
     if (pos == 0.0)
     {
-        PrepareData(output, &_left, _targetProtocol);
-        output->ApplyBrightness(leftBrightness, _excludedChannels);
+        PrepareData(output, &left, _targetProtocol);
+        if (output->GetDataLength() > 0) FadeChannels(output->GetDataPtr(), output->GetDataLength(), leftBrightness, _fadeMask);
     }
     else if (pos == 1.0)
     {
-        PrepareData(output, &_right, _targetProtocol);
-        output->ApplyBrightness(rightBrightness, _excludedChannels);
+        PrepareData(output, &right, _targetProtocol);
+        if (output->GetDataLength() > 0) FadeChannels(output->GetDataPtr(), output->GetDataLength(), rightBrightness, _fadeMask);
     }
     else
     {
-        int sz = std::min(_left.GetDataLength(), _right.GetDataLength());
-
-        PacketData l = _left;
-        PacketData r = _right;
-        l.ApplyBrightness(leftBrightness, _excludedChannels);
-        r.ApplyBrightness(rightBrightness, _excludedChannels);
-
-        Blend(l.GetDataPtr(), r.GetDataPtr(), sz, pos, _excludedChannels);
-        PrepareData(output, &l, _targetProtocol);
-    }
-    return output;
-}
-
-void UniverseData::Blend(uint8_t* buffer, uint8_t* blendBuffer, size_t channels, float pos, std::list<int> excludeChannels)
-{
-    float inv = 1.0 - pos;
-    for (size_t i = 0; i < channels; ++i)
-    {
-        if (std::find(excludeChannels.begin(), excludeChannels.end(), i + 1) != excludeChannels.end())
+        PrepareData(output, &left, _targetProtocol);
+        int channels = output->GetDataLength();
+        int sz = std::min(channels, right.GetDataLength());
+        if (channels > 0)
         {
-            if (pos < 0.5)
-            {
-                // dont change anything
-            }
-            else
+            uint8_t* data = output->GetDataPtr();
+            FadeChannels(data, channels, leftBrightness, _fadeMask);
+
+            if (sz > 0)
             {
-                *(buffer + i) = *(blendBuffer + i);
+                // the latest right packet may be sent again next frame so it must not be faded in place
+                uint8_t faded[512];
+                memcpy(faded, right.GetDataPtr(), sz);
+                FadeChannels(faded, sz, rightBrightness, _fadeMask);
+                CrossFadeChannels(data, faded, sz, pos, _fadeMask);
             }
         }
-        else
-        {
-            *(buffer + i) = (uint8_t)((float) * (buffer + i) * inv + (float) * (blendBuffer + i) * pos);
-        }
     }
+    return output;
 }
 
 void UniverseData::PrepareData(PacketData* target, PacketData* source, int protocol)
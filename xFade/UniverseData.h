@@ -1,21 +1,42 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
+#include <list>
 
 #include "PacketData.h"
 
 class UniverseData
 {
+    // The latest packet for one side of the fade.
+    // There is a single receiving thread writing and the emitter thread reading. The writer fills a spare slot and
+    // swaps it in as the latest, the reader swaps the latest out when it is newer than the one it holds. Three slots
+    // means neither thread ever waits for the other and no packet is torn.
+    class Side
+    {
+        static const int FRESH = 4;
+
+        PacketData _slots[3];
+        std::atomic<int> _latest; // slot index | FRESH if the reader has not taken it yet
+        int _back = 0; // only used by the writer
+        int _front = 2; // only used by the reader
+        int _lastSequenceNum = -1; // only used by the writer
+
+    public:
+        Side() : _latest(1) {}
+        bool Update(UniverseData* universe, int type, uint8_t* buffer, int size);
+        PacketData& GetLatest();
+    };
+
     int _universe = 0;
     int _targetProtocol = 0;
-    std::mutex _lock;
-    PacketData _left;
-    PacketData _right;
+    Side _left;
+    Side _right;
     std::string _targetIP;
-    std::list<int> _excludedChannels;
+    uint8_t _fadeMask[512]; // 0xFF for channels that fade, 0x00 for excluded channels
+    std::atomic<uint32_t> _latePackets; // = 0;
+    std::atomic<uint32_t> _droppedPackets; // = 0;
 
     void PrepareData(PacketData* target, PacketData* source, int protocol);
-    void Blend(uint8_t* buffer, uint8_t* blendBuffer, size_t channels, float pos, std::list<int> excludeChannels);
 
 public:
 
@@ -26,14 +47,14 @@ public:
     static void SetLeftTag(const std::string& left) { __leftTag = left; }
     static void SetRightTag(const std::string& right) { __rightTag = right; }
     int GetUniverse() const { return _universe; }
-    std::mutex& GetLock() { return _lock; }
     std::string GetTargetIP() const { return _targetIP; }
     bool UpdateLeft(int type, uint8_t* buffer, int size);
     bool UpdateRight(int type, uint8_t* buffer, int size);
-    int GetLeftSequenceNum();
-    int GetRightSequenceNum();
     int GetOutputFormat() const { return _targetProtocol; }
-    UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, std::list<int> excludedChannels);
+    uint32_t GetLatePackets() const { return _latePackets; }
+    uint32_t GetDroppedPackets() const { return _droppedPackets; }
+    void ZeroPacketCounts() { _latePackets = 0; _droppedPackets = 0; }
+    UniverseData(int universe, const std::string& targetIP, const std::string& targetProtocol, const std::list<int>& excludedChannels);
     virtual ~UniverseData() {}
     PacketData* GetOutput(PacketData* output, int leftBrightness, int rightBrightness, float pos);
 };
@@ -1145,9 +1145,11 @@ void xFadeFrame::OnTimer_StatusTrigger(wxTimerEvent& event)
     StatusBar1->SetStatusText(wxString::Format("Left: %u", leftReceived), 0);
     StatusBar1->SetStatusText(wxString::Format("Right: %u", rightReceived), 2);
     if (_emitter != nullptr) {
-        StatusBar1->SetStatusText(wxString::Format("Sent: %u", _emitter->GetSent()), 1);
+        uint32_t late = _emitter->GetLatePackets();
+        uint32_t dropped = _emitter->GetDroppedPackets();
+        StatusBar1->SetStatusText(wxString::Format("Sent: %u Late: %u Dropped: %u", _emitter->GetSent(), late, dropped), 1);
         if (count % 60 == 0) {
-            logger_base.debug("Activity - Left Received %u, Right Received %u, Sent %u.", leftReceived, rightReceived, _emitter->GetSent());
+            logger_base.debug("Activity - Left Received %u, Right Received %u, Sent %u, Late %u, Dropped %u.", leftReceived, rightReceived, _emitter->GetSent(), late, dropped);
         }
     } else {
         StatusBar1->SetStatusText("Sending disabled", 1);
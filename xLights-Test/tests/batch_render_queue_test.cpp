@@ -0,0 +1,86 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "../xlRender/BatchRenderQueue.h"
+
+TEST(BatchRenderQueue, BiggestFirstWithinJobLimit)
+{
+    BatchRenderQueue queue(2, 10000);
+    queue.Add("small", 100);
+    queue.Add("big", 900);
+    queue.Add("medium", 500);
+
+    int a = queue.Start();
+    int b = queue.Start();
+    EXPECT_EQ("big", queue.GetJob(a).sequence);
+    EXPECT_EQ("medium", queue.GetJob(b).sequence);
+    EXPECT_EQ(-1, queue.Start());
+    EXPECT_EQ(1400u, queue.GetMemoryInUseMB());
+
+    queue.Finish(a);
+    int c = queue.Start();
+    EXPECT_EQ("small", queue.GetJob(c).sequence);
+    queue.Finish(b);
+    queue.Finish(c);
+    EXPECT_TRUE(queue.IsDone());
+    EXPECT_EQ(0u, queue.GetMemoryInUseMB());
+}
+
+TEST(BatchRenderQueue, MemoryBudgetHoldsBackJobs)
+{
+    BatchRenderQueue queue(4, 1000);
+    queue.Add("a", 600);
+    queue.Add("b", 600);
+    queue.Add("c", 300);
+
+    int a = queue.Start();
+    // b does not fit next to a but c does
+    int c = queue.Start();
+    EXPECT_EQ("a", queue.GetJob(a).sequence);
+    EXPECT_EQ("c", queue.GetJob(c).sequence);
+    EXPECT_EQ(-1, queue.Start());
+
+    queue.Finish(a);
+    int b = queue.Start();
+    EXPECT_EQ("b", queue.GetJob(b).sequence);
+    EXPECT_EQ(900u, queue.GetMemoryInUseMB());
+}
+
+TEST(BatchRenderQueue, OversizedJobRunsAlone)
+{
+    BatchRenderQueue queue(4, 1000);
+    queue.Add("huge", 5000);
+    queue.Add("small", 100);
+
+    int huge = queue.Start();
+    EXPECT_EQ("huge", queue.GetJob(huge).sequence);
+    EXPECT_EQ(-1, queue.Start());
+    queue.Finish(huge);
+    EXPECT_NE(-1, queue.Start());
+}
+
+TEST(BatchRenderQueue, EstimateFromFseqHeader)
+{
+    const char* name = "batch_render_queue_test.fseq";
+    {
+        // v2 header, 2048 channels, 1024 frames = 2MB of frame data
+        unsigned char header[18] = { 'P', 'S', 'E', 'Q', 32, 0, 0, 2, 32, 0, 0, 8, 0, 0, 0, 4, 0, 0 };
+        std::ofstream out(name, std::ios::binary);
+        out.write((const char*)header, sizeof(header));
+    }
+    EXPECT_EQ(512u + 2u, BatchRenderQueue::EstimateMemoryMB(name, 512, 768));
+    std::remove(name);
+    EXPECT_EQ(768u, BatchRenderQueue::EstimateMemoryMB(name, 512, 768));
+}
@@ -0,0 +1,169 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "../xSchedule/Blend.h"
+
+// Straightforward per channel versions of each blend mode that the vectorised ones must match
+static void ReferenceBlend(uint8_t* b, const uint8_t* bb, size_t channels, APPLYMETHOD method)
+{
+    size_t pixels = channels / 3;
+    switch (method) {
+    case APPLYMETHOD::METHOD_OVERWRITE:
+        for (size_t i = 0; i < channels; ++i) b[i] = bb[i];
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITEIFZERO:
+        for (size_t i = 0; i < channels; ++i) if (b[i] == 0) b[i] = bb[i];
+        break;
+    case APPLYMETHOD::METHOD_MASK:
+        for (size_t i = 0; i < channels; ++i) if (bb[i] != 0) b[i] = 0;
+        break;
+    case APPLYMETHOD::METHOD_UNMASK:
+        for (size_t i = 0; i < channels; ++i) if (bb[i] == 0) b[i] = 0;
+        break;
+    case APPLYMETHOD::METHOD_AVERAGE:
+        for (size_t i = 0; i < channels; ++i) b[i] = ((int)b[i] + (int)bb[i]) / 2;
+        break;
+    case APPLYMETHOD::METHOD_MAX:
+        for (size_t i = 0; i < channels; ++i) b[i] = std::max(b[i], bb[i]);
+        break;
+    case APPLYMETHOD::METHOD_MIN:
+        for (size_t i = 0; i < channels; ++i) b[i] = std::min(b[i], bb[i]);
+        break;
+    case APPLYMETHOD::METHOD_BRIGHTNESS:
+        for (size_t i = 0; i < pixels * 3; ++i) b[i] = ((int)b[i] * (int)bb[i]) / 255;
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITEIFBLACK:
+        for (size_t p = 0; p < pixels * 3; p += 3) {
+            if (b[p] == 0 && b[p + 1] == 0 && b[p + 2] == 0) {
+                b[p] = bb[p]; b[p + 1] = bb[p + 1]; b[p + 2] = bb[p + 2];
+            }
+        }
+        break;
+    case APPLYMETHOD::METHOD_OVERWRITESKIPBLACK:
+        for (size_t p = 0; p < pixels * 3; p += 3) {
+            if (bb[p] != 0 || bb[p + 1] != 0 || bb[p + 2] != 0) {
+                b[p] = bb[p]; b[p + 1] = bb[p + 1]; b[p + 2] = bb[p + 2];
+            }
+        }
+        break;
+    case APPLYMETHOD::METHOD_MASKPIXEL:
+        for (size_t p = 0; p < pixels * 3; p += 3) {
+            if (bb[p] != 0 || bb[p + 1] != 0 || bb[p + 2] != 0) {
+                b[p] = 0; b[p + 1] = 0; b[p + 2] = 0;
+            }
+        }
+        break;
+    case APPLYMETHOD::METHOD_UNMASKPIXEL:
+        for (size_t p = 0; p < pixels * 3; p += 3) {
+            if (bb[p] == 0 && bb[p + 1] == 0 && bb[p + 2] == 0) {
+                b[p] = 0; b[p + 1] = 0; b[p + 2] = 0;
+            }
+        }
+        break;
+    }
+}
+
+static const APPLYMETHOD ALL_METHODS[] = {
+    APPLYMETHOD::METHOD_OVERWRITE, APPLYMETHOD::METHOD_OVERWRITEIFZERO, APPLYMETHOD::METHOD_OVERWRITESKIPBLACK,
+    APPLYMETHOD::METHOD_MASK, APPLYMETHOD::METHOD_UNMASK, APPLYMETHOD::METHOD_AVERAGE,
+    APPLYMETHOD::METHOD_MAX, APPLYMETHOD::METHOD_OVERWRITEIFBLACK, APPLYMETHOD::METHOD_MASKPIXEL,
+    APPLYMETHOD::METHOD_UNMASKPIXEL, APPLYMETHOD::METHOD_MIN, APPLYMETHOD::METHOD_BRIGHTNESS
+};
+
+// Lots of zero channels and black pixels so the masking modes take both paths
+static void FillRandom(std::vector<uint8_t>& v, std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (size_t i = 0; i < v.size(); i += 3) {
+        int kind = dist(rng) % 4;
+        for (size_t c = i; c < std::min(v.size(), i + 3); ++c) {
+            switch (kind) {
+            case 0: v[c] = 0; break;
+            case 1: v[c] = dist(rng) % 3 == 0 ? 0 : dist(rng); break;
+            case 2: v[c] = 255; break;
+            default: v[c] = dist(rng); break;
+            }
+        }
+    }
+}
+
+TEST(Blend_Tests, MatchesReference) {
+    std::mt19937 rng(1234);
+    // sizes either side of the vector widths and offsets that leave the buffers misaligned
+    for (size_t size : { 0, 1, 3, 15, 16, 17, 47, 48, 49, 95, 96, 97, 300, 1000, 4099 }) {
+        for (size_t offset : { 0, 1, 3, 7 }) {
+            for (auto method : ALL_METHODS) {
+                std::vector<uint8_t> buffer(size + offset + 5);
+                std::vector<uint8_t> blend(size);
+                FillRandom(buffer, rng);
+                FillRandom(blend, rng);
+                std::vector<uint8_t> expected = buffer;
+                ReferenceBlend(expected.data() + offset, blend.data(), size, method);
+
+                Blend(buffer.data(), size + offset, blend.data(), blend.size(), method, offset);
+                ASSERT_EQ(expected, buffer) << DecodeBlendMode(method) << " size " << size << " offset " << offset;
+            }
+        }
+    }
+}
+
+TEST(Blend_Tests, EveryByteValue) {
+    // every combination of two channel values through the per channel modes
+    std::vector<uint8_t> buffer(256 * 256);
+    std::vector<uint8_t> blend(256 * 256);
+    for (auto method : ALL_METHODS) {
+        for (int a = 0; a < 256; ++a) {
+            for (int b = 0; b < 256; ++b) {
+                buffer[a * 256 + b] = a;
+                blend[a * 256 + b] = b;
+            }
+        }
+        std::vector<uint8_t> expected = buffer;
+        ReferenceBlend(expected.data(), blend.data(), buffer.size(), method);
+        Blend(buffer.data(), buffer.size(), blend.data(), blend.size(), method);
+        ASSERT_EQ(expected, buffer) << DecodeBlendMode(method);
+    }
+}
+
+// run with --gtest_also_run_disabled_tests to see the throughput of each mode on a large show
+TEST(Blend_Tests, DISABLED_Throughput) {
+    const size_t channels = 3 * 1024 * 1024;
+    const int loops = 100;
+    std::mt19937 rng(42);
+    std::vector<uint8_t> buffer(channels);
+    std::vector<uint8_t> blend(channels);
+    FillRandom(buffer, rng);
+    FillRandom(blend, rng);
+    std::vector<uint8_t> original = buffer;
+
+    for (auto method : ALL_METHODS) {
+        double vectorSecs = 0;
+        double referenceSecs = 0;
+        for (int l = 0; l < loops; ++l) {
+            buffer = original;
+            auto start = std::chrono::steady_clock::now();
+            Blend(buffer.data(), buffer.size(), blend.data(), blend.size(), method);
+            vectorSecs += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            buffer = original;
+            start = std::chrono::steady_clock::now();
+            ReferenceBlend(buffer.data(), blend.data(), buffer.size(), method);
+            referenceSecs += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        double mb = (double)channels * loops / (1024.0 * 1024.0);
+        printf("%-24s %8.0f MB/s   reference %8.0f MB/s\n", DecodeBlendMode(method).c_str(), mb / vectorSecs, mb / referenceSecs);
+    }
+}
@@ -0,0 +1,156 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "../xLights/ColorSpan.h"
+
+// The double versions from Color.cpp that the span versions must match
+static void ReferenceFromHSV(double h, double s, double v, uint8_t* rgb)
+{
+    double red, green, blue;
+    if (0.0f == s) {
+        red = green = blue = v;
+    } else {
+        double hue = h * 6.0;
+        int i = (int)std::floor(hue);
+        double f = hue - i;
+        double p = v * (1.0 - s);
+        switch (i) {
+        case 0: red = v; green = v * (1.0 - s * (1.0 - f)); blue = p; break;
+        case 1: red = v * (1.0 - s * f); green = v; blue = p; break;
+        case 2: red = p; green = v; blue = v * (1.0 - s * (1.0 - f)); break;
+        case 3: red = p; green = v * (1.0 - s * f); blue = v; break;
+        case 4: red = v * (1.0 - s * (1.0 - f)); green = p; blue = v; break;
+        default: red = v; green = p; blue = v * (1.0 - s * f); break;
+        }
+    }
+    rgb[0] = (uint8_t)(red * 255.0);
+    rgb[1] = (uint8_t)(green * 255.0);
+    rgb[2] = (uint8_t)(blue * 255.0);
+}
+
+static void ReferenceToHSV(const uint8_t* rgb, double& h, double& s, double& v)
+{
+    double r = rgb[0] / 255.0;
+    double g = rgb[1] / 255.0;
+    double b = rgb[2] / 255.0;
+    double K = 0.0;
+    if (g < b) {
+        std::swap(g, b);
+        K = -1.0;
+    }
+    double min_gb = b;
+    if (r < g) {
+        std::swap(r, g);
+        K = -2.0 / 6.0 - K;
+        min_gb = std::min(g, b);
+    }
+    double chroma = r - min_gb;
+    h = std::abs(K + (g - b) / (6.0 * chroma + 1e-20));
+    s = chroma / (r + 1e-20);
+    v = r;
+}
+
+TEST(ColorSpan, HSVToRGBMatchesFromHSV)
+{
+    std::vector<float> hue, saturation, value;
+    for (int h = -12; h <= 30; ++h) {
+        for (int s = 0; s <= 10; ++s) {
+            for (int v = 0; v <= 10; ++v) {
+                hue.push_back(h / 24.0f + 0.013f);
+                saturation.push_back(s / 10.0f);
+                value.push_back(v / 10.0f);
+            }
+        }
+    }
+    // exactly on the sector boundaries including hue 1 which fromHSV puts in the last sector
+    for (int h = 0; h <= 6; ++h) {
+        hue.push_back(h / 6.0f);
+        saturation.push_back(0.75f);
+        value.push_back(1.0f);
+    }
+
+    const size_t count = hue.size();
+    std::vector<uint8_t> rgba(count * 4, 77);
+    HSVToRGBSpan(hue.data(), saturation.data(), value.data(), rgba.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t expected[3];
+        ReferenceFromHSV(hue[i], saturation[i], value[i], expected);
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_LE(std::abs((int)rgba[i * 4 + c] - (int)expected[c]), 1) << "hue " << hue[i] << " sat " << saturation[i] << " val " << value[i];
+        }
+        EXPECT_EQ(rgba[i * 4 + 3], 77);
+    }
+}
+
+TEST(ColorSpan, RGBToHSVMatchesToHSV)
+{
+    std::vector<uint8_t> rgba;
+    for (int r = 0; r < 256; r += 15) {
+        for (int g = 0; g < 256; g += 17) {
+            for (int b = 0; b < 256; b += 5) {
+                rgba.push_back(r);
+                rgba.push_back(g);
+                rgba.push_back(b);
+                rgba.push_back(255);
+            }
+        }
+    }
+
+    const size_t count = rgba.size() / 4;
+    std::vector<float> hue(count), saturation(count), value(count);
+    RGBToHSVSpan(rgba.data(), hue.data(), saturation.data(), value.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        double h, s, v;
+        ReferenceToHSV(&rgba[i * 4], h, s, v);
+        EXPECT_NEAR(hue[i], h, 1e-5);
+        EXPECT_NEAR(saturation[i], s, 1e-5);
+        EXPECT_NEAR(value[i], v, 1e-5);
+    }
+
+    // and back again lands within one of where it started
+    std::vector<uint8_t> back(count * 4, 0);
+    HSVToRGBSpan(hue.data(), saturation.data(), value.data(), back.data(), count);
+    for (size_t i = 0; i < count * 4; ++i) {
+        if (i % 4 != 3) {
+            EXPECT_LE(std::abs((int)back[i] - (int)rgba[i]), 1);
+        }
+    }
+}
+
+TEST(ColorSpan, AdjustWrapsHueAndClampsTheRest)
+{
+    std::vector<float> hue = { 0.1f, 0.5f, 0.95f };
+    std::vector<float> saturation = { 0.1f, 0.5f, 0.95f };
+    std::vector<float> value = { 0.1f, 0.5f, 0.95f };
+
+    AdjustHSVSpan(hue.data(), saturation.data(), value.data(), 3, 0.2f, -0.2f, 0.0f);
+    EXPECT_FLOAT_EQ(hue[0], 0.3f);
+    EXPECT_FLOAT_EQ(hue[1], 0.7f);
+    EXPECT_NEAR(hue[2], 0.15f, 1e-6);
+    EXPECT_FLOAT_EQ(saturation[0], 0.0f);
+    EXPECT_FLOAT_EQ(saturation[1], 0.3f);
+    EXPECT_FLOAT_EQ(saturation[2], 0.75f);
+    EXPECT_FLOAT_EQ(value[2], 0.95f);
+
+    AdjustHSVSpan(hue.data(), saturation.data(), value.data(), 3, -0.5f, 0.0f, 0.5f);
+    EXPECT_NEAR(hue[0], 0.8f, 1e-6);
+    EXPECT_NEAR(hue[1], 0.2f, 1e-6);
+    EXPECT_FLOAT_EQ(value[0], 0.6f);
+    EXPECT_FLOAT_EQ(value[1], 1.0f);
+}
@@ -0,0 +1,338 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "../xLights/SinTable.h"
+#include "../xLights/effects/EffectKernels.h"
+
+// The kernels are checked against copies of the scalar Render loops from the effects, down to the sin lookup table
+// RenderBuffer uses, so these are image diffs against what the effects drew before.
+
+static const double PI = 3.1415926535897932384626433832;
+
+static const SinTable sinTable;
+static double RefSin(double rad) { return sinTable.sin(rad); }
+static double RefCos(double rad) { return sinTable.cos(rad); }
+
+typedef std::vector<uint8_t> Image;
+
+static void RefSetPixel(Image& img, int w, int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+{
+    uint8_t* p = &img[(y * w + x) * 4];
+    p[0] = r;
+    p[1] = g;
+    p[2] = b;
+    p[3] = a;
+}
+
+static void RefMultiColorBlend(const uint8_t (*colors)[4], int numColors, float n, uint8_t* out)
+{
+    if (numColors <= 1) {
+        std::copy(colors[0], colors[0] + 4, out);
+        return;
+    }
+    if (n >= 1.0) n = 0.99999f;
+    if (n < 0.0) n = 0.0f;
+    float realidx = n * (numColors - 1);
+    int coloridx1 = floor(realidx);
+    int coloridx2 = (coloridx1 + 1) % numColors;
+    float ratio = realidx - float(coloridx1);
+    for (int c = 0; c < 3; ++c) {
+        out[c] = colors[coloridx1][c] + floor(ratio * (colors[coloridx2][c] - colors[coloridx1][c]) + 0.5);
+    }
+    out[3] = colors[coloridx1][3];
+}
+
+// xlColor::fromHSV
+static void RefFromHSV(double h, double s, double v, uint8_t* rgb)
+{
+    double red, green, blue;
+    if (0.0f == s) {
+        red = green = blue = v;
+    } else {
+        double hue = h * 6.0;
+        int i = (int)std::floor(hue);
+        double f = hue - i;
+        double p = v * (1.0 - s);
+        switch (i) {
+        case 0: red = v; green = v * (1.0 - s * (1.0 - f)); blue = p; break;
+        case 1: red = v * (1.0 - s * f); green = v; blue = p; break;
+        case 2: red = p; green = v; blue = v * (1.0 - s * (1.0 - f)); break;
+        case 3: red = p; green = v * (1.0 - s * f); blue = v; break;
+        case 4: red = v * (1.0 - s * (1.0 - f)); green = p; blue = v; break;
+        default: red = v; green = p; blue = v * (1.0 - s * f); break;
+        }
+    }
+    rgb[0] = (uint8_t)(red * 255.0);
+    rgb[1] = (uint8_t)(green * 255.0);
+    rgb[2] = (uint8_t)(blue * 255.0);
+}
+
+static Image RefPlasma(const PlasmaKernelData& d)
+{
+    const int w = d.width;
+    const int h = d.height;
+    Image img(w * h * 4, 0);
+    const double pi3 = PI / 3.0;
+    const double time = d.time;
+    for (int x = 0; x < w; x++) {
+        double rx = ((float)x / (w - 1));
+        double rx2 = rx * rx;
+        double cx = rx + .5 * d.sin_time_5;
+        double cx2 = cx * cx;
+        double sin_rx_time = RefSin(rx + time);
+        double v1 = RefSin(rx * 10 + time);
+        for (int y = 0; y < h; y++) {
+            double ry = ((float)y / (h - 1));
+            double v = v1;
+            v += RefSin(10 * (rx * d.sin_time_2 + ry * d.cos_time_3) + time);
+            double cy = ry + .5 * d.cos_time_3;
+            v += RefSin(sqrt((d.Style * 50) * ((cx2) + (cy * cy)) + time));
+            v += sin_rx_time;
+            v += RefSin((ry + time) / 2.0);
+            v += RefSin((rx + ry + time) / 2.0);
+            v += RefSin(sqrt(rx2 + ry * ry) + time);
+            v = v / 2.0;
+            double vldpi = v * d.Line_Density * PI;
+
+            uint8_t* p = &img[(y * w + x) * 4];
+            switch (d.colorScheme) {
+            case 0:
+                RefMultiColorBlend(d.colors, d.numColors, (RefSin(vldpi + 2 * pi3) + 1) * 0.5, p);
+                break;
+            case 1:
+                RefSetPixel(img, w, x, y, (RefSin(vldpi) + 1) * 128, (RefCos(vldpi) + 1) * 128, 0);
+                break;
+            case 2:
+                RefSetPixel(img, w, x, y, 1, (RefCos(vldpi) + 1) * 128, (RefSin(vldpi) + 1) * 128);
+                break;
+            case 3:
+                RefSetPixel(img, w, x, y, (RefSin(vldpi) + 1) * 128, (RefSin(vldpi + 2 * pi3) + 1) * 128, (RefSin(vldpi + 4 * pi3) + 1) * 128);
+                break;
+            default: {
+                uint8_t c = (RefSin(vldpi) + 1) * 128;
+                RefSetPixel(img, w, x, y, c, c, c);
+            } break;
+            }
+        }
+    }
+    return img;
+}
+
+static Image RefButterfly(const ButterflyKernelData& d)
+{
+    const int w = d.width;
+    const int h = d.height;
+    Image img(w * h * 4, 0);
+    static const double pi2 = 6.283185307;
+    const int maxframe = h * 2;
+    const int frame = (h * d.curState / 200) % maxframe;
+    const double offset = d.offset;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            double n, hue = 0.0, f, x1, y1, intpart;
+            int dd;
+            const int wave = d.style == 5 ? h * w : h + w;
+            int xx = x;
+            int yy = y;
+            if (x == 0 && y == 1) yy = 2;
+            if (x == 1 && y == 0) xx = 2;
+            switch (d.style) {
+            case 1:
+            case 5:
+                n = std::abs((xx * xx - yy * yy) * RefSin(offset + ((xx + yy) * pi2 / float(wave))));
+                dd = xx * xx + yy * yy;
+                hue = dd > 0.001 ? n / dd : 0.0;
+                break;
+            case 2:
+                f = (frame < maxframe / 2) ? frame + 1 : maxframe - frame;
+                x1 = (double(x) - w / 2.0) / f;
+                y1 = (double(y) - h / 2.0) / f;
+                hue = sqrt(x1 * x1 + y1 * y1);
+                break;
+            case 3:
+                f = (frame < maxframe / 2) ? frame + 1 : maxframe - frame;
+                f = f * 0.1 + double(h) / 60.0;
+                x1 = (x - w / 2.0) / f;
+                y1 = (y - h / 2.0) / f;
+                hue = RefSin(x1) * RefCos(y1);
+                break;
+            case 4:
+                n = ((xx * xx - yy * yy) * RefSin(offset + ((xx + yy) * pi2 / float(wave))));
+                dd = xx * xx + yy * yy;
+                hue = dd > 0.001 ? n / dd : 0.0;
+                hue = modf(hue, &intpart);
+                if (hue < 0) hue = 1.0 + hue;
+                break;
+            }
+            if (d.chunks <= 1 || int(hue * d.chunks) % d.skip != 0) {
+                uint8_t* p = &img[(y * w + x) * 4];
+                if (d.colorScheme == 0) {
+                    RefFromHSV((float)hue, 1.0, 1.0, p);
+                    p[3] = 255;
+                } else {
+                    RefMultiColorBlend(d.colors, d.numColors, hue, p);
+                }
+            }
+        }
+    }
+    return img;
+}
+
+static Image RefShockwave(const ShockwaveKernelData& d)
+{
+    const int w = d.width;
+    const int h = d.height;
+    Image img(w * h * 4, 0);
+    for (int x = 0; x < w; x++) {
+        int x1 = x - d.xc_adj;
+        for (int y = 0; y < h; y++) {
+            int y1 = y - d.yc_adj;
+            double r = std::hypot(x1, y1);
+            if (r >= d.radius1 && r <= d.radius2) {
+                uint8_t* p = &img[(y * w + x) * 4];
+                std::copy(d.color, d.color + 4, p);
+                if (d.blend) {
+                    double color_pct = 1.0 - std::abs(r - d.radius_center) / d.half_width;
+                    if (d.allowAlpha) {
+                        p[3] = 255.0 * color_pct;
+                    } else {
+                        RefFromHSV(d.colorHSV[0], d.colorHSV[1], d.colorHSV[2] * color_pct, p);
+                    }
+                }
+            }
+        }
+    }
+    return img;
+}
+
+// the kernels work in float where the effects work in double, so now and then a sin lands on the next table entry
+// and a channel moves a level or two
+static void ExpectClose(const Image& expected, const Image& actual, int tolerance)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    size_t differ = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (std::abs((int)expected[i] - (int)actual[i]) > tolerance) {
+            ++differ;
+        }
+    }
+    EXPECT_EQ(0u, differ) << differ << " of " << expected.size() << " channels differ by more than " << tolerance;
+}
+
+static const uint8_t PALETTE[3][4] = { { 255, 0, 0, 255 }, { 0, 255, 0, 255 }, { 20, 40, 250, 255 } };
+
+TEST(EffectKernels, PlasmaMatchesScalar)
+{
+    for (int scheme = 0; scheme <= 4; ++scheme) {
+        for (int frame : { 0, 37, 500, 20000 }) {
+            PlasmaKernelData d;
+            d.width = 67;
+            d.height = 41;
+            d.Style = 2;
+            d.Line_Density = 3;
+            d.time = (frame + 1.0) / ((101 - 10) * 3);
+            d.sin_time_5 = sinTable.sin(d.time / 5);
+            d.cos_time_3 = sinTable.cos(d.time / 3);
+            d.sin_time_2 = sinTable.sin(d.time / 2);
+            d.colorScheme = scheme;
+            d.numColors = 3;
+            std::copy(&PALETTE[0][0], &PALETTE[0][0] + 12, &d.colors[0][0]);
+
+            Image actual(d.width * d.height * 4, 0);
+            PlasmaKernel(d, actual.data(), 0, d.height);
+            ExpectClose(RefPlasma(d), actual, 3);
+        }
+    }
+}
+
+TEST(EffectKernels, ButterflyMatchesScalar)
+{
+    for (int style = 1; style <= 5; ++style) {
+        for (int scheme = 0; scheme <= 1; ++scheme) {
+            for (int chunks : { 1, 4 }) {
+                ButterflyKernelData d;
+                d.width = 50;
+                d.height = 29;
+                d.style = style;
+                d.colorScheme = scheme;
+                d.chunks = chunks;
+                d.skip = 2;
+                d.curState = 310;
+                d.offset = d.curState / 200.0;
+                d.numColors = 3;
+                std::copy(&PALETTE[0][0], &PALETTE[0][0] + 12, &d.colors[0][0]);
+
+                Image actual(d.width * d.height * 4, 0);
+                ButterflyKernel(d, actual.data(), 0, d.height);
+                ExpectClose(RefButterfly(d), actual, 1);
+            }
+        }
+    }
+}
+
+TEST(EffectKernels, ShockwaveMatchesScalar)
+{
+    for (int mode = 0; mode < 3; ++mode) {
+        ShockwaveKernelData d;
+        d.width = 61;
+        d.height = 45;
+        d.xc_adj = 27;
+        d.yc_adj = 20;
+        d.radius_center = 14.3f;
+        d.half_width = 4.5f;
+        d.radius1 = d.radius_center - d.half_width;
+        d.radius2 = d.radius_center + d.half_width;
+        d.color[0] = 200;
+        d.color[1] = 100;
+        d.color[2] = 50;
+        d.color[3] = 255;
+        d.colorHSV[0] = 0.05555f;
+        d.colorHSV[1] = 0.75f;
+        d.colorHSV[2] = 200.0f / 255.0f;
+        d.blend = mode > 0;
+        d.allowAlpha = mode == 2;
+
+        Image actual(d.width * d.height * 4, 0);
+        ShockwaveKernel(d, actual.data(), 0, d.height);
+        ExpectClose(RefShockwave(d), actual, 1);
+    }
+}
+
+TEST(EffectKernels, RowBandsMatchWholeBuffer)
+{
+    // rendering in bands the way the effects split the buffer across the pool gives the same picture
+    PlasmaKernelData d;
+    d.width = 130;
+    d.height = 17;
+    d.Style = 1;
+    d.Line_Density = 1;
+    d.time = 0.4f;
+    d.sin_time_5 = std::sin(0.08f);
+    d.cos_time_3 = std::cos(0.4f / 3);
+    d.sin_time_2 = std::sin(0.2f);
+    d.colorScheme = 3;
+    d.numColors = 1;
+    std::copy(&PALETTE[0][0], &PALETTE[0][0] + 4, &d.colors[0][0]);
+
+    Image whole(d.width * d.height * 4, 0);
+    PlasmaKernel(d, whole.data(), 0, d.height);
+    Image bands(d.width * d.height * 4, 0);
+    for (int y = 0; y < (int)d.height; y += 5) {
+        PlasmaKernel(d, bands.data(), y, std::min(y + 5, (int)d.height));
+    }
+    EXPECT_EQ(whole, bands);
+}
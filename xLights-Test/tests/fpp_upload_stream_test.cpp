@@ -0,0 +1,212 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../xLights/controllers/FPPUploadStream.h"
+
+// Stands in for FPP's upload handler.  Each PATCH body is written at its Upload-Offset and the file is
+// complete once every byte up to the Upload-Length has arrived.  Requests it can't place are rejected.
+class UploadStandIn {
+public:
+    int failNext = 0;
+    int requests = 0;
+    int completedOnRequest = 0;
+    int deferredRequests = 0;
+    std::string name;
+    std::vector<uint8_t> file;
+
+    long Patch(const std::vector<std::string>& headers, const std::vector<uint8_t>& body) {
+        requests++;
+        if (failNext > 0) {
+            failNext--;
+            return 500;
+        }
+        int64_t offset = -1;
+        uint64_t length = 0;
+        bool deferred = false;
+        for (const auto& h : headers) {
+            if (h.rfind("Upload-Offset: ", 0) == 0) {
+                offset = std::stoll(h.substr(15));
+            } else if (h.rfind("Upload-Length: ", 0) == 0) {
+                length = std::stoull(h.substr(15));
+            } else if (h == "Upload-Defer-Length: 1") {
+                deferred = true;
+            } else if (h.rfind("Upload-Name: ", 0) == 0) {
+                name = h.substr(13);
+            }
+        }
+        if (offset < 0 || (length == 0) == !deferred) {
+            return 400;
+        }
+        if (deferred) {
+            deferredRequests++;
+        } else {
+            if (_length != 0 && _length != length) {
+                return 409;
+            }
+            _length = length;
+            if (offset + body.size() > _length) {
+                return 400;
+            }
+        }
+        if (completedOnRequest != 0) {
+            // nothing may arrive after the file is complete
+            return 409;
+        }
+        if (file.size() < offset + body.size()) {
+            file.resize(offset + body.size());
+            _received.resize(offset + body.size());
+        }
+        for (size_t x = 0; x < body.size(); x++) {
+            file[offset + x] = body[x];
+            _received[offset + x] = true;
+        }
+        if (_length != 0 && file.size() == _length) {
+            bool complete = true;
+            for (auto r : _received) {
+                complete &= r;
+            }
+            if (complete) {
+                completedOnRequest = requests;
+            }
+        }
+        return 200;
+    }
+
+private:
+    uint64_t _length = 0;
+    std::vector<bool> _received;
+};
+
+static std::vector<uint8_t> MakeData(size_t size, uint8_t seed) {
+    std::vector<uint8_t> d(size);
+    for (size_t x = 0; x < size; x++) {
+        d[x] = (uint8_t)(x * 31 + seed);
+    }
+    return d;
+}
+
+// sends whatever is queued, returns the result of the last response
+static FPPUploadStream::Result Pump(FPPUploadStream& stream, UploadStandIn& server) {
+    FPPUploadStream::Result result = FPPUploadStream::Result::NEXT;
+    uint64_t offset;
+    std::vector<uint8_t> data;
+    std::vector<std::string> headers;
+    while (stream.Next(offset, data, headers)) {
+        result = stream.OnResponse(server.Patch(headers, data));
+    }
+    return result;
+}
+
+// encodes a file the way FPP::AddFrameToUpload and FinalizeUploadSequence do, channel data is streamed
+// as it builds up and the header and remaining data are only handed over at the end
+static std::vector<uint8_t> StreamFile(FPPUploadStream& stream, UploadStandIn& server, size_t headerSize, size_t dataSize, size_t pieceSize) {
+    std::vector<uint8_t> header = MakeData(headerSize, 7);
+    std::vector<uint8_t> data = MakeData(dataSize, 3);
+    std::vector<uint8_t> expected = header;
+    expected.insert(expected.end(), data.begin(), data.end());
+
+    size_t pos = 0;
+    while (dataSize - pos > pieceSize) {
+        std::vector<uint8_t> piece(data.begin() + pos, data.begin() + pos + pieceSize);
+        stream.Add(headerSize + pos, piece);
+        pos += pieceSize;
+        Pump(stream, server);
+    }
+    std::vector<uint8_t> tail(data.begin() + pos, data.end());
+    stream.Finish(header, headerSize + pos, tail);
+    return expected;
+}
+
+TEST(FPPUploadStream, AssemblesTheWholeFile) {
+    FPPUploadStream stream("test.fseq", 1000);
+    UploadStandIn server;
+    std::vector<uint8_t> expected = StreamFile(stream, server, 64, 10500, 700);
+    EXPECT_GT(server.deferredRequests, 0);
+    EXPECT_EQ(0, server.completedOnRequest);
+
+    EXPECT_EQ(FPPUploadStream::Result::DONE, Pump(stream, server));
+    EXPECT_EQ(expected, server.file);
+    EXPECT_EQ("test.fseq", server.name);
+    // the request that completes the file is the last one
+    EXPECT_EQ(server.requests, server.completedOnRequest);
+    EXPECT_EQ(expected.size(), stream.GetSentBytes());
+    EXPECT_EQ(expected.size(), stream.GetTotalLength());
+    EXPECT_EQ(0u, stream.GetQueuedBytes());
+}
+
+TEST(FPPUploadStream, LargeTailIsSplitIntoChunks) {
+    FPPUploadStream stream("test.fseq", 1000);
+    UploadStandIn server;
+    std::vector<uint8_t> expected = StreamFile(stream, server, 64, 4500, 10000);
+    EXPECT_EQ(0, server.requests);
+    EXPECT_EQ(4564u, stream.GetQueuedBytes());
+
+    EXPECT_EQ(FPPUploadStream::Result::DONE, Pump(stream, server));
+    EXPECT_EQ(expected, server.file);
+    // four full chunks, the header and the last 500 bytes
+    EXPECT_EQ(6, server.requests);
+    EXPECT_EQ(server.requests, server.completedOnRequest);
+}
+
+TEST(FPPUploadStream, RetriesFailedRequests) {
+    FPPUploadStream stream("test.fseq", 1000);
+    UploadStandIn server;
+    server.failNext = FPPUploadStream::MAX_RETRIES;
+    std::vector<uint8_t> expected = StreamFile(stream, server, 64, 3000, 700);
+
+    EXPECT_EQ(FPPUploadStream::Result::DONE, Pump(stream, server));
+    EXPECT_EQ(expected, server.file);
+    EXPECT_FALSE(stream.IsFailed());
+}
+
+TEST(FPPUploadStream, GivesUpAfterTooManyFailures) {
+    FPPUploadStream stream("test.fseq", 1000);
+    UploadStandIn server;
+    server.failNext = FPPUploadStream::MAX_RETRIES + 1;
+    StreamFile(stream, server, 64, 3000, 10000);
+
+    EXPECT_EQ(FPPUploadStream::Result::FAILED, Pump(stream, server));
+    EXPECT_TRUE(stream.IsFailed());
+    EXPECT_EQ(0u, stream.GetQueuedBytes());
+    EXPECT_EQ(FPPUploadStream::MAX_RETRIES + 1, server.requests);
+    EXPECT_EQ(0, server.completedOnRequest);
+}
+
+TEST(FPPUploadStream, OnlyOneRequestAtATime) {
+    FPPUploadStream stream("test.fseq", 1000);
+    std::vector<uint8_t> a = MakeData(100, 1);
+    std::vector<uint8_t> b = MakeData(100, 2);
+    stream.Add(64, a);
+    stream.Add(164, b);
+
+    uint64_t offset;
+    std::vector<uint8_t> data;
+    std::vector<std::string> headers;
+    EXPECT_TRUE(stream.Next(offset, data, headers));
+    EXPECT_EQ(64u, offset);
+    EXPECT_FALSE(stream.Next(offset, data, headers));
+    EXPECT_EQ(FPPUploadStream::Result::RETRY, stream.OnResponse(500));
+    // the failed piece goes again
+    EXPECT_TRUE(stream.Next(offset, data, headers));
+    EXPECT_EQ(64u, offset);
+    EXPECT_EQ(FPPUploadStream::Result::NEXT, stream.OnResponse(200));
+    EXPECT_TRUE(stream.Next(offset, data, headers));
+    EXPECT_EQ(164u, offset);
+
+    stream.Abandon();
+    EXPECT_EQ(FPPUploadStream::Result::FAILED, stream.OnResponse(200));
+    EXPECT_FALSE(stream.Next(offset, data, headers));
+}
@@ -0,0 +1,135 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <cstdint>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "../xLights/controllers/FSEQBlockManifest.h"
+
+// a 100 byte header and index, four blocks and 20 bytes of variable headers at the end
+static FSEQBlockManifest MakeManifest(uint64_t id, const std::vector<uint64_t>& hashes, const std::vector<uint64_t>& lengths)
+{
+    std::vector<std::pair<uint32_t, uint64_t>> offsets;
+    uint64_t offset = 100;
+    for (size_t x = 0; x < lengths.size(); x++) {
+        offsets.emplace_back((uint32_t)(x * 10), offset);
+        offset += lengths[x];
+    }
+    FSEQBlockManifest m;
+    EXPECT_TRUE(m.Build(id, offset + 20, offsets, hashes, offset));
+    return m;
+}
+
+TEST(FSEQBlockManifest, Build)
+{
+    auto m = MakeManifest(7, { 1, 2, 3, 4 }, { 50, 60, 70, 80 });
+    EXPECT_EQ(7u, m.uniqueId);
+    EXPECT_EQ(100u, m.dataOffset);
+    EXPECT_EQ(360u, m.dataEnd);
+    EXPECT_EQ(380u, m.fileSize);
+    ASSERT_EQ(4u, m.blocks.size());
+    EXPECT_EQ(210u, m.blocks[2].offset);
+    EXPECT_EQ(70u, m.blocks[2].length);
+    EXPECT_EQ(3u, m.blocks[2].hash);
+
+    // hashes have to line up with the blocks
+    FSEQBlockManifest bad;
+    EXPECT_FALSE(bad.Build(7, 380, { { 0, 100 }, { 10, 150 } }, { 1 }, 360));
+    EXPECT_FALSE(bad.Build(7, 380, {}, {}, 360));
+    // and the data has to fit in the file
+    EXPECT_FALSE(bad.Build(7, 300, { { 0, 100 } }, { 1 }, 360));
+}
+
+TEST(FSEQBlockManifest, SaveAndLoad)
+{
+    auto m = MakeManifest(0xFFFFFFFFFFFFull, { 0xcbf29ce484222325ULL, 2, 0, 4 }, { 50, 60, 70, 80 });
+    std::stringstream s;
+    ASSERT_TRUE(m.Save(s));
+
+    FSEQBlockManifest loaded;
+    ASSERT_TRUE(loaded.Load(s));
+    EXPECT_EQ(m.uniqueId, loaded.uniqueId);
+    EXPECT_EQ(m.fileSize, loaded.fileSize);
+    EXPECT_EQ(m.dataOffset, loaded.dataOffset);
+    EXPECT_EQ(m.dataEnd, loaded.dataEnd);
+    ASSERT_EQ(m.blocks.size(), loaded.blocks.size());
+    for (size_t x = 0; x < m.blocks.size(); x++) {
+        EXPECT_EQ(m.blocks[x].offset, loaded.blocks[x].offset);
+        EXPECT_EQ(m.blocks[x].length, loaded.blocks[x].length);
+        EXPECT_EQ(m.blocks[x].hash, loaded.blocks[x].hash);
+    }
+}
+
+TEST(FSEQBlockManifest, LoadRejectsDamagedFiles)
+{
+    FSEQBlockManifest m;
+    std::istringstream wrongMagic("somethingElse 1\n1 2 3 4 0\n");
+    EXPECT_FALSE(m.Load(wrongMagic));
+    std::istringstream wrongVersion("xLightsFSEQManifest 2\n1 2 3 4 0\n");
+    EXPECT_FALSE(m.Load(wrongVersion));
+    std::istringstream truncated("xLightsFSEQManifest 1\n1 380 100 360 4\n100 50 1\n150 60 2\n");
+    EXPECT_FALSE(m.Load(truncated));
+    EXPECT_TRUE(m.blocks.empty());
+}
+
+TEST(FSEQBlockManifest, PatchCopiesUnchangedBlocks)
+{
+    auto previous = MakeManifest(1, { 1, 2, 3, 4 }, { 50, 60, 70, 80 });
+    // block 2 changed and got longer
+    auto current = MakeManifest(2, { 1, 2, 9, 4 }, { 50, 60, 75, 80 });
+
+    std::vector<FSEQBlockManifest::PatchOp> ops;
+    uint64_t sending = current.BuildPatch(previous, ops);
+    ASSERT_EQ(5u, ops.size());
+    // header and index always go
+    EXPECT_FALSE(ops[0].copy);
+    EXPECT_EQ(0u, ops[0].offset);
+    EXPECT_EQ(100u, ops[0].length);
+    // the first two blocks are next to each other in the old file so they are one copy
+    EXPECT_TRUE(ops[1].copy);
+    EXPECT_EQ(100u, ops[1].offset);
+    EXPECT_EQ(110u, ops[1].length);
+    EXPECT_FALSE(ops[2].copy);
+    EXPECT_EQ(210u, ops[2].offset);
+    EXPECT_EQ(75u, ops[2].length);
+    // the last block comes from where it was in the old file
+    EXPECT_TRUE(ops[3].copy);
+    EXPECT_EQ(280u, ops[3].offset);
+    EXPECT_EQ(80u, ops[3].length);
+    // and the variable headers after the data
+    EXPECT_FALSE(ops[4].copy);
+    EXPECT_EQ(365u, ops[4].offset);
+    EXPECT_EQ(20u, ops[4].length);
+    EXPECT_EQ(195u, sending);
+
+    // the ops cover the new file from start to end
+    uint64_t total = 0;
+    for (const auto& op : ops) {
+        total += op.length;
+    }
+    EXPECT_EQ(current.fileSize, total);
+}
+
+TEST(FSEQBlockManifest, PatchOfUnrelatedFileSendsEverything)
+{
+    auto previous = MakeManifest(1, { 1, 2, 3, 4 }, { 50, 60, 70, 80 });
+    auto current = MakeManifest(2, { 5, 6, 7, 8 }, { 50, 60, 70, 80 });
+
+    std::vector<FSEQBlockManifest::PatchOp> ops;
+    EXPECT_EQ(current.fileSize, current.BuildPatch(previous, ops));
+    // all sends of consecutive ranges so one op
+    ASSERT_EQ(1u, ops.size());
+    EXPECT_FALSE(ops[0].copy);
+    EXPECT_EQ(current.fileSize, ops[0].length);
+}
@@ -0,0 +1,109 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "../xLights/effects/ParticlePool.h"
+
+TEST(ParticlePool, MoveAndAccelerate)
+{
+    ParticlePool<int> pool;
+    pool.Add(10, 20, -1, 0, 1);
+    pool.Add(5, 5, 0.5f, -2, 2);
+
+    pool.Move(4);
+    EXPECT_FLOAT_EQ(pool.x[0], 6);
+    EXPECT_FLOAT_EQ(pool.y[0], 20);
+    EXPECT_FLOAT_EQ(pool.x[1], 7);
+    EXPECT_FLOAT_EQ(pool.y[1], -3);
+
+    pool.Accelerate(0, 1);
+    EXPECT_FLOAT_EQ(pool.vy[1], -1);
+    EXPECT_FLOAT_EQ(pool.y[1], -4);
+    EXPECT_FLOAT_EQ(pool.x[1], 7.5f);
+    EXPECT_EQ(pool.age[0], 2);
+    EXPECT_EQ(pool.age[1], 2);
+}
+
+TEST(ParticlePool, RemoveIfKeepsParticlesTogether)
+{
+    ParticlePool<int> pool;
+    for (int i = 0; i < 10; i++) {
+        pool.Add(i, -i, 0, 0, i * 100, i);
+    }
+
+    size_t removed = pool.RemoveIf([](const ParticlePool<int>& p, size_t i) { return p.param[i] % 3 == 0; });
+    EXPECT_EQ(removed, (size_t)4);
+    ASSERT_EQ(pool.Size(), (size_t)6);
+
+    // whatever order they end up in every field of a particle moved with it
+    std::vector<int> left;
+    for (size_t i = 0; i < pool.Size(); i++) {
+        int p = pool.param[i];
+        EXPECT_FLOAT_EQ(pool.x[i], p);
+        EXPECT_FLOAT_EQ(pool.y[i], -p);
+        EXPECT_EQ(pool.colour[i], p * 100);
+        EXPECT_EQ(pool.seed[i], (uint32_t)p);
+        left.push_back(p);
+    }
+    std::sort(left.begin(), left.end());
+    EXPECT_EQ(left, std::vector<int>({ 1, 2, 4, 5, 7, 8 }));
+
+    // seeds start again after a clear so an effect restarting gets the same seeds as the first time
+    pool.Clear();
+    EXPECT_TRUE(pool.Empty());
+    pool.Add(0, 0, 0, 0, 0);
+    pool.Add(0, 0, 0, 0, 0);
+    EXPECT_EQ(pool.seed[0], (uint32_t)0);
+    EXPECT_EQ(pool.seed[1], (uint32_t)1);
+}
+
+// what the meteors draw passes do, hues for every tail pixel picked on worker threads, has to come out the same
+// every time the frame is rendered
+static std::vector<int> DrawTails(int threads)
+{
+    ParticlePool<int> pool;
+    for (int i = 0; i < 50; i++) {
+        pool.Add(i, 0, 0, 1, 0);
+    }
+    const int tail = 20;
+    std::vector<int> hues(pool.Size() * (tail + 1));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&pool, &hues, t, threads]() {
+            for (size_t n = t; n < pool.Size(); n += threads) {
+                for (int ph = 0; ph <= tail; ph++) {
+                    hues[n * (tail + 1) + ph] = ParticleHash(pool.seed[n], ph, 7) % 1000;
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    return hues;
+}
+
+TEST(ParticlePool, HashedDrawIsTheSameEveryRender)
+{
+    auto first = DrawTails(1);
+    EXPECT_EQ(first, DrawTails(4));
+    EXPECT_EQ(first, DrawTails(7));
+
+    // and it still looks random
+    std::sort(first.begin(), first.end());
+    EXPECT_GT(std::unique(first.begin(), first.end()) - first.begin(), 500);
+    EXPECT_NE(ParticleHash(1, 2, 3), ParticleHash(1, 2, 4));
+    EXPECT_NE(ParticleHash(1, 2, 3), ParticleHash(2, 2, 3));
+}
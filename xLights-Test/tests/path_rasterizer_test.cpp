@@ -0,0 +1,162 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+
+#include "../xLights/PathRasterizer.h"
+
+// collects the coverage into a width x height grid
+struct CoverageGrid {
+    CoverageGrid(int w, int h) :
+        width(w), height(h), coverage(w * h, 0) {}
+
+    PathRasterizer::SpanFunc Func()
+    {
+        return [this](int y, int x, int count, const uint8_t* c) {
+            EXPECT_GE(y, 0);
+            EXPECT_LT(y, height);
+            EXPECT_GE(x, 0);
+            EXPECT_LE(x + count, width);
+            for (int i = 0; i < count; ++i) {
+                coverage[y * width + x + i] = c[i];
+            }
+        };
+    }
+    int At(int x, int y) const { return coverage[y * width + x]; }
+    double Area() const
+    {
+        double a = 0;
+        for (auto c : coverage) {
+            a += c / 255.0;
+        }
+        return a;
+    }
+
+    int width;
+    int height;
+    std::vector<uint8_t> coverage;
+};
+
+TEST(PathRasterizer, FillsWholePixelsExactly)
+{
+    PathRasterizer path(8, 8);
+    path.AddPolygon({ { 1, 2 }, { 4, 2 }, { 4, 5 }, { 1, 5 } });
+    CoverageGrid grid(8, 8);
+    path.Fill(PathRasterizer::FillRule::NonZero, grid.Func());
+
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            bool inside = x >= 1 && x < 4 && y >= 2 && y < 5;
+            EXPECT_EQ(grid.At(x, y), inside ? 255 : 0) << x << "," << y;
+        }
+    }
+}
+
+TEST(PathRasterizer, PartialPixelsGetPartialCoverage)
+{
+    PathRasterizer path(8, 4);
+    path.AddPolygon({ { 1.5f, 1 }, { 3.5f, 1 }, { 3.5f, 2 }, { 1.5f, 2 } });
+    CoverageGrid grid(8, 4);
+    path.Fill(PathRasterizer::FillRule::NonZero, grid.Func());
+
+    EXPECT_NEAR(grid.At(1, 1), 128, 1);
+    EXPECT_EQ(grid.At(2, 1), 255);
+    EXPECT_NEAR(grid.At(3, 1), 128, 1);
+    EXPECT_EQ(grid.At(4, 1), 0);
+    EXPECT_EQ(grid.At(2, 0), 0);
+}
+
+TEST(PathRasterizer, CircleCoversItsArea)
+{
+    PathRasterizer path(40, 40);
+    path.AddCircle(20, 20, 12);
+    CoverageGrid grid(40, 40);
+    path.Fill(PathRasterizer::FillRule::NonZero, grid.Func());
+
+    const double area = 3.14159265358979 * 12 * 12;
+    EXPECT_NEAR(grid.Area(), area, area * 0.01);
+    EXPECT_EQ(grid.At(20, 20), 255);
+    EXPECT_EQ(grid.At(2, 2), 0);
+}
+
+TEST(PathRasterizer, FillRules)
+{
+    // two squares wound the same way, the inner one is a hole only under even odd
+    PathRasterizer path(10, 10);
+    path.AddPolygon({ { 1, 1 }, { 9, 1 }, { 9, 9 }, { 1, 9 } });
+    path.AddPolygon({ { 3, 3 }, { 7, 3 }, { 7, 7 }, { 3, 7 } });
+
+    CoverageGrid nonZero(10, 10);
+    path.Fill(PathRasterizer::FillRule::NonZero, nonZero.Func());
+    EXPECT_EQ(nonZero.At(5, 5), 255);
+    EXPECT_EQ(nonZero.At(2, 2), 255);
+
+    CoverageGrid evenOdd(10, 10);
+    path.Fill(PathRasterizer::FillRule::EvenOdd, evenOdd.Func());
+    EXPECT_EQ(evenOdd.At(5, 5), 0);
+    EXPECT_EQ(evenOdd.At(2, 2), 255);
+}
+
+TEST(PathRasterizer, ConcavePolygon)
+{
+    // a U shape, the notch stays empty
+    PathRasterizer path(10, 10);
+    path.AddPolygon({ { 1, 1 }, { 9, 1 }, { 9, 9 }, { 6, 9 }, { 6, 4 }, { 4, 4 }, { 4, 9 }, { 1, 9 } });
+    CoverageGrid grid(10, 10);
+    path.Fill(PathRasterizer::FillRule::NonZero, grid.Func());
+
+    EXPECT_EQ(grid.At(2, 6), 255);
+    EXPECT_EQ(grid.At(5, 6), 0);
+    EXPECT_EQ(grid.At(7, 6), 255);
+    EXPECT_EQ(grid.At(5, 2), 255);
+}
+
+TEST(PathRasterizer, StrokeOverlapsDontCancel)
+{
+    // a stroke doubling back over itself is still solid
+    PathRasterizer path(12, 8);
+    path.MoveTo(2, 4);
+    path.LineTo(10, 4);
+    path.LineTo(3, 4);
+    CoverageGrid grid(12, 8);
+    path.Stroke(2, grid.Func());
+
+    for (int x = 2; x < 10; ++x) {
+        EXPECT_EQ(grid.At(x, 3), 255) << x;
+        EXPECT_EQ(grid.At(x, 4), 255) << x;
+    }
+    EXPECT_EQ(grid.At(6, 1), 0);
+    EXPECT_EQ(grid.At(6, 6), 0);
+    // round caps reach past the ends
+    EXPECT_GT(grid.At(1, 3), 0);
+    EXPECT_GT(grid.At(10, 4), 0);
+}
+
+TEST(PathRasterizer, CurvesAndClipping)
+{
+    // mostly off the buffer, only the visible part is reported
+    PathRasterizer path(10, 10);
+    path.MoveTo(-20, -20);
+    path.CurveTo(30, -20, 30, 30, -20, 30);
+    path.QuadTo(-40, 5, -20, -20);
+    path.ClosePath();
+    CoverageGrid grid(10, 10);
+    path.Fill(PathRasterizer::FillRule::NonZero, grid.Func());
+    EXPECT_EQ(grid.At(0, 5), 255);
+
+    path.Clear();
+    EXPECT_TRUE(path.IsEmpty());
+    CoverageGrid empty(10, 10);
+    path.Fill(PathRasterizer::FillRule::NonZero, empty.Func());
+    EXPECT_EQ(empty.Area(), 0.0);
+}
@@ -0,0 +1,96 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include "../xLights/RenderCheckpoints.h"
+
+class TestCheckpoint : public RenderLayerCheckpoint {
+public:
+    TestCheckpoint(int v, size_t size = 1024) : value(v), _size(size) {}
+    virtual size_t GetSize() const override { return _size; }
+    int value;
+
+private:
+    size_t _size;
+};
+
+static std::shared_ptr<RenderLayerCheckpoint> MakeCheckpoint(int v, size_t size = 1024) {
+    return std::make_shared<TestCheckpoint>(v, size);
+}
+
+static int ValueOf(const std::shared_ptr<RenderLayerCheckpoint>& cp) {
+    return cp == nullptr ? -1 : ((TestCheckpoint*)cp.get())->value;
+}
+
+TEST(RenderCheckpointStore, FindsLatestCheckpointInRange)
+{
+    RenderCheckpointStore store;
+    store.Save("Matrix", 0, 100, "Life", MakeCheckpoint(100));
+    store.Save("Matrix", 0, 200, "Life", MakeCheckpoint(200));
+    store.Save("Matrix", 0, 300, "Life", MakeCheckpoint(300));
+    store.Save("Matrix", 1, 250, "Life", MakeCheckpoint(1250));
+
+    int frame = 0;
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 1, 299, "Life", frame)), 200);
+    EXPECT_EQ(frame, 200);
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 1, 300, "Life", frame)), 300);
+    EXPECT_EQ(frame, 300);
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 1, 1, 1000, "Life", frame)), 1250);
+
+    // nothing inside the effect
+    EXPECT_EQ(store.Find("Matrix", 0, 150, 199, "Life", frame), nullptr);
+    EXPECT_EQ(frame, -1);
+    EXPECT_EQ(store.Find("Arch", 0, 0, 1000, "Life", frame), nullptr);
+    EXPECT_EQ(store.GetCount(), (size_t)4);
+}
+
+TEST(RenderCheckpointStore, ChangedEffectDropsStaleCheckpoints)
+{
+    RenderCheckpointStore store;
+    store.Save("Matrix", 0, 100, "Meteors|1", MakeCheckpoint(100));
+    store.Save("Matrix", 0, 200, "Meteors|1", MakeCheckpoint(200));
+    store.Save("Matrix", 0, 300, "Twinkle", MakeCheckpoint(300));
+
+    // the effect was edited so its checkpoints are no use, the one after the effect belongs to something else
+    int frame = 0;
+    EXPECT_EQ(store.Find("Matrix", 0, 1, 250, "Meteors|2", frame), nullptr);
+    EXPECT_EQ(store.GetCount(), (size_t)1);
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 251, 300, "Twinkle", frame)), 300);
+
+    // saving at the same frame replaces what was there
+    store.Save("Matrix", 0, 300, "Twinkle", MakeCheckpoint(301));
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 251, 300, "Twinkle", frame)), 301);
+    EXPECT_EQ(store.GetCount(), (size_t)1);
+    EXPECT_EQ(store.GetSize(), (size_t)1024);
+}
+
+TEST(RenderCheckpointStore, DropsLeastRecentlyUsedWhenFull)
+{
+    RenderCheckpointStore store(1);
+    const size_t size = 400 * 1024;
+    store.Save("Matrix", 0, 100, "Life", MakeCheckpoint(100, size));
+    store.Save("Matrix", 0, 200, "Life", MakeCheckpoint(200, size));
+
+    // using the first keeps it so the second goes when the third arrives
+    int frame = 0;
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 1, 199, "Life", frame)), 100);
+    store.Save("Arch", 0, 100, "Fire", MakeCheckpoint(300, size));
+
+    EXPECT_EQ(store.GetCount(), (size_t)2);
+    EXPECT_LE(store.GetSize(), (size_t)1024 * 1024);
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 150, 250, "Life", frame)), -1);
+    EXPECT_EQ(ValueOf(store.Find("Matrix", 0, 1, 250, "Life", frame)), 100);
+    EXPECT_EQ(ValueOf(store.Find("Arch", 0, 1, 250, "Fire", frame)), 300);
+
+    store.Purge();
+    EXPECT_EQ(store.GetCount(), (size_t)0);
+    EXPECT_EQ(store.GetSize(), (size_t)0);
+}
@@ -0,0 +1,163 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../xLights/RenderTaskGraph.h"
+
+// Minimal pool that runs whatever the graph schedules
+class TestTaskPool {
+public:
+    TestTaskPool(RenderTaskGraph& graph, int threads) : _graph(graph) {
+        for (int i = 0; i < threads; ++i) {
+            _threads.emplace_back([this]() { Work(); });
+        }
+    }
+
+    ~TestTaskPool() {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _stop = true;
+        }
+        _signal.notify_all();
+        for (auto& it : _threads) {
+            it.join();
+        }
+    }
+
+    void Push(RenderTaskGraph::Task* task) {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _queue.push_back(task);
+        }
+        _signal.notify_one();
+    }
+
+private:
+    void Work() {
+        while (true) {
+            RenderTaskGraph::Task* task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(_lock);
+                _signal.wait(lock, [this]() { return _stop || !_queue.empty(); });
+                if (_queue.empty()) {
+                    return;
+                }
+                task = _queue.front();
+                _queue.pop_front();
+            }
+            _graph.Run(task);
+        }
+    }
+
+    RenderTaskGraph& _graph;
+    std::vector<std::thread> _threads;
+    std::deque<RenderTaskGraph::Task*> _queue;
+    std::mutex _lock;
+    std::condition_variable _signal;
+    bool _stop = false;
+};
+
+static void WaitForGraph(const RenderTaskGraph& graph) {
+    while (!graph.IsComplete()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST(RenderTaskGraph, RunsTasksAfterTheirDependencies)
+{
+    // three models over four frame ranges where model 1 and 2 both overlap model 0
+    const int models = 3;
+    const int chunks = 4;
+    RenderTaskGraph graph;
+    std::mutex lock;
+    std::vector<std::pair<int, int>> order;
+    std::vector<std::vector<RenderTaskGraph::Task*>> tasks(models);
+    for (int m = 0; m < models; ++m) {
+        for (int c = 0; c < chunks; ++c) {
+            auto task = graph.AddTask("Model" + std::to_string(m), c * 10, c * 10 + 9, [&lock, &order, m, c]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::unique_lock<std::mutex> l(lock);
+                order.emplace_back(m, c);
+            });
+            if (c > 0) {
+                EXPECT_TRUE(graph.AddDependency(tasks[m].back(), task));
+            }
+            if (m > 0) {
+                EXPECT_TRUE(graph.AddDependency(tasks[0][c], task));
+            }
+            tasks[m].push_back(task);
+        }
+    }
+    EXPECT_FALSE(graph.AddDependency(tasks[0][0], tasks[1][0]));
+    EXPECT_EQ(graph.GetTaskCount(), (size_t)(models * chunks));
+
+    {
+        TestTaskPool pool(graph, 4);
+        graph.Start([&pool](RenderTaskGraph::Task* task) { pool.Push(task); });
+        WaitForGraph(graph);
+    }
+
+    ASSERT_EQ(order.size(), (size_t)(models * chunks));
+    auto position = [&order](int m, int c) {
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (order[i].first == m && order[i].second == c) return (int)i;
+        }
+        return -1;
+    };
+    for (int m = 0; m < models; ++m) {
+        for (int c = 0; c < chunks; ++c) {
+            if (c > 0) {
+                EXPECT_LT(position(m, c - 1), position(m, c));
+            }
+            if (m > 0) {
+                EXPECT_LT(position(0, c), position(m, c));
+            }
+        }
+    }
+}
+
+TEST(RenderTaskGraph, TimingsMarkTheCriticalPath)
+{
+    RenderTaskGraph graph;
+    auto slow = graph.AddTask("Slow", 0, 9, []() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+    auto fast = graph.AddTask("Fast", 0, 9, []() {});
+    auto last = graph.AddTask("Group", 0, 9, []() {});
+    graph.AddDependency(slow, last);
+    graph.AddDependency(fast, last);
+
+    {
+        TestTaskPool pool(graph, 2);
+        graph.Start([&pool](RenderTaskGraph::Task* task) { pool.Push(task); });
+        WaitForGraph(graph);
+    }
+
+    auto timings = graph.GetTimings();
+    ASSERT_EQ(timings.size(), (size_t)3);
+    for (const auto& it : timings) {
+        EXPECT_LE(it.readyMS, it.startMS);
+        EXPECT_LE(it.startMS, it.endMS);
+        EXPECT_EQ(it.critical, it.name != "Fast");
+    }
+}
+
+TEST(RenderTaskGraph, EmptyGraphIsComplete)
+{
+    RenderTaskGraph graph;
+    graph.Start([](RenderTaskGraph::Task*) { FAIL(); });
+    EXPECT_TRUE(graph.IsComplete());
+    EXPECT_TRUE(graph.GetTimings().empty());
+}
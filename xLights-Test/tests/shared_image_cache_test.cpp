@@ -0,0 +1,94 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <string>
+
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/imaggif.h>
+#include <wx/image.h>
+#include <wx/init.h>
+#include <wx/wfstream.h>
+
+#include "../xLights/effects/SharedImageCache.h"
+
+struct SharedImageCacheTests : public ::testing::Test
+{
+    wxInitializer init;
+    std::string still;
+    std::string other;
+    std::string gif;
+
+    void SetUp() override
+    {
+        wxInitAllImageHandlers();
+        std::string dir = wxFileName::GetTempDir().ToStdString() + wxString(wxFileName::GetPathSeparator()).ToStdString();
+        still = dir + "xlights_image_cache_test_still.png";
+        other = dir + "xlights_image_cache_test_other.png";
+        gif = dir + "xlights_image_cache_test.gif";
+
+        ASSERT_TRUE(wxImage(64, 48).SaveFile(still, wxBITMAP_TYPE_PNG));
+        ASSERT_TRUE(wxImage(32, 32).SaveFile(other, wxBITMAP_TYPE_PNG));
+
+        wxImageArray frames;
+        for (int i = 0; i < 3; i++) {
+            wxImage frame(40, 30);
+            frame.SetRGB(wxRect(i * 10, 0, 10, 30), 255, 0, 0);
+            frames.Add(frame);
+        }
+        wxFileOutputStream out(gif);
+        ASSERT_TRUE(wxGIFHandler().SaveAnimation(frames, &out, false, 50));
+    }
+
+    void TearDown() override
+    {
+        wxRemoveFile(still);
+        wxRemoveFile(other);
+        wxRemoveFile(gif);
+    }
+};
+
+TEST_F(SharedImageCacheTests, FileOverTheLimitIsKeptWhileInUse)
+{
+    // nothing fits so everything is over the limit
+    SharedImageCache cache(0);
+
+    EXPECT_TRUE(cache.GetFrame(still, 0, true).IsOk());
+    EXPECT_EQ(64u * 48u * 3u, cache.GetSize());
+    // asking again finds it rather than decoding it again
+    EXPECT_TRUE(cache.GetFrame(still, 0, true).IsOk());
+    EXPECT_EQ(64u * 48u * 3u, cache.GetSize());
+
+    // using another file is what drops it
+    EXPECT_TRUE(cache.GetFrame(other, 0, true).IsOk());
+    EXPECT_EQ(32u * 32u * 3u, cache.GetSize());
+}
+
+TEST_F(SharedImageCacheTests, GIFFramesAreCountedAsTheyAreComposed)
+{
+    SharedImageCache cache(0);
+
+    // the header is enough to answer this
+    auto info = cache.GetInfo(gif, true);
+    ASSERT_TRUE(info.ok);
+    EXPECT_EQ(3, info.frames);
+    EXPECT_EQ(0u, cache.GetSize());
+
+    const size_t pixels = 40 * 30;
+    EXPECT_TRUE(cache.GetFrame(gif, 0, true).IsOk());
+    EXPECT_EQ(pixels * 3 + pixels * 4, cache.GetSize());
+    // getting to frame 2 builds frame 1 on the way
+    EXPECT_TRUE(cache.GetFrame(gif, 2, true).IsOk());
+    EXPECT_EQ(pixels * 3 + pixels * 4 * 3, cache.GetSize());
+    EXPECT_TRUE(cache.GetFrame(gif, 1, true).IsOk());
+    EXPECT_EQ(pixels * 3 + pixels * 4 * 3, cache.GetSize());
+}
@@ -0,0 +1,231 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "pch.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../xLights/sequencer/XmlStreamReader.h"
+#include "../xLights/sequencer/XsqEffectStore.h"
+
+// flattens a document to one line per element/attribute/text so two documents can be compared, whitespace only
+// text is dropped like the wx loader does
+class DumpHandler : public XmlStreamReader::Handler
+{
+public:
+    void StartElement(std::string_view name, const std::vector<XmlStreamReader::Attribute>& attributes, size_t start, size_t tagEnd) override
+    {
+        lines.push_back("<" + std::string(name));
+        for (const auto& a : attributes) {
+            if (a.name != XsqEffectStore::LAYER_ATTRIBUTE) {
+                lines.push_back(" " + std::string(a.name) + "=" + a.value);
+            }
+        }
+    }
+    void EndElement(std::string_view name, size_t start, size_t end) override
+    {
+        lines.push_back("</" + std::string(name));
+    }
+    void Text(const std::string& text) override
+    {
+        if (text.find_first_not_of(" \t\r\n") != std::string::npos) {
+            lines.push_back("#" + text);
+        }
+    }
+
+    std::vector<std::string> lines;
+};
+
+static std::vector<std::string> Dump(const std::string& xml)
+{
+    DumpHandler h;
+    std::string error;
+    EXPECT_TRUE(XmlStreamReader::Parse(xml, h, error)) << error;
+    return h.lines;
+}
+
+static const std::string sequence =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<xsequence BaseChannel=\"0\" ChanCtrlBasic=\"0\" ChanCtrlColor=\"0\" FixedPointTiming=\"1\" ModelBlending=\"true\">\n"
+    "  <head>\n"
+    "    <version>2023.01</version>\n"
+    "    <song>Tom &amp; Jerry</song>\n"
+    "  </head>\n"
+    "  <ColorPalettes>\n"
+    "    <ColorPalette>C_BUTTON_Palette1=#FF0000,C_CHECKBOX_Palette1=1</ColorPalette>\n"
+    "  </ColorPalettes>\n"
+    "  <EffectDB>\n"
+    "    <Effect>E_SLIDER_Bars_BarCount=1</Effect>\n"
+    "  </EffectDB>\n"
+    "  <ElementEffects>\n"
+    "    <Element type=\"timing\" name=\"Beats\">\n"
+    "      <EffectLayer>\n"
+    "        <Effect label=\"1\" startTime=\"0\" endTime=\"500\"/>\n"
+    "      </EffectLayer>\n"
+    "    </Element>\n"
+    "    <Element type=\"model\" name=\"Arch &quot;1&quot;\">\n"
+    "      <EffectLayer>\n"
+    "        <Effect ref=\"0\" name=\"Bars\" startTime=\"0\" endTime=\"1000\" palette=\"0\"/>\n"
+    "        <Effect name=\"On\" startTime=\"1000\" endTime=\"2000\">E_TEXTCTRL_Eff_On_Start=100&lt;x&gt;</Effect>\n"
+    "      </EffectLayer>\n"
+    "      <EffectLayer/>\n"
+    "      <Strand index=\"0\">\n"
+    "        <Effect ref=\"0\" name=\"Bars\" startTime=\"2000\" endTime=\"3000\" protected=\"1\"/>\n"
+    "        <Node index=\"3\">\n"
+    "          <Effect ref=\"0\" name=\"Bars\" startTime=\"0\" endTime=\"1000\"/>\n"
+    "        </Node>\n"
+    "      </Strand>\n"
+    "    </Element>\n"
+    "  </ElementEffects>\n"
+    "  <lastView>0</lastView>\n"
+    "</xsequence>\n";
+
+TEST(XmlStreamReader, DecodesEntitiesAndLineEndings)
+{
+    std::string out;
+    XmlStreamReader::Decode("a&amp;b&lt;&gt;&quot;&apos;&#65;&#x42;&#233;", out, false);
+    EXPECT_EQ("a&b<>\"'AB\xC3\xA9", out);
+    XmlStreamReader::Decode("a\r\nb\rc\n", out, false);
+    EXPECT_EQ("a\nb\nc\n", out);
+    XmlStreamReader::Decode("a\r\nb\tc", out, true);
+    EXPECT_EQ("a b c", out);
+}
+
+TEST(XmlStreamReader, RejectsMismatchedTags)
+{
+    DumpHandler h;
+    std::string error;
+    EXPECT_FALSE(XmlStreamReader::Parse("<a><b></a></b>", h, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(XmlStreamReader::Parse("<a>", h, error));
+}
+
+TEST(XsqEffectStore, StripsOnlyModelEffects)
+{
+    XsqEffectStore store;
+    std::string slim;
+    ASSERT_TRUE(store.Strip(sequence, slim));
+
+    // effect layer, node and strand
+    EXPECT_EQ(3u, store.GetLayerCount());
+    EXPECT_EQ(4u, store.GetEffectCount());
+    EXPECT_NE(std::string::npos, slim.find("<Effect label=\"1\" startTime=\"0\" endTime=\"500\"/>"));
+    EXPECT_EQ(std::string::npos, slim.find("name=\"Bars\""));
+    EXPECT_NE(std::string::npos, slim.find("<EffectLayer xlfx=\"0\">"));
+    // the shared table entries stay in the document
+    EXPECT_NE(std::string::npos, slim.find("<Effect>E_SLIDER_Bars_BarCount=1</Effect>"));
+
+    const auto& first = *store.GetLayer(0);
+    ASSERT_EQ(2u, first.size());
+    EXPECT_EQ("Bars", *first[0].GetAttribute("name"));
+    EXPECT_EQ("0", *first[0].GetAttribute("palette"));
+    EXPECT_EQ(nullptr, first[0].content);
+    EXPECT_EQ(nullptr, first[0].GetAttribute("protected"));
+    EXPECT_EQ("E_TEXTCTRL_Eff_On_Start=100<x>", *first[1].content);
+
+    // a strand's own effects are written before its nodes
+    const auto& strand = *store.GetLayer(1);
+    const auto& node = *store.GetLayer(2);
+    ASSERT_EQ(1u, node.size());
+    ASSERT_EQ(1u, strand.size());
+    EXPECT_EQ("1", *strand[0].GetAttribute("protected"));
+    EXPECT_NE(std::string::npos, slim.find("<Strand index=\"0\" xlfx=\"1\">"));
+    EXPECT_NE(std::string::npos, slim.find("<Node index=\"3\" xlfx=\"2\">"));
+
+    // same names and values share one string
+    EXPECT_EQ(first[0].GetAttribute("name"), node[0].GetAttribute("name"));
+    EXPECT_EQ(first[0].attributes[0].first, node[0].attributes[0].first);
+}
+
+TEST(XsqEffectStore, RoundTrip)
+{
+    XsqEffectStore store;
+    std::string slim;
+    ASSERT_TRUE(store.Strip(sequence, slim));
+    std::string restored;
+    ASSERT_TRUE(store.Restore(slim, restored));
+    EXPECT_EQ(Dump(sequence), Dump(restored));
+
+    // and again from what was written back
+    XsqEffectStore again;
+    std::string slim2;
+    ASSERT_TRUE(again.Strip(restored, slim2));
+    EXPECT_EQ(slim, slim2);
+    std::string restored2;
+    ASSERT_TRUE(again.Restore(slim2, restored2));
+    EXPECT_EQ(restored, restored2);
+}
+
+TEST(XsqEffectStore, DroppingEffectsGivesTheSameDocument)
+{
+    // what the loader does when the snapshot is expected to supply the effects
+    XsqEffectStore dropped;
+    std::string slim;
+    ASSERT_TRUE(dropped.Strip(sequence, slim, false));
+    EXPECT_EQ(0u, dropped.GetEffectCount());
+    EXPECT_EQ(0u, dropped.GetStringCount());
+
+    // and the store can be filled in later without rebuilding the document
+    XsqEffectStore store;
+    std::string slim2;
+    ASSERT_TRUE(store.Strip(sequence, slim2));
+    EXPECT_EQ(slim, slim2);
+    EXPECT_EQ(dropped.GetLayerCount(), store.GetLayerCount());
+    EXPECT_NE(0u, store.GetEffectCount());
+}
+
+TEST(XsqEffectStore, LeavesFilesItCannotHandle)
+{
+    XsqEffectStore store;
+    std::string slim = "untouched";
+
+    std::string old = sequence;
+    old.replace(old.find("FixedPointTiming=\"1\" "), 21, "");
+    EXPECT_FALSE(store.Strip(old, slim));
+
+    std::string compressed = sequence;
+    compressed.replace(compressed.find("<lastView>"), 0, "<CompressedData size=\"1\">AA==</CompressedData>");
+    EXPECT_FALSE(store.Strip(compressed, slim));
+
+    EXPECT_FALSE(store.Strip(sequence.substr(0, sequence.size() / 2), slim));
+    EXPECT_TRUE(store.IsEmpty());
+    EXPECT_EQ("untouched", slim);
+}
+
+TEST(XsqEffectStore, LargeSequenceLoad)
+{
+    // 500 models x 200 effects, the size of sequence that takes seconds through the full document load
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<xsequence FixedPointTiming=\"1\">\n  <ElementEffects>\n";
+    for (int m = 0; m < 500; m++) {
+        xml += "    <Element type=\"model\" name=\"Model " + std::to_string(m) + "\">\n      <EffectLayer>\n";
+        for (int e = 0; e < 200; e++) {
+            xml += "        <Effect ref=\"" + std::to_string(e % 40) + "\" name=\"Bars\" id=\"" + std::to_string(m * 200 + e) +
+                   "\" startTime=\"" + std::to_string(e * 50) + "\" endTime=\"" + std::to_string(e * 50 + 50) + "\" palette=\"" + std::to_string(e % 7) + "\"/>\n";
+        }
+        xml += "      </EffectLayer>\n    </Element>\n";
+    }
+    xml += "  </ElementEffects>\n</xsequence>\n";
+
+    XsqEffectStore store;
+    std::string slim;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(store.Strip(xml, slim));
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    RecordProperty("StripMS", (int)ms);
+    printf("Stripped %d effects from %dKB in %0.1fms, %d distinct strings, %dKB left for the document.\n",
+           (int)store.GetEffectCount(), (int)(xml.size() / 1024), ms, (int)store.GetStringCount(), (int)(slim.size() / 1024));
+
+    EXPECT_EQ(100000u, store.GetEffectCount());
+    EXPECT_LT(slim.size() * 50, xml.size());
+    // ids are unique, times and the rest are shared
+    EXPECT_LT(store.GetStringCount(), 100000u + 20000u);
+}
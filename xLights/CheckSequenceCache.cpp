@@ -0,0 +1,205 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "CheckSequenceCache.h"
+#include "ExternalHooks.h"
+#include "UtilFunctions.h"
+#include "VideoReader.h"
+
+#include <wx/filefn.h>
+
+#include <log4cpp/Category.hh>
+
+CheckSequenceCache& CheckSequenceCache::Instance()
+{
+    static CheckSequenceCache cache;
+    return cache;
+}
+
+CheckSequenceCache::CheckSequenceCache()
+{
+}
+
+CheckSequenceCache::~CheckSequenceCache()
+{
+}
+
+void CheckSequenceCache::StartCheck(const std::string& showDir, const std::string& context)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _files.clear();
+    _disabledOptions.clear();
+
+    if (showDir != _showDir || context != _context) {
+        _effects.clear();
+        _showDir = showDir;
+        _context = context;
+    } else {
+        // anything the last check didn't look at belongs to an effect that has since changed or gone
+        for (auto it = _effects.begin(); it != _effects.end();) {
+            if (it->second.lastCheck != _check) {
+                it = _effects.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    ++_check;
+
+    logger_base.debug("CheckSequenceCache: %d effect results carried over from the last check.", (int)_effects.size());
+}
+
+void CheckSequenceCache::SetOptionDisabled(const std::string& option, bool disabled)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _disabledOptions[option] = disabled;
+}
+
+bool CheckSequenceCache::IsOptionDisabled(const std::string& option)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _disabledOptions.find(option);
+    return it != _disabledOptions.end() && it->second;
+}
+
+CheckSequenceCache::FileState CheckSequenceCache::GetFileState(const std::string& filename)
+{
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _files.find(filename);
+        if (it != _files.end()) {
+            return it->second;
+        }
+    }
+
+    // probed without the lock so checks of different files dont queue behind a slow disk, two threads asking
+    // about the same file at once both probe it which is harmless
+    FileState state;
+    state.exists = ::FileExists(filename);
+    if (state.exists) {
+        state.modified = (int64_t)wxFileModificationTime(filename);
+    }
+
+    std::unique_lock<std::mutex> lock(_lock);
+    return _files.emplace(filename, state).first->second;
+}
+
+bool CheckSequenceCache::FileExists(const std::string& filename)
+{
+    if (filename == "") {
+        return false;
+    }
+    return GetFileState(filename).exists;
+}
+
+bool CheckSequenceCache::IsFileInShowDir(const std::string& filename)
+{
+    FileState state = GetFileState(filename);
+    if (state.inShowDir >= 0) {
+        return state.inShowDir == 1;
+    }
+
+    std::string showDir;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        showDir = _showDir;
+    }
+    bool inShowDir = ::IsFileInShowDir(showDir, filename);
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _files[filename].inShowDir = inShowDir ? 1 : 0;
+    return inShowDir;
+}
+
+CheckSequenceCache::VideoInfo CheckSequenceCache::GetVideoInfo(const std::string& filename)
+{
+    FileState state = GetFileState(filename);
+    if (!state.exists) {
+        return VideoInfo();
+    }
+
+    // opening a video is the slowest thing a check does so what we learnt is kept until the file changes
+    std::string key = filename + "|" + std::to_string(state.modified);
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _videos.find(key);
+        if (it != _videos.end()) {
+            return it->second;
+        }
+    }
+
+    VideoInfo info;
+    VideoReader* videoreader = new VideoReader(filename, 100, 100, false, true, true);
+    if (videoreader != nullptr) {
+        info.lengthMS = videoreader->GetLengthMS();
+        info.width = videoreader->GetWidth();
+        info.height = videoreader->GetHeight();
+        info.ok = info.lengthMS != 0;
+        delete videoreader;
+    }
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _videos[key] = info;
+    return info;
+}
+
+std::vector<std::pair<std::string, int64_t>> CheckSequenceCache::GetFileStamps(const std::list<std::string>& files)
+{
+    std::vector<std::pair<std::string, int64_t>> res;
+    res.reserve(files.size());
+    for (const auto& f : files) {
+        FileState state = GetFileState(f);
+        res.push_back({ f, state.exists ? state.modified : -1 });
+    }
+    return res;
+}
+
+bool CheckSequenceCache::GetEffectResult(const std::string& signature, const std::list<std::string>& files, std::list<std::string>& result)
+{
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_effects.find(signature) == _effects.end()) {
+            return false;
+        }
+    }
+
+    auto stamps = GetFileStamps(files);
+
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _effects.find(signature);
+    if (it == _effects.end() || it->second.files != stamps) {
+        return false;
+    }
+    it->second.lastCheck = _check;
+    result = it->second.result;
+    return true;
+}
+
+void CheckSequenceCache::SetEffectResult(const std::string& signature, const std::list<std::string>& files, const std::list<std::string>& result)
+{
+    auto stamps = GetFileStamps(files);
+
+    std::unique_lock<std::mutex> lock(_lock);
+    auto& entry = _effects[signature];
+    entry.files = std::move(stamps);
+    entry.result = result;
+    entry.lastCheck = _check;
+}
+
+void CheckSequenceCache::Purge()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _files.clear();
+    _videos.clear();
+    _effects.clear();
+    _context = "";
+}
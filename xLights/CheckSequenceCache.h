@@ -0,0 +1,84 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// What Check Sequence learns about files and effects. Effects run their CheckEffectSettings in parallel and many of
+// them point at the same handful of files so existence, show directory and video probes are answered once per check.
+// The messages each effect's checks produced are kept between checks and handed back while the effect, the files it
+// references and the check context (show directory, models, audio, timing tracks) are unchanged.
+class CheckSequenceCache
+{
+public:
+    struct VideoInfo
+    {
+        bool ok = false;
+        int lengthMS = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    static CheckSequenceCache& Instance();
+
+    CheckSequenceCache();
+    virtual ~CheckSequenceCache();
+
+    // call before each check. File probes only last for one check as files can come and go between them, effect
+    // results from earlier checks are dropped if the context has changed or they weren't used by the last check
+    void StartCheck(const std::string& showDir, const std::string& context);
+    // wxConfig can't be read from the job pool so the check options effects look at are read on the main thread as
+    // the check starts, anything not set here reads as enabled
+    void SetOptionDisabled(const std::string& option, bool disabled);
+    bool IsOptionDisabled(const std::string& option);
+
+    bool FileExists(const std::string& filename);
+    bool IsFileInShowDir(const std::string& filename);
+    VideoInfo GetVideoInfo(const std::string& filename);
+
+    // files are the effect's file references, the result is only reused if they are as they were when it was saved
+    bool GetEffectResult(const std::string& signature, const std::list<std::string>& files, std::list<std::string>& result);
+    void SetEffectResult(const std::string& signature, const std::list<std::string>& files, const std::list<std::string>& result);
+
+    void Purge();
+
+private:
+    struct FileState
+    {
+        bool exists = false;
+        int64_t modified = 0;
+        int inShowDir = -1; // not yet asked
+    };
+
+    struct EffectResult
+    {
+        std::vector<std::pair<std::string, int64_t>> files; // modification time, -1 if the file was missing
+        std::list<std::string> result;
+        uint32_t lastCheck = 0;
+    };
+
+    FileState GetFileState(const std::string& filename);
+    std::vector<std::pair<std::string, int64_t>> GetFileStamps(const std::list<std::string>& files);
+
+    std::mutex _lock;
+    std::string _showDir;
+    std::string _context;
+    uint32_t _check = 0;
+    std::map<std::string, bool> _disabledOptions;
+    std::map<std::string, FileState> _files;
+    std::map<std::string, VideoInfo> _videos;
+    std::map<std::string, EffectResult> _effects;
+};
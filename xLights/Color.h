@@ -15,6 +15,8 @@
 #include <cstdint>
 #include <string>
 
+#include "ColorSpan.h"
+
 #if __has_include(<simd/simd.h>)
 #include <simd/simd.h>
 #endif
@@ -311,6 +313,17 @@ typedef std::vector<xlColor> xlColorVector;
 typedef std::vector<ColorCurve> xlColorCurveVector;
 typedef std::vector<HSVValue> hsvVector;
 
+// xlColor versions of the span conversions in ColorSpan.h
+static_assert(sizeof(xlColor) == 4, "the span conversions need xlColor to be 4 packed bytes");
+inline void HSVToRGBSpan(const float* hue, const float* saturation, const float* value, xlColor* colors, size_t count)
+{
+    HSVToRGBSpan(hue, saturation, value, reinterpret_cast<uint8_t*>(colors), count);
+}
+inline void RGBToHSVSpan(const xlColor* colors, float* hue, float* saturation, float* value, size_t count)
+{
+    RGBToHSVSpan(reinterpret_cast<const uint8_t*>(colors), hue, saturation, value, count);
+}
+
 enum ColorDisplayMode
 {
     MODE_HUE,
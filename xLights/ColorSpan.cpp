@@ -0,0 +1,185 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "ColorSpan.h"
+#include "Simd4.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef SIMD4_VECTOR
+// fromHSV truncates, the clamp just keeps out of range (or nan) input from wrapping
+static inline I4 ToChannels(F4 v)
+{
+    const F4 c = Mul(v, Splat(255.0f));
+    return ToInt(Select(Gt(c, Splat(0.0f)), Select(Lt(c, Splat(255.0f)), c, Splat(255.0f)), Splat(0.0f)));
+}
+
+static inline void HSVToRGB4(const float* hue, const float* saturation, const float* value, uint8_t* rgba)
+{
+    const F4 zero = Splat(0.0f);
+    const F4 one = Splat(1.0f);
+    const F4 h = Mul(Load(hue), Splat(6.0f));
+    const F4 s = Load(saturation);
+    const F4 v = Load(value);
+
+    const F4 fl = Floor(h);
+    const F4 f = Sub(h, fl);
+    // fromHSV treats any sector outside 0-4 as 5, grey falls out as p, q and t all equal v
+    const F4 sector = Select(And(Ge(fl, zero), Lt(fl, Splat(5.0f))), fl, Splat(5.0f));
+    const F4 p = Mul(v, Sub(one, s));
+    const F4 q = Mul(v, Sub(one, Mul(s, f)));
+    const F4 t = Mul(v, Sub(one, Mul(s, Sub(one, f))));
+
+    const M4 s0 = Eq(sector, zero);
+    const M4 s1 = Eq(sector, one);
+    const M4 s2 = Eq(sector, Splat(2.0f));
+    const M4 s3 = Eq(sector, Splat(3.0f));
+    const M4 s4 = Eq(sector, Splat(4.0f));
+    const M4 s5 = Eq(sector, Splat(5.0f));
+
+    const F4 r = Select(Or(s0, s5), v, Select(s4, t, Select(s1, q, p)));
+    const F4 g = Select(s0, t, Select(Or(s1, s2), v, Select(s3, q, p)));
+    const F4 b = Select(Le(sector, one), p, Select(s2, t, Select(s5, q, v)));
+
+    StorePixels(rgba, Pack(ToChannels(r), ToChannels(g), ToChannels(b), LoadPixels(rgba)));
+}
+
+static inline void RGBToHSV4(const uint8_t* rgba, float* hue, float* saturation, float* value)
+{
+    const I4 px = LoadPixels(rgba);
+    const F4 scale = Splat(255.0f);
+    const F4 r = Div(ToFloat(Red(px)), scale);
+    const F4 g = Div(ToFloat(Green(px)), scale);
+    const F4 b = Div(ToFloat(Blue(px)), scale);
+
+    const M4 gb = Lt(g, b);
+    const F4 g1 = Select(gb, b, g);
+    const F4 b1 = Select(gb, g, b);
+    const F4 k1 = Select(gb, Splat(-1.0f), Splat(0.0f));
+
+    const M4 rg = Lt(r, g1);
+    const F4 r2 = Select(rg, g1, r);
+    const F4 g2 = Select(rg, r, g1);
+    const F4 k2 = Select(rg, Sub(Splat(-2.0f / 6.0f), k1), k1);
+    const F4 minGB = Select(rg, Select(Lt(g2, b1), g2, b1), b1);
+
+    const F4 chroma = Sub(r2, minGB);
+    Store(hue, Abs(Add(k2, Div(Sub(g2, b1), Add(Mul(Splat(6.0f), chroma), Splat(1e-20f))))));
+    Store(saturation, Div(chroma, Add(r2, Splat(1e-20f))));
+    Store(value, r2);
+}
+#endif
+
+void HSVToRGBSpan(const float* hue, const float* saturation, const float* value, uint8_t* rgba, size_t count)
+{
+    size_t i = 0;
+#ifdef SIMD4_VECTOR
+    for (; i + 4 <= count; i += 4) {
+        HSVToRGB4(hue + i, saturation + i, value + i, rgba + i * 4);
+    }
+#endif
+    for (; i < count; ++i) {
+        const float h = hue[i] * 6.0f;
+        const float s = saturation[i];
+        const float v = value[i];
+        const float fl = std::floor(std::min(std::max(h, -4194304.0f), 4194304.0f));
+        const float f = h - fl;
+        const float p = v * (1.0f - s);
+        const float q = v * (1.0f - s * f);
+        const float t = v * (1.0f - s * (1.0f - f));
+
+        float r, g, b;
+        switch ((fl >= 0.0f && fl < 5.0f) ? (int)fl : 5) {
+        case 0: r = v; g = t; b = p; break;
+        case 1: r = q; g = v; b = p; break;
+        case 2: r = p; g = v; b = t; break;
+        case 3: r = p; g = q; b = v; break;
+        case 4: r = t; g = p; b = v; break;
+        default: r = v; g = p; b = q; break;
+        }
+        rgba[i * 4] = (uint8_t)std::min(std::max(r * 255.0f, 0.0f), 255.0f);
+        rgba[i * 4 + 1] = (uint8_t)std::min(std::max(g * 255.0f, 0.0f), 255.0f);
+        rgba[i * 4 + 2] = (uint8_t)std::min(std::max(b * 255.0f, 0.0f), 255.0f);
+    }
+}
+
+// same algorithm as toHSV, the vector version does the swaps as selects
+void RGBToHSVSpan(const uint8_t* rgba, float* hue, float* saturation, float* value, size_t count)
+{
+    size_t i = 0;
+#ifdef SIMD4_VECTOR
+    for (; i + 4 <= count; i += 4) {
+        RGBToHSV4(rgba + i * 4, hue + i, saturation + i, value + i);
+    }
+#endif
+    for (; i < count; ++i) {
+        float r = rgba[i * 4] / 255.0f;
+        float g = rgba[i * 4 + 1] / 255.0f;
+        float b = rgba[i * 4 + 2] / 255.0f;
+
+        float k = 0.0f;
+        if (g < b) {
+            std::swap(g, b);
+            k = -1.0f;
+        }
+        float minGB = b;
+        if (r < g) {
+            std::swap(r, g);
+            k = -2.0f / 6.0f - k;
+            minGB = std::min(g, b);
+        }
+        const float chroma = r - minGB;
+        hue[i] = std::abs(k + (g - b) / (6.0f * chroma + 1e-20f));
+        saturation[i] = chroma / (r + 1e-20f);
+        value[i] = r;
+    }
+}
+
+static void AdjustClamped(float* values, size_t count, float adjust)
+{
+    size_t i = 0;
+#ifdef SIMD4_VECTOR
+    const F4 zero = Splat(0.0f);
+    const F4 one = Splat(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        const F4 v = Add(Load(values + i), Splat(adjust));
+        Store(values + i, Select(Gt(v, zero), Select(Lt(v, one), v, one), zero));
+    }
+#endif
+    for (; i < count; ++i) {
+        values[i] = std::min(std::max(values[i] + adjust, 0.0f), 1.0f);
+    }
+}
+
+void AdjustHSVSpan(float* hue, float* saturation, float* value, size_t count, float hueAdjust, float saturationAdjust, float valueAdjust)
+{
+    if (hueAdjust != 0) {
+        size_t i = 0;
+#ifdef SIMD4_VECTOR
+        const F4 zero = Splat(0.0f);
+        const F4 one = Splat(1.0f);
+        for (; i + 4 <= count; i += 4) {
+            const F4 h = Add(Load(hue + i), Splat(hueAdjust));
+            Store(hue + i, Sub(Add(h, Select(Lt(h, zero), one, zero)), Select(Gt(h, one), one, zero)));
+        }
+#endif
+        for (; i < count; ++i) {
+            const float h = hue[i] + hueAdjust;
+            hue[i] = h < 0.0f ? h + 1.0f : (h > 1.0f ? h - 1.0f : h);
+        }
+    }
+    if (saturationAdjust != 0) {
+        AdjustClamped(saturation, count, saturationAdjust);
+    }
+    if (valueAdjust != 0) {
+        AdjustClamped(value, count, valueAdjust);
+    }
+}
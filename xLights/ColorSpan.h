@@ -0,0 +1,29 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+
+// Bulk colour conversion for code that colours a row or a whole buffer at a time. These are the same conversions
+// as xlColor::fromHSV and xlColor::toHSV but done in float over separate hue, saturation and value arrays 4 pixels at a
+// time with SSE2 or NEON. A channel can come out one different to the double
+// versions where the value lands right on a boundary.
+//
+// rgba is 4 bytes a pixel in xlColor order (red, green, blue, alpha) so an xlColor array can be passed straight in.
+// Alpha is never read or written.
+
+void HSVToRGBSpan(const float* hue, const float* saturation, const float* value, uint8_t* rgba, size_t count);
+void RGBToHSVSpan(const uint8_t* rgba, float* hue, float* saturation, float* value, size_t count);
+
+// Shifts hue wrapping it once back into 0-1 and shifts saturation and value clamping them to 0-1, the layer hue,
+// saturation and value adjust. A zero adjust leaves that array alone.
+void AdjustHSVSpan(float* hue, float* saturation, float* value, size_t count, float hueAdjust, float saturationAdjust, float valueAdjust);
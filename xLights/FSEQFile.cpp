@@ -425,7 +425,7 @@ int FSEQFile::seek(uint64_t location, int origin) {
     } else if (origin == SEEK_CUR) {
         m_memoryBufferPos += location;
     } else if (origin == SEEK_END) {
-        m_memoryBufferPos = m_memoryBuffer.size();
+        m_memoryBufferPos = m_memoryBuffer.size() + m_memoryBufferReleased;
     }
     return 0;
 }
@@ -441,14 +441,38 @@ uint64_t FSEQFile::write(const void* ptr, uint64_t size) {
     if (m_seqFile) {
         return fwrite(ptr, 1, size, m_seqFile);
     }
-    if ((m_memoryBufferPos + size) > m_memoryBuffer.size()) {
-        m_memoryBuffer.resize(m_memoryBufferPos + size);
+    uint64_t idx = m_memoryBufferPos;
+    if (m_memoryBufferReleased && idx >= m_seqChanDataOffset) {
+        if (idx < m_seqChanDataOffset + m_memoryBufferReleased) {
+            LogErr(VB_SEQUENCE, "Cannot write to channel data that has already been released %" PRIu64 "\n", idx);
+            return 0;
+        }
+        idx -= m_memoryBufferReleased;
+    }
+    if ((idx + size) > m_memoryBuffer.size()) {
+        m_memoryBuffer.resize(idx + size);
     }
-    memcpy(&m_memoryBuffer[m_memoryBufferPos], ptr, size);
+    memcpy(&m_memoryBuffer[idx], ptr, size);
     m_memoryBufferPos += size;
     return size;
 }
 
+bool FSEQFile::takeWrittenData(std::vector<uint8_t>& data, uint64_t& offset, uint64_t minSize) {
+    data.clear();
+    offset = m_seqChanDataOffset + m_memoryBufferReleased;
+    if (m_seqFile || m_memoryBuffer.size() <= m_seqChanDataOffset) {
+        return false;
+    }
+    uint64_t available = m_memoryBuffer.size() - m_seqChanDataOffset;
+    if (available < minSize || available == 0) {
+        return false;
+    }
+    data.assign(m_memoryBuffer.begin() + m_seqChanDataOffset, m_memoryBuffer.end());
+    m_memoryBuffer.resize(m_seqChanDataOffset);
+    m_memoryBufferReleased += available;
+    return true;
+}
+
 uint64_t FSEQFile::read(void* ptr, uint64_t size) {
     return fread(ptr, 1, size, m_seqFile);
 }
@@ -808,6 +832,14 @@ public:
         return m_file->tell();
     }
     uint64_t write(const void* ptr, uint64_t size) {
+        if (m_hashingBlock) {
+            // FNV-1a over the compressed bytes of the block
+            const uint8_t* p = (const uint8_t*)ptr;
+            for (uint64_t x = 0; x < size; x++) {
+                m_blockHash ^= p[x];
+                m_blockHash *= 0x100000001b3ULL;
+            }
+        }
         return m_file->write(ptr, size);
     }
     uint64_t read(void* ptr, uint64_t size) {
@@ -840,6 +872,9 @@ public:
     uint64_t m_seqChanDataOffset = 0;
     
     std::vector<uint64_t> m_variableHeaderOffsets;
+
+    bool m_hashingBlock = false;
+    uint64_t m_blockHash = 0;
 };
 
 class V2NoneCompressionHandler : public V2Handler {
@@ -950,7 +985,24 @@ public:
         return m_maxBlocks;
     }
 
+    // records the start of a new compression block, everything written until the next
+    // block starts is part of this block's hash
+    void startBlock(uint32_t frame) {
+        endBlock();
+        m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(frame, tell()));
+        m_hashingBlock = true;
+        m_blockHash = 0xcbf29ce484222325ULL;
+    }
+    void endBlock() {
+        if (m_hashingBlock) {
+            m_file->m_blockHashes.push_back(m_blockHash);
+            m_file->m_blockDataEnd = tell();
+            m_hashingBlock = false;
+        }
+    }
+
     virtual void finalize() override {
+        endBlock();
         uint64_t lastFrame = tell();
         uint64_t off = V2FSEQ_HEADER_SIZE;
         seek(off, SEEK_SET);
@@ -1161,9 +1213,8 @@ public:
             m_cctx = ZSTD_createCStream();
         }
         if (m_curFrameInBlock == 0) {
-            uint64_t offset = tell();
-            //LogDebug(VB_SEQUENCE, "  Preparing to create a compressed block of data starting at frame %d, offset  %" PRIu64 ".\n", frame, offset);
-            m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(frame, offset));
+            //LogDebug(VB_SEQUENCE, "  Preparing to create a compressed block of data starting at frame %d, offset  %" PRIu64 ".\n", frame, tell());
+            startBlock(frame);
             int clevel = m_file->m_compressionLevel == -99 ? 2 : m_file->m_compressionLevel;
             if (clevel < -25 || clevel > 25) {
                 clevel = 2;
@@ -1352,8 +1403,7 @@ public:
             m_stream = (z_stream*)calloc(1, sizeof(z_stream));
         }
         if (m_curFrameInBlock == 0) {
-            uint64_t offset = tell();
-            m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(frame, offset));
+            startBlock(frame);
             deflateEnd(m_stream);
             memset(m_stream, 0, sizeof(z_stream));
         }
@@ -104,6 +104,12 @@ public:
 
     const std::vector<uint8_t> &getMemoryBuffer() const { return m_memoryBuffer;}
     uint64_t getMemoryBufferPos() const { return m_memoryBufferPos; }
+
+    //For "-memory-" files being written, moves the channel data written since the
+    //last call into data and returns false if there is less than minSize available.
+    //offset is set to the position of that data in the file.  Only the header area
+    //is kept in the memory buffer as finalize() still needs to update it.
+    bool takeWrittenData(std::vector<uint8_t> &data, uint64_t &offset, uint64_t minSize = 0);
 protected:
     std::string   m_filename;
     uint64_t      m_uniqueId;
@@ -129,6 +135,7 @@ private:
     FILE* volatile  m_seqFile;
     std::vector<uint8_t> m_memoryBuffer;
     uint64_t      m_memoryBufferPos;
+    uint64_t      m_memoryBufferReleased = 0;
 };
 
 
@@ -193,6 +200,10 @@ public:
     std::vector<std::pair<uint32_t, uint32_t>> m_sparseRanges;
     std::vector<std::pair<uint32_t, uint32_t>> m_rangesToRead;
     std::vector<std::pair<uint32_t, uint64_t>> m_frameOffsets;
+    //hash of the compressed data of each block in m_frameOffsets, only filled in when writing
+    std::vector<uint64_t> m_blockHashes;
+    //end of the last compressed block, anything after it is extended variable headers
+    uint64_t m_blockDataEnd = 0;
     uint32_t m_dataBlockSize;
     bool m_allowExtendedBlocks;
 private:
@@ -43,7 +43,7 @@ void xlFont::GatherInfo()
     {
         widths[i] = char_width;
     }
-    wxImage image = bitmap.ConvertToImage();
+    image = bitmap.ConvertToImage();
     for( int y = 0; y < FONT_BITMAP_ROWS; y++)
     {
         int y_pos = (y * (char_height + 1)) + 1;
@@ -72,7 +72,7 @@ FontManager::FontManager()
 
 std::vector<wxBitmap> FontManager::bitmaps;
 std::vector<xlFont> FontManager::fonts;
-bool FontManager::initialized = false;
+std::atomic_bool FontManager::initialized = false;
 wxArrayString FontManager::names;
 
 FontManager::~FontManager()
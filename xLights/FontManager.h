@@ -10,6 +10,7 @@
  * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
  **************************************************************/
 
+#include <atomic>
 #include <vector>
 #include "wx/wx.h"
 
@@ -21,6 +22,7 @@ class xlFont
         xlFont(wxBitmap& bitmap_);
         virtual ~xlFont();
         wxBitmap* get_bitmap() { return &bitmap; }
+        const wxImage& get_image() const { return image; }
         int GetWidth() { return char_width; }
         int GetHeight() { return char_height; }
         int GetCharWidth(int ascii); 
@@ -34,6 +36,7 @@ class xlFont
         int caps_height;  // the capital letter height
         int widths[XL_FONT_WIDTHS];  // the trimmed width of each character
         wxBitmap& bitmap;
+        wxImage image;     // converted once so rendering never touches the platform bitmap
 };
 
 class FontManager
@@ -46,6 +49,7 @@ class FontManager
         }
 
         void init();
+        static bool IsInitialized() { return initialized; }
 
         virtual ~FontManager();
 
@@ -62,6 +66,6 @@ class FontManager
 
         static std::vector<wxBitmap> bitmaps;
         static std::vector<xlFont> fonts;
-        static bool initialized;
+        static std::atomic_bool initialized;
         static wxArrayString names;
 };
@@ -763,10 +763,12 @@ void ModelPreview::Render(uint32_t frameTime, const unsigned char *data, bool sw
         const std::vector<Model*> &models = GetModels();
         std::map<int32_t, std::list<Model*>> sortedModels;
         for (auto m : models) {
-            int NodeCnt = m->GetNodeCount();
-            for (size_t n = 0; n < NodeCnt; ++n) {
-                int start = m->NodeStartChannel(n);
-                m->SetNodeChannelValues(n, &data[start]);
+            if (!m->SetPreviewColorsFromFrame(data)) {
+                int NodeCnt = m->GetNodeCount();
+                for (size_t n = 0; n < NodeCnt; ++n) {
+                    int start = m->NodeStartChannel(n);
+                    m->SetNodeChannelValues(n, &data[start]);
+                }
             }
             auto p = ProjViewMatrix * glm::vec4(m->GetHcenterPos(), m->GetVcenterPos(), m->GetDcenterPos(), 1);
             int z = std::round(p.z * 100);
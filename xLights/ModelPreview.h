@@ -75,9 +75,8 @@ public:
 	void SetbackgroundImage(wxString image);
     const wxString &GetBackgroundImage() const { return mBackgroundImage;}
 	void SetBackgroundBrightness(int brightness, int alpha);
-/*
     int GetBackgroundBrightness() const { return mBackgroundBrightness;}
-     */
+    int GetBackgroundAlpha() const { return mBackgroundAlpha;}
     void SetScaleBackgroundImage(bool b);
     bool GetScaleBackgroundImage() const { return scaleImage; }
 
@@ -0,0 +1,276 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <wx/image.h>
+
+#include "OffscreenPreviewRenderer.h"
+#include "Parallel.h"
+#include "DimmingCurve.h"
+#include "models/Model.h"
+#include "models/Node.h"
+#include "models/ModelScreenLocation.h"
+#include "ExternalHooks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <log4cpp/Category.hh>
+
+// rows of the output image handled by a single job
+#define OFFSCREEN_BAND_HEIGHT 16
+
+OffscreenPreviewRenderer::OffscreenPreviewRenderer(int width, int height, int virtualWidth, int virtualHeight, bool center2D0) :
+    _width(width), _height(height), _virtualWidth(virtualWidth), _virtualHeight(virtualHeight), _center2D0(center2D0)
+{
+    // same fit as the 2D ModelPreview, keep the aspect ratio and centre the smaller direction
+    if (_virtualWidth > 0 && _virtualHeight > 0) {
+        float scaleh = (float)_height / (float)_virtualHeight;
+        float scalew = (float)_width / (float)_virtualWidth;
+        _scale = std::min(scaleh, scalew);
+        _offsetX = ((float)_width - _scale * (float)_virtualWidth) / 2.0f;
+        _offsetY = ((float)_height - _scale * (float)_virtualHeight) / 2.0f;
+    }
+    if (_center2D0) {
+        _offsetX += _scale * (float)_virtualWidth / 2.0f;
+    }
+    _background.resize((size_t)_width * _height * 3);
+    _bands.resize((_height + OFFSCREEN_BAND_HEIGHT - 1) / OFFSCREEN_BAND_HEIGHT);
+}
+
+bool OffscreenPreviewRenderer::SetBackground(const std::string& imageFile, bool scaleImage, int brightness, int alpha)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::fill(_background.begin(), _background.end(), 0);
+    if (imageFile.empty() || !FileExists(imageFile)) {
+        return false;
+    }
+    wxImage image(imageFile);
+    if (!image.IsOk() || image.GetWidth() == 0 || image.GetHeight() == 0) {
+        logger_base.warn("Offscreen preview could not load background image %s.", (const char*)imageFile.c_str());
+        return false;
+    }
+
+    float scaleh = 1.0f;
+    float scalew = 1.0f;
+    if (!scaleImage && _virtualWidth != 0 && _virtualHeight != 0) {
+        float nscaleh = float(image.GetHeight()) / float(_virtualHeight);
+        float nscalew = float(image.GetWidth()) / float(_virtualWidth);
+        if (nscalew < nscaleh) {
+            scalew = nscalew / nscaleh;
+        } else {
+            scaleh = nscaleh / nscalew;
+        }
+    }
+
+    // the image covers world x from the left edge and y from 0 up to the scaled height
+    float wx = _center2D0 ? -(float)_virtualWidth / 2.0f : 0.0f;
+    int left = std::round(wx * _scale + _offsetX);
+    int right = std::round((wx + _virtualWidth * scalew) * _scale + _offsetX);
+    int top = _height - (int)std::round(_virtualHeight * scaleh * _scale + _offsetY);
+    int bottom = _height - (int)std::round(_offsetY);
+    if (right <= left || bottom <= top) {
+        return false;
+    }
+    image.Rescale(right - left, bottom - top, wxIMAGE_QUALITY_BILINEAR);
+
+    brightness = std::clamp(brightness, 0, 100);
+    alpha = std::clamp(alpha, 0, 100);
+    int mult = brightness * alpha * 255 / 10000;
+    const uint8_t* src = image.GetData();
+    int iw = image.GetWidth();
+    for (int y = std::max(0, top); y < std::min(_height, bottom); ++y) {
+        const uint8_t* srow = src + (size_t)(y - top) * iw * 3;
+        uint8_t* drow = &_background[(size_t)y * _width * 3];
+        for (int x = std::max(0, left); x < std::min(_width, right); ++x) {
+            const uint8_t* s = srow + (x - left) * 3;
+            uint8_t* d = drow + x * 3;
+            d[0] = s[0] * mult / 255;
+            d[1] = s[1] * mult / 255;
+            d[2] = s[2] * mult / 255;
+        }
+    }
+    return true;
+}
+
+void OffscreenPreviewRenderer::Prepare(const std::vector<Model*>& models)
+{
+    _models.clear();
+    _sprites.clear();
+    for (auto& b : _bands) {
+        b.clear();
+    }
+
+    // the preview draws the solid models before any with transparency
+    std::vector<Model*> ordered;
+    ordered.reserve(models.size());
+    for (int pass = 0; pass < 2; ++pass) {
+        for (auto m : models) {
+            bool transparent = m->GetPixelStyle() == Model::PIXEL_STYLE::PIXEL_STYLE_BLENDED_CIRCLE ||
+                               m->GetTransparency() != 0 || m->GetBlackTransparency() != 0;
+            if (transparent == (pass == 1)) {
+                ordered.push_back(m);
+            }
+        }
+    }
+
+    uint32_t colorCount = 0;
+    for (auto m : ordered) {
+        _models.push_back({ m, colorCount });
+
+        SpriteStyle style = SpriteStyle::SQUARE;
+        switch (m->GetPixelStyle()) {
+        case Model::PIXEL_STYLE::PIXEL_STYLE_SMOOTH:
+            style = SpriteStyle::SMOOTH;
+            break;
+        case Model::PIXEL_STYLE::PIXEL_STYLE_SOLID_CIRCLE:
+            style = SpriteStyle::SOLID_CIRCLE;
+            break;
+        case Model::PIXEL_STYLE::PIXEL_STYLE_BLENDED_CIRCLE:
+            style = SpriteStyle::BLENDED_CIRCLE;
+            break;
+        default:
+            break;
+        }
+        float radius = std::max(1.0f, m->GetPixelSize() * _scale) / 2.0f;
+
+        const ModelScreenLocation& location = m->GetModelScreenLocation();
+        location.PrepareToDraw(false, false);
+        uint32_t nodeCount = m->GetNodeCount();
+        for (uint32_t n = 0; n < nodeCount; ++n) {
+            NodeBaseClass* node = m->GetNode(n);
+            for (const auto& coord : node->Coords) {
+                float sx = coord.screenX;
+                float sy = coord.screenY;
+                float sz = coord.screenZ;
+                location.TranslatePoint(sx, sy, sz);
+                Sprite s;
+                s.x = sx * _scale + _offsetX;
+                s.y = (float)_height - (sy * _scale + _offsetY);
+                s.radius = radius;
+                s.colorIdx = colorCount + n;
+                s.style = style;
+                if (s.x + radius < 0 || s.x - radius >= _width || s.y + radius < 0 || s.y - radius >= _height) {
+                    continue;
+                }
+                uint32_t idx = _sprites.size();
+                _sprites.push_back(s);
+                int firstBand = std::max(0, (int)std::floor(s.y - radius)) / OFFSCREEN_BAND_HEIGHT;
+                int lastBand = std::min(_height - 1, (int)std::ceil(s.y + radius)) / OFFSCREEN_BAND_HEIGHT;
+                for (int b = firstBand; b <= lastBand && b < (int)_bands.size(); ++b) {
+                    _bands[b].push_back(idx);
+                }
+            }
+        }
+        colorCount += nodeCount;
+    }
+    _colors.resize(colorCount);
+}
+
+void OffscreenPreviewRenderer::Render(const uint8_t* data, uint8_t* buf)
+{
+    for (const auto& it : _models) {
+        Model* m = it.model;
+        uint32_t nodeCount = m->GetNodeCount();
+        int transparency = m->GetTransparency();
+        int blackTransparency = m->GetBlackTransparency();
+        xlColor* colors = _colors.data() + it.firstColor;
+        for (uint32_t n = 0; n < nodeCount; ++n) {
+            m->SetNodeChannelValues(n, &data[m->NodeStartChannel(n)]);
+            xlColor color = m->GetNodeColor(n);
+            if (m->modelDimmingCurve != nullptr) {
+                m->modelDimmingCurve->reverse(color);
+            }
+            Model::ApplyTransparency(color, transparency, blackTransparency);
+            colors[n] = color;
+        }
+    }
+
+    parallel_for(0, _bands.size(), [this, buf](int band) {
+        int startRow = band * OFFSCREEN_BAND_HEIGHT;
+        int endRow = std::min(_height, startRow + OFFSCREEN_BAND_HEIGHT);
+        size_t rowSize = (size_t)_width * 3;
+        memcpy(buf + startRow * rowSize, &_background[startRow * rowSize], (endRow - startRow) * rowSize);
+        for (auto idx : _bands[band]) {
+            const Sprite& s = _sprites[idx];
+            DrawSprite(s, _colors[s.colorIdx], buf, startRow, endRow);
+        }
+    });
+}
+
+static inline void BlendPixel(uint8_t* d, const xlColor& c, int alpha)
+{
+    if (alpha >= 255) {
+        d[0] = c.red;
+        d[1] = c.green;
+        d[2] = c.blue;
+    } else if (alpha > 0) {
+        int inv = 255 - alpha;
+        d[0] = (c.red * alpha + d[0] * inv) / 255;
+        d[1] = (c.green * alpha + d[1] * inv) / 255;
+        d[2] = (c.blue * alpha + d[2] * inv) / 255;
+    }
+}
+
+void OffscreenPreviewRenderer::DrawSprite(const Sprite& s, const xlColor& c, uint8_t* buf, int startRow, int endRow) const
+{
+    int y0 = std::max(startRow, (int)std::floor(s.y - s.radius));
+    int y1 = std::min(endRow, (int)std::ceil(s.y + s.radius));
+    int x0 = std::max(0, (int)std::floor(s.x - s.radius));
+    int x1 = std::min(_width, (int)std::ceil(s.x + s.radius));
+    if (x1 <= x0) {
+        // very small sprites still light the pixel they fall on
+        x0 = std::clamp((int)s.x, 0, _width - 1);
+        x1 = x0 + 1;
+    }
+    if (y1 <= y0) {
+        int y = (int)s.y;
+        if (y < startRow || y >= endRow) {
+            return;
+        }
+        y0 = y;
+        y1 = y + 1;
+    }
+
+    float r2 = s.radius * s.radius;
+    for (int y = y0; y < y1; ++y) {
+        uint8_t* row = buf + ((size_t)y * _width + x0) * 3;
+        float dy = (float)y + 0.5f - s.y;
+        for (int x = x0; x < x1; ++x, row += 3) {
+            if (s.style == SpriteStyle::SQUARE) {
+                BlendPixel(row, c, c.alpha);
+                continue;
+            }
+            float dx = (float)x + 0.5f - s.x;
+            float d2 = dx * dx + dy * dy;
+            if (d2 > r2 && s.style != SpriteStyle::SMOOTH) {
+                continue;
+            }
+            switch (s.style) {
+            case SpriteStyle::SMOOTH: {
+                // soften the last pixel of the edge like a smoothed GL point
+                float edge = s.radius - std::sqrt(d2) + 0.5f;
+                if (edge > 0) {
+                    BlendPixel(row, c, edge >= 1.0f ? c.alpha : (int)(c.alpha * edge));
+                }
+                break;
+            }
+            case SpriteStyle::BLENDED_CIRCLE:
+                // fades out to nothing at the edge
+                BlendPixel(row, c, (int)(c.alpha * (1.0f - std::sqrt(d2) / s.radius)));
+                break;
+            default:
+                BlendPixel(row, c, c.alpha);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Color.h"
+
+class Model;
+
+// Draws the 2D house preview of a set of models into an RGB24 buffer without needing an OpenGL window.
+//
+// Node positions are projected once in Prepare and binned into horizontal bands of the output image. Each frame the
+// node colours are pulled from the sequence data and the bands are rasterised in parallel over the background image.
+// This is intended for exporting preview videos where there is no display or the on screen preview is too slow.
+class OffscreenPreviewRenderer
+{
+public:
+    OffscreenPreviewRenderer(int width, int height, int virtualWidth, int virtualHeight, bool center2D0);
+    virtual ~OffscreenPreviewRenderer() {}
+
+    // brightness and alpha are 0-100 as used by the layout background settings
+    bool SetBackground(const std::string& imageFile, bool scaleImage, int brightness, int alpha);
+    void Prepare(const std::vector<Model*>& models);
+
+    // renders one frame of channel data into buf which must hold width * height * 3 bytes
+    void Render(const uint8_t* data, uint8_t* buf);
+
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+
+private:
+    enum class SpriteStyle : uint8_t {
+        SQUARE,
+        SMOOTH,
+        SOLID_CIRCLE,
+        BLENDED_CIRCLE
+    };
+
+    struct Sprite {
+        float x;
+        float y;
+        float radius;
+        uint32_t colorIdx;
+        SpriteStyle style;
+    };
+
+    struct ModelNodes {
+        Model* model;
+        uint32_t firstColor;
+    };
+
+    void DrawSprite(const Sprite& s, const xlColor& c, uint8_t* buf, int startRow, int endRow) const;
+
+    int _width;
+    int _height;
+    int _virtualWidth;
+    int _virtualHeight;
+    bool _center2D0;
+    float _scale = 1.0f;
+    float _offsetX = 0.0f;
+    float _offsetY = 0.0f;
+
+    std::vector<uint8_t> _background;
+    std::vector<ModelNodes> _models;
+    std::vector<Sprite> _sprites;
+    std::vector<xlColor> _colors;
+    std::vector<std::vector<uint32_t>> _bands;
+};
@@ -0,0 +1,374 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "PathRasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+// vertical samples per row, horizontally the coverage is exact
+static const int SUB_SCANLINES = 5;
+// curves and circles are flattened to segments about this long
+static const float SEGMENT_LENGTH = 1.5f;
+static const int MAX_SEGMENTS = 256;
+static const float TWO_PI = 6.28318530718f;
+
+static int Segments(float length)
+{
+    if (!(length > 0.0f)) {
+        return 1;
+    }
+    return std::min(MAX_SEGMENTS, std::max(1, (int)std::ceil(length / SEGMENT_LENGTH)));
+}
+
+static float Distance(float x1, float y1, float x2, float y2)
+{
+    return std::sqrt((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+}
+
+PathRasterizer::PathRasterizer(int width, int height)
+{
+    Reset(width, height);
+}
+
+void PathRasterizer::Reset(int width, int height)
+{
+    _width = std::max(0, width);
+    _height = std::max(0, height);
+    Clear();
+}
+
+void PathRasterizer::Clear()
+{
+    _paths.clear();
+}
+
+bool PathRasterizer::IsEmpty() const
+{
+    for (const auto& p : _paths) {
+        if (p.points.size() > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PathRasterizer::SubPath& PathRasterizer::Current()
+{
+    if (_paths.empty()) {
+        _paths.emplace_back();
+    } else if (_paths.back().closed) {
+        // drawing on after a close carries on from where the closed path started
+        Point start = _paths.back().points.front();
+        _paths.emplace_back();
+        _paths.back().points.push_back(start);
+    }
+    return _paths.back();
+}
+
+void PathRasterizer::MoveTo(float x, float y)
+{
+    if (!_paths.empty() && _paths.back().points.size() == 1 && !_paths.back().closed) {
+        _paths.back().points.front() = { x, y };
+        return;
+    }
+    _paths.emplace_back();
+    _paths.back().points.push_back({ x, y });
+}
+
+void PathRasterizer::LineTo(float x, float y)
+{
+    Current().points.push_back({ x, y });
+}
+
+void PathRasterizer::QuadTo(float cx, float cy, float x, float y)
+{
+    SubPath& p = Current();
+    if (p.points.empty()) {
+        p.points.push_back({ cx, cy });
+    }
+    const Point s = p.points.back();
+    const int n = Segments(Distance(s.x, s.y, cx, cy) + Distance(cx, cy, x, y));
+    for (int i = 1; i <= n; ++i) {
+        const float t = (float)i / n;
+        const float mt = 1.0f - t;
+        p.points.push_back({ mt * mt * s.x + 2 * mt * t * cx + t * t * x,
+                             mt * mt * s.y + 2 * mt * t * cy + t * t * y });
+    }
+}
+
+void PathRasterizer::CurveTo(float c1x, float c1y, float c2x, float c2y, float x, float y)
+{
+    SubPath& p = Current();
+    if (p.points.empty()) {
+        p.points.push_back({ c1x, c1y });
+    }
+    const Point s = p.points.back();
+    const int n = Segments(Distance(s.x, s.y, c1x, c1y) + Distance(c1x, c1y, c2x, c2y) + Distance(c2x, c2y, x, y));
+    for (int i = 1; i <= n; ++i) {
+        const float t = (float)i / n;
+        const float mt = 1.0f - t;
+        const float a = mt * mt * mt;
+        const float b = 3 * mt * mt * t;
+        const float c = 3 * mt * t * t;
+        const float d = t * t * t;
+        p.points.push_back({ a * s.x + b * c1x + c * c2x + d * x,
+                             a * s.y + b * c1y + c * c2y + d * y });
+    }
+}
+
+void PathRasterizer::ClosePath()
+{
+    if (!_paths.empty() && !_paths.back().points.empty()) {
+        _paths.back().closed = true;
+    }
+}
+
+void PathRasterizer::AddLine(float x1, float y1, float x2, float y2)
+{
+    MoveTo(x1, y1);
+    LineTo(x2, y2);
+}
+
+void PathRasterizer::AddPolygon(const std::vector<std::pair<float, float>>& points)
+{
+    if (points.empty()) {
+        return;
+    }
+    MoveTo(points.front().first, points.front().second);
+    for (size_t i = 1; i < points.size(); ++i) {
+        LineTo(points[i].first, points[i].second);
+    }
+    ClosePath();
+}
+
+void PathRasterizer::AddCircle(float cx, float cy, float radius)
+{
+    if (!(radius > 0.0f)) {
+        return;
+    }
+    const int n = std::max(8, Segments(TWO_PI * radius));
+    MoveTo(cx + radius, cy);
+    for (int i = 1; i < n; ++i) {
+        const float a = TWO_PI * i / n;
+        LineTo(cx + radius * std::cos(a), cy + radius * std::sin(a));
+    }
+    ClosePath();
+}
+
+void PathRasterizer::AddArc(float cx, float cy, float radius, float startAngle, float endAngle)
+{
+    if (!(radius > 0.0f)) {
+        return;
+    }
+    const int n = Segments(std::abs(endAngle - startAngle) * radius);
+    MoveTo(cx + radius * std::cos(startAngle), cy + radius * std::sin(startAngle));
+    for (int i = 1; i <= n; ++i) {
+        const float a = startAngle + (endAngle - startAngle) * i / n;
+        LineTo(cx + radius * std::cos(a), cy + radius * std::sin(a));
+    }
+}
+
+void PathRasterizer::AddEdge(float x0, float y0, float x1, float y1) const
+{
+    if (y0 == y1 || !std::isfinite(x0) || !std::isfinite(y0) || !std::isfinite(x1) || !std::isfinite(y1)) {
+        return;
+    }
+    int dir = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1;
+    }
+    _edges.push_back({ x0, y0, y1, (x1 - x0) / (y1 - y0), dir });
+}
+
+// a closed outline for stroking, all of them wind the same way so overlaps stay filled under the non zero rule
+void PathRasterizer::AddOutline(const std::vector<Point>& points) const
+{
+    float area = 0.0f;
+    for (size_t i = 0, j = points.size() - 1; i < points.size(); j = i++) {
+        area += points[j].x * points[i].y - points[i].x * points[j].y;
+    }
+    for (size_t i = 0, j = points.size() - 1; i < points.size(); j = i++) {
+        if (area < 0) {
+            AddEdge(points[i].x, points[i].y, points[j].x, points[j].y);
+        } else {
+            AddEdge(points[j].x, points[j].y, points[i].x, points[i].y);
+        }
+    }
+}
+
+void PathRasterizer::Fill(FillRule rule, const SpanFunc& span) const
+{
+    _edges.clear();
+    for (const auto& p : _paths) {
+        // open paths fill as if they were closed
+        for (size_t i = 0, j = p.points.size() - 1; i < p.points.size(); j = i++) {
+            AddEdge(p.points[j].x, p.points[j].y, p.points[i].x, p.points[i].y);
+        }
+    }
+    Rasterize(rule, span);
+}
+
+void PathRasterizer::Stroke(float width, const SpanFunc& span) const
+{
+    const float half = width / 2.0f;
+    if (!(half > 0.0f)) {
+        return;
+    }
+    const int circleSegments = std::max(8, Segments(TWO_PI * half));
+
+    _edges.clear();
+    auto addCircle = [this, half, circleSegments](const Point& c) {
+        _outline.clear();
+        for (int i = 0; i < circleSegments; ++i) {
+            const float a = TWO_PI * i / circleSegments;
+            _outline.push_back({ c.x + half * std::cos(a), c.y + half * std::sin(a) });
+        }
+        AddOutline(_outline);
+    };
+
+    for (const auto& p : _paths) {
+        // a lone move draws nothing
+        if (p.points.size() < 2) {
+            continue;
+        }
+        const Point* last = &p.points.front();
+        auto addSegment = [&](const Point& to) {
+            const float len = Distance(last->x, last->y, to.x, to.y);
+            if (len == 0.0f) {
+                return;
+            }
+            const float nx = -(to.y - last->y) / len * half;
+            const float ny = (to.x - last->x) / len * half;
+            _outline.clear();
+            _outline.push_back({ last->x + nx, last->y + ny });
+            _outline.push_back({ to.x + nx, to.y + ny });
+            _outline.push_back({ to.x - nx, to.y - ny });
+            _outline.push_back({ last->x - nx, last->y - ny });
+            AddOutline(_outline);
+            // round join, or the cap at the start
+            addCircle(*last);
+            last = &to;
+        };
+        for (size_t i = 1; i < p.points.size(); ++i) {
+            addSegment(p.points[i]);
+        }
+        if (p.closed) {
+            addSegment(p.points.front());
+        }
+        // end cap
+        addCircle(*last);
+    }
+    Rasterize(FillRule::NonZero, span);
+}
+
+// adds weight across xa to xb, the partly covered pixels at each end get their share now and the whole pixels
+// between go in as a step which is summed up when the row is emitted
+void PathRasterizer::AddSpan(float xa, float xb, float weight) const
+{
+    xa = std::min(std::max(xa, 0.0f), (float)_width);
+    xb = std::min(std::max(xb, 0.0f), (float)_width);
+    if (!(xb > xa)) {
+        return;
+    }
+    const int ia = (int)xa;
+    const int ib = (int)xb;
+    if (ia == ib) {
+        _cover[ia] += (xb - xa) * weight;
+        _minX = std::min(_minX, ia);
+        _maxX = std::max(_maxX, ia);
+        return;
+    }
+    _cover[ia] += (ia + 1 - xa) * weight;
+    _delta[ia + 1] += weight;
+    _delta[ib] -= weight;
+    if (ib < _width) {
+        _cover[ib] += (xb - ib) * weight;
+    }
+    _minX = std::min(_minX, ia);
+    _maxX = std::max(_maxX, std::min(ib, _width - 1));
+}
+
+void PathRasterizer::Rasterize(FillRule rule, const SpanFunc& span) const
+{
+    if (_edges.empty() || _width <= 0 || _height <= 0) {
+        return;
+    }
+    std::sort(_edges.begin(), _edges.end(), [](const Edge& a, const Edge& b) { return a.y0 < b.y0; });
+    float maxY = _edges.front().y1;
+    for (const auto& e : _edges) {
+        maxY = std::max(maxY, e.y1);
+    }
+    const int yStart = (int)std::min(std::max(std::floor(_edges.front().y0), 0.0f), (float)_height);
+    const int yEnd = (int)std::min(std::max(std::ceil(maxY), 0.0f), (float)_height);
+
+    _cover.assign(_width + 1, 0.0f);
+    _delta.assign(_width + 2, 0.0f);
+    _coverage.resize(_width);
+    _active.clear();
+
+    const float weight = 1.0f / SUB_SCANLINES;
+    size_t next = 0;
+    for (int y = yStart; y < yEnd; ++y) {
+        while (next < _edges.size() && _edges[next].y0 < y + 1) {
+            _active.push_back((int)next++);
+        }
+        _active.erase(std::remove_if(_active.begin(), _active.end(), [this, y](int i) { return _edges[i].y1 <= y; }), _active.end());
+        if (_active.empty()) {
+            continue;
+        }
+
+        _minX = _width;
+        _maxX = -1;
+        for (int s = 0; s < SUB_SCANLINES; ++s) {
+            const float sy = y + (s + 0.5f) * weight;
+            _crossings.clear();
+            for (int i : _active) {
+                const Edge& e = _edges[i];
+                if (e.y0 <= sy && sy < e.y1) {
+                    _crossings.emplace_back(e.x0 + (sy - e.y0) * e.dxdy, e.dir);
+                }
+            }
+            if (_crossings.size() < 2) {
+                continue;
+            }
+            std::sort(_crossings.begin(), _crossings.end());
+
+            int winding = 0;
+            float start = 0.0f;
+            for (const auto& c : _crossings) {
+                const bool wasInside = rule == FillRule::NonZero ? winding != 0 : (winding & 1) != 0;
+                winding += c.second;
+                const bool inside = rule == FillRule::NonZero ? winding != 0 : (winding & 1) != 0;
+                if (!wasInside && inside) {
+                    start = c.first;
+                } else if (wasInside && !inside) {
+                    AddSpan(start, c.first, weight);
+                }
+            }
+        }
+        if (_maxX < _minX) {
+            continue;
+        }
+
+        float run = 0.0f;
+        for (int x = _minX; x <= _maxX; ++x) {
+            run += _delta[x];
+            const float c = run + _cover[x];
+            _coverage[x - _minX] = c >= 0.999f ? 255 : (c <= 0.0f ? 0 : (uint8_t)(c * 255.0f + 0.5f));
+            _delta[x] = 0.0f;
+            _cover[x] = 0.0f;
+        }
+        _delta[_maxX + 1] = 0.0f;
+        span(y, _minX, _maxX - _minX + 1, _coverage.data());
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Anti-aliased scanline rasterizer behind the RenderBuffer path drawing. A path is built from lines, curves, arcs
+// and circles, flattened to edges and then filled a row at a time. Each row is sampled on several sub scanlines
+// with exact horizontal coverage so edges come out smooth without supersampling the whole buffer. The coverage for
+// each row goes to a callback which does the colouring so this knows nothing about pixels or colours.
+//
+// Pixel (x, y) covers x to x + 1 and y to y + 1, the same as wxGraphicsContext, so a line through a pixel centre
+// is at x + 0.5. A rasterizer isn't thread safe, each RenderBuffer has its own.
+class PathRasterizer
+{
+public:
+    enum class FillRule {
+        NonZero,
+        EvenOdd
+    };
+
+    // coverage runs from 0 (outside) to 255 (fully covered) for count pixels starting at x on row y
+    typedef std::function<void(int y, int x, int count, const uint8_t* coverage)> SpanFunc;
+
+    PathRasterizer(int width = 0, int height = 0);
+
+    // resizes and clears the path
+    void Reset(int width, int height);
+    void Clear();
+    bool IsEmpty() const;
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+
+    void MoveTo(float x, float y);
+    void LineTo(float x, float y);
+    void QuadTo(float cx, float cy, float x, float y);
+    void CurveTo(float c1x, float c1y, float c2x, float c2y, float x, float y);
+    void ClosePath();
+
+    // each of these is a sub path of its own, angles are in radians
+    void AddLine(float x1, float y1, float x2, float y2);
+    void AddPolygon(const std::vector<std::pair<float, float>>& points);
+    void AddCircle(float cx, float cy, float radius);
+    void AddArc(float cx, float cy, float radius, float startAngle, float endAngle);
+
+    void Fill(FillRule rule, const SpanFunc& span) const;
+    // fills the outline of the path drawn width wide with round joins and caps
+    void Stroke(float width, const SpanFunc& span) const;
+
+private:
+    struct Point {
+        float x;
+        float y;
+    };
+    struct SubPath {
+        std::vector<Point> points;
+        bool closed = false;
+    };
+    struct Edge {
+        float x0;
+        float y0;
+        float y1;
+        float dxdy;
+        int dir;
+    };
+
+    SubPath& Current();
+    void AddEdge(float x0, float y0, float x1, float y1) const;
+    void AddOutline(const std::vector<Point>& points) const;
+    void AddSpan(float xa, float xb, float weight) const;
+    void Rasterize(FillRule rule, const SpanFunc& span) const;
+
+    int _width = 0;
+    int _height = 0;
+    std::vector<SubPath> _paths;
+
+    // scratch kept between calls so drawing doesn't allocate once it has warmed up
+    mutable std::vector<Edge> _edges;
+    mutable std::vector<Point> _outline;
+    mutable std::vector<std::pair<float, int>> _crossings;
+    mutable std::vector<int> _active;
+    mutable std::vector<float> _cover;
+    mutable std::vector<float> _delta;
+    mutable std::vector<uint8_t> _coverage;
+    mutable int _minX = 0;
+    mutable int _maxX = -1;
+};
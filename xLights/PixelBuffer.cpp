@@ -913,10 +913,10 @@ void PixelBufferClass::reset(int nlayers, int timing, bool isNode) {
         if (x == (numLayers - 1)) {
             // for the model "blend" layer, use the "Single Line" style so none of the nodes will overlap with others
             // in the renderbuff which can occur if the group defaults to per-preview or similar
-            model->InitRenderBufferNodes("Single Line", "2D", "None", layers[x]->buffer.Nodes, layers[x]->BufferWi, layers[x]->BufferHt, layers[x]->stagger);
+            model->InitRenderBufferNodesCached("Single Line", "2D", "None", layers[x]->buffer.Nodes, layers[x]->BufferWi, layers[x]->BufferHt, layers[x]->stagger);
             layers[x]->bufferType = "Single Line";
         } else {
-            model->InitRenderBufferNodes("Default", "2D", "None", layers[x]->buffer.Nodes, layers[x]->BufferWi, layers[x]->BufferHt, layers[x]->stagger);
+            model->InitRenderBufferNodesCached("Default", "2D", "None", layers[x]->buffer.Nodes, layers[x]->BufferWi, layers[x]->BufferHt, layers[x]->stagger);
             layers[x]->bufferType = "Default";
         }
         layers[x]->camera = "2D";
@@ -960,7 +960,7 @@ void PixelBufferClass::InitPerModelBuffers(const ModelGroup& model, int layer, i
         wxASSERT(m != nullptr);
         RenderBuffer* buf = new RenderBuffer(frame);
         buf->SetFrameTimeInMs(timing);
-        m->InitRenderBufferNodes("Default", "2D", "None", buf->Nodes, buf->BufferWi, buf->BufferHt, 0);
+        m->InitRenderBufferNodes("Default", "2D", "None", buf->Nodes.Edit(), buf->BufferWi, buf->BufferHt, 0);
         buf->InitBuffer(buf->BufferHt, buf->BufferWi, "None");
         GPURenderUtils::setupRenderBuffer(this, buf, layer);
         layers[layer]->shallowModelBuffers.push_back(std::unique_ptr<RenderBuffer>(buf));
@@ -973,7 +973,7 @@ void PixelBufferClass::InitPerModelBuffersDeep(const ModelGroup& model, int laye
         wxASSERT(m != nullptr);
         RenderBuffer* buf = new RenderBuffer(frame);
         buf->SetFrameTimeInMs(timing);
-        m->InitRenderBufferNodes("Default", "2D", "None", buf->Nodes, buf->BufferWi, buf->BufferHt, 0);
+        m->InitRenderBufferNodes("Default", "2D", "None", buf->Nodes.Edit(), buf->BufferWi, buf->BufferHt, 0);
         buf->InitBuffer(buf->BufferHt, buf->BufferWi, "None");
         GPURenderUtils::setupRenderBuffer(this, buf, layer);
         layers[layer]->deepModelBuffers.push_back(std::unique_ptr<RenderBuffer>(buf));
@@ -1025,7 +1025,7 @@ void PixelBufferClass::GetNodeChannelValues(size_t nodenum, unsigned char* buf)
     layers[0]->buffer.Nodes[nodenum]->GetForChannels(buf);
 }
 void PixelBufferClass::SetNodeChannelValues(size_t nodenum, const unsigned char* buf) {
-    layers[0]->buffer.Nodes[nodenum]->SetFromChannels(buf);
+    layers[0]->buffer.Nodes.Edit()[nodenum]->SetFromChannels(buf);
 }
 xlColor PixelBufferClass::GetNodeColor(size_t nodenum) const {
     xlColor color;
@@ -1364,6 +1364,41 @@ void PixelBufferClass::mixColors(const wxCoord& x, const wxCoord& y, xlColor& fg
     }
 }
 
+static void AdjustHSV(xlColor& color, float ha, float sa, float va) {
+    HSVValue hsv = color.asHSV();
+
+    if (ha != 0) {
+        hsv.hue += ha;
+        if (hsv.hue < 0) {
+            hsv.hue += 1.0;
+        } else if (hsv.hue > 1) {
+            hsv.hue -= 1.0;
+        }
+    }
+
+    if (sa != 0) {
+        hsv.saturation += sa;
+        if (hsv.saturation < 0) {
+            hsv.saturation = 0.0;
+        } else if (hsv.saturation > 1) {
+            hsv.saturation = 1.0;
+        }
+    }
+
+    if (va != 0) {
+        hsv.value += va;
+        if (hsv.value < 0) {
+            hsv.value = 0.0;
+        } else if (hsv.value > 1) {
+            hsv.value = 1.0;
+        }
+    }
+
+    unsigned char alpha = color.Alpha();
+    color = hsv;
+    color.alpha = alpha;
+}
+
 void PixelBufferClass::GetMixedColor(int node, const std::vector<bool>& validLayers, int EffectPeriod, int saveLayer) {
     int cnt = 0;
     xlColor c(xlBLACK);
@@ -1377,6 +1412,7 @@ void PixelBufferClass::GetMixedColor(int node, const std::vector<bool>& validLay
             } else {
                 int x = 0;
                 int y = 0;
+                bool fromPixel = false;
                 if (thelayer->buffer.Nodes[node]->Coords.size() > 1) {
                     color.Set(0, 0, 0, 0);
                     xlColor c2;
@@ -1392,6 +1428,7 @@ void PixelBufferClass::GetMixedColor(int node, const std::vector<bool>& validLay
                             thelayer->buffer.GetPixel(x1, y1, c2);
                             if (c2.alpha != 0) {
                                 found = true;
+                                fromPixel = true;
                                 color = c2;
                                 x = x1;
                                 y = y1;
@@ -1413,42 +1450,12 @@ void PixelBufferClass::GetMixedColor(int node, const std::vector<bool>& validLay
                         color.Set(0, 0, 0, 0);
                     } else {
                         thelayer->buffer.GetPixel(x, y, color);
+                        fromPixel = true;
                     }
                 }
                 // adjust for HSV adjustments
                 if (thelayer->needsHSVAdjust) {
-                    HSVValue hsv = color.asHSV();
-
-                    if (thelayer->outputHueAdjust != 0) {
-                        hsv.hue += thelayer->outputHueAdjust;
-                        if (hsv.hue < 0) {
-                            hsv.hue += 1.0;
-                        } else if (hsv.hue > 1) {
-                            hsv.hue -= 1.0;
-                        }
-                    }
-
-                    if (thelayer->outputSaturationAdjust != 0) {
-                        hsv.saturation += thelayer->outputSaturationAdjust;
-                        if (hsv.saturation < 0) {
-                            hsv.saturation = 0.0;
-                        } else if (hsv.saturation > 1) {
-                            hsv.saturation = 1.0;
-                        }
-                    }
-
-                    if (thelayer->outputValueAdjust != 0) {
-                        hsv.value += thelayer->outputValueAdjust;
-                        if (hsv.value < 0) {
-                            hsv.value = 0.0;
-                        } else if (hsv.value > 1) {
-                            hsv.value = 1.0;
-                        }
-                    }
-
-                    unsigned char alpha = color.Alpha();
-                    color = hsv;
-                    color.alpha = alpha;
+                    thelayer->getHSVAdjusted(x, y, fromPixel, color);
                 }
 
                 // add sparkles
@@ -1534,7 +1541,7 @@ void PixelBufferClass::GetMixedColor(int node, const std::vector<bool>& validLay
         }
     }
     // set color for physical output
-    layers[saveLayer]->buffer.Nodes[node]->SetColor(c);
+    layers[saveLayer]->buffer.Nodes.Edit()[node]->SetColor(c);
 }
 
 void PixelBufferClass::GetMixedColor(int lx, int ly, xlColor& c, const std::vector<bool>& validLayers, int EffectPeriod) {
@@ -1592,38 +1599,7 @@ void PixelBufferClass::GetMixedColor(int lx, int ly, xlColor& c, const std::vect
 
                 // adjust for HSV adjustments
                 if (ha != 0 || sa != 0 || va != 0) {
-                    HSVValue hsv = color.asHSV();
-
-                    if (ha != 0) {
-                        hsv.hue += ha;
-                        if (hsv.hue < 0) {
-                            hsv.hue += 1.0;
-                        } else if (hsv.hue > 1) {
-                            hsv.hue -= 1.0;
-                        }
-                    }
-
-                    if (sa != 0) {
-                        hsv.saturation += sa;
-                        if (hsv.saturation < 0) {
-                            hsv.saturation = 0.0;
-                        } else if (hsv.saturation > 1) {
-                            hsv.saturation = 1.0;
-                        }
-                    }
-
-                    if (va != 0) {
-                        hsv.value += va;
-                        if (hsv.value < 0) {
-                            hsv.value = 0.0;
-                        } else if (hsv.value > 1) {
-                            hsv.value = 1.0;
-                        }
-                    }
-
-                    unsigned char alpha = color.Alpha();
-                    color = hsv;
-                    color.alpha = alpha;
+                    AdjustHSV(color, ha, sa, va);
                 }
 
                 int b;
@@ -2107,7 +2083,7 @@ void ComputeValueCurve(const std::string& valueCurve, ValueCurve& theValueCurve,
     theValueCurve.Deserialise(valueCurve);
 }
 
-void ComputeSubBuffer(const std::string& subBuffer, std::vector<NodeBaseClassPtr>& newNodes,
+void ComputeSubBuffer(const std::string& subBuffer, RenderBufferNodes& nodes,
                       int& bufferWi, int& bufferHi,
                       int& buffOffsetX, int& buffOffsetY,
                       float progress, long startMS, long endMS) {
@@ -2215,10 +2191,13 @@ void ComputeSubBuffer(const std::string& subBuffer, std::vector<NodeBaseClassPtr
         bufferWi = 1;
     if (bufferHi < 1)
         bufferHi = 1;
-    for (size_t x = 0; x < newNodes.size(); x++) {
-        for (auto& it2 : newNodes[x]->Coords) {
-            it2.bufX -= x1Int;
-            it2.bufY -= y1Int;
+    if (x1Int != 0 || y1Int != 0) {
+        std::vector<NodeBaseClassPtr>& newNodes = nodes.Edit();
+        for (size_t x = 0; x < newNodes.size(); x++) {
+            for (auto& it2 : newNodes[x]->Coords) {
+                it2.bufX -= x1Int;
+                it2.bufY -= y1Int;
+            }
         }
     }
     buffOffsetX = x1Int;
@@ -2371,10 +2350,10 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap& settingsMa
 
         inf->BufferOffsetX = 0;
         inf->BufferOffsetY = 0;
-        model->InitRenderBufferNodes(tt, camera, transform, inf->buffer.Nodes, inf->BufferWi, inf->BufferHt, inf->stagger, go_deep);
+        model->InitRenderBufferNodesCached(tt, camera, transform, inf->buffer.Nodes, inf->BufferWi, inf->BufferHt, inf->stagger, go_deep);
         if (origNodeCount != 0 && origNodeCount != inf->buffer.Nodes.size()) {
             inf->buffer.Nodes.clear();
-            model->InitRenderBufferNodes(tt, camera, transform, inf->buffer.Nodes, inf->BufferWi, inf->BufferHt, inf->stagger, go_deep);
+            model->InitRenderBufferNodes(tt, camera, transform, inf->buffer.Nodes.Edit(), inf->BufferWi, inf->BufferHt, inf->stagger, go_deep);
         }
 
         ComputeSubBuffer(subBuffer, inf->buffer.Nodes,
@@ -2433,7 +2412,7 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap& settingsMa
                         std::string ntype = "Default"; // type.substr(10, type.length() - 10);
                         int bw, bh;
                         it->Nodes.clear();
-                        (*it_m)->InitRenderBufferNodes(ntype, camera, transform, it->Nodes, bw, bh, 0);
+                        (*it_m)->InitRenderBufferNodesCached(ntype, camera, transform, it->Nodes, bw, bh, 0);
                         if (bw == 0)
                             bw = 1; // zero sized buffers are a problem
                         if (bh == 0)
@@ -2453,7 +2432,7 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap& settingsMa
                         std::string ntype = type.substr(10, type.length() - 10);
                         int bw, bh;
                         it->Nodes.clear();
-                        gp->ActiveModels()[cnt]->InitRenderBufferNodes(ntype, camera, transform, it->Nodes, bw, bh, 0);
+                        gp->ActiveModels()[cnt]->InitRenderBufferNodesCached(ntype, camera, transform, it->Nodes, bw, bh, 0);
                         if (bw == 0)
                             bw = 1; // zero sized buffers are a problem
                         if (bh == 0)
@@ -2511,7 +2490,7 @@ void PixelBufferClass::UnMergeBuffersForLayer(int layer) {
         for (const auto& modelBuffer : *(layers[layer]->modelBuffers)) {
             for (const auto& mbnode : modelBuffer->Nodes) {
                 if (nc < layers[layer]->buffer.Nodes.size()) {
-                    auto& node = layers[layer]->buffer.Nodes[nc];
+                    const auto* node = layers[layer]->buffer.Nodes[nc];
                     layers[layer]->buffer.GetPixel(node->Coords[0].bufX, node->Coords[0].bufY, color);
                     for (const auto& coord : mbnode->Coords) {
                         modelBuffer->SetPixel(coord.bufX, coord.bufY, color);
@@ -2627,9 +2606,10 @@ void PixelBufferClass::GetColors(unsigned char* fdata, const std::vector<bool>&
     // KW ... I think this needs to be optimised
 
     if (layers[0] != nullptr) { // I dont like this ... it should never be null
-        if (layers[0]->buffer.Nodes.size() < 1000) {
+        std::vector<NodeBaseClassPtr>& Nodes = layers[0]->buffer.Nodes.Edit();
+        if (Nodes.size() < 1000) {
             // smaller model, no sense in setting up the parallel_for
-            for (auto& n : layers[0]->buffer.Nodes) {
+            for (auto& n : Nodes) {
                 size_t start = n->ActChan;
                 if (IsInRange(restrictRange, start)) {
                     if (n->model != nullptr) { // nor this
@@ -2655,8 +2635,8 @@ void PixelBufferClass::GetColors(unsigned char* fdata, const std::vector<bool>&
             }
         } else {
             parallel_for(
-                0, layers[0]->buffer.Nodes.size(), [&](int i) {
-                    auto& n = layers[0]->buffer.Nodes[i];
+                0, Nodes.size(), [&](int i) {
+                    auto& n = Nodes[i];
                     size_t start = n->ActChan;
                     if (IsInRange(restrictRange, start)) {
                         if (n->model != nullptr) { // nor this
@@ -2689,9 +2669,10 @@ void PixelBufferClass::SetColors(int layer, const unsigned char* fdata) {
     if (layer >= layers.size())
         return;
 
-    if (layers[layer]->buffer.Nodes.size() < 1000) {
+    std::vector<NodeBaseClassPtr>& Nodes = layers[layer]->buffer.Nodes.Edit();
+    if (Nodes.size() < 1000) {
         xlColor color;
-        for (const auto& n : layers[layer]->buffer.Nodes) {
+        for (const auto& n : Nodes) {
             size_t start = n->ActChan;
 
             n->SetFromChannels(&fdata[start]);
@@ -2707,8 +2688,8 @@ void PixelBufferClass::SetColors(int layer, const unsigned char* fdata) {
         }
     } else {
         parallel_for(
-            0, layers[layer]->buffer.Nodes.size(), [&](int i) {
-                auto& n = layers[layer]->buffer.Nodes[i];
+            0, Nodes.size(), [&](int i) {
+                auto& n = Nodes[i];
                 xlColor color;
                 size_t start = n->ActChan;
                 n->SetFromChannels(&fdata[start]);
@@ -2948,7 +2929,7 @@ void PixelBufferClass::PrepareVariableSubBuffer(int EffectPeriod, int layer) {
     layers[layer]->buffer.Nodes.clear();
     layers[layer]->BufferOffsetX = 0;
     layers[layer]->BufferOffsetY = 0;
-    model->InitRenderBufferNodes(type, camera, transform, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt, layers[layer]->stagger);
+    model->InitRenderBufferNodesCached(type, camera, transform, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt, layers[layer]->stagger);
     ComputeSubBuffer(subBuffer, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt,
                      layers[layer]->BufferOffsetX, layers[layer]->BufferOffsetY,
                      offset, layers[layer]->buffer.GetStartTimeMS(), layers[layer]->buffer.GetEndTimeMS());
@@ -3090,6 +3071,9 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool>& val
                 continue;
             }
             GPURenderUtils::waitForRenderCompletion(&layers[ii]->buffer);
+            if (layers[ii]->needsHSVAdjust) {
+                layers[ii]->calculateHSVAdjust();
+            }
         }
         
         int blockSize = std::max(5000 / std::max(countValid, 1), 500);
@@ -3121,7 +3105,7 @@ void PixelBufferClass::CalcOutput(int EffectPeriod, const std::vector<bool>& val
         }
         */
 
-        std::vector<NodeBaseClassPtr>& Nodes = layers[saveLayer]->buffer.Nodes;
+        std::vector<NodeBaseClassPtr>& Nodes = layers[saveLayer]->buffer.Nodes.Edit();
         parallel_for(
             0, NodeCount, [this, &Nodes, &validLayers, saveLayer, EffectPeriod](int i) {
                 if (!Nodes[i]->IsVisible()) {
@@ -3874,6 +3858,44 @@ void PixelBufferClass::LayerInfo::calculateNodeOutputParams(int EffectPeriod) {
     }
 }
 
+// The hue, saturation and value adjust is the same for every pixel of the layer so it is applied to the whole buffer
+// in blocks before the nodes are mixed rather than a node at a time
+void PixelBufferClass::LayerInfo::calculateHSVAdjust() {
+    adjustedClear = xlCLEAR;
+    AdjustHSV(adjustedClear, outputHueAdjust, outputSaturationAdjust, outputValueAdjust);
+
+    const size_t count = buffer.GetPixelCount();
+    adjustedPixels.resize(count);
+    if (count == 0) {
+        return;
+    }
+
+    const xlColor* src = buffer.GetPixels();
+    xlColor* dst = &adjustedPixels[0];
+    const size_t blockSize = 4096;
+    parallel_for(0, (count + blockSize - 1) / blockSize, [this, src, dst, count, blockSize](int block) {
+        const size_t start = block * blockSize;
+        const size_t n = std::min(blockSize, count - start);
+        std::vector<float> hue(n), saturation(n), value(n);
+        RGBToHSVSpan(src + start, &hue[0], &saturation[0], &value[0], n);
+        AdjustHSVSpan(&hue[0], &saturation[0], &value[0], n, outputHueAdjust, outputSaturationAdjust, outputValueAdjust);
+        // the conversion leaves alpha alone so it comes across with the copy
+        std::copy(src + start, src + start + n, dst + start);
+        HSVToRGBSpan(&hue[0], &saturation[0], &value[0], dst + start, n);
+    });
+}
+
+void PixelBufferClass::LayerInfo::getHSVAdjusted(int x, int y, bool fromPixel, xlColor& color) const {
+    size_t idx = (size_t)y * buffer.BufferWi + x;
+    if (fromPixel && x >= 0 && y >= 0 && x < buffer.BufferWi && y < buffer.BufferHt && idx < adjustedPixels.size()) {
+        color = adjustedPixels[idx];
+    } else if (color.IsNilColor()) {
+        color = adjustedClear;
+    } else {
+        AdjustHSV(color, outputHueAdjust, outputSaturationAdjust, outputValueAdjust);
+    }
+}
+
 bool PixelBufferClass::LayerInfo::isMasked(int x, int y) {
     int idx = x * BufferHt + y;
     if (idx < maskSize) {
@@ -209,11 +209,15 @@ private:
         float outputSaturationAdjust = 0.0f;
         float outputValueAdjust = 0.0f;
         bool needsHSVAdjust = false;
+        xlColorVector adjustedPixels;
+        xlColor adjustedClear;
         int outputSparkleCount = 0;
         int outputBrightnessAdjust = 100;
         float outputEffectMixThreshold = 0.0f;
 
         void calculateNodeOutputParams(int effectPeriod);
+        void calculateHSVAdjust();
+        void getHSVAdjusted(int x, int y, bool fromPixel, xlColor& color) const;
 
     private:
         void createSquareExplodeMask(bool end);
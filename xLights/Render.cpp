@@ -8,10 +8,12 @@
  * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
  **************************************************************/
 
+#include <algorithm>
 #include <mutex>
 #include <condition_variable>
 #include <map>
 #include <memory>
+#include <thread>
 
 #include "xLightsMain.h"
 #include "xLightsXmlFile.h"
@@ -27,14 +29,52 @@
 #include "Parallel.h"
 #include "ExternalHooks.h"
 #include "GPURenderUtils.h"
+#include "RenderTaskGraph.h"
+#include "RenderCheckpoints.h"
 
 #include <log4cpp/Category.hh>
 
 #define END_OF_RENDER_FRAME INT_MAX
 
+// a render is split into at most this many tasks per model, each at least this many frames long
+#define RENDER_TASK_MAX_CHUNKS 64
+#define RENDER_TASK_MIN_FRAMES 20
+
+// how often the state of stateful effects is kept so a later render can resume part way through the effect
+#define RENDER_CHECKPOINT_INTERVAL 100
+
 //other common strings
 static const std::string STR_EMPTY("");
 
+// Frames of a frame independent effect that have been rendered ahead of the frame being processed
+class FrameChunk {
+public:
+    Effect* effect = nullptr;
+    int effectId = -1;
+    int start = 0;
+    int end = -1;
+    std::vector<xlColorVector> frames;
+
+    void Reset() {
+        effect = nullptr;
+        effectId = -1;
+    }
+};
+
+// Snapshots of every buffer of a layer, there is one for each model when a group renders per model
+class LayerCheckpoint : public RenderLayerCheckpoint {
+public:
+    std::vector<RenderBufferSnapshot> buffers;
+
+    virtual size_t GetSize() const override {
+        size_t size = 0;
+        for (const auto& it : buffers) {
+            size += it.GetSize();
+        }
+        return size;
+    }
+};
+
 class EffectLayerInfo {
 public:
     EffectLayerInfo(): element(nullptr)
@@ -57,6 +97,7 @@ public:
         settingsMaps.resize(l);
         effectStates.resize(l);
         validLayers.resize(l + 1); //extra one for the blending layer
+        chunks.resize(l);
     }
 
     int numLayers;
@@ -69,6 +110,7 @@ public:
     std::vector<SettingsMap> settingsMaps;
     std::vector<bool> effectStates;
     std::vector<bool> validLayers;
+    std::vector<FrameChunk> chunks;
 };
 
 class RenderEvent {
@@ -87,108 +129,6 @@ public:
     bool suppress{ false };
 };
 
-class NextRenderer {
-public:
-
-    NextRenderer() : nextLock(), nextSignal(), previousFrameDone(-1) {
-    }
-
-    virtual ~NextRenderer() {}
-
-    bool addNext(NextRenderer *n) {
-        for (const auto& i : next) {
-            if (i == n) return false;
-        }
-        next.push_back(n);
-        return true;
-    }
-
-    bool HasNext() const {
-        return !next.empty();
-    }
-
-    void FrameDone(int frame) {
-        for (const auto& i : next) {
-            i->setPreviousFrameDone(frame);
-        }
-    }
-
-    virtual void setPreviousFrameDone(int i) {
-        previousFrameDone = i;
-        nextSignal.notify_all();
-    }
-
-    int waitForFrame(int frame) {
-        if (frame > previousFrameDone) {
-            std::unique_lock<std::mutex> lock(nextLock);
-            while (frame > previousFrameDone) {
-                nextSignal.wait_for(lock, std::chrono::milliseconds(10));
-            }
-        }
-        return previousFrameDone;
-    }
-
-    bool checkIfDone(int frame, int timeout = 5) {
-        return previousFrameDone >= frame;
-    }
-
-    int GetPreviousFrameDone() const {
-        return previousFrameDone;
-    }
-
-protected:
-    std::mutex nextLock;
-    std::condition_variable nextSignal;
-    std::atomic_int previousFrameDone;
-private:
-    std::vector<NextRenderer *> next;
-};
-
-class AggregatorRenderer: public NextRenderer {
-public:
-
-    AggregatorRenderer(int numFrames) : NextRenderer(), finalFrame(numFrames + 19), data(numFrames + 20) {
-        for (int x = 0; x < (numFrames + 20); ++x) {
-            data[x] = 0;
-        }
-        max = 0;
-    }
-
-    virtual ~AggregatorRenderer() {
-    }
-
-    void incNumAggregated() {
-        ++max;
-    }
-
-    int getNumAggregated() const
-    {
-        return max;
-    }
-
-    virtual void setPreviousFrameDone(int frame) {
-        if (max <= 1) {
-            previousFrameDone = frame;
-            FrameDone(frame);
-            return;
-        }
-        int idx = frame;
-        if (idx == END_OF_RENDER_FRAME) {
-            idx = finalFrame;
-        }
-        int i = data[idx].fetch_add(1);
-        if (i == (max - 1)) {
-            previousFrameDone = frame;
-            FrameDone(previousFrameDone);
-        }
-    }
-
-private:
-    std::vector<std::atomic_int> data;
-    int max;
-    const int finalFrame;
-};
-
 class SNPair {
 public:
     SNPair(int s, int n) : strand(s), node(n) {}
@@ -214,10 +154,10 @@ public:
 };
 
 
-class RenderJob: public Job, public NextRenderer {
+class RenderJob {
 public:
     RenderJob(ModelElement *row, SequenceData &data, xLightsFrame *xframe, bool zeroBased = false)
-        : Job(), NextRenderer(), rowToRender(row), seqData(&data), xLights(xframe),
+        : rowToRender(row), seqData(&data), xLights(xframe),
             gauge(nullptr), currentFrame(0), renderLog(log4cpp::Category::getInstance(std::string("log_render"))),
             supportsModelBlending(false), abort(false), statusMap(nullptr)
     {
@@ -324,12 +264,14 @@ public:
     int GetEndFrame() const { return endFrame;}
     int GetStartFrame() const { return startFrame;}
 
-    const std::string GetName() const override {
+    const std::string GetName() const {
         return name;
     }
 
-    virtual bool DeleteWhenComplete() override {
-        return false;
+    // dependency is an earlier model in the same render that shares channels with this one
+    void AddDependency(RenderJob* dependency) {
+        dependency->hasDependents = true;
+        dependencies.push_back(dependency);
     }
 
     void LogToLogger(int logLevel) {
@@ -429,7 +371,7 @@ public:
         LogToLogger(debugLog ? log4cpp::Priority::DEBUG : log4cpp::Priority::INFO);
     }
 
-    std::string GetStatus() override {
+    std::string GetStatus() {
         return GetwxStatus().ToStdString();
     }
 
@@ -547,7 +489,96 @@ public:
         return frame - (ef->GetStartTimeMS() / frameTime);
     }
 
-    bool ProcessFrame(int frame, Element *el, EffectLayerInfo &info, PixelBufferClass *buffer, int strand = -1, bool blend = false) {
+    // Frame independent effects can have their next frames rendered at the same time into copies of the layer
+    // buffer. Only the effect itself is rendered ahead, blur, rotozoom, transitions and the layer blending are still
+    // done one frame at a time in order so the output is the same as rendering each frame in turn.
+    bool CanRenderFramesAhead(Effect* ef, int layer, PixelBufferClass* buffer, const SettingsMap& settings) {
+        if (!xLights->IsParallelFrameRender() || ef == nullptr || ef->GetEffectIndex() < 0) {
+            return false;
+        }
+        if (buffer->IsPersistent(layer) || buffer->IsCanvasMix(layer) || buffer->IsVariableSubBuffer(layer) ||
+            buffer->GetFreezeFrame(layer) != 999999 || buffer->BufferCountForLayer(layer) != 1) {
+            return false;
+        }
+        RenderBuffer& rb = buffer->BufferForLayer(layer, -1);
+        if (rb.gpuRenderData != nullptr || rb.IsDmxBuffer() || rb.GetPixelCount() == 0) {
+            return false;
+        }
+        RenderableEffect* reff = xLights->GetEffectManager().GetEffect(ef->GetEffectIndex());
+        if (reff == nullptr || !reff->IsFrameIndependent(settings)) {
+            return false;
+        }
+        if (reff->SupportsRenderCache(settings) && xLights->_renderCache.IsEnabled()) {
+            return false;
+        }
+        return reff->CanRenderOnBackgroundThread(ef, settings, rb);
+    }
+
+    void RenderFramesAhead(EffectLayerInfo& info, int layer, Effect* ef, int frame, PixelBufferClass* buffer) {
+        static ParallelJobPool FRAME_AHEAD_POOL("frame_ahead_pool");
+        static const int maxFrames = std::clamp((int)std::thread::hardware_concurrency() * 2, 4, 64);
+
+        FrameChunk& chunk = info.chunks[layer];
+        chunk.Reset();
+
+        int lastFrame = std::min((int)endFrame, (ef->GetEndTimeMS() - 1) / seqData->FrameTime());
+        int count = std::min(lastFrame - frame, maxFrames);
+        if (count < 2) {
+            return;
+        }
+
+        RenderBuffer& rb = buffer->BufferForLayer(layer, -1);
+        RenderableEffect* reff = xLights->GetEffectManager().GetEffect(ef->GetEffectIndex());
+        const SettingsMap& settings = info.settingsMaps[layer];
+        chunk.frames.resize(count);
+        std::atomic_bool complete(true);
+        parallel_for(0, count, [&](int i) {
+            if (abort) {
+                complete = false;
+                return;
+            }
+            RenderBuffer copy(rb);
+            copy.SetState(frame + 1 + i, false, rb.cur_model);
+            copy.Clear();
+            reff->Render(ef, settings, copy);
+            chunk.frames[i].assign(copy.GetPixels(), copy.GetPixels() + copy.GetPixelCount());
+        }, 1, &FRAME_AHEAD_POOL);
+
+        if (complete) {
+            chunk.effect = ef;
+            chunk.effectId = ef->GetID();
+            chunk.start = frame + 1;
+            chunk.end = frame + count;
+        }
+    }
+
+    bool TakeFrameAhead(EffectLayerInfo& info, int layer, Effect* ef, int frame, PixelBufferClass* buffer, bool& resetEffectState) {
+        FrameChunk& chunk = info.chunks[layer];
+        if (chunk.effect == nullptr) {
+            return false;
+        }
+        if (chunk.effect != ef || chunk.effectId != ef->GetID() || frame < chunk.start || frame > chunk.end) {
+            chunk.Reset();
+            return false;
+        }
+
+        RenderBuffer& rb = buffer->BufferForLayer(layer, -1);
+        const xlColorVector& pixels = chunk.frames[frame - chunk.start];
+        if (pixels.size() != rb.GetPixelCount()) {
+            chunk.Reset();
+            return false;
+        }
+
+        buffer->SetLayer(layer, frame, resetEffectState);
+        resetEffectState = false;
+        memcpy(rb.GetPixels(), pixels.data(), pixels.size() * sizeof(xlColor));
+        if (frame == chunk.end) {
+            chunk.Reset();
+        }
+        return true;
+    }
+
+    bool ProcessFrame(int frame, Element *el, EffectLayerInfo &info, PixelBufferClass *buffer, int strand = -1, bool blend = false, bool output = true) {
         bool effectsToUpdate = false;
         Effect* tempEffect = nullptr;
         int numLayers = el->GetEffectLayerCount();
@@ -652,8 +683,6 @@ public:
             if (!freeze) {
                 // Mix canvas pre-loads the buffer with data from underlying layers
                 if (buffer->IsCanvasMix(layer) && layer < numLayers - 1) {
-                    maybeWaitForFrame(frame);
-
                     auto vl = info.validLayers;
                     if (info.settingsMaps[layer].Get("LayersSelected", "") != "") {
                         // remove from valid layers any layers we dont need to include
@@ -693,7 +722,14 @@ public:
                     buffer->UnMergeBuffersForLayer(layer);
                 }
 
-                info.validLayers[layer] = xLights->RenderEffectFromMap(suppress, ef, layer, frame, info.settingsMaps[layer], *buffer, b, true, &renderEvent);
+                if (!suppress && copy == nullptr && TakeFrameAhead(info, layer, ef, frame, buffer, b)) {
+                    info.validLayers[layer] = true;
+                } else {
+                    info.validLayers[layer] = xLights->RenderEffectFromMap(suppress, ef, layer, frame, info.settingsMaps[layer], *buffer, b, true, &renderEvent);
+                    if (info.validLayers[layer] && !suppress && copy == nullptr && CanRenderFramesAhead(ef, layer, buffer, info.settingsMaps[layer])) {
+                        RenderFramesAhead(info, layer, ef, frame, buffer);
+                    }
+                }
                 effectsToUpdate |= info.validLayers[layer];
                 info.effectStates[layer] = b;
 
@@ -710,8 +746,7 @@ public:
             }
         }
 
-        if (effectsToUpdate) {
-            maybeWaitForFrame(frame);
+        if (effectsToUpdate && output) {
             SetCalOutputStatus(frame, info.submodel, strand, -1);
             if (blend) {
                 buffer->SetColors(numLayers, &((*seqData)[frame][0]));
@@ -727,34 +762,61 @@ public:
         return effectsToUpdate;
     }
 
-    std::atomic_int maxFrameBeforeCheck = -1;
-    void maybeWaitForFrame(int frame) {
-        //make sure we can do this frame
-        if (frame >= maxFrameBeforeCheck) {
-            SetWaitingStatus(frame);
-            maxFrameBeforeCheck = waitForFrame(frame);
-            SetGenericStatus("%s: Processing frame %d ", frame, true, true);
-        }
-    }
-    virtual void Process() override {
-        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    // Renders one task of the render graph. The first task of a job works out the frames to render and sets up the
+    // starting effects and the last one tidies up. The model's render lock is only held while a task is running and
+    // the graph only schedules a task once the models it overlaps have finished the same frames so nothing here ever
+    // waits on another model. As the lock is let go between tasks a newer render of the model can get in, once that
+    // happens the rest of this job is stale so it stops and leaves its frames dirty for the newer render.
+    void RenderFrames(int from, int to, bool first, bool last) {
         static log4cpp::Category& logger_jobpool = log4cpp::Category::getInstance(std::string("log_jobpool"));
         logger_jobpool.debug("Render job thread id 0x%x or %d", wxThread::GetCurrentId(), wxThread::GetCurrentId());
 
-        SetGenericStatus("Initializing rendering thread for %s", 0);
-        int origChangeCount;
-        int ss, es;
-
-        rowToRender->IncWaitCount();
+        if (first) {
+            SetGenericStatus("Initializing rendering thread for %s", 0);
+            rowToRender->IncWaitCount();
+        }
         std::unique_lock<std::recursive_timed_mutex> lock(rowToRender->GetRenderLock());
-        if (rowToRender->DecWaitCount() && !HasNext()) {
-            // other threads for this model waiting, we'll bail fast and let them handle this
-            renderLog.debug("Rendering thread exiting early.");
-            currentFrame = END_OF_RENDER_FRAME; // this is needed otherwise the job does not look done
-            return;
+        if (first) {
+            if (rowToRender->DecWaitCount()) {
+                // other threads for this model waiting, we'll bail fast and let them handle this
+                renderLog.debug("Rendering thread exiting early.");
+                stopped = true;
+                stoppedAt = 0;
+                exitedEarly = true;
+            } else {
+                SetGenericStatus("Got lock on rendering thread for %s", 0);
+                Begin();
+            }
+        }
+
+        if (!stopped) {
+            if (first) {
+                from = startFrame;
+            }
+            if (last) {
+                to = endFrame;
+            }
+            RenderRange(from, to);
         }
-        SetGenericStatus("Got lock on rendering thread for %s", 0);
 
+        if (last) {
+            Finish();
+        } else if (!stopped) {
+            SetWaitingStatus(to + 1);
+        }
+    }
+
+    void AbortRender() {
+        abort = true;
+    }
+
+    ModelElement* GetModelElement() const { return rowToRender; }
+
+private:
+
+    void Begin() {
+        int ss, es;
+        renderGeneration = rowToRender->StartRender();
         rowToRender->GetAndResetDirtyRange(origChangeCount, ss, es);
         if (ss != -1) {
             //expand to cover the whole dirty range
@@ -776,51 +838,224 @@ public:
         if (startFrame < 0) startFrame = 0;
         if (endFrame > (int)seqData->NumFrames()) endFrame = seqData->NumFrames() - 1;
 
-        EffectLayerInfo mainModelInfo(numLayers);
-        std::map<SNPair, Effect*> nodeEffects;
-        std::map<SNPair, SettingsMap> nodeSettingsMaps;
-        std::map<SNPair, bool> nodeEffectStates;
-        std::map<SNPair, int> nodeEffectIdxs;
+        mainModelInfo.resize(numLayers);
 
         try {
-            //for (int layer = 0; layer < numLayers; ++layer) {
-            for (int layer = numLayers - 1; layer >= 0; --layer) {
-                SetGenericStatus("Finding starting effect for %s, startFrame %d, and layer %d ", (int)startFrame, layer, false, true);
-                EffectLayer *elayer = rowToRender->GetEffectLayer(layer);
-                std::unique_lock<std::recursive_mutex> elock(elayer->GetLock());
-                mainModelInfo.currentEffects[layer] = findEffectForFrame(elayer, startFrame, mainModelInfo.currentEffectIdxs[layer]);
-                SetGenericStatus("Initializing starting effect for %s, startFrame %d, and layer %d ", (int)startFrame, layer, false, true);
-                initialize(layer, startFrame, mainModelInfo.currentEffects[layer], mainModelInfo.settingsMaps[layer], mainBuffer);
-                mainModelInfo.effectStates[layer] = true;
+            // Stateful effects already running at the start frame need their state from the frame before. Keep
+            // moving back until every such layer either has a checkpoint there or has none to go back to.
+            int resumeFrame = startFrame;
+            std::vector<std::shared_ptr<RenderLayerCheckpoint>> checkpoints(numLayers);
+            bool resumable = false;
+            while (!resumable) {
+                resumable = true;
+                int earliest = resumeFrame;
+                //for (int layer = 0; layer < numLayers; ++layer) {
+                for (int layer = numLayers - 1; layer >= 0; --layer) {
+                    SetGenericStatus("Finding starting effect for %s, startFrame %d, and layer %d ", resumeFrame, layer, false, true);
+                    EffectLayer *elayer = rowToRender->GetEffectLayer(layer);
+                    std::unique_lock<std::recursive_mutex> elock(elayer->GetLock());
+                    mainModelInfo.currentEffects[layer] = findEffectForFrame(elayer, resumeFrame, mainModelInfo.currentEffectIdxs[layer]);
+                    SetGenericStatus("Initializing starting effect for %s, startFrame %d, and layer %d ", resumeFrame, layer, false, true);
+                    initialize(layer, resumeFrame, mainModelInfo.currentEffects[layer], mainModelInfo.settingsMaps[layer], mainBuffer);
+                    mainModelInfo.effectStates[layer] = true;
+
+                    int from = FindCheckpoint(layer, resumeFrame, checkpoints[layer]);
+                    if (from < resumeFrame) {
+                        resumable = false;
+                        earliest = std::min(earliest, from);
+                    }
+                }
+                resumeFrame = earliest;
+            }
+
+            for (int layer = 0; layer < numLayers; ++layer) {
+                if (checkpoints[layer] != nullptr) {
+                    mainModelInfo.effectStates[layer] = !RestoreCheckpoint(layer, *(LayerCheckpoint*)checkpoints[layer].get());
+                }
             }
+            if (resumeFrame < startFrame) {
+                renderLog.debug("Resuming effects on %s from frame %d to render from frame %d.", (const char*)name.c_str(), resumeFrame, (int)startFrame);
+                FastForward(resumeFrame);
+            }
+        } catch (std::exception& ex) {
+            LogException(ex.what());
+            stopped = true;
+        } catch (...) {
+            LogException(nullptr);
+            stopped = true;
+        }
+    }
+
+    // The effect on a layer of the main model if the layer can be resumed from a checkpoint. Persistent and canvas
+    // layers start from whatever other effects left in the buffer which a checkpoint knows nothing about.
+    RenderableEffect* GetCheckpointEffect(int layer, Effect* ef, const SettingsMap& settings) {
+        if (ef == nullptr || ef->GetEffectIndex() < 0 || ef->GetParentEffectLayer() != rowToRender->GetEffectLayer(layer)) {
+            return nullptr;
+        }
+        if (mainBuffer->IsPersistent(layer) || mainBuffer->IsCanvasMix(layer) || mainBuffer->IsRenderingDisabled(layer)) {
+            return nullptr;
+        }
+        RenderableEffect* reff = xLights->GetEffectManager().GetEffect(ef->GetEffectIndex());
+        if (reff == nullptr || !reff->SupportsRenderCheckpoints(settings)) {
+            return nullptr;
+        }
+        return reff;
+    }
+
+    // everything about the effect and the layer buffers that the effect state depends on
+    std::string GetCheckpointSignature(int layer, Effect* ef) {
+        std::string sig = ef->GetEffectName() + "|" + std::to_string(ef->GetStartTimeMS()) + "|" + std::to_string(ef->GetEndTimeMS()) +
+                          "|" + std::to_string(seqData->FrameTime());
+        for (uint32_t i = 0; i < mainBuffer->BufferCountForLayer(layer); ++i) {
+            RenderBuffer& rb = mainBuffer->BufferForLayer(layer, i);
+            sig += "|" + std::to_string(rb.BufferWi) + "x" + std::to_string(rb.BufferHt);
+        }
+        return sig + "|" + ef->GetSettingsAsString() + "|" + ef->GetPaletteAsString();
+    }
+
+    // Returns the frame the layer can be rendered from with the right state for frame. That is frame itself if the
+    // layer has no stateful effect running into it or there is a checkpoint for it, otherwise the latest earlier
+    // checkpoint. With no checkpoint at all it is the start of the effect so the frames before get re-simulated, slow
+    // for a long effect but the output matches a full render. Must be called with the layer initialised for frame and locked.
+    int FindCheckpoint(int layer, int frame, std::shared_ptr<RenderLayerCheckpoint>& checkpoint) {
+        checkpoint = nullptr;
+        Effect* ef = mainModelInfo.currentEffects[layer];
+        if (GetCheckpointEffect(layer, ef, mainModelInfo.settingsMaps[layer]) == nullptr) {
+            return frame;
+        }
+        int effectStart = (ef->GetStartTimeMS() + seqData->FrameTime() - 1) / seqData->FrameTime();
+        if (effectStart >= frame) {
+            return frame;
+        }
+        int cpFrame = -1;
+        auto cp = xLights->_renderCheckpoints.Find(rowToRender->GetModelName(), layer, effectStart + 1, frame, GetCheckpointSignature(layer, ef), cpFrame);
+        if (cp == nullptr) {
+            return effectStart;
+        }
+        if (cpFrame == frame) {
+            checkpoint = cp;
+        }
+        return cpFrame;
+    }
+
+    bool RestoreCheckpoint(int layer, const LayerCheckpoint& checkpoint) {
+        RenderableEffect* reff = xLights->GetEffectManager().GetEffect(mainModelInfo.currentEffects[layer]->GetEffectIndex());
+        if (checkpoint.buffers.size() != mainBuffer->BufferCountForLayer(layer)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < checkpoint.buffers.size(); ++i) {
+            if (!mainBuffer->BufferForLayer(layer, i).RestoreSnapshot(reff->GetId(), checkpoint.buffers[i])) {
+                renderLog.warn("Checkpoint for %s layer %d could not be restored, the effect will restart.", (const char*)name.c_str(), layer + 1);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Once a frame of the main model is rendered keep the state of the stateful effects that carry on into the next
+    // frame every RENDER_CHECKPOINT_INTERVAL frames
+    void SaveCheckpoints(int frame) {
+        int next = frame + 1;
+        if (next % RENDER_CHECKPOINT_INTERVAL != 0) {
+            return;
+        }
+        int time = next * seqData->FrameTime();
+        for (int layer = 0; layer < numLayers; ++layer) {
+            EffectLayer* elayer = rowToRender->GetEffectLayer(layer);
+            std::unique_lock<std::recursive_mutex> elock(elayer->GetLock());
+            // the effect may have been changed while rendering so make sure it is the one that was rendered
+            int idx = mainModelInfo.currentEffectIdxs[layer];
+            Effect* ef = findEffectForFrame(elayer, frame, idx);
+            if (ef == nullptr || ef != mainModelInfo.currentEffects[layer] || ef->GetEndTimeMS() <= time) {
+                continue;
+            }
+            RenderableEffect* reff = GetCheckpointEffect(layer, ef, mainModelInfo.settingsMaps[layer]);
+            if (reff == nullptr) {
+                continue;
+            }
+            auto checkpoint = std::make_shared<LayerCheckpoint>();
+            checkpoint->buffers.resize(mainBuffer->BufferCountForLayer(layer));
+            bool ok = true;
+            for (uint32_t i = 0; ok && i < checkpoint->buffers.size(); ++i) {
+                RenderBuffer& rb = mainBuffer->BufferForLayer(layer, i);
+                GPURenderUtils::waitForRenderCompletion(&rb);
+                ok = rb.Snapshot(reff->GetId(), checkpoint->buffers[i]);
+            }
+            if (ok) {
+                xLights->_renderCheckpoints.Save(rowToRender->GetModelName(), layer, next, GetCheckpointSignature(layer, ef), checkpoint);
+            }
+        }
+    }
+
+    // Renders the main model from an earlier frame up to the start frame without writing anything out so the
+    // stateful effects reach the start frame in the state a render of the whole effect would have them in
+    void FastForward(int from) {
+        for (int frame = from; frame < startFrame; ++frame) {
+            if (abort) {
+                StopAt(startFrame);
+                return;
+            }
+            SetGenericStatus("%s: Resuming effects at frame %d ", frame, true, true);
+            ProcessFrame(frame, rowToRender, mainModelInfo, mainBuffer, -1, false, false);
+            SaveCheckpoints(frame);
+        }
+    }
+
+    void LogException(const char* what) {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        wxASSERT(false); // so when we debug we catch them
+        if (what != nullptr) {
+            printf("Caught an exception %s", what);
+            renderLog.error("Caught an exception on rendering thread: " + std::string(what));
+            logger_base.error("Caught an exception on rendering thread: %s", what);
+        } else {
+            printf("Caught an unknown exception");
+            renderLog.error("Caught an unknown exception on rendering thread.");
+            logger_base.error("Caught an unknown exception on rendering thread.");
+        }
+    }
+
+    // a newer render of the model has started or been asked for
+    bool IsSuperseded() const {
+        return origChangeCount != rowToRender->getChangeCount() || rowToRender->GetWaitCount() || renderGeneration != rowToRender->GetRenderGeneration();
+    }
+
+    // a model this one draws over stopped before this frame so what it left in the channels is stale
+    bool IsDependencyStopped(int frame) const {
+        for (const auto& it : dependencies) {
+            if (it->stoppedAt <= frame) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // we're bailing out but make sure the rest of the range is reconsidered
+    void StopAt(int frame) {
+        rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+        stoppedAt = frame;
+        stopped = true;
+    }
+
+    void RenderRange(int from, int to) {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-            for (int frame = startFrame; frame <= endFrame; ++frame) {
+        try {
+            for (int frame = from; frame <= to; ++frame) {
                 currentFrame = frame;
                 SetGenericStatus("%s: Starting frame %d ", frame, true, true);
 
-                if (abort) {
-                    rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
-                    break;
-                }
-
-                if (!HasNext() &&
-                        (origChangeCount != rowToRender->getChangeCount()
-                         || rowToRender->GetWaitCount())) {
-                    //we're bailing out but make sure this range is reconsidered
-                    rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
-                    break;
-                }
-                if (abort) {
-                    rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+                if (abort || IsSuperseded() || IsDependencyStopped(frame)) {
+                    StopAt(frame);
                     break;
                 }
 
                 bool cleared = ProcessFrame(frame, rowToRender, mainModelInfo, mainBuffer, -1, supportsModelBlending);
+                SaveCheckpoints(frame);
                 if (!subModelInfos.empty()) {
-                    maybeWaitForFrame(frame);
                     for (const auto& a : subModelInfos) {
                         if (abort) {
-                            rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+                            StopAt(frame);
                             break;
                         }
                         EffectLayerInfo *info = a;
@@ -829,10 +1064,9 @@ public:
                 }
 
                 if (!nodeBuffers.empty()) {
-                    maybeWaitForFrame(frame);
                     for (const auto& it : nodeBuffers) {
                         if (abort) {
-                            rowToRender->SetDirtyRange(frame * seqData->FrameTime(), endFrame * seqData->FrameTime());
+                            StopAt(frame);
                             break;
                         }
                         SNPair node = it.first;
@@ -879,51 +1113,33 @@ public:
                     }
                 }
                 //mainBuffer->ApplyDimmingCurves(&((*seqData)[frame][0]));
-                if (HasNext()) {
-                    SetGenericStatus("%s: Notifying next renderer of frame %d done", frame, true);
-                    FrameDone(frame);
+                if (stopped) {
+                    break;
                 }
             }
-            SetGenericStatus("%s: All done - Completed frame %d ", endFrame, true, false);
-        } catch ( std::exception &ex) {
-            wxASSERT(false); // so when we debug we catch them
-            printf("Caught an exception %s", ex.what());
-			renderLog.error("Caught an exception on rendering thread: " + std::string(ex.what()));
-            logger_base.error("Caught an exception on rendering thread: %s", ex.what());
-		} catch ( ... ) {
-            wxASSERT(false); // so when we debug we catch them
-            printf("Caught an unknown exception");
-			renderLog.error("Caught an unknown exception on rendering thread.");
-            logger_base.error("Caught an unknown exception on rendering thread.");
+        } catch (std::exception& ex) {
+            LogException(ex.what());
+            stopped = true;
+        } catch (...) {
+            LogException(nullptr);
+            stopped = true;
         }
-        if (HasNext()) {
-            //make sure the previous has told us we're at the end.  If we return before waiting, the previous
-            //may try sending the END_OF_RENDER_FRAME to us and we'll have been deleted
-            SetGenericStatus("%s: Waiting on previous renderer for final frame", 0, true);
-            waitForFrame(END_OF_RENDER_FRAME);
+    }
 
-            //let the next know we're done
-            SetGenericStatus("%s: Notifying next renderer of final frame", 0, true);
-            FrameDone(END_OF_RENDER_FRAME);
-            xLights->CallAfter(&xLightsFrame::SetStatusText, wxString("Done Rendering \"" + rowToRender->GetModelName() + "\""), 0);
+    void Finish() {
+        if (!exitedEarly) {
             SetGenericStatus("%s: All done - Completed frame %d ", endFrame, true, false);
-        } else {
-            xLights->CallAfter(&xLightsFrame::RenderDone);
+            if (hasDependents) {
+                xLights->CallAfter(&xLightsFrame::SetStatusText, wxString("Done Rendering \"" + rowToRender->GetModelName() + "\""), 0);
+            } else {
+                xLights->CallAfter(&xLightsFrame::RenderDone);
+            }
+            rowToRender->CleanupAfterRender();
         }
-        rowToRender->CleanupAfterRender();
         currentFrame = END_OF_RENDER_FRAME;
-        //printf("Done rendering %lx (next %lx)\n", (unsigned long)this, (unsigned long)next);
-		renderLog.debug("Rendering thread exiting.");
-	}
-
-    void AbortRender() {
-        abort = true;
+        renderLog.debug("Rendering thread exiting.");
     }
 
-    ModelElement* GetModelElement() const { return rowToRender; }
-
-private:
-
     void initialize(int layer, int frame, Effect *el, SettingsMap &settingsMap, PixelBufferClass *buffer) {
         bool layerEnabled = true;
         if (el == nullptr || el->GetEffectIndex() == -1) {
@@ -1025,12 +1241,53 @@ private:
     wxGauge *gauge;
     std::atomic_int currentFrame;
     std::atomic_bool abort;
+    bool hasDependents = false;
+    std::vector<RenderJob*> dependencies;
+    // read by the tasks of the models that depend on this one
+    std::atomic_int stoppedAt{ END_OF_RENDER_FRAME };
+    // the tasks of a job run one after the other so these do not need to be atomic
+    bool stopped = false;
+    bool exitedEarly = false;
+    int origChangeCount = 0;
+    int renderGeneration = 0;
+
+    EffectLayerInfo mainModelInfo;
+    std::map<SNPair, Effect*> nodeEffects;
+    std::map<SNPair, SettingsMap> nodeSettingsMaps;
+    std::map<SNPair, bool> nodeEffectStates;
+    std::map<SNPair, int> nodeEffectIdxs;
 
     std::vector<EffectLayerInfo *> subModelInfos;
 
     std::map<SNPair, PixelBufferClassPtr> nodeBuffers;
 };
 
+// Runs one task of a render graph on the render job pool
+class RenderTaskJob : public Job {
+public:
+    RenderTaskJob(RenderTaskGraph* graph, RenderTaskGraph::Task* task) : Job(), graph(graph), task(task) {}
+
+    virtual void Process() override {
+        graph->Run(task);
+    }
+
+    virtual bool DeleteWhenComplete() override {
+        return true;
+    }
+
+    const std::string GetName() const override {
+        return task->GetName();
+    }
+
+    std::string GetStatus() override {
+        return ((RenderJob*)task->GetData())->GetStatus();
+    }
+
+private:
+    RenderTaskGraph* graph;
+    RenderTaskGraph::Task* task;
+};
+
 
 IMPLEMENT_DYNAMIC_CLASS(RenderCommandEvent, wxCommandEvent)
 IMPLEMENT_DYNAMIC_CLASS(SelectedEffectChangedEvent, wxCommandEvent)
@@ -1089,7 +1346,7 @@ public:
         startFrame = 0;
         endFrame = 0;
         jobs = nullptr;
-        aggregators = nullptr;
+        graph = nullptr;
         renderProgressDialog = nullptr;
     };
     std::function<void(bool)> callback;
@@ -1097,7 +1354,7 @@ public:
     int startFrame;
     int endFrame;
     RenderJob **jobs;
-    AggregatorRenderer **aggregators;
+    RenderTaskGraph *graph;
     RenderProgressDialog *renderProgressDialog;
     std::list<Model *> restriction;
 };
@@ -1110,7 +1367,8 @@ void xLightsFrame::LogRenderStatus()
     logger_base.debug("Render Thread status:\n%s", (const char *)GetThreadStatusReport().c_str());
     for (const auto& it : renderProgressInfo) {
         int frames = it->endFrame - it->startFrame + 1;
-        logger_base.debug("Render progress rows %d, start frame %d, end frame %d, frames %d.", it->numRows, it->startFrame, it->endFrame, frames);
+        logger_base.debug("Render progress rows %d, start frame %d, end frame %d, frames %d, tasks %d of %d left.", it->numRows, it->startFrame, it->endFrame, frames,
+                          (int)it->graph->GetRemainingTaskCount(), (int)it->graph->GetTaskCount());
         for (int i = 0; i < it->numRows; i++) {
             if (it->jobs[i] != nullptr) {
                 auto job = it->jobs[i];
@@ -1144,6 +1402,35 @@ void xLightsFrame::LogRenderStatus()
     logger_base.debug("*************************************");
 }
 
+void xLightsFrame::SaveRenderTaskTimings(RenderTaskGraph* graph)
+{
+    static log4cpp::Category &logger_render = log4cpp::Category::getInstance(std::string("log_render"));
+
+    _lastRenderTaskTimings = graph->GetTimings();
+    if (_lastRenderTaskTimings.empty() || !logger_render.isDebugEnabled()) {
+        return;
+    }
+
+    double elapsed = 0;
+    double busy = 0;
+    double critical = 0;
+    for (const auto& it : _lastRenderTaskTimings) {
+        elapsed = std::max(elapsed, it.endMS);
+        busy += it.endMS - it.startMS;
+        if (it.critical) {
+            critical += it.endMS - it.startMS;
+        }
+    }
+    logger_render.debug("Render graph %d tasks took %0.1fms, %0.1fms of rendering, %0.1fms of it on the critical path.",
+                        (int)_lastRenderTaskTimings.size(), elapsed, busy, critical);
+    for (const auto& it : _lastRenderTaskTimings) {
+        if (it.critical) {
+            logger_render.debug("    %s frames %d-%d ready %0.1fms start %0.1fms end %0.1fms.",
+                                (const char *)it.name.c_str(), it.startFrame, it.endFrame, it.readyMS, it.startMS, it.endMS);
+        }
+    }
+}
+
 static bool HasEffects(ModelElement *me) {
     if (me->HasEffects()) {
         return true;
@@ -1249,13 +1536,15 @@ void xLightsFrame::UpdateRenderStatus() {
             }
         }
 
-        if (done) {
+        // the jobs can look done just before the last task has let go of the graph
+        if (done && rpi->graph->IsComplete()) {
+            SaveRenderTaskTimings(rpi->graph);
             for (size_t row = 0; row < rpi->numRows; ++row) {
                 if (rpi->jobs[row]) {
                     delete rpi->jobs[row];
                 }
-                delete rpi->aggregators[row];
             }
+            delete rpi->graph;
             if (rpi->renderProgressDialog) {
                 delete rpi->renderProgressDialog;
                 rpi->renderProgressDialog = nullptr;
@@ -1264,7 +1553,6 @@ void xLightsFrame::UpdateRenderStatus() {
             _appProgress->Reset();
             RenderDone();
             delete []rpi->jobs;
-            delete []rpi->aggregators;
             rpi->callback(abortedRenderJobs > 0);
             delete rpi;
             rpi = nullptr;
@@ -1446,13 +1734,13 @@ void xLightsFrame::Render(SequenceElements& seqElements,
     }
     int numRows = models.size();
     RenderJob **jobs = new RenderJob*[numRows];
-    AggregatorRenderer **aggregators = new AggregatorRenderer*[numRows];
+    // for each row the earlier rows that share channels with it and so must render each frame before it does
+    std::vector<std::set<int>> dependsOn(numRows);
     std::vector<std::set<int>> channelMaps(seqData.NumChannels());
 
     size_t row = 0;
     for (auto it = models.begin(); it != models.end(); ++it, ++row) {
         jobs[row] = nullptr;
-        aggregators[row] = new AggregatorRenderer(seqData.NumFrames());
 
         Element *rowEl = seqElements.GetElement((*it)->GetName());
 
@@ -1487,7 +1775,6 @@ void xLightsFrame::Render(SequenceElements& seqElements,
                     }
 
                     jobs[row] = job;
-                    aggregators[row]->addNext(job);
                     size_t cn = buffer->GetChanCountPerNode();
                     for (size_t node = 0; node < buffer->GetNodeCount(); ++node) {
                         uint32_t start = buffer->NodeStartChannel(node);
@@ -1495,11 +1782,8 @@ void xLightsFrame::Render(SequenceElements& seqElements,
                             size_t cnum = start + c;
                             if (cnum < seqData.NumChannels()) {
                                 for (const auto i : channelMaps[cnum]) {
-                                    int idx = i;
-                                    if (idx != row) {
-                                        if (jobs[idx]->addNext(aggregators[row])) {
-                                            aggregators[row]->incNumAggregated();
-                                        }
+                                    if (i != row) {
+                                        dependsOn[row].insert(i);
                                     }
                                 }
                                 channelMaps[cnum].insert(row);
@@ -1511,9 +1795,41 @@ void xLightsFrame::Render(SequenceElements& seqElements,
         }
     }
 
-    logger_render.debug("Aggregators created.");
-
     channelMaps.clear();
+
+    // Each job is split into the same frame ranges. A task waits for the job's previous task, as effects carry state
+    // from frame to frame, and for the task covering the same frames of every model it overlaps.
+    RenderTaskGraph *graph = new RenderTaskGraph();
+    int frames = std::max(1, endFrame - startFrame + 1);
+    int numChunks = std::clamp(frames / RENDER_TASK_MIN_FRAMES, 1, RENDER_TASK_MAX_CHUNKS);
+    std::vector<std::vector<RenderTaskGraph::Task*>> tasks(numRows);
+    for (row = 0; row < numRows; ++row) {
+        RenderJob *job = jobs[row];
+        if (job == nullptr) {
+            continue;
+        }
+        for (const auto i : dependsOn[row]) {
+            job->AddDependency(jobs[i]);
+        }
+        for (int c = 0; c < numChunks; ++c) {
+            int from = startFrame + (int)((int64_t)frames * c / numChunks);
+            int to = startFrame + (int)((int64_t)frames * (c + 1) / numChunks) - 1;
+            bool first = c == 0;
+            bool last = c == numChunks - 1;
+            auto task = graph->AddTask(job->GetName(), from, to, [job, from, to, first, last]() { job->RenderFrames(from, to, first, last); }, job);
+            if (!first) {
+                graph->AddDependency(tasks[row].back(), task);
+            }
+            for (const auto i : dependsOn[row]) {
+                graph->AddDependency(tasks[i][c], task);
+            }
+            tasks[row].push_back(task);
+        }
+    }
+    tasks.clear();
+    dependsOn.clear();
+
+    logger_render.debug("Render graph created, %d tasks.", (int)graph->GetTaskCount());
     RenderProgressDialog *renderProgressDialog = nullptr;
     if (progressDialog) {
         renderProgressDialog = new RenderProgressDialog(this);
@@ -1531,13 +1847,7 @@ void xLightsFrame::Render(SequenceElements& seqElements,
 
     for (row = 0; row < numRows; ++row) {
         if (jobs[row]) {
-            if (aggregators[row]->getNumAggregated() == 0) {
-                //start all the jobs that don't depend on anything above them
-                //get them rendering while we setup the rest
-                jobs[row]->setPreviousFrameDone(END_OF_RENDER_FRAME);
-                jobPool.PushJob(jobs[row]);
-                ++count;
-            }
+            ++count;
             if (progressDialog) {
                 wxStaticText *label = new wxStaticText(renderProgressDialog->scrolledWindow, wxID_ANY, jobs[row]->GetName());
                 renderProgressDialog->scrolledWindowSizer->Add(label,1, wxALL |wxEXPAND,3);
@@ -1551,13 +1861,9 @@ void xLightsFrame::Render(SequenceElements& seqElements,
     }
 
     logger_render.debug("Job pool start size %d.", (int)jobPool.size());
-    for (row = 0; row < numRows; ++row) {
-        if (jobs[row] && aggregators[row]->getNumAggregated() != 0) {
-            //now start the rest
-            jobPool.PushJob(jobs[row]);
-            ++count;
-        }
-    }
+    graph->Start([this, graph](RenderTaskGraph::Task* task) {
+        jobPool.PushJob(new RenderTaskJob(graph, task));
+    });
     logger_base.debug("Job pool new size %d.", (int)jobPool.size());
 
     if (count) {
@@ -1575,11 +1881,13 @@ void xLightsFrame::Render(SequenceElements& seqElements,
         pi->jobs = jobs;
         pi->renderProgressDialog = renderProgressDialog;
         pi->restriction = restrictToModels;
-        pi->aggregators = aggregators;
+        pi->graph = graph;
 
         renderProgressInfo.push_back(pi);
         RenderStatusTimer.Start(100, false);
     } else {
+        delete graph;
+        delete []jobs;
         callback(abortedRenderJobs > 0);
         if (progressDialog) {
             delete renderProgressDialog;
@@ -1961,7 +2269,6 @@ bool xLightsFrame::DoExportModel(unsigned int startFrame, unsigned int endFrame,
     SetStatusText(wxString::Format("Starting Export for %s - %s", format, Out3));
     wxYield();
 
-    NextRenderer wait;
     Element* el = _sequenceElements.GetElement(model);
     if (el == nullptr)
         return false;
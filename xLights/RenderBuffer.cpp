@@ -28,6 +28,7 @@
 
 #include <log4cpp/Category.hh>
 #include "Parallel.h"
+#include "SinTable.h"
 
 template <class CTX>
 class ContextPool {
@@ -79,7 +80,6 @@ private:
 };
 
 static ContextPool<TextDrawingContext> *TEXT_CONTEXT_POOL = nullptr;
-static ContextPool<PathDrawingContext> *PATH_CONTEXT_POOL = nullptr;
 
 void DrawingContext::Initialize(wxWindow *parent) {
     if (TEXT_CONTEXT_POOL == nullptr) {
@@ -89,13 +89,6 @@ void DrawingContext::Initialize(wxWindow *parent) {
         });
         //TEXT_CONTEXT_POOL->PreAlloc(10);
     }
-    if (PATH_CONTEXT_POOL == nullptr) {
-        PATH_CONTEXT_POOL = new ContextPool<PathDrawingContext>([parent]() {
-            // atomic reference counting, can create this on background thread
-            return new PathDrawingContext(10, 10 ,false);
-        });
-        //PATH_CONTEXT_POOL->PreAlloc(5);
-    }
 }
 
 void DrawingContext::CleanUp() {
@@ -103,23 +96,6 @@ void DrawingContext::CleanUp() {
         delete TEXT_CONTEXT_POOL;
         TEXT_CONTEXT_POOL = nullptr;
     }
-    if (PATH_CONTEXT_POOL != nullptr) {
-        delete PATH_CONTEXT_POOL;
-        PATH_CONTEXT_POOL = nullptr;
-    }
-}
-
-PathDrawingContext* PathDrawingContext::GetContext() {
-    if (PATH_CONTEXT_POOL != nullptr) {
-        return PATH_CONTEXT_POOL->GetContext();
-    }
-    return nullptr;
-}
-
-void PathDrawingContext::ReleaseContext(PathDrawingContext* pdc) {
-    if (PATH_CONTEXT_POOL != nullptr) {
-        return PATH_CONTEXT_POOL->ReleaseContext(pdc);
-    }
 }
 
 TextDrawingContext* TextDrawingContext::GetContext() {
@@ -329,11 +305,6 @@ DrawingContext::~DrawingContext() {
 }
 
 
-PathDrawingContext::PathDrawingContext(int BufferWi, int BufferHt, bool allowShared)
-    : DrawingContext(BufferWi, BufferHt, allowShared, true) {}
-
-PathDrawingContext::~PathDrawingContext() {}
-
 
 
 TextDrawingContext::TextDrawingContext(int BufferWi, int BufferHt, bool allowShared)
@@ -417,27 +388,6 @@ void DrawingContext::Clear()
     }
 }
 
-void PathDrawingContext::Clear() {
-    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-
-    if (gc != nullptr) {
-        delete gc;
-        gc = nullptr;
-    }
-    DrawingContext::Clear();
-    gc = wxGraphicsContext::Create(*dc);
-
-    if (gc == nullptr)
-    {
-        logger_base.error("PathDrawingContext DC creation failed.");
-        return;
-    }
-
-    gc->SetAntialiasMode(wxANTIALIAS_NONE);
-    gc->SetInterpolationQuality(wxInterpolationQuality::wxINTERPOLATION_FAST);
-    gc->SetCompositionMode(wxCompositionMode::wxCOMPOSITION_SOURCE);
-}
-
 void TextDrawingContext::Clear()
 {
 
@@ -497,23 +447,6 @@ wxImage *DrawingContext::FlushAndGetImage() {
     return image;
 }
 
-void PathDrawingContext::SetPen(wxPen &pen) {
-    if (gc != nullptr)
-        gc->SetPen(pen);
-}
-
-void PathDrawingContext::SetBrush(wxBrush& brush)
-{
-    if (gc != nullptr)
-        gc->SetBrush(brush);
-}
-
-void PathDrawingContext::SetBrush(wxGraphicsBrush& brush)
-{
-    if (gc != nullptr)
-        gc->SetBrush(brush);
-}
-
 void TextDrawingContext::SetPen(wxPen& pen)
 {
     if (gc != nullptr) {
@@ -523,21 +456,6 @@ void TextDrawingContext::SetPen(wxPen& pen)
     }
 }
 
-wxGraphicsPath PathDrawingContext::CreatePath()
-{
-    return gc->CreatePath();
-}
-
-void PathDrawingContext::StrokePath(wxGraphicsPath& path)
-{
-    gc->StrokePath(path);
-}
-
-void PathDrawingContext::FillPath(wxGraphicsPath& path, wxPolygonFillMode fillStyle)
-{
-    gc->FillPath(path, fillStyle);
-}
-
 void TextDrawingContext::SetFont(const wxFontInfo& font, const xlColor& color)
 {
     FontMapLock lk;
@@ -729,7 +647,6 @@ RenderBuffer::RenderBuffer(xLightsFrame *f) : frame(f)
     _nodeBuffer = false;
     frameTimeInMs = 50;
     _textDrawingContext = nullptr;
-    _pathDrawingContext = nullptr;
     isTransformed = false;
 }
 
@@ -741,9 +658,6 @@ RenderBuffer::~RenderBuffer()
     if (_textDrawingContext != nullptr) {
         TextDrawingContext::ReleaseContext(_textDrawingContext);
     }
-    if (_pathDrawingContext != nullptr) {
-        PathDrawingContext::ReleaseContext(_pathDrawingContext);
-    }
     for (auto& it : infoCache) {
         delete it.second;
         it.second = nullptr;
@@ -754,20 +668,6 @@ RenderBuffer::~RenderBuffer()
     }
 }
 
-PathDrawingContext * RenderBuffer::GetPathDrawingContext()
-{
-    if (_pathDrawingContext == nullptr)
-    {
-        _pathDrawingContext = PathDrawingContext::GetContext();
-        _pathDrawingContext->ResetSize(BufferWi, BufferHt);
-    } else if (_pathDrawingContext->GetWidth() != BufferWi || _pathDrawingContext->GetHeight() != BufferHt) {
-        // varying subbuffers the size may have changed
-        _pathDrawingContext->ResetSize(BufferWi, BufferHt);
-    }
-
-    return _pathDrawingContext;
-}
-
 TextDrawingContext* RenderBuffer::GetTextDrawingContext()
 {
     if (_textDrawingContext == nullptr) {
@@ -783,9 +683,6 @@ TextDrawingContext* RenderBuffer::GetTextDrawingContext()
 
 void RenderBuffer::InitBuffer(int newBufferHt, int newBufferWi, const std::string& bufferTransform, bool nodeBuffer)
 {
-    if (_pathDrawingContext != nullptr && (BufferHt != newBufferHt || BufferWi != newBufferWi)) {
-        _pathDrawingContext->ResetSize(newBufferWi, newBufferHt);
-    }
     if (_textDrawingContext != nullptr && (BufferHt != newBufferHt || BufferWi != newBufferWi)) {
         _textDrawingContext->ResetSize(newBufferWi, newBufferHt);
     }
@@ -833,53 +730,6 @@ size_t RenderBuffer::GetColorCount()
     return palette.Size();
 }
 
-class SinTable {
-public:
-    static constexpr float precision = 300.0f; // gradations per Pi, 942 entries of size float is under 4K or less than a memory page
-    static constexpr int modulus = (int)(M_PI * precision) + 1;
-    static constexpr int modulus2 = modulus * 2;
-
-    SinTable() {
-        for (int i = 0; i<modulus; i++) {
-            float f = i;
-            f /= precision;
-            table[i]=sinf(f);
-        }
-        /*
-        for (int x = -720; x <= 720; x++) {
-            float s = ((float)x)*3.14159f/180.0f;
-            printf("%d:\t%f\t%f\n", x, this->cos(s), cosf(s));
-        }
-         */
-    }
-    ~SinTable() {
-    }
-    float table[modulus]; // lookup table
-
-    float sinLookup(int a) {
-        if (a >= 0) {
-            int idx = a%(modulus2);
-            if (idx >= modulus) {
-                idx -= modulus;
-                return -table[idx];
-            }
-            return table[idx];
-        }
-        int idx = -a%(modulus2);
-        if (idx >= modulus) {
-            idx -= modulus;
-            return table[idx];
-        }
-        return -table[idx];
-    }
-    float sin(float rad) {
-        float idx = rad * precision + 0.5f;
-        return sinLookup((int)idx);
-    }
-    float cos(float a) {
-        return this->sin(a + M_PI_2);
-    }
-};
 static SinTable sinTable;
 
 float RenderBuffer::sin(float rad)
@@ -981,6 +831,38 @@ void RenderBuffer::GetMultiColorBlend(float n, bool circular, xlColor &color, in
     Get2ColorBlend(coloridx1, coloridx2, ratio, color);
 }
 
+// GetMultiColorBlend for a row or column of positions with the palette looked up once
+void RenderBuffer::GetMultiColorBlend(const float* n, size_t count, bool circular, xlColor* colors, int reserveColours)
+{
+    size_t colorcnt = GetColorCount() - reserveColours;
+    if (colorcnt <= 1)
+    {
+        xlColor color;
+        palette.GetColor(0, color);
+        std::fill(colors, colors + count, color);
+        return;
+    }
+
+    xlColorVector pal(colorcnt);
+    for (size_t i = 0; i < colorcnt; i++)
+    {
+        pal[i] = palette.GetColor(i);
+    }
+    const float scale = circular ? colorcnt : colorcnt - 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        float v = n[i];
+        if (v >= 1.0) v = 0.99999f;
+        if (v < 0.0) v = 0.0f;
+        float realidx = v * scale;
+        int coloridx1 = floor(realidx);
+        int coloridx2 = (coloridx1 + 1) % colorcnt;
+        float ratio = realidx - float(coloridx1);
+        colors[i] = pal[coloridx1];
+        Get2ColorBlend(colors[i], pal[coloridx2], ratio);
+    }
+}
+
 // 0,0 is lower left
 void RenderBuffer::SetPixel(int x, int y, const xlColor &color, bool wrap, bool useAlpha, bool dmx_ignore)
 {
@@ -1398,6 +1280,102 @@ void RenderBuffer::FillConvexPoly(const std::vector<std::pair<int, int>>& opoly,
     }
 }
 
+PathRasterizer& RenderBuffer::GetPathRasterizer()
+{
+    _pathRasterizer.Reset(BufferWi, BufferHt);
+    return _pathRasterizer;
+}
+
+static inline void BlendOnto(xlColor& dst, const xlColor& src, uint8_t coverage, bool allowAlpha)
+{
+    const int a = (src.alpha * coverage + 127) / 255;
+    if (a == 0) {
+        return;
+    }
+    if (a == 255) {
+        dst = src;
+    } else if (allowAlpha) {
+        // source over, the result keeps an alpha so the layer still blends properly
+        const int da = dst.alpha * (255 - a) / 255;
+        const int oa = a + da;
+        dst.Set((src.red * a + dst.red * da) / oa, (src.green * a + dst.green * da) / oa, (src.blue * a + dst.blue * da) / oa, oa);
+    } else {
+        dst.Set((src.red * a + dst.red * (255 - a)) / 255, (src.green * a + dst.green * (255 - a)) / 255, (src.blue * a + dst.blue * (255 - a)) / 255);
+    }
+}
+
+void RenderBuffer::BlendCoverage(int y, int x, int count, const uint8_t* coverage, const xlColor& color)
+{
+    if (color.alpha == 0) {
+        return;
+    }
+    if (dmx_buffer) {
+        for (int i = 0; i < count; ++i) {
+            if (coverage[i] != 0) {
+                xlColor c = GetPixel(x + i, y);
+                BlendOnto(c, color, coverage[i], allowAlpha);
+                SetPixel(x + i, y, c);
+            }
+        }
+        return;
+    }
+    if ((size_t)(y * BufferWi + x + count) > pixelVector.size()) {
+        return;
+    }
+    xlColor* row = pixels + y * BufferWi + x;
+    for (int i = 0; i < count; ++i) {
+        BlendOnto(row[i], color, coverage[i], allowAlpha);
+    }
+}
+
+void RenderBuffer::FillPath(const PathRasterizer& path, const xlColor& color, bool evenOdd)
+{
+    path.Fill(evenOdd ? PathRasterizer::FillRule::EvenOdd : PathRasterizer::FillRule::NonZero,
+              [this, &color](int y, int x, int count, const uint8_t* coverage) {
+                  BlendCoverage(y, x, count, coverage, color);
+              });
+}
+
+void RenderBuffer::FillPath(const PathRasterizer& path, const std::vector<std::pair<float, xlColor>>& gradient, bool evenOdd)
+{
+    if (gradient.empty()) {
+        return;
+    }
+
+    // the gradient only runs vertically so work out each row's colour once
+    xlColorVector rowColors(BufferHt);
+    for (int y = 0; y < BufferHt; ++y) {
+        const float pos = (BufferHt - (y + 0.5f)) / BufferHt;
+        size_t i = 0;
+        while (i < gradient.size() && gradient[i].first < pos) {
+            ++i;
+        }
+        if (i == 0) {
+            rowColors[y] = gradient.front().second;
+        } else if (i == gradient.size()) {
+            rowColors[y] = gradient.back().second;
+        } else {
+            const auto& from = gradient[i - 1];
+            const auto& to = gradient[i];
+            const float ratio = to.first > from.first ? (pos - from.first) / (to.first - from.first) : 1.0f;
+            rowColors[y].Set(ChannelBlend(from.second.red, to.second.red, ratio), ChannelBlend(from.second.green, to.second.green, ratio),
+                             ChannelBlend(from.second.blue, to.second.blue, ratio), ChannelBlend(from.second.alpha, to.second.alpha, ratio));
+        }
+    }
+
+    path.Fill(evenOdd ? PathRasterizer::FillRule::EvenOdd : PathRasterizer::FillRule::NonZero,
+              [this, &rowColors](int y, int x, int count, const uint8_t* coverage) {
+                  BlendCoverage(y, x, count, coverage, rowColors[y]);
+              });
+}
+
+void RenderBuffer::StrokePath(const PathRasterizer& path, const xlColor& color, float thickness)
+{
+    path.Stroke(thickness, [this, &color](int y, int x, int count, const uint8_t* coverage) {
+        BlendCoverage(y, x, count, coverage, color);
+    });
+}
+
 void RenderBuffer::DrawFadingCircle(int x0, int y0, int radius, const xlColor& rgb, bool wrap)
 {
     HSVValue hsv(rgb);
@@ -1528,6 +1506,7 @@ void RenderBuffer::SetState(int period, bool ResetState, const std::string& mode
 {
     if (ResetState) {
         needToInit = true;
+        randomEngine.seed(curEffStartPer + 1);
     }
     curPeriod = period;
     curPeriod = period;
@@ -1557,6 +1536,55 @@ void RenderBuffer::CopyPixelsToTempBuf() {
     memcpy(tempbuf, pixels, pixelVector.size() * 4);
 }
 
+bool RenderBuffer::Snapshot(int effectId, RenderBufferSnapshot& snapshot) const {
+    snapshot.cache.reset();
+    auto it = infoCache.find(effectId);
+    if (it != infoCache.end() && it->second != nullptr) {
+        snapshot.cache.reset(it->second->Snapshot());
+        if (snapshot.cache == nullptr) {
+            return false;
+        }
+    }
+    snapshot.BufferWi = BufferWi;
+    snapshot.BufferHt = BufferHt;
+    snapshot.pixels.assign(pixels, pixels + pixelVector.size());
+    snapshot.tempbuf.assign(tempbuf, tempbuf + tempbufVector.size());
+    snapshot.randomEngine = randomEngine;
+    return true;
+}
+
+bool RenderBuffer::RestoreSnapshot(int effectId, const RenderBufferSnapshot& snapshot) {
+    if (snapshot.BufferWi != BufferWi || snapshot.BufferHt != BufferHt ||
+        snapshot.pixels.size() != pixelVector.size() || snapshot.tempbuf.size() != tempbufVector.size()) {
+        return false;
+    }
+    // the snapshot may be restored again later so the effect gets its own copy of the cache
+    EffectRenderCache* cache = nullptr;
+    if (snapshot.cache != nullptr) {
+        cache = snapshot.cache->Snapshot();
+        if (cache == nullptr) {
+            return false;
+        }
+    }
+    auto it = infoCache.find(effectId);
+    if (it != infoCache.end()) {
+        delete it->second;
+        infoCache.erase(it);
+    }
+    if (cache != nullptr) {
+        infoCache[effectId] = cache;
+    }
+    if (!pixelVector.empty()) {
+        memcpy(pixels, snapshot.pixels.data(), pixelVector.size() * sizeof(xlColor));
+    }
+    if (!tempbufVector.empty()) {
+        memcpy(tempbuf, snapshot.tempbuf.data(), tempbufVector.size() * sizeof(xlColor));
+    }
+    randomEngine = snapshot.randomEngine;
+    needToInit = false;
+    return true;
+}
+
 // Gets the maximum oversized buffer size a model could have
 // Useful for models which need to track data per cell as with value curves the buffer size could
 // get as large as this during the effect
@@ -1719,16 +1747,22 @@ RenderBuffer::RenderBuffer(RenderBuffer& buffer) : pixelVector(buffer.pixels, &b
     fadeinsteps = buffer.fadeinsteps;
     fadeoutsteps = buffer.fadeoutsteps;
     needToInit = buffer.needToInit;
+    randomEngine = buffer.randomEngine;
     allowAlpha = buffer.allowAlpha;
     dmx_buffer = buffer.dmx_buffer;
     _nodeBuffer = buffer._nodeBuffer;
     BufferHt = buffer.BufferHt;
     BufferWi = buffer.BufferWi;
     cur_model = buffer.cur_model;
+    palette = buffer.palette;
 
     pixels = &pixelVector[0];
+    // copies are used to render whole frames off the main buffer so they need their own scratch buffer
+    tempbufVector.resize(pixelVector.size());
+    if (!tempbufVector.empty()) {
+        tempbuf = &tempbufVector[0];
+    }
     _textDrawingContext = buffer._textDrawingContext;
-    _pathDrawingContext = buffer._pathDrawingContext;
     gpuRenderData = nullptr;
 }
 
@@ -1736,7 +1770,6 @@ void RenderBuffer::Forget()
 {
     // Forget some stuff as this is a fake render buffer and we dont want it destroyed
     _textDrawingContext = nullptr;
-    _pathDrawingContext = nullptr;
 }
 
 void RenderBuffer::SetPixelDMXModel(int x, int y, const xlColor& color)
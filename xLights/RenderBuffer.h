@@ -12,9 +12,11 @@
 
 #include <stdint.h>
 #include <map>
+#include <memory>
 #include <list>
 #include <vector>
 #include <atomic>
+#include <random>
 #include <wx/colour.h>
 #include <wx/dcclient.h>
 #include <wx/dcmemory.h>
@@ -26,6 +28,7 @@
 
 #include "Color.h"
 #include "ColorCurve.h"
+#include "PathRasterizer.h"
 #include "models/Node.h"
 
 //added hash_map, queue, vector: -DJ
@@ -92,41 +95,6 @@ protected:
     wxGraphicsContext *gc;
 };
 
-class PathDrawingContext : public DrawingContext {
-public:
-    PathDrawingContext(int BufferWi, int BufferHt, bool allowShared);
-    virtual ~PathDrawingContext();
-
-    static PathDrawingContext* GetContext();
-    static void ReleaseContext(PathDrawingContext* pdc);
-
-    virtual void Clear() override;
-
-    void SetPen(wxPen& pen);
-    void SetBrush(wxBrush& brush);
-    void SetBrush(wxGraphicsBrush& brush);
-    wxGraphicsBrush CreateLinearGradientBrush(wxDouble x1, wxDouble y1, wxDouble x2, wxDouble y2, const wxGraphicsGradientStops& stops) const
-    {
-        if (gc != nullptr)
-            return gc->CreateLinearGradientBrush(x1, y1, x2, y2, stops);
-
-        return wxGraphicsBrush();
-    }
-    wxGraphicsBrush CreateLinearGradientBrush(wxDouble x1, wxDouble y1, wxDouble x2, wxDouble y2, const wxColour& c1, const wxColour& c2) const
-    {
-        if (gc != nullptr)
-            return gc->CreateLinearGradientBrush(x1, y1, x2, y2, c1, c2);
-
-        return wxGraphicsBrush();
-    }
-
-    wxGraphicsPath CreatePath();
-    void StrokePath(wxGraphicsPath& path);
-    void FillPath(wxGraphicsPath& path, wxPolygonFillMode fillStyle);
-
-private:
-};
-
 constexpr char WIN_NATIVE_EMOJI_FONT[] = "Segoe UI Emoji";
 constexpr char OSX_NATIVE_EMOJI_FONT[] = "Apple Color Emoji";
 constexpr char LINUX_NATIVE_EMOJI_FONT[] = "Noto Color Emoji";
@@ -178,6 +146,19 @@ private:
     xlColorCurveVector cc;
     const ColorCurve nilcc;
 
+    // spatial colour curves sampled once per effect so colouring a pixel is a lookup rather than a walk of the curve,
+    // empty for curves that are not spatial or are random
+    static const int RAMP_SIZE = 4096;
+    std::vector<xlColorVector> ramps;
+
+    xlColor GetCurveValueAt(size_t idx, float offset) const
+    {
+        if (idx < ramps.size() && !ramps[idx].empty() && offset >= 0.0f && offset <= 1.0f) {
+            return ramps[idx][(int)(offset * (RAMP_SIZE - 1) + 0.5f)];
+        }
+        return cc[idx].GetValueAt(offset);
+    }
+
 public:
 
     void UpdateForProgress(float progress)
@@ -205,6 +186,20 @@ public:
         {
             hsv.push_back(newcolors[i].asHSV());
         }
+
+        ramps.clear();
+        ramps.resize(cc.size());
+        for (size_t i = 0; i < cc.size(); i++)
+        {
+            if (cc[i].IsActive() && cc[i].GetTimeCurve() != TC_TIME && cc[i].GetType() != "Random")
+            {
+                ramps[i].resize(RAMP_SIZE);
+                for (int j = 0; j < RAMP_SIZE; j++)
+                {
+                    ramps[i][j] = cc[i].GetValueAt((float)j / (float)(RAMP_SIZE - 1));
+                }
+            }
+        }
     }
 
     size_t Size() const
@@ -276,11 +271,11 @@ public:
         {
             if (type == TC_CW)
             {
-                return cc[idx].GetValueAt(round);
+                return GetCurveValueAt(idx, round);
             }
             else
             {
-                return cc[idx].GetValueAt(1.0 - round);
+                return GetCurveValueAt(idx, 1.0 - round);
             }
         }
         else
@@ -295,9 +290,9 @@ public:
         {
             double len = sqrt((x - centrex) * (x - centrex) + (y - centrey) * (y - centrey));
             if (type == TC_RADIALIN)
-                return cc[idx].GetValueAt(1.0 - len / maxradius);
+                return GetCurveValueAt(idx, 1.0 - len / maxradius);
             else
-                return cc[idx].GetValueAt(len / maxradius);
+                return GetCurveValueAt(idx, len / maxradius);
         }
         else
         {
@@ -354,16 +349,16 @@ public:
                 switch (cc[idx].GetTimeCurve())
                 {
                 case TC_RIGHT:
-                    c = cc[idx].GetValueAt(x);
+                    c = GetCurveValueAt(idx, x);
                     break;
                 case TC_LEFT:
-                    c = cc[idx].GetValueAt(1.0 - x);
+                    c = GetCurveValueAt(idx, 1.0 - x);
                     break;
                 case TC_UP:
-                    c = cc[idx].GetValueAt(y);
+                    c = GetCurveValueAt(idx, y);
                     break;
                 case TC_DOWN:
-                    c = cc[idx].GetValueAt(1.0 - y);
+                    c = GetCurveValueAt(idx, 1.0 - y);
                     break;
                 default:
                     c = color[idx];
@@ -438,6 +433,22 @@ class /*NCCDLLEXPORT*/ EffectRenderCache {
 public:
 	EffectRenderCache();
 	virtual ~EffectRenderCache();
+
+    // Returns a copy of the state the effect carries from frame to frame or nullptr if it can't be copied
+    virtual EffectRenderCache* Snapshot() const { return nullptr; }
+};
+
+// The state of a buffer for one effect after a frame so rendering can pick up from there later
+class /*NCCDLLEXPORT*/ RenderBufferSnapshot {
+public:
+    int BufferWi = 0;
+    int BufferHt = 0;
+    xlColorVector pixels;
+    xlColorVector tempbuf;
+    std::minstd_rand randomEngine;
+    std::unique_ptr<EffectRenderCache> cache;
+
+    size_t GetSize() const { return (pixels.size() + tempbuf.size()) * sizeof(xlColor); }
 };
 
 class /*NCCDLLEXPORT*/ RenderBuffer {
@@ -507,6 +518,14 @@ public:
 
     void FillConvexPoly(const std::vector<std::pair<int, int>>& poly, const xlColor& color);
 
+    // Anti-aliased drawing. Build the path on GetPathRasterizer(), which comes back empty and sized to the buffer,
+    // then fill or stroke it. Partly covered pixels are blended over what is already there.
+    PathRasterizer& GetPathRasterizer();
+    void FillPath(const PathRasterizer& path, const xlColor& color, bool evenOdd = false);
+    // gradient stops are positions 0-1 running from the top row of the buffer down to row 0
+    void FillPath(const PathRasterizer& path, const std::vector<std::pair<float, xlColor>>& gradient, bool evenOdd = false);
+    void StrokePath(const PathRasterizer& path, const xlColor& color, float thickness);
+
     //approximation of sin/cos, but much faster
     static float sin(float rad);
     static float cos(float rad);
@@ -520,6 +539,7 @@ public:
     void Get2ColorBlend(xlColor& color, xlColor color2, float ratio);
     void Get2ColorAlphaBlend(const xlColor& c1, const xlColor& c2, float ratio, xlColor &color);
     void GetMultiColorBlend(float n, bool circular, xlColor &color, int reserveColors = 0);
+    void GetMultiColorBlend(const float* n, size_t count, bool circular, xlColor* colors, int reserveColors = 0);
     void SetRangeColor(const HSVValue& hsv1, const HSVValue& hsv2, HSVValue& newhsv);
     double RandomRange(double num1, double num2) const;
     void Color2HSV(const xlColor& color, HSVValue& hsv) const;
@@ -529,7 +549,6 @@ public:
     float GetEffectTimeIntervalPosition() const;
     float GetEffectTimeIntervalPosition(float cycles) const;
 
-    PathDrawingContext * GetPathDrawingContext();
     TextDrawingContext * GetTextDrawingContext();
 
     void CopyPixelsToDisplayListX(Effect *eff, int y, int sx, int ex, int inc = 1);
@@ -558,8 +577,17 @@ public:
     xlColor *GetTempBuf() { return tempbuf; }
     void CopyTempBufToPixels();
     void CopyPixelsToTempBuf();
+    // effectId is the RenderableEffect id the effect keys its infoCache entry with
+    bool Snapshot(int effectId, RenderBufferSnapshot& snapshot) const;
+    bool RestoreSnapshot(int effectId, const RenderBufferSnapshot& snapshot);
     wxPoint GetMaxBuffer(const SettingsMap& SettingsMap) const;
 
+    // Random numbers for the effects that carry state from frame to frame. Reseeded as each effect starts and
+    // kept in snapshots so a render resumed from a checkpoint draws the same numbers a full render would.
+    // Same range as rand()
+    int Rand() { return (int)(randomEngine() % ((uint32_t)RAND_MAX + 1)); }
+    double Rand01() { return (double)Rand() / (double)RAND_MAX; }
+
     PaletteClass palette;
     bool _nodeBuffer = false;
 
@@ -576,6 +604,7 @@ public:
     int fadeoutsteps = 0;
 
     bool needToInit = false;
+    std::minstd_rand randomEngine;
     bool allowAlpha = false;
     bool dmx_buffer = false;
     bool _isCopy = false;
@@ -588,9 +617,11 @@ public:
 
 private:
     friend class PixelBufferClass;
-    std::vector<NodeBaseClassPtr> Nodes;
-    PathDrawingContext *_pathDrawingContext = nullptr;
+    RenderBufferNodes Nodes;
     TextDrawingContext *_textDrawingContext = nullptr;
+    PathRasterizer _pathRasterizer;
+
+    void BlendCoverage(int y, int x, int count, const uint8_t* coverage, const xlColor& color);
 
     void SetPixelDMXModel(int x, int y, const xlColor& color);
     void Forget();
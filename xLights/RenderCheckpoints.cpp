@@ -0,0 +1,133 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "RenderCheckpoints.h"
+
+RenderCheckpointStore::RenderCheckpointStore(size_t maxSizeMB)
+{
+    _maxSize = maxSizeMB * 1024 * 1024;
+}
+
+void RenderCheckpointStore::Save(const std::string& model, int layer, int frame, const std::string& signature, std::shared_ptr<RenderLayerCheckpoint> checkpoint)
+{
+    if (checkpoint == nullptr) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_lock);
+    auto& checkpoints = _checkpoints[LayerKey(model, layer)];
+    auto it = checkpoints.find(frame);
+    if (it != checkpoints.end()) {
+        Erase(checkpoints, it);
+    }
+    Entry& e = checkpoints[frame];
+    e.signature = signature;
+    e.checkpoint = checkpoint;
+    e.size = checkpoint->GetSize();
+    e.lastUsed = ++_uses;
+    _size += e.size;
+    _count++;
+    Trim();
+}
+
+std::shared_ptr<RenderLayerCheckpoint> RenderCheckpointStore::Find(const std::string& model, int layer, int minFrame, int frame, const std::string& signature, int& checkpointFrame)
+{
+    checkpointFrame = -1;
+    std::unique_lock<std::mutex> lock(_lock);
+    auto cps = _checkpoints.find(LayerKey(model, layer));
+    if (cps == _checkpoints.end()) {
+        return nullptr;
+    }
+    auto& checkpoints = cps->second;
+    std::shared_ptr<RenderLayerCheckpoint> res;
+    auto it = checkpoints.upper_bound(frame);
+    while (it != checkpoints.begin()) {
+        --it;
+        if (it->first < minFrame) {
+            break;
+        }
+        if (it->second.signature != signature) {
+            auto stale = it++;
+            Erase(checkpoints, stale);
+            continue;
+        }
+        if (res == nullptr) {
+            res = it->second.checkpoint;
+            checkpointFrame = it->first;
+            it->second.lastUsed = ++_uses;
+        }
+    }
+    if (checkpoints.empty()) {
+        _checkpoints.erase(cps);
+    }
+    return res;
+}
+
+void RenderCheckpointStore::Purge()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _checkpoints.clear();
+    _size = 0;
+    _count = 0;
+}
+
+void RenderCheckpointStore::SetMaximumSizeMB(size_t maxSizeMB)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _maxSize = maxSizeMB * 1024 * 1024;
+    Trim();
+}
+
+size_t RenderCheckpointStore::GetSize() const
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _size;
+}
+
+size_t RenderCheckpointStore::GetCount() const
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _count;
+}
+
+void RenderCheckpointStore::Erase(std::map<int, Entry>& layer, std::map<int, Entry>::iterator it)
+{
+    _size -= it->second.size;
+    _count--;
+    layer.erase(it);
+}
+
+// must hold the lock
+void RenderCheckpointStore::Trim()
+{
+    while (_size > _maxSize && _count > 0) {
+        // drop whichever checkpoint has gone longest without being saved or used
+        std::map<int, Entry>* oldestLayer = nullptr;
+        std::map<int, Entry>::iterator oldest;
+        for (auto& l : _checkpoints) {
+            for (auto it = l.second.begin(); it != l.second.end(); ++it) {
+                if (oldestLayer == nullptr || it->second.lastUsed < oldest->second.lastUsed) {
+                    oldestLayer = &l.second;
+                    oldest = it;
+                }
+            }
+        }
+        if (oldestLayer == nullptr) {
+            break;
+        }
+        Erase(*oldestLayer, oldest);
+    }
+    for (auto it = _checkpoints.begin(); it != _checkpoints.end();) {
+        if (it->second.empty()) {
+            it = _checkpoints.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
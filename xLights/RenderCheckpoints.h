@@ -0,0 +1,69 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// The state of one layer of a model after a frame was rendered
+class RenderLayerCheckpoint
+{
+public:
+    virtual ~RenderLayerCheckpoint() {}
+    virtual size_t GetSize() const = 0;
+};
+
+// Layer checkpoints taken while rendering stateful effects. A later render of part of the effect can resume from the
+// nearest checkpoint rather than re-running the effect from its start. Each checkpoint carries a signature of the
+// effect it was taken from and is only handed back for the same signature so edited effects never resume from stale
+// state.
+class RenderCheckpointStore
+{
+public:
+    RenderCheckpointStore(size_t maxSizeMB = 256);
+    virtual ~RenderCheckpointStore() {}
+
+    // replaces any checkpoint already held for the layer at that frame, frame is the first frame still to render
+    void Save(const std::string& model, int layer, int frame, const std::string& signature, std::shared_ptr<RenderLayerCheckpoint> checkpoint);
+
+    // The latest checkpoint for the layer taken at a frame in minFrame to frame for the given signature. Checkpoints
+    // in that range with a different signature are dropped as the effect they came from has changed.
+    std::shared_ptr<RenderLayerCheckpoint> Find(const std::string& model, int layer, int minFrame, int frame, const std::string& signature, int& checkpointFrame);
+
+    void Purge();
+    void SetMaximumSizeMB(size_t maxSizeMB);
+    size_t GetSize() const;
+    size_t GetCount() const;
+
+private:
+    struct Entry
+    {
+        std::string signature;
+        std::shared_ptr<RenderLayerCheckpoint> checkpoint;
+        size_t size = 0;
+        uint64_t lastUsed = 0;
+    };
+    typedef std::pair<std::string, int> LayerKey;
+
+    void Erase(std::map<int, Entry>& layer, std::map<int, Entry>::iterator it);
+    void Trim();
+
+    mutable std::mutex _lock;
+    std::map<LayerKey, std::map<int, Entry>> _checkpoints;
+    size_t _size = 0;
+    size_t _count = 0;
+    size_t _maxSize = 0;
+    uint64_t _uses = 0;
+};
@@ -0,0 +1,121 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "RenderTaskGraph.h"
+
+#include <algorithm>
+
+RenderTaskGraph::Task* RenderTaskGraph::AddTask(const std::string& name, int startFrame, int endFrame, std::function<void()>&& work, void* data)
+{
+    Task* task = new Task();
+    task->_name = name;
+    task->_startFrame = startFrame;
+    task->_endFrame = endFrame;
+    task->_work = std::move(work);
+    task->_data = data;
+    _tasks.emplace_back(task);
+    return task;
+}
+
+bool RenderTaskGraph::AddDependency(Task* before, Task* after)
+{
+    if (before == nullptr || after == nullptr || before == after) {
+        return false;
+    }
+    if (std::find(after->_predecessors.begin(), after->_predecessors.end(), before) != after->_predecessors.end()) {
+        return false;
+    }
+    before->_successors.push_back(after);
+    after->_predecessors.push_back(before);
+    after->_pending++;
+    return true;
+}
+
+int64_t RenderTaskGraph::Now() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _startTime).count();
+}
+
+void RenderTaskGraph::Start(std::function<void(Task*)>&& schedule)
+{
+    _schedule = std::move(schedule);
+    _startTime = std::chrono::steady_clock::now();
+
+    // collect the roots before scheduling any of them as once the first is running the counts start changing
+    std::vector<Task*> ready;
+    for (const auto& it : _tasks) {
+        if (it->_pending == 0) {
+            it->_readyUS = 0;
+            ready.push_back(it.get());
+        }
+    }
+    _remaining = (int)_tasks.size();
+    for (const auto& it : ready) {
+        _schedule(it);
+    }
+}
+
+void RenderTaskGraph::Run(Task* task)
+{
+    task->_startUS = Now();
+    task->_work();
+    task->_endUS = Now();
+
+    for (const auto& it : task->_successors) {
+        if (--it->_pending == 0) {
+            it->_readyUS = Now();
+            _schedule(it);
+        }
+    }
+
+    // this must be the last thing touched as the graph can be deleted as soon as it reaches zero
+    --_remaining;
+}
+
+std::vector<RenderTaskTiming> RenderTaskGraph::GetTimings() const
+{
+    std::vector<RenderTaskTiming> res;
+    res.reserve(_tasks.size());
+
+    const Task* last = nullptr;
+    for (const auto& it : _tasks) {
+        if (it->_endUS >= 0 && (last == nullptr || it->_endUS > last->_endUS)) {
+            last = it.get();
+        }
+    }
+
+    std::vector<const Task*> critical;
+    while (last != nullptr) {
+        critical.push_back(last);
+        const Task* prior = nullptr;
+        for (const auto& it : last->_predecessors) {
+            if (it->_endUS >= 0 && (prior == nullptr || it->_endUS > prior->_endUS)) {
+                prior = it;
+            }
+        }
+        last = prior;
+    }
+
+    for (const auto& it : _tasks) {
+        if (it->_endUS < 0) {
+            continue;
+        }
+        RenderTaskTiming t;
+        t.name = it->_name;
+        t.startFrame = it->_startFrame;
+        t.endFrame = it->_endFrame;
+        t.readyMS = it->_readyUS / 1000.0;
+        t.startMS = it->_startUS / 1000.0;
+        t.endMS = it->_endUS / 1000.0;
+        t.critical = std::find(critical.begin(), critical.end(), it.get()) != critical.end();
+        res.push_back(t);
+    }
+    return res;
+}
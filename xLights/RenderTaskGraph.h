@@ -0,0 +1,90 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct RenderTaskTiming {
+    std::string name;
+    int startFrame = 0;
+    int endFrame = 0;
+    // milliseconds since the graph was started
+    double readyMS = 0;
+    double startMS = 0;
+    double endMS = 0;
+    bool critical = false;
+};
+
+// A render planned as a graph of tasks where each task is one model over a range of frames. Every task counts the
+// tasks it depends on that have not finished and it is only handed to the scheduler once that count reaches zero,
+// so a running task never has to wait on another one.
+class RenderTaskGraph {
+public:
+    class Task {
+    public:
+        const std::string& GetName() const { return _name; }
+        int GetStartFrame() const { return _startFrame; }
+        int GetEndFrame() const { return _endFrame; }
+        void* GetData() const { return _data; }
+
+    private:
+        friend class RenderTaskGraph;
+
+        std::string _name;
+        int _startFrame = 0;
+        int _endFrame = 0;
+        void* _data = nullptr;
+        std::function<void()> _work;
+        std::vector<Task*> _successors;
+        std::vector<Task*> _predecessors;
+        std::atomic_int _pending{ 0 };
+        int64_t _readyUS = -1;
+        int64_t _startUS = -1;
+        int64_t _endUS = -1;
+    };
+
+    RenderTaskGraph() {}
+    virtual ~RenderTaskGraph() {}
+
+    // data is not used by the graph, it is there for the scheduler
+    Task* AddTask(const std::string& name, int startFrame, int endFrame, std::function<void()>&& work, void* data = nullptr);
+    // after will not be scheduled until before has run, returns false if the dependency was already there
+    bool AddDependency(Task* before, Task* after);
+
+    // Hands every task with nothing to wait for to schedule. Tasks must not be added once the graph is started.
+    void Start(std::function<void(Task*)>&& schedule);
+    // Called by whatever schedule handed the task to. Once the task has finished any task that was only waiting on
+    // it is passed to schedule.
+    void Run(Task* task);
+
+    // when this returns true no thread will touch the graph again so it can be deleted
+    bool IsComplete() const { return _remaining == 0; }
+    size_t GetTaskCount() const { return _tasks.size(); }
+    size_t GetRemainingTaskCount() const { return _remaining; }
+
+    // Timings of the tasks that have finished. The critical path is traced back from the last task to finish through
+    // whichever dependency finished last.
+    std::vector<RenderTaskTiming> GetTimings() const;
+
+private:
+    int64_t Now() const;
+
+    std::vector<std::unique_ptr<Task>> _tasks;
+    std::function<void(Task*)> _schedule;
+    std::atomic_int _remaining{ 0 };
+    std::chrono::steady_clock::time_point _startTime;
+};
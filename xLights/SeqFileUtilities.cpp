@@ -54,6 +54,8 @@
 #include "effects/PinwheelEffect.h"
 #include "effects/SnowflakesEffect.h"
 #include "effects/SpiralsEffect.h"
+#include "CheckSequenceCache.h"
+#include "effects/SharedImageCache.h"
 
 #include "xLightsApp.h"
 #include "xLightsMain.h"
@@ -634,6 +636,9 @@ bool xLightsFrame::CloseSequence()
 
     _renderCache.CleanupCache(&_sequenceElements);
     _renderCache.SetSequence(renderCacheDirectory, "");
+    _renderCheckpoints.Purge();
+    SharedImageCache::Instance().Purge();
+    CheckSequenceCache::Instance().Purge();
 
     // clear everything to prepare for new sequence
     if (displayElementsPanel != nullptr)
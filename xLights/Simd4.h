@@ -0,0 +1,125 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+
+// A small 4 wide float wrapper shared by the span colour conversions and the CPU effect kernels. Only include it
+// from .cpp files, the names are short and global.
+//
+// SSE2 is always there on x64 and NEON on arm64 so neither needs a runtime check. Everything else uses the plain
+// loops which also finish off whatever is left over after the last 4 pixels. 32 bit ARM stays on the plain loops as
+// its NEON has no divide.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD4_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIMD4_NEON
+#include <arm_neon.h>
+#endif
+
+// The 4 wide kernels are written once against these few operations. Comparisons give a mask which Select uses to
+// pick lanes and MaskBits turns into a bit per lane for the odd bit of per pixel work that can't be done 4 wide.
+#if defined(SIMD4_SSE2)
+#define SIMD4_VECTOR
+typedef __m128 F4;
+typedef __m128 M4;
+typedef __m128i I4;
+static inline F4 Load(const float* p) { return _mm_loadu_ps(p); }
+static inline void Store(float* p, F4 v) { _mm_storeu_ps(p, v); }
+static inline F4 Splat(float f) { return _mm_set1_ps(f); }
+static inline F4 Add(F4 a, F4 b) { return _mm_add_ps(a, b); }
+static inline F4 Sub(F4 a, F4 b) { return _mm_sub_ps(a, b); }
+static inline F4 Mul(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+static inline F4 Div(F4 a, F4 b) { return _mm_div_ps(a, b); }
+static inline F4 Abs(F4 a) { return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF))); }
+static inline M4 Eq(F4 a, F4 b) { return _mm_cmpeq_ps(a, b); }
+static inline M4 Lt(F4 a, F4 b) { return _mm_cmplt_ps(a, b); }
+static inline M4 Gt(F4 a, F4 b) { return _mm_cmpgt_ps(a, b); }
+static inline M4 Ge(F4 a, F4 b) { return _mm_cmpge_ps(a, b); }
+static inline M4 Le(F4 a, F4 b) { return _mm_cmple_ps(a, b); }
+static inline M4 And(M4 a, M4 b) { return _mm_and_ps(a, b); }
+static inline M4 Or(M4 a, M4 b) { return _mm_or_ps(a, b); }
+static inline F4 Select(M4 m, F4 a, F4 b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+static inline I4 ToInt(F4 a) { return _mm_cvttps_epi32(a); }
+static inline F4 ToFloat(I4 a) { return _mm_cvtepi32_ps(a); }
+static inline I4 LoadPixels(const uint8_t* p) { return _mm_loadu_si128((const __m128i*)p); }
+static inline void StorePixels(uint8_t* p, I4 v) { _mm_storeu_si128((__m128i*)p, v); }
+static inline I4 Red(I4 px) { return _mm_and_si128(px, _mm_set1_epi32(0xFF)); }
+static inline I4 Green(I4 px) { return _mm_and_si128(_mm_srli_epi32(px, 8), _mm_set1_epi32(0xFF)); }
+static inline I4 Blue(I4 px) { return _mm_and_si128(_mm_srli_epi32(px, 16), _mm_set1_epi32(0xFF)); }
+static inline I4 Pack(I4 r, I4 g, I4 b, I4 old)
+{
+    const I4 alpha = _mm_and_si128(old, _mm_set1_epi32((int)0xFF000000));
+    return _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), alpha));
+}
+static inline F4 Min(F4 a, F4 b) { return _mm_min_ps(a, b); }
+static inline F4 Max(F4 a, F4 b) { return _mm_max_ps(a, b); }
+static inline F4 Sqrt(F4 a) { return _mm_sqrt_ps(a); }
+static inline F4 Ramp(float start) { return _mm_setr_ps(start, start + 1.0f, start + 2.0f, start + 3.0f); }
+static inline int MaskBits(M4 m) { return _mm_movemask_ps(m); }
+#elif defined(SIMD4_NEON)
+#define SIMD4_VECTOR
+typedef float32x4_t F4;
+typedef uint32x4_t M4;
+typedef int32x4_t I4;
+static inline F4 Load(const float* p) { return vld1q_f32(p); }
+static inline void Store(float* p, F4 v) { vst1q_f32(p, v); }
+static inline F4 Splat(float f) { return vdupq_n_f32(f); }
+static inline F4 Add(F4 a, F4 b) { return vaddq_f32(a, b); }
+static inline F4 Sub(F4 a, F4 b) { return vsubq_f32(a, b); }
+static inline F4 Mul(F4 a, F4 b) { return vmulq_f32(a, b); }
+static inline F4 Div(F4 a, F4 b) { return vdivq_f32(a, b); }
+static inline F4 Abs(F4 a) { return vabsq_f32(a); }
+static inline M4 Eq(F4 a, F4 b) { return vceqq_f32(a, b); }
+static inline M4 Lt(F4 a, F4 b) { return vcltq_f32(a, b); }
+static inline M4 Gt(F4 a, F4 b) { return vcgtq_f32(a, b); }
+static inline M4 Ge(F4 a, F4 b) { return vcgeq_f32(a, b); }
+static inline M4 Le(F4 a, F4 b) { return vcleq_f32(a, b); }
+static inline M4 And(M4 a, M4 b) { return vandq_u32(a, b); }
+static inline M4 Or(M4 a, M4 b) { return vorrq_u32(a, b); }
+static inline F4 Select(M4 m, F4 a, F4 b) { return vbslq_f32(m, a, b); }
+static inline I4 ToInt(F4 a) { return vcvtq_s32_f32(a); }
+static inline F4 ToFloat(I4 a) { return vcvtq_f32_s32(a); }
+static inline I4 LoadPixels(const uint8_t* p) { return vreinterpretq_s32_u8(vld1q_u8(p)); }
+static inline void StorePixels(uint8_t* p, I4 v) { vst1q_u8(p, vreinterpretq_u8_s32(v)); }
+static inline I4 Red(I4 px) { return vandq_s32(px, vdupq_n_s32(0xFF)); }
+static inline I4 Green(I4 px) { return vandq_s32(vshrq_n_s32(px, 8), vdupq_n_s32(0xFF)); }
+static inline I4 Blue(I4 px) { return vandq_s32(vshrq_n_s32(px, 16), vdupq_n_s32(0xFF)); }
+static inline I4 Pack(I4 r, I4 g, I4 b, I4 old)
+{
+    const I4 alpha = vandq_s32(old, vdupq_n_s32((int)0xFF000000));
+    return vorrq_s32(vorrq_s32(r, vshlq_n_s32(g, 8)), vorrq_s32(vshlq_n_s32(b, 16), alpha));
+}
+static inline F4 Min(F4 a, F4 b) { return vminq_f32(a, b); }
+static inline F4 Max(F4 a, F4 b) { return vmaxq_f32(a, b); }
+static inline F4 Sqrt(F4 a) { return vsqrtq_f32(a); }
+static inline F4 Ramp(float start)
+{
+    const float v[4] = { start, start + 1.0f, start + 2.0f, start + 3.0f };
+    return vld1q_f32(v);
+}
+static inline int MaskBits(M4 m)
+{
+    const uint32_t bits[4] = { 1, 2, 4, 8 };
+    return (int)vaddvq_u32(vandq_u32(m, vld1q_u32(bits)));
+}
+#endif
+
+#ifdef SIMD4_VECTOR
+// floor by way of int, beyond +-2^22 floats are whole numbers anyway so clamping there changes nothing
+static inline F4 Floor(F4 a)
+{
+    const F4 c = Select(Gt(a, Splat(-4194304.0f)), Select(Lt(a, Splat(4194304.0f)), a, Splat(4194304.0f)), Splat(-4194304.0f));
+    const F4 trunc = ToFloat(ToInt(c));
+    return Sub(trunc, Select(Gt(trunc, c), Splat(1.0f), Splat(0.0f)));
+}
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cmath>
+
+// The lookup table behind RenderBuffer::sin and cos. The CPU effect kernels use it too so they draw exactly what the
+// scalar effect code does, its period is a little longer than 2 pi so real sin slowly drifts away from it.
+class SinTable {
+public:
+    static constexpr double pi = 3.14159265358979323846;
+    static constexpr float precision = 300.0f; // gradations per Pi, 942 entries of size float is under 4K or less than a memory page
+    static constexpr int modulus = (int)(pi * precision) + 1;
+    static constexpr int modulus2 = modulus * 2;
+
+    SinTable() {
+        for (int i = 0; i<modulus; i++) {
+            float f = i;
+            f /= precision;
+            table[i]=sinf(f);
+        }
+        /*
+        for (int x = -720; x <= 720; x++) {
+            float s = ((float)x)*3.14159f/180.0f;
+            printf("%d:\t%f\t%f\n", x, this->cos(s), cosf(s));
+        }
+         */
+    }
+    ~SinTable() {
+    }
+    float table[modulus]; // lookup table
+
+    float sinLookup(int a) const {
+        if (a >= 0) {
+            int idx = a%(modulus2);
+            if (idx >= modulus) {
+                idx -= modulus;
+                return -table[idx];
+            }
+            return table[idx];
+        }
+        int idx = -a%(modulus2);
+        if (idx >= modulus) {
+            idx -= modulus;
+            return table[idx];
+        }
+        return -table[idx];
+    }
+    float sin(float rad) const {
+        float idx = rad * precision + 0.5f;
+        return sinLookup((int)idx);
+    }
+    float cos(float a) const {
+        return this->sin(a + pi / 2.0);
+    }
+};
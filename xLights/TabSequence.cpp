@@ -1166,6 +1166,19 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
         EnableSequenceControls(true);
         logger_base.debug("Batch render done.");
         printf("Done All Files\n");
+        float totalSecs = 0.0f;
+        for (const auto& t : _batchRenderTimings) {
+            float secs = t.loadSecs + t.renderSecs + t.writeSecs;
+            totalSecs += secs;
+            logger_base.info("Batch render timing: %s  load %0.3fs  render %0.3fs  fseq %0.3fs  total %0.3fs",
+                             (const char*)t.sequence.c_str(), t.loadSecs, t.renderSecs, t.writeSecs, secs);
+            printf("    %s  load %0.3fs  render %0.3fs  fseq %0.3fs  total %0.3fs\n",
+                   (const char*)t.sequence.c_str(), t.loadSecs, t.renderSecs, t.writeSecs, secs);
+        }
+        logger_base.info("Batch render of %d sequences took %0.3fs.", (int)_batchRenderTimings.size(), totalSecs);
+        printf("Batch render of %d sequences took %0.3fs.\n", (int)_batchRenderTimings.size(), totalSecs);
+        _lastBatchRenderTimings = std::move(_batchRenderTimings);
+        _batchRenderTimings.clear();
         wxBell();
         if (exitOnDone) {
             Destroy();
@@ -1179,6 +1192,7 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     if (wxGetKeyState(WXK_ESCAPE))
     {
         logger_base.debug("Batch render cancelled.");
+        _batchRenderTimings.clear();
         EnableSequenceControls(true);
         printf("Batch render cancelled.\n");
         if (exitOnDone) {
@@ -1210,6 +1224,7 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     logger_base.debug("Batch Render Processing file %s\n", (const char *)seq.c_str());
     OpenSequence(seq, nullptr);
     EnableSequenceControls(false);
+    long loadMS = sw.Time();
 
     // if the fseq directory is not the show directory then ensure the fseq folder is set right
     if (fseqDirectory != showDirectory) {
@@ -1230,9 +1245,10 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     RenderIseqData(true, nullptr); // render ISEQ layers below the Nutcracker layer
     logger_base.info("   iseq below effects done.");
     ProgressBar->SetValue(10);
-    RenderGridToSeqData([this, sw, fileNames, exitOnDone, alreadyRetried] (bool aborted) {
+    RenderGridToSeqData([this, sw, loadMS, fileNames, exitOnDone, alreadyRetried] (bool aborted) {
         static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
         logger_base.info("   Effects done.");
+        long renderMS = sw.Time();
         ProgressBar->SetValue(90);
         RenderIseqData(false, nullptr);  // render ISEQ layers above the Nutcracker layer
         logger_base.info("   iseq above effects done. Render complete.");
@@ -1249,6 +1265,12 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
             logger_base.info("fseq file done.");
             DisplayXlightsFilename(xlightsFilename);
             float elapsedTime = sw.Time() / 1000.0; // now stop stopwatch timer and get elapsed time. change into seconds from ms
+            BatchRenderTiming timing;
+            timing.sequence = fileNames[0].ToStdString();
+            timing.loadSecs = loadMS / 1000.0;
+            timing.renderSecs = (renderMS - loadMS) / 1000.0;
+            timing.writeSecs = elapsedTime - renderMS / 1000.0;
+            _batchRenderTimings.push_back(timing);
             wxString displayBuff = wxString::Format(_("%s     Updated in %7.3f seconds"), xlightsFilename, elapsedTime);
             logger_base.info("%s", (const char*)displayBuff.c_str());
             CallAfter(&xLightsFrame::SetStatusText, displayBuff, 0);
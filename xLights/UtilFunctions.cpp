@@ -500,7 +500,8 @@ bool IsFileInShowDir(const wxString& showDir, const std::string filename)
     )) {
         return true;
     }
-    for (auto &d : SearchDirectories) {
+    // d is a copy as check sequence asks this from several threads at once
+    for (auto d : SearchDirectories) {
 #ifdef __WXMSW__
         transform(d.begin(), d.end(), d.begin(), ::tolower);
 #endif
@@ -227,8 +227,34 @@ void GenericVideoExporter::initialize()
     _ptsIncrement = av_rescale_q(1, _videoCodecContext->time_base, _formatContext->streams[0]->time_base);
 }
 
+namespace
+{
+    // another encoder for the same codec that isnt VideoToolbox, mpeg4 if there isnt one
+    const AVCodec* findSoftwareEncoder(const AVCodec* codec)
+    {
+        void* cio = nullptr;
+        const AVCodec* ci = ::av_codec_iterate(&cio);
+        while (ci != nullptr) {
+            if (::av_codec_is_encoder(ci) && ci->id == codec->id && (ci->pix_fmts == nullptr || ci->pix_fmts[0] != AV_PIX_FMT_VIDEOTOOLBOX)) {
+                return ci;
+            }
+            ci = ::av_codec_iterate(&cio);
+        }
+        return ::avcodec_find_encoder_by_name("mpeg4");
+    }
+}
+
 bool GenericVideoExporter::initializeVideo(const AVCodec* codec)
 {
+    if (_softwareEncoder && codec->pix_fmts != nullptr && codec->pix_fmts[0] == AV_PIX_FMT_VIDEOTOOLBOX) {
+        const AVCodec* sw = findSoftwareEncoder(codec);
+        if (sw == nullptr) {
+            throw std::runtime_error("VideoExporter - No software video encoder available");
+        }
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        logger_base.info("VideoExporter - using %s rather than %s.", sw->name, codec->name);
+        codec = sw;
+    }
     _videoCodecContext = ::avcodec_alloc_context3(codec);
     _videoCodecContext->time_base.num = 1000;
     _videoCodecContext->time_base.den = _outParams.fps * 1000;
@@ -65,6 +65,8 @@ public:
    void setGetAudioCallback( GetAudioFrameCb fn ) { _getAudio = fn; }
    void setQueryForCancelCallback( QueryForCancelCb fn ) { _queryForCancel = fn; }
    void setProgressReportCallback( ProgressReportCb fn ) { _progressReporter = fn; }
+   // frames that are only ever in memory can't be handed to VideoToolbox as images so it must not be used
+   void setSoftwareEncoder( bool sw ) { _softwareEncoder = sw; }
 
    void initialize();
    void exportFrames( int videoFrameCount );
@@ -104,6 +106,7 @@ protected:
    ProgressReportCb        _progressReporter = nullptr;
    uint32_t                _curVideoFrame = 0;
    int64_t                 _curPts = 0LL;
+   bool                    _softwareEncoder = false;
 };
 
 class VideoExporter : public GenericVideoExporter
@@ -29,6 +29,7 @@
 #include "../../xSchedule/wxHTTPServer/wxhttpserver.h"
 #include "../sequencer/MainSequencer.h"
 #include <wx/uri.h>
+#include <wx/stopwatch.h>
 
 #include "LuaRunner.h"
 
@@ -242,16 +243,39 @@ bool xLightsFrame::ProcessAutomation(std::vector<std::string> &paths,
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_RELOAD_MODEL_FROM_XML, "Automation::renderAll");
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_MODELS_CHANGE_REQUIRING_RERENDER, "Automation::renderAll");
         }
+        auto parallelFrames = _parallelFrameRender;
+        if (params["parallelFrames"] == "true") {
+            _parallelFrameRender = true;
+        } else if (params["parallelFrames"] == "false") {
+            _parallelFrameRender = false;
+        }
+        wxStopWatch sw;
         RenderAll();
         while (mRendering) {
             wxYield();
         }
+        long renderMS = sw.Time();
+        _parallelFrameRender = parallelFrames;
         if (ld != _lowDefinitionRender) {
             _lowDefinitionRender = ld;
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_RELOAD_MODEL_FROM_XML, "Automation::renderAll");
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_MODELS_CHANGE_REQUIRING_RERENDER, "Automation::renderAll");
         }
-        return sendResponse("Rendered.", "msg", 200, false);
+        std::string response = wxString::Format("{\"msg\":\"Rendered.\",\"render\":%0.3f}", renderMS / 1000.0);
+        return sendResponse(response, "", 200, true);
+    } else if (cmd == "getRenderTaskTimings") {
+        std::string response = "{\"tasks\":[";
+        bool first = true;
+        for (const auto& t : GetLastRenderTaskTimings()) {
+            if (!first) {
+                response += ",";
+            }
+            first = false;
+            response += wxString::Format("{\"model\":\"%s\",\"start\":%d,\"end\":%d,\"ready\":%0.3f,\"started\":%0.3f,\"finished\":%0.3f,\"critical\":%s}",
+                                         JSONSafe(t.name), t.startFrame, t.endFrame, t.readyMS, t.startMS, t.endMS, t.critical ? "true" : "false");
+        }
+        response += "]}";
+        return sendResponse(response, "", 200, true);
     } else if (cmd == "batchRender") {
         wxArrayString files;
 
@@ -292,7 +316,18 @@ bool xLightsFrame::ProcessAutomation(std::vector<std::string> &paths,
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_RELOAD_MODEL_FROM_XML, "Automation::batchRender");
             _outputModelManager.AddImmediateWork(OutputModelManager::WORK_MODELS_CHANGE_REQUIRING_RERENDER, "Automation::batchRender");
         }
-        return sendResponse("Sequence batch rendered.", "msg", 200, false);
+        std::string response = "{\"msg\":\"Sequence batch rendered.\",\"timings\":[";
+        bool first = true;
+        for (const auto& t : GetLastBatchRenderTimings()) {
+            if (!first) {
+                response += ",";
+            }
+            first = false;
+            response += wxString::Format("{\"seq\":\"%s\",\"load\":%0.3f,\"render\":%0.3f,\"fseq\":%0.3f}",
+                                         JSONSafe(t.sequence), t.loadSecs, t.renderSecs, t.writeSecs);
+        }
+        response += "]}";
+        return sendResponse(response, "", 200, true);
     } else if (cmd == "uploadController") {
         auto ip = params["ip"];
         Controller* c = _outputManager.GetControllerWithIP(ip);
@@ -776,7 +811,8 @@ bool xLightsFrame::ProcessAutomation(std::vector<std::string> &paths,
         if (filename == "" || filename == "null") {
             filename = CurrentDir + wxFileName::GetPathSeparator() + CurrentSeqXmlFile->GetName() + ".mp4";
         }
-        auto const worked = ExportVideoPreview(filename);
+        bool offscreen = ReadBool(params["offscreen"]);
+        auto const worked = ExportVideoPreview(filename, offscreen);
         if (worked) {
             std::string response = wxString::Format("{\"msg\":\"Export Video Preview.\",\"output\":\"%s\"}", JSONSafe(filename));
             return sendResponse(response, "", 200, true);
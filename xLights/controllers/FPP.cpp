@@ -13,8 +13,11 @@
 #endif
 
 #include <map>
+#include <algorithm>
+#include <sstream>
 #include <string.h>
 #include <cctype>
+#include <mutex>
 #include <thread>
 #include <cinttypes>
 
@@ -62,6 +65,8 @@
 #include <log4cpp/Category.hh>
 #include "ControllerUploadData.h"
 #include "FPPUploadProgressDialog.h"
+#include "FPPUploadStream.h"
+#include "FSEQBlockManifest.h"
 #include "../FSEQFile.h"
 #include "../Discovery.h"
 #include "../utils/CurlManager.h"
@@ -124,7 +129,72 @@ FPP::FPP(const FPP &c)
 
 }
 
+static std::string GetManifestFile(const std::string& host, const std::string& sequence) {
+    wxFileName dir(wxFileName::GetTempDir(), "");
+    dir.AppendDir("xLightsFPPManifests");
+    if (!dir.DirExists()) {
+        dir.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+    }
+    std::string name = host + "_" + sequence + ".manifest";
+    std::replace_if(name.begin(), name.end(), [](char c) { return c == ':' || c == '/' || c == '\\'; }, '_');
+    return ToUTF8(dir.GetPath()) + ToUTF8(wxString(wxFileName::GetPathSeparator())) + name;
+}
+
+static bool LoadManifest(FSEQBlockManifest& manifest, const std::string& fileName) {
+    wxFile f;
+    wxString content;
+    if (!FileExists(fileName) || !f.Open(FromUTF8(fileName)) || !f.ReadAll(&content)) {
+        return false;
+    }
+    std::istringstream in(content.ToStdString());
+    return manifest.Load(in);
+}
+
+static bool SaveManifest(const FSEQBlockManifest& manifest, const std::string& fileName) {
+    std::ostringstream out;
+    if (!manifest.Save(out)) {
+        return false;
+    }
+    wxFile f;
+    if (!f.Create(FromUTF8(fileName), true)) {
+        return false;
+    }
+    return f.Write(out.str().c_str(), out.str().size()) == out.str().size();
+}
+
+// don't let a target get more than this far behind the encoding
+static const size_t FPP_STREAM_MAX_BACKLOG = 32 * 1024 * 1024;
+static const uint64_t FPP_STREAM_CHUNK_SIZE = 4 * 1024 * 1024;
+
+// Sequence data streamed to FPP while the fseq is still being encoded.  Chunks are queued by whichever
+// thread is adding frames but only sent from the main thread, one at a time.
+class FPPStreamedUpload {
+public:
+    FPPStreamedUpload(const std::string& fn) : stream(fn, FPP_STREAM_CHUNK_SIZE), filename(fn) {}
+
+    FPPUploadStream stream;
+    std::string filename;
+    std::string fullUrl;
+
+    std::mutex lock;
+    FPP* instance = nullptr;
+    // written out once the player has the whole file
+    std::shared_ptr<FSEQBlockManifest> manifest;
+    std::string manifestFile;
+
+    void Abandon() {
+        {
+            std::unique_lock<std::mutex> l(lock);
+            instance = nullptr;
+        }
+        stream.Abandon();
+    }
+};
+
 FPP::~FPP() {
+    if (streamedUpload) {
+        streamedUpload->Abandon();
+    }
     if (outputFile && !outputFileIsOriginal) {
         delete outputFile;
         outputFile = nullptr;
@@ -806,6 +876,10 @@ public:
     std::string fileSizeHeader;
     std::string fileNameHeader;
     std::string filename;
+
+    // written out once the player has the whole file
+    std::shared_ptr<FSEQBlockManifest> manifest;
+    std::string manifestFile;
 };
 int progress_callback(void *clientp,
                       curl_off_t dltotal,
@@ -893,6 +967,9 @@ void prepareCurlForMulti(V7ProgressStruct *ps) {
         }
         uint64_t pct = (ps->offset * 1000) / ps->length;
         cancelled |= ps->instance->updateProgress(pct, false);
+        if (!cancelled && ps->offset >= ps->length && ps->manifest) {
+            SaveManifest(*ps->manifest, ps->manifestFile);
+        }
         if (cancelled || ps->offset >= ps->length) {
             delete ps;
         } else {
@@ -923,6 +1000,8 @@ bool FPP::uploadFileV7(const std::string &filename,
         ps->fileSizeHeader = "Upload-Length: " + std::to_string(ps->length);
         ps->fileNameHeader = "Upload-Name: " + filename;
         ps->instance = this;
+        ps->manifest = uploadManifest;
+        ps->manifestFile = seqManifestFile;
         if (progressDialog != nullptr) {
             cancelled |= updateProgress(0, true);
         }
@@ -933,6 +1012,72 @@ bool FPP::uploadFileV7(const std::string &filename,
     return cancelled;
 }
 
+static void sendNextStreamedChunk(std::shared_ptr<FPPStreamedUpload> su) {
+    static log4cpp::Category& logger_curl = log4cpp::Category::getInstance(std::string("log_curl"));
+
+    uint64_t offset = 0;
+    std::vector<uint8_t> data;
+    std::vector<std::string> uploadHeaders;
+    if (!su->stream.Next(offset, data, uploadHeaders)) {
+        return;
+    }
+    size_t size = data.size();
+
+    CurlManager::CurlPrivateData* cpd = nullptr;
+    CURL* curl = CurlManager::INSTANCE.createCurl(su->fullUrl, &cpd, true);
+    //if we cannot upload a single chunk in 3 minutes, we have serious issues
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, 1000 * 3 * 60);
+
+    struct curl_slist* headers = nullptr;
+    headers = curl_slist_append(headers, "Content-Type: application/offset+octet-stream");
+    headers = curl_slist_append(headers, "X-Requested-With: FPPConnect");
+    headers = curl_slist_append(headers, "Expect:");
+    headers = curl_slist_append(headers, "Connection: keep-alive");
+    for (const auto& h : uploadHeaders) {
+        headers = curl_slist_append(headers, h.c_str());
+    }
+
+    cpd->req->swap(data);
+    curl_easy_setopt(curl, CURLOPT_UPLOAD, (long)1);
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PATCH");
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)size);
+
+    logger_curl.info("FPPConnect Adding CURL - URL: %s    Method: PATCH    Start: %" PRIu64 "   Length: %zd   Total: %" PRIu64,
+                     su->fullUrl.c_str(), offset, size, su->stream.GetTotalLength());
+
+    CurlManager::INSTANCE.addCURL(su->fullUrl, curl, [su, headers](CURL* c) {
+        curl_slist_free_all(headers);
+        long response_code = 0;
+        curl_easy_getinfo(c, CURLINFO_RESPONSE_CODE, &response_code);
+        logger_curl.info("    FPPConnect CURL Callback - URL: %s    Response: %d", su->fullUrl.c_str(), response_code);
+
+        std::unique_lock<std::mutex> l(su->lock);
+        FPP* instance = su->instance;
+        if (instance == nullptr) {
+            return;
+        }
+        FPPUploadStream::Result result = su->stream.OnResponse(response_code);
+        if (result == FPPUploadStream::Result::FAILED) {
+            instance->messages.push_back("ERROR Uploading file: " + su->filename + ". Response code: " + std::to_string(response_code));
+            return;
+        }
+        if (result == FPPUploadStream::Result::DONE && su->manifest) {
+            SaveManifest(*su->manifest, su->manifestFile);
+        }
+        uint64_t total = su->stream.GetTotalLength();
+        l.unlock();
+        if (total) {
+            int pct = (su->stream.GetSentBytes() * 1000) / total;
+            if (instance->updateProgress(pct, false)) {
+                su->Abandon();
+                return;
+            }
+        }
+        sendNextStreamedChunk(su);
+    });
+}
+
 bool FPP::uploadOrCopyFile(const std::string &filename,
                            const std::string &file,
                            const std::string &dir) {
@@ -1069,6 +1214,13 @@ bool FPP::PrepareUploadSequence(FSEQFile *file,
         ::wxRemoveFile(tempFileName);
         tempFileName = "";
     }
+    if (streamedUpload) {
+        streamedUpload->Abandon();
+        streamedUpload = nullptr;
+    }
+    previousManifest = nullptr;
+    uploadManifest = nullptr;
+    seqManifestFile = "";
 
     updateProgress(0, true);
     wxFileName fn(FromUTF8(seq));
@@ -1085,9 +1237,15 @@ bool FPP::PrepareUploadSequence(FSEQFile *file,
     sequences[baseName].media = mediaBaseName;
     sequences[baseName].duration = ((float)(file->getStepTime() * file->getNumFrames())) / 1000.0f;
 
-    tempFileName = ToStdString(wxFileName::CreateTempFileName(ToWXString(baseName)));
-    TempFileManager::GetTempFileManager().AddTempFile(tempFileName);
-    std::string fileName = tempFileName;
+    // FPP 7 accepts uploads in pieces at given offsets so the sequence can be sent while
+    // it is being encoded rather than going through a temp file first
+    bool streamUpload = streamSequenceUploads && fppType == FPP_TYPE::FPP && IsVersionAtLeast(7, 0);
+    std::string fileName = "-memory-";
+    if (!streamUpload) {
+        tempFileName = ToStdString(wxFileName::CreateTempFileName(ToWXString(baseName)));
+        TempFileManager::GetTempFileManager().AddTempFile(tempFileName);
+        fileName = tempFileName;
+    }
 
     FSEQFile::CompressionType ctype = ::FSEQFile::CompressionType::zstd;
     if (type == 3 || type == 4) {
@@ -1101,10 +1259,12 @@ bool FPP::PrepareUploadSequence(FSEQFile *file,
     int currentChannelCount = 0;
     std::vector<std::pair<uint32_t, uint32_t>> currentRanges;
     std::vector<std::pair<uint32_t, uint32_t>> newRanges;
+    std::string currentId;
     if (fppType == FPP_TYPE::FPP) {
         wxJSONValue currentMeta;
         if (GetURLAsJSON("/api/sequence/" + URLEncode(baseName) + "/meta", currentMeta, false)) {
             doSeqUpload = false;
+            currentId = ToStdString(currentMeta["ID"].AsString());
             char buf[24];
             sprintf(buf, "%" PRIu64, file->getUniqueId());
             wxString version = currentMeta["Version"].AsString();
@@ -1235,9 +1395,31 @@ bool FPP::PrepareUploadSequence(FSEQFile *file,
         }
     }
     outputFile->writeHeader();
+    if (fppType == FPP_TYPE::FPP && IsVersionAtLeast(7, 0) && ctype != ::FSEQFile::CompressionType::none) {
+        seqManifestFile = GetManifestFile(uuid.empty() ? ipAddress : uuid, baseName);
+        // only worth comparing against if the player still has the file from our last upload
+        auto manifest = std::make_shared<FSEQBlockManifest>();
+        if (!currentId.empty() && LoadManifest(*manifest, seqManifestFile) && std::to_string(manifest->uniqueId) == currentId) {
+            previousManifest = manifest;
+        }
+    }
+    if (streamUpload) {
+        createStreamedUpload();
+    }
     return false;
 }
 
+void FPP::createStreamedUpload() {
+    streamedUpload = std::make_shared<FPPStreamedUpload>(baseSeqName);
+    streamedUpload->instance = this;
+    streamedUpload->fullUrl = ipAddress + "/api/file/sequences";
+    if (!_fppProxy.empty()) {
+        streamedUpload->fullUrl = "http://" + _fppProxy + "/proxy/" + streamedUpload->fullUrl;
+    } else {
+        streamedUpload->fullUrl = "http://" + streamedUpload->fullUrl;
+    }
+}
+
 bool FPP::WillUploadSequence() const {
     return outputFile != nullptr;
 }
@@ -1247,15 +1429,81 @@ bool FPP::NeedCustomSequence() const {
 bool FPP::AddFrameToUpload(uint32_t frame, uint8_t *data) {
     if (outputFile && !outputFileIsOriginal) {
         outputFile->addFrame(frame, data);
+        if (streamedUpload) {
+            std::vector<uint8_t> chunk;
+            uint64_t offset = 0;
+            if (outputFile->takeWrittenData(chunk, offset, FPP_STREAM_CHUNK_SIZE)) {
+                streamedUpload->stream.Add(offset, chunk);
+            }
+        }
+    }
+    return false;
+}
+
+void FPP::PumpUploadSequence() {
+    if (streamedUpload) {
+        sendNextStreamedChunk(streamedUpload);
+    }
+}
+
+bool FPP::IsUploadSequenceBacklogged() const {
+    if (streamedUpload) {
+        return streamedUpload->stream.GetQueuedBytes() > FPP_STREAM_MAX_BACKLOG;
     }
     return false;
 }
 
+// Block layout of the finished file for the manifest, logging how much of it a player holding the previous
+// upload would actually need.  Only FPP 7 v2 compressed uploads get one.
+std::shared_ptr<FSEQBlockManifest> FPP::buildUploadManifest(uint64_t fileSize) {
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    V2FSEQFile* v2 = dynamic_cast<V2FSEQFile*>(outputFile);
+    if (seqManifestFile.empty() || v2 == nullptr) {
+        return nullptr;
+    }
+    auto manifest = std::make_shared<FSEQBlockManifest>();
+    if (!manifest->Build(outputFile->getUniqueId(), fileSize, v2->m_frameOffsets, v2->m_blockHashes, v2->m_blockDataEnd)) {
+        return nullptr;
+    }
+    if (previousManifest) {
+        std::vector<FSEQBlockManifest::PatchOp> ops;
+        uint64_t changed = manifest->BuildPatch(*previousManifest, ops);
+        logger_base.info("FPP %s: %" PRIu64 " of %" PRIu64 " bytes of %s changed since the last upload.",
+                         ipAddress.c_str(), changed, fileSize, baseSeqName.c_str());
+        previousManifest = nullptr;
+    }
+    return manifest;
+}
+
 bool FPP::FinalizeUploadSequence() {
     bool cancelled = false;
-    if (outputFile) {
+    if (outputFile && streamedUpload) {
+        outputFile->finalize();
+        std::vector<uint8_t> tail;
+        uint64_t tailOffset = 0;
+        outputFile->takeWrittenData(tail, tailOffset);
+        std::vector<uint8_t> header = outputFile->getMemoryBuffer();
+        auto manifest = buildUploadManifest(tailOffset + tail.size());
+        delete outputFile;
+        outputFile = nullptr;
+
+        {
+            std::unique_lock<std::mutex> l(streamedUpload->lock);
+            streamedUpload->manifest = manifest;
+            streamedUpload->manifestFile = seqManifestFile;
+        }
+        // the header is only complete now
+        streamedUpload->stream.Finish(header, tailOffset, tail);
+        cancelled |= updateProgress(0, false);
+        sendNextStreamedChunk(streamedUpload);
+    } else if (outputFile) {
         if (!outputFileIsOriginal) {
             outputFile->finalize();
+            wxFile f;
+            if (tempFileName != "" && f.Open(ToWXString(tempFileName))) {
+                uploadManifest = buildUploadManifest(f.Length());
+            }
             delete outputFile;
         }
         outputFile = nullptr;
@@ -1265,6 +1513,7 @@ bool FPP::FinalizeUploadSequence() {
                 directory = "effects";
             }
             cancelled = uploadOrCopyFile(baseSeqName, tempFileName, directory);
+            uploadManifest = nullptr;
             if (!outputFileIsOriginal) {
                 ::wxRemoveFile(tempFileName);
             }
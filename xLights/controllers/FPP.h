@@ -2,6 +2,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <algorithm>
 #include <string>
@@ -17,6 +18,8 @@ class wxWindow;
 class wxGauge;
 class FPPUploadProgressDialog;
 class Discovery;
+class FPPStreamedUpload;
+class FSEQBlockManifest;
 
 enum class FPP_TYPE { FPP,
                       FALCONV4V5,
@@ -67,6 +70,9 @@ class FPP : public BaseController
     
     std::list<std::string> messages;
     int defaultConnectTimeout = 2000;
+    // send FPP 7 sequences while they are encoded rather than from a temp file, needs FPP to accept
+    // the pieces out of order so it is off unless turned on in FPP Connect
+    bool streamSequenceUploads = false;
 
     std::map<int, int> GetExpansionPorts(ControllerCaps* caps) const;
     bool AuthenticateAndUpdateVersions();
@@ -89,6 +95,10 @@ class FPP : public BaseController
     bool NeedCustomSequence() const;
     bool AddFrameToUpload(uint32_t frame, uint8_t *data);
     bool FinalizeUploadSequence();
+    // streamed sequence uploads send their data from the main thread, these keep them moving while
+    // frames are being added and report when the encoder has got too far ahead of the network
+    void PumpUploadSequence();
+    bool IsUploadSequenceBacklogged() const;
     std::string GetTempFile() const { return tempFileName; }
     void ClearTempFile() { tempFileName = ""; }
 #endif
@@ -175,6 +185,8 @@ private:
                       const std::string &file,
                       const std::string &dir);
     bool callMoveFile(const std::string &filename);
+    void createStreamedUpload();
+    std::shared_ptr<FSEQBlockManifest> buildUploadManifest(uint64_t fileSize);
 
     bool parseSysInfo(wxJSONValue& v);
     void parseControllerType(wxJSONValue& v);
@@ -197,6 +209,12 @@ private:
     std::string baseSeqName;
     FSEQFile *outputFile = nullptr;
     bool outputFileIsOriginal = false;
+    std::shared_ptr<FPPStreamedUpload> streamedUpload;
+    // block layout of what this player already has for the sequence being uploaded, if known
+    std::shared_ptr<FSEQBlockManifest> previousManifest;
+    // saved once the upload completes
+    std::shared_ptr<FSEQBlockManifest> uploadManifest;
+    std::string seqManifestFile;
 
     CURL *setupCurl(const std::string &url, bool isGet = true, int timeout = 30000);
     std::string curlInputBuffer;
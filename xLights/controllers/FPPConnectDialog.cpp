@@ -58,6 +58,7 @@ const long FPPConnectDialog::ID_FPP_INSTANCE_LIST = wxNewId();
 
 static const long ID_POPUP_MNU_SORT_NAME = wxNewId();
 static const long ID_POPUP_MNU_SORT_IP = wxNewId();
+static const long ID_POPUP_MNU_STREAM_UPLOADS = wxNewId();
 static const long ID_POPUP_MNU_SELECT_ALL = wxNewId();
 static const long ID_POPUP_MNU_DESELECT_ALL = wxNewId();
 static const long ID_POPUP_MNU_CAPE_SELECT_ALL = wxNewId();
@@ -292,6 +293,9 @@ void FPPConnectDialog::OnLocationPopupClick(wxCommandEvent &evt) {
         SaveSettings(true);
         instances.sort(sortByIP);
         PopulateFPPInstanceList();
+    } else if (evt.GetId() == ID_POPUP_MNU_STREAM_UPLOADS) {
+        wxConfigBase* config = wxConfigBase::Get();
+        config->Write("FPPConnectStreamUploads", evt.IsChecked());
     }
 }
 
@@ -299,6 +303,8 @@ void FPPConnectDialog::LocationPopupMenu(wxContextMenuEvent& event) {
     wxMenu mnu;
     mnu.Append(ID_POPUP_MNU_SORT_NAME, "Sort by Hostname");
     mnu.Append(ID_POPUP_MNU_SORT_IP, "Sort by IP Address");
+    mnu.AppendSeparator();
+    mnu.AppendCheckItem(ID_POPUP_MNU_STREAM_UPLOADS, "Stream Sequences While Encoding (FPP 7+, Experimental)")->Check(wxConfigBase::Get()->ReadBool("FPPConnectStreamUploads", false));
     mnu.Connect(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(FPPConnectDialog::OnLocationPopupClick), NULL, this);
     PopupMenu(&mnu);
 }
@@ -912,6 +918,7 @@ void FPPConnectDialog::doUpload(FPPUploadProgressDialog *prgs, std::vector<bool>
     std::map<int, int> udpRanges;
     wxJSONValue outputs = FPP::CreateUniverseFile(_outputManager->GetControllers(), false, &udpRanges);
     std::string displayMap = FPP::CreateVirtualDisplayMap(&frame->AllModels);
+    bool streamUploads = wxConfigBase::Get()->ReadBool("FPPConnectStreamUploads", false);
     bool cancelled = false;
     int row = 0;
     for (const auto& inst : instances) {
@@ -1025,6 +1032,7 @@ void FPPConnectDialog::doUpload(FPPUploadProgressDialog *prgs, std::vector<bool>
                         } else {
                             fseqType = 3;
                         }
+                        inst->streamSequenceUploads = streamUploads;
                         cancelled |= inst->PrepareUploadSequence(seq,
                                                                 fseq, m2,
                                                                 fseqType);
@@ -1095,6 +1103,21 @@ void FPPConnectDialog::doUpload(FPPUploadProgressDialog *prgs, std::vector<bool>
                                 }
                             };
                             parallel_for(instances, func);
+
+                            // keep any streamed uploads moving and let them catch up if the encoding gets too far ahead
+                            bool backlogged = false;
+                            do {
+                                backlogged = false;
+                                for (const auto& inst : instances) {
+                                    inst->PumpUploadSequence();
+                                    backlogged |= inst->IsUploadSequenceBacklogged();
+                                }
+                                CurlManager::INSTANCE.processCurls();
+                                if (backlogged) {
+                                    wxYield();
+                                    cancelled |= prgs->isCancelled();
+                                }
+                            } while (backlogged && !cancelled);
                         }
                     }
                     row = 0;
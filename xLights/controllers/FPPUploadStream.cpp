@@ -0,0 +1,120 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "FPPUploadStream.h"
+
+FPPUploadStream::FPPUploadStream(const std::string& filename, uint64_t chunkSize) :
+    _filename(filename), _chunkSize(chunkSize) {
+}
+
+void FPPUploadStream::Queue(uint64_t offset, std::vector<uint8_t>& data) {
+    if (!_failed && !data.empty()) {
+        _queuedBytes += data.size();
+        _queue.emplace_back();
+        _queue.back().offset = offset;
+        _queue.back().data.swap(data);
+    }
+}
+
+void FPPUploadStream::Add(uint64_t offset, std::vector<uint8_t>& data) {
+    std::unique_lock<std::mutex> l(_lock);
+    Queue(offset, data);
+}
+
+void FPPUploadStream::Finish(std::vector<uint8_t>& header, uint64_t tailOffset, std::vector<uint8_t>& tail) {
+    std::unique_lock<std::mutex> l(_lock);
+    _totalLength = tailOffset + tail.size();
+    uint64_t pos = 0;
+    while (tail.size() - pos > _chunkSize) {
+        std::vector<uint8_t> chunk(tail.begin() + pos, tail.begin() + pos + _chunkSize);
+        Queue(tailOffset + pos, chunk);
+        pos += _chunkSize;
+    }
+    if (pos) {
+        tail.erase(tail.begin(), tail.begin() + pos);
+    }
+    Queue(0, header);
+    Queue(tailOffset + pos, tail);
+}
+
+void FPPUploadStream::Abandon() {
+    std::unique_lock<std::mutex> l(_lock);
+    _failed = true;
+    _queue.clear();
+    _queuedBytes = 0;
+}
+
+bool FPPUploadStream::Next(uint64_t& offset, std::vector<uint8_t>& data, std::vector<std::string>& headers) {
+    std::unique_lock<std::mutex> l(_lock);
+    if (_inFlight || _failed || _queue.empty()) {
+        return false;
+    }
+    _inFlight = true;
+    const Chunk& chunk = _queue.front();
+    offset = chunk.offset;
+    data = chunk.data;
+
+    headers.clear();
+    headers.push_back("Upload-Offset: " + std::to_string(chunk.offset));
+    if (_totalLength) {
+        headers.push_back("Upload-Length: " + std::to_string(_totalLength));
+    } else {
+        headers.push_back("Upload-Defer-Length: 1");
+    }
+    headers.push_back("Upload-Name: " + _filename);
+    return true;
+}
+
+FPPUploadStream::Result FPPUploadStream::OnResponse(long responseCode) {
+    std::unique_lock<std::mutex> l(_lock);
+    _inFlight = false;
+    if (_failed) {
+        return Result::FAILED;
+    }
+    if (responseCode != 200) {
+        if (++_errorCount > MAX_RETRIES) {
+            _failed = true;
+            _queue.clear();
+            _queuedBytes = 0;
+            return Result::FAILED;
+        }
+        return Result::RETRY;
+    }
+    _errorCount = 0;
+    if (!_queue.empty()) {
+        _queuedBytes -= _queue.front().data.size();
+        _sentBytes += _queue.front().data.size();
+        _queue.pop_front();
+    }
+    if (_totalLength && _queue.empty() && _sentBytes >= _totalLength) {
+        return Result::DONE;
+    }
+    return Result::NEXT;
+}
+
+size_t FPPUploadStream::GetQueuedBytes() {
+    std::unique_lock<std::mutex> l(_lock);
+    return _queuedBytes;
+}
+
+uint64_t FPPUploadStream::GetSentBytes() {
+    std::unique_lock<std::mutex> l(_lock);
+    return _sentBytes;
+}
+
+uint64_t FPPUploadStream::GetTotalLength() {
+    std::unique_lock<std::mutex> l(_lock);
+    return _totalLength;
+}
+
+bool FPPUploadStream::IsFailed() {
+    std::unique_lock<std::mutex> l(_lock);
+    return _failed;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// The PATCH requests that stream an fseq to FPP while it is still being encoded.  Channel data is sent as
+// it is written, each piece with the Upload-Offset of where it belongs.  The length isn't known until the
+// sequence is finalized so until then requests carry Upload-Defer-Length, and the completed header then
+// goes to offset 0 ahead of the last piece so the request that completes the file is still the last one.
+// FPP has to accept the pieces out of order for this to work so it is only used when turned on.
+//
+// Pieces are queued by whichever thread is encoding, the caller sends them one at a time and reports
+// each response back.
+class FPPUploadStream {
+public:
+    enum class Result { NEXT, RETRY, DONE, FAILED };
+
+    static constexpr int MAX_RETRIES = 3;
+
+    FPPUploadStream(const std::string& filename, uint64_t chunkSize);
+
+    // channel data written while encoding, offset is where it goes in the file
+    void Add(uint64_t offset, std::vector<uint8_t>& data);
+    // header is the finished header area and tail whatever channel data hasn't been added yet
+    void Finish(std::vector<uint8_t>& header, uint64_t tailOffset, std::vector<uint8_t>& tail);
+    void Abandon();
+
+    // the next request to send, false if one is already out, nothing is queued or the upload has failed.
+    // The piece stays queued until a response accepts it so it can be sent again
+    bool Next(uint64_t& offset, std::vector<uint8_t>& data, std::vector<std::string>& headers);
+    Result OnResponse(long responseCode);
+
+    size_t GetQueuedBytes();
+    uint64_t GetSentBytes();
+    uint64_t GetTotalLength(); // 0 until Finish
+    bool IsFailed();
+
+private:
+    struct Chunk {
+        uint64_t offset = 0;
+        std::vector<uint8_t> data;
+    };
+
+    void Queue(uint64_t offset, std::vector<uint8_t>& data);
+
+    const std::string _filename;
+    const uint64_t _chunkSize;
+
+    std::mutex _lock;
+    std::list<Chunk> _queue;
+    size_t _queuedBytes = 0;
+    bool _inFlight = false;
+    bool _failed = false;
+    int _errorCount = 0;
+    uint64_t _totalLength = 0;
+    uint64_t _sentBytes = 0;
+};
@@ -0,0 +1,106 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "FSEQBlockManifest.h"
+
+#include <map>
+#include <string>
+
+bool FSEQBlockManifest::Build(uint64_t id, uint64_t size, const std::vector<std::pair<uint32_t, uint64_t>>& frameOffsets,
+                              const std::vector<uint64_t>& blockHashes, uint64_t blockDataEnd)
+{
+    blocks.clear();
+    if (frameOffsets.empty() || frameOffsets.size() != blockHashes.size()) {
+        return false;
+    }
+    uniqueId = id;
+    fileSize = size;
+    dataOffset = frameOffsets[0].second;
+    dataEnd = blockDataEnd;
+    for (size_t x = 0; x < frameOffsets.size(); x++) {
+        Block b;
+        b.offset = frameOffsets[x].second;
+        uint64_t end = x + 1 < frameOffsets.size() ? frameOffsets[x + 1].second : dataEnd;
+        if (end < b.offset) {
+            blocks.clear();
+            return false;
+        }
+        b.length = end - b.offset;
+        b.hash = blockHashes[x];
+        blocks.push_back(b);
+    }
+    return dataEnd >= dataOffset && dataEnd <= fileSize;
+}
+
+bool FSEQBlockManifest::Load(std::istream& in)
+{
+    std::string magic;
+    int version = 0;
+    size_t count = 0;
+    in >> magic >> version >> uniqueId >> fileSize >> dataOffset >> dataEnd >> count;
+    if (!in || magic != "xLightsFSEQManifest" || version != 1 || count > 1000000) {
+        blocks.clear();
+        return false;
+    }
+    blocks.resize(count);
+    for (auto& b : blocks) {
+        in >> b.offset >> b.length >> std::hex >> b.hash >> std::dec;
+    }
+    if (in.fail()) {
+        blocks.clear();
+        return false;
+    }
+    return true;
+}
+
+bool FSEQBlockManifest::Save(std::ostream& out) const
+{
+    out << "xLightsFSEQManifest 1\n"
+        << uniqueId << " " << fileSize << " " << dataOffset << " " << dataEnd << " " << blocks.size() << "\n";
+    for (const auto& b : blocks) {
+        out << b.offset << " " << b.length << " " << std::hex << b.hash << std::dec << "\n";
+    }
+    return !out.fail();
+}
+
+uint64_t FSEQBlockManifest::BuildPatch(const FSEQBlockManifest& previous, std::vector<PatchOp>& ops) const
+{
+    ops.clear();
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> oldBlocks;
+    for (const auto& b : previous.blocks) {
+        oldBlocks.emplace(std::make_pair(b.hash, b.length), b.offset);
+    }
+
+    uint64_t sending = 0;
+    auto add = [&](bool copy, uint64_t offset, uint64_t length) {
+        if (length == 0) {
+            return;
+        }
+        if (!ops.empty() && ops.back().copy == copy && ops.back().offset + ops.back().length == offset) {
+            ops.back().length += length;
+        } else {
+            ops.push_back({ copy, offset, length });
+        }
+        if (!copy) {
+            sending += length;
+        }
+    };
+    add(false, 0, dataOffset);
+    for (const auto& b : blocks) {
+        auto it = oldBlocks.find(std::make_pair(b.hash, b.length));
+        if (it != oldBlocks.end()) {
+            add(true, it->second, b.length);
+        } else {
+            add(false, b.offset, b.length);
+        }
+    }
+    add(false, dataEnd, fileSize - dataEnd);
+    return sending;
+}
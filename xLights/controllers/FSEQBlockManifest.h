@@ -0,0 +1,55 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+// Compressed block layout of a v2 fseq uploaded to a player. It is kept locally after every successful
+// upload so the next upload of the same sequence can work out which compressed blocks actually changed.
+// No FPP release can rebuild a sequence from part of a file yet so for now that is only reported, the
+// ops are what a player would need to be sent once it can.
+class FSEQBlockManifest {
+public:
+    struct Block {
+        uint64_t offset = 0;
+        uint64_t length = 0;
+        uint64_t hash = 0;
+    };
+
+    // rebuilds the new file from start to end, either a range of the player's existing copy or a range of
+    // the new file that has to be sent
+    struct PatchOp {
+        bool copy = false;
+        uint64_t offset = 0;
+        uint64_t length = 0;
+    };
+
+    uint64_t uniqueId = 0;
+    uint64_t fileSize = 0;
+    uint64_t dataOffset = 0; // everything before this is the header and block index
+    uint64_t dataEnd = 0;    // everything after this is extended variable headers
+    std::vector<Block> blocks;
+
+    // frameOffsets and blockHashes are V2FSEQFile's m_frameOffsets and m_blockHashes once the file is finalized
+    bool Build(uint64_t id, uint64_t size, const std::vector<std::pair<uint32_t, uint64_t>>& frameOffsets,
+               const std::vector<uint64_t>& blockHashes, uint64_t blockDataEnd);
+
+    bool Load(std::istream& in);
+    bool Save(std::ostream& out) const;
+
+    // ops that turn the file previous describes into this one, the header and block index are always sent as
+    // the unique id and block sizes are in there. Returns the number of bytes that would have to be sent.
+    uint64_t BuildPatch(const FSEQBlockManifest& previous, std::vector<PatchOp>& ops) const;
+};
@@ -30,6 +30,10 @@ public:
     virtual ~BarsEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool SupportsLinearColorCurves(const SettingsMap& SettingsMap) const override
     {
         return true;
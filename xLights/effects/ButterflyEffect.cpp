@@ -23,6 +23,9 @@
 #include "../../include/butterfly-64.xpm"
 
 #include "../Parallel.h"
+#include "EffectKernels.h"
+
+#include <cstring>
 
 ButterflyEffect::ButterflyEffect(int i) : RenderableEffect(i, "Butterfly", butterfly_16, butterfly_24, butterfly_32, butterfly_48, butterfly_64)
 {
@@ -98,6 +101,30 @@ void ButterflyEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
     const double offset = (ButterflyDirection==1 ? -1 : 1) * double(curState)/200.0;
     const int xc=buffer.BufferWi/2;
     const int yc=buffer.BufferHt/2;
+
+    // the butterfly styles go through the row kernel, 4 pixels at a time
+    if (Style <= 5 && buffer.BufferWi >= 4 && !buffer.IsDmxBuffer()) {
+        ButterflyKernelData data;
+        data.offset = offset;
+        data.chunks = Chunks;
+        data.skip = Skip;
+        data.curState = curState;
+        data.style = Style;
+        data.width = buffer.BufferWi;
+        data.height = buffer.BufferHt;
+        data.colorScheme = ColorScheme;
+        data.numColors = std::min((int)colorcnt, MAX_KERNEL_COLORS);
+        for (int i = 0; i < data.numColors; i++) {
+            const xlColor c = buffer.palette.GetColor(i);
+            std::memcpy(data.colors[i], &c, 4);
+        }
+        uint8_t* pixels = (uint8_t*)buffer.GetPixels();
+        parallel_for(0, buffer.BufferHt, [&data, pixels](int y) {
+            ButterflyKernel(data, pixels, y, y + 1);
+        }, std::max(1, 1024 / buffer.BufferWi));
+        return;
+    }
+
     int block = buffer.BufferHt * buffer.BufferWi > 100 ? 1 : -1;
     parallel_for(0, buffer.BufferWi, [&buffer, Style, &xc, &yc, &offset, frame, maxframe, Chunks, colorcnt, Skip, ColorScheme, butterFlySpeed](int x) {
         double  fractpart, intpart;
@@ -108,6 +135,10 @@ void ButterflyEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
         double n,x1,y1,f;
         double rx,ry,cx,cy,v,time,multiplier;
 
+        // styles 1-5 work out the hue of each pixel down the column and then colour them all in one go
+        std::vector<int> rows;
+        std::vector<float> hues;
+
         for (y=0; y<buffer.BufferHt; y++)
         {
             switch (Style)
@@ -202,22 +233,10 @@ void ButterflyEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             }
             if(Style<=5)
             {
-                
-                
-                hsv.saturation=1.0;
-                hsv.value=1.0;
                 if (Chunks <= 1 || int(h*Chunks) % Skip != 0)
                 {
-                    if (ColorScheme == 0)
-                    {
-                        hsv.hue=h;
-                        buffer.SetPixel(x,y,hsv);
-                    }
-                    else
-                    {
-                        buffer.GetMultiColorBlend(h,false,color);
-                        buffer.SetPixel(x,y,color);
-                    }
+                    rows.push_back(y);
+                    hues.push_back(h);
                 }
             }
             else  // Plasma
@@ -307,6 +326,24 @@ void ButterflyEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
                 buffer.SetPixel(x,y,color);
             }
         }
+
+        if (!rows.empty())
+        {
+            std::vector<xlColor> colors(rows.size());
+            if (ColorScheme == 0)
+            {
+                std::vector<float> full(rows.size(), 1.0f);
+                HSVToRGBSpan(hues.data(), full.data(), full.data(), colors.data(), rows.size());
+            }
+            else
+            {
+                buffer.GetMultiColorBlend(hues.data(), rows.size(), false, colors.data());
+            }
+            for (size_t i = 0; i < rows.size(); i++)
+            {
+                buffer.SetPixel(x, rows[i], colors[i]);
+            }
+        }
     }, block);
 }
 
@@ -28,6 +28,10 @@ public:
     virtual ~ButterflyEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool AppropriateOnNodes() const override
     {
         return false;
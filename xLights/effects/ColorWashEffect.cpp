@@ -185,6 +185,24 @@ void ColorWashEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
         orig = color;
         HSVValue hsvOrig = color.asHSV();
         xlColor color2 = color;
+
+        // without alpha a vertical fade only changes the brightness down each column so the columns are converted in
+        // one go, hue and saturation are the same everywhere
+        const bool fadeColumns = VertFade && !buffer.allowAlpha;
+        const int columnHt = endY - StartY + 1;
+        std::vector<float> columnHue, columnSaturation, columnMult, columnValue;
+        std::vector<xlColor> column;
+        if (fadeColumns) {
+            columnHue.assign(columnHt, hsvOrig.hue);
+            columnSaturation.assign(columnHt, hsvOrig.saturation);
+            columnMult.resize(columnHt);
+            columnValue.resize(columnHt);
+            column.resize(columnHt);
+            for (y = StartY; y <= endY; y++) {
+                double mult = std::abs(HalfHt - (y - StartY)) / HalfHt;
+                columnMult[y - StartY] = reverseFades ? mult : 1.0 - mult;
+            }
+        }
         for (int x = StartX; x <= endX; x++)
         {
             HSVValue hsv = hsvOrig;
@@ -213,6 +231,16 @@ void ColorWashEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             }
  
             color2.alpha = color.alpha;
+            if (fadeColumns) {
+                for (int i = 0; i < columnHt; i++) {
+                    columnValue[i] = hsv.value * columnMult[i];
+                }
+                HSVToRGBSpan(columnHue.data(), columnSaturation.data(), columnValue.data(), column.data(), columnHt);
+                for (y = StartY; y <= endY; y++) {
+                    buffer.SetPixel(x, y, column[y - StartY]);
+                }
+                continue;
+            }
             for (y=StartY; y<=endY; y++) {
                 if (VertFade) {
                     if (reverseFades) {
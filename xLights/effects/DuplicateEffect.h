@@ -26,6 +26,7 @@ class DuplicateEffect : public RenderableEffect
             return true;
         }
         virtual std::list<std::string> CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache) override;
+        virtual bool CheckEffectSettingsUsesOtherEffects() const override { return true; }
         static int GetLayersForModel(const wxString& model);
 
     protected:
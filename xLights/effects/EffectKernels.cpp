@@ -0,0 +1,421 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "EffectKernels.h"
+
+#include "../ColorSpan.h"
+#include "../Simd4.h"
+#include "../SinTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// rows are worked through this many pixels at a time so the scratch can live on the stack
+#define KERNEL_CHUNK 64
+
+static const float KERNEL_PI = 3.1415926535897932384626433832f;
+static const float KERNEL_PI2 = 6.283185307f;
+
+static inline uint8_t ChannelBlend(uint8_t c1, uint8_t c2, float ratio)
+{
+    return c1 + std::floor(ratio * (c2 - c1) + 0.5);
+}
+
+// RenderBuffer::GetMultiColorBlend against a copy of the palette
+static inline void MultiColorBlend(const uint8_t (*colors)[4], int numColors, float n, uint8_t* rgba)
+{
+    if (numColors <= 1) {
+        std::memcpy(rgba, colors[0], 4);
+        return;
+    }
+    if (n >= 1.0f) n = 0.99999f;
+    if (n < 0.0f) n = 0.0f;
+    const float realidx = n * (numColors - 1);
+    const int coloridx1 = std::floor(realidx);
+    const int coloridx2 = (coloridx1 + 1) % numColors;
+    const float ratio = realidx - float(coloridx1);
+    rgba[0] = ChannelBlend(colors[coloridx1][0], colors[coloridx2][0], ratio);
+    rgba[1] = ChannelBlend(colors[coloridx1][1], colors[coloridx2][1], ratio);
+    rgba[2] = ChannelBlend(colors[coloridx1][2], colors[coloridx2][2], ratio);
+    rgba[3] = colors[coloridx1][3];
+}
+
+// sin and cos come from RenderBuffer's table so the kernels draw what the effects did pixel for pixel
+static const SinTable sinTable;
+
+static inline float TableSin(float rad)
+{
+    return sinTable.sin(rad);
+}
+
+static inline float TableCos(float rad)
+{
+    return sinTable.cos(rad);
+}
+
+#ifdef SIMD4_VECTOR
+// the lookups are one lane at a time, the maths around them stays 4 wide
+static inline F4 TableSin(F4 rad)
+{
+    float v[4];
+    Store(v, rad);
+    for (auto& f : v) {
+        f = sinTable.sin(f);
+    }
+    return Load(v);
+}
+
+static inline F4 TableCos(F4 rad)
+{
+    float v[4];
+    Store(v, rad);
+    for (auto& f : v) {
+        f = sinTable.cos(f);
+    }
+    return Load(v);
+}
+#endif
+
+// (sin + 1) * 128 as the effects do it, the table never quite reaches 1 but the clamp keeps that from mattering
+static inline uint8_t SinChannel(float s)
+{
+    return (uint8_t)std::min((s + 1.0f) * 128.0f, 255.0f);
+}
+
+// out = sin(in + offset)
+static void SinSpan(const float* in, float offset, float* out, int count)
+{
+    int i = 0;
+#ifdef SIMD4_VECTOR
+    const F4 o = Splat(offset);
+    for (; i + 4 <= count; i += 4) {
+        Store(out + i, TableSin(Add(Load(in + i), o)));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = TableSin(in[i] + offset);
+    }
+}
+
+// Butterfly
+
+// styles 1, 4 and 5 are the same butterfly function, they only differ in the scale on x + y and what they do with
+// the sign
+static inline float ButterflyWave(float x, float y, float offset, float scale, int style)
+{
+    const float n = (x * x - y * y) * TableSin(offset + (x + y) * scale);
+    const float d = x * x + y * y;
+    if (d <= 0.001f) {
+        return 0.0f;
+    }
+    if (style != 4) {
+        return std::abs(n) / d;
+    }
+    float h = n / d;
+    h -= std::trunc(h);
+    return h < 0.0f ? 1.0f + h : h;
+}
+
+#ifdef SIMD4_VECTOR
+static inline F4 ButterflyWave4(F4 x, F4 y, float offset, float scale, int style)
+{
+    const F4 x2 = Mul(x, x);
+    const F4 y2 = Mul(y, y);
+    F4 n = Mul(Sub(x2, y2), TableSin(Add(Splat(offset), Mul(Add(x, y), Splat(scale)))));
+    const F4 d = Add(x2, y2);
+    if (style != 4) {
+        n = Abs(n);
+    }
+    // the lanes with d of 0 divide by zero but are thrown away by the select
+    F4 h = Select(Gt(d, Splat(0.001f)), Div(n, d), Splat(0.0f));
+    if (style == 4) {
+        h = Sub(h, ToFloat(ToInt(h)));
+        h = Select(Lt(h, Splat(0.0f)), Add(h, Splat(1.0f)), h);
+    }
+    return h;
+}
+#endif
+
+static void ButterflyHues(const ButterflyKernelData& data, int y, int x0, int count, float* hues)
+{
+    const float fy = y;
+    int i = 0;
+    if (data.style == 2 || data.style == 3) {
+        const int height = data.height;
+        const int maxframe = height * 2;
+        const int frame = (height * data.curState / 200) % maxframe;
+        float f = (frame < maxframe / 2) ? frame + 1 : maxframe - frame;
+        if (data.style == 3) {
+            f = f * 0.1f + float(data.height) / 60.0f;
+        }
+        const float xc = data.width / 2.0f;
+        const float y1 = (fy - data.height / 2.0f) / f;
+#ifdef SIMD4_VECTOR
+        const F4 ff = Splat(f);
+        const F4 y4 = Splat(y1);
+        const F4 cy = TableCos(y4);
+        for (; i + 4 <= count; i += 4) {
+            const F4 x1 = Div(Sub(Ramp(x0 + i), Splat(xc)), ff);
+            Store(hues + i, data.style == 2 ? Sqrt(Add(Mul(x1, x1), Mul(y4, y4))) : Mul(TableSin(x1), cy));
+        }
+#endif
+        const float cy1 = TableCos(y1);
+        for (; i < count; ++i) {
+            const float x1 = (float(x0 + i) - xc) / f;
+            hues[i] = data.style == 2 ? std::sqrt(x1 * x1 + y1 * y1) : TableSin(x1) * cy1;
+        }
+        return;
+    }
+
+    const float scale = KERNEL_PI2 / (data.style == 5 ? float(data.height * data.width) : float(data.height + data.width));
+#ifdef SIMD4_VECTOR
+    const F4 y4 = Splat(fy);
+    for (; i + 4 <= count; i += 4) {
+        Store(hues + i, ButterflyWave4(Ramp(x0 + i), y4, data.offset, scale, data.style));
+    }
+#endif
+    for (; i < count; ++i) {
+        hues[i] = ButterflyWave(x0 + i, fy, data.offset, scale, data.style);
+    }
+
+    //  This section is to fix the colors on pixels at {0,1} and {1,0}
+    if (y == 1 && x0 == 0) {
+        hues[0] = ButterflyWave(0, 2, data.offset, scale, data.style);
+    }
+    if (y == 0 && x0 <= 1 && x0 + count > 1) {
+        hues[1 - x0] = ButterflyWave(2, 0, data.offset, scale, data.style);
+    }
+}
+
+void ButterflyKernel(const ButterflyKernelData& data, uint8_t* rgba, int startRow, int endRow)
+{
+    float hues[KERNEL_CHUNK];
+    float kept[KERNEL_CHUNK];
+    int columns[KERNEL_CHUNK];
+    uint8_t colors[KERNEL_CHUNK * 4];
+    float ones[KERNEL_CHUNK];
+    std::fill(ones, ones + KERNEL_CHUNK, 1.0f);
+
+    for (int y = startRow; y < endRow; ++y) {
+        uint8_t* row = rgba + (size_t)y * data.width * 4;
+        for (int x0 = 0; x0 < (int)data.width; x0 += KERNEL_CHUNK) {
+            const int count = std::min(KERNEL_CHUNK, (int)data.width - x0);
+            ButterflyHues(data, y, x0, count, hues);
+
+            int keptCount = 0;
+            for (int i = 0; i < count; ++i) {
+                const float h = hues[i];
+                if (data.chunks <= 1 || (data.skip > 0 && int(h * data.chunks) % data.skip != 0)) {
+                    kept[keptCount] = h;
+                    columns[keptCount] = x0 + i;
+                    ++keptCount;
+                }
+            }
+            if (keptCount == 0) {
+                continue;
+            }
+
+            if (data.colorScheme == 0) {
+                for (int i = 0; i < keptCount; ++i) {
+                    colors[i * 4] = colors[i * 4 + 1] = colors[i * 4 + 2] = 0;
+                    colors[i * 4 + 3] = 255;
+                }
+                HSVToRGBSpan(kept, ones, ones, colors, keptCount);
+            } else {
+                for (int i = 0; i < keptCount; ++i) {
+                    MultiColorBlend(data.colors, data.numColors, kept[i], colors + i * 4);
+                }
+            }
+            for (int i = 0; i < keptCount; ++i) {
+                std::memcpy(row + columns[i] * 4, colors + i * 4, 4);
+            }
+        }
+    }
+}
+
+// Plasma
+
+// reference: http://www.bidouille.org/prog/plasma
+static void PlasmaValues(const PlasmaKernelData& data, int y, int x0, int count, float* vldpi)
+{
+    const float time = data.time;
+    const float ry = data.height > 1 ? ((float)y / (float)(data.height - 1)) : 0.0f;
+    const float cy = ry + 0.5f * data.cos_time_3;
+    const float cy2 = cy * cy;
+    const float ry2 = ry * ry;
+    const float sin_ry_time = TableSin((ry + time) / 2.0f);
+    const float xscale = data.width > 1 ? 1.0f / (float)(data.width - 1) : 0.0f;
+    const float style50 = data.Style * 50.0f;
+    const float scale = data.Line_Density * KERNEL_PI / 2.0f;
+
+    int i = 0;
+#ifdef SIMD4_VECTOR
+    const F4 t = Splat(time);
+    const F4 half = Splat(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        const F4 rx = Mul(Ramp(x0 + i), Splat(xscale));
+        const F4 cx = Add(rx, Splat(0.5f * data.sin_time_5));
+        F4 v = TableSin(Add(Mul(rx, Splat(10.0f)), t));
+        v = Add(v, TableSin(Add(Mul(Splat(10.0f), Add(Mul(rx, Splat(data.sin_time_2)), Splat(ry * data.cos_time_3))), t)));
+        v = Add(v, TableSin(Sqrt(Add(Mul(Splat(style50), Add(Mul(cx, cx), Splat(cy2))), t))));
+        v = Add(v, TableSin(Add(rx, t)));
+        v = Add(v, Splat(sin_ry_time));
+        v = Add(v, TableSin(Mul(Add(Add(rx, Splat(ry)), t), half)));
+        v = Add(v, TableSin(Add(Sqrt(Add(Mul(rx, rx), Splat(ry2))), t)));
+        Store(vldpi + i, Mul(v, Splat(scale)));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float rx = (x0 + i) * xscale;
+        const float cx = rx + 0.5f * data.sin_time_5;
+        float v = TableSin(rx * 10.0f + time);
+        v += TableSin(10.0f * (rx * data.sin_time_2 + ry * data.cos_time_3) + time);
+        v += TableSin(std::sqrt(style50 * (cx * cx + cy2) + time));
+        v += TableSin(rx + time);
+        v += sin_ry_time;
+        v += TableSin((rx + ry + time) / 2.0f);
+        v += TableSin(std::sqrt(rx * rx + ry2) + time);
+        vldpi[i] = v * scale;
+    }
+}
+
+void PlasmaKernel(const PlasmaKernelData& data, uint8_t* rgba, int startRow, int endRow)
+{
+    static const float pi3 = KERNEL_PI / 3.0f;
+
+    float vldpi[KERNEL_CHUNK];
+    float s1[KERNEL_CHUNK];
+    float s2[KERNEL_CHUNK];
+    float s3[KERNEL_CHUNK];
+
+    for (int y = startRow; y < endRow; ++y) {
+        uint8_t* row = rgba + (size_t)y * data.width * 4;
+        for (int x0 = 0; x0 < (int)data.width; x0 += KERNEL_CHUNK) {
+            const int count = std::min(KERNEL_CHUNK, (int)data.width - x0);
+            uint8_t* px = row + x0 * 4;
+            PlasmaValues(data, y, x0, count, vldpi);
+
+            switch (data.colorScheme) {
+            case 0:
+                SinSpan(vldpi, 2.0f * pi3, s1, count);
+                for (int i = 0; i < count; ++i) {
+                    MultiColorBlend(data.colors, data.numColors, (s1[i] + 1.0f) * 0.5f, px + i * 4);
+                }
+                break;
+            case 1:
+            case 2:
+                SinSpan(vldpi, 0.0f, s1, count);
+                SinSpan(vldpi, KERNEL_PI / 2.0f, s2, count);
+                for (int i = 0; i < count; ++i) {
+                    uint8_t* p = px + i * 4;
+                    if (data.colorScheme == 1) {
+                        p[0] = SinChannel(s1[i]);
+                        p[2] = 0;
+                    } else {
+                        p[0] = 1;
+                        p[2] = SinChannel(s1[i]);
+                    }
+                    p[1] = SinChannel(s2[i]);
+                    p[3] = 255;
+                }
+                break;
+            case 3:
+                SinSpan(vldpi, 0.0f, s1, count);
+                SinSpan(vldpi, 2.0f * pi3, s2, count);
+                SinSpan(vldpi, 4.0f * pi3, s3, count);
+                for (int i = 0; i < count; ++i) {
+                    uint8_t* p = px + i * 4;
+                    p[0] = SinChannel(s1[i]);
+                    p[1] = SinChannel(s2[i]);
+                    p[2] = SinChannel(s3[i]);
+                    p[3] = 255;
+                }
+                break;
+            default:
+                SinSpan(vldpi, 0.0f, s1, count);
+                for (int i = 0; i < count; ++i) {
+                    uint8_t* p = px + i * 4;
+                    p[0] = p[1] = p[2] = SinChannel(s1[i]);
+                    p[3] = 255;
+                }
+                break;
+            }
+        }
+    }
+}
+
+// Shockwave
+
+void ShockwaveKernel(const ShockwaveKernelData& data, uint8_t* rgba, int startRow, int endRow)
+{
+    float radius[KERNEL_CHUNK];
+    float pct[KERNEL_CHUNK];
+    float hue[KERNEL_CHUNK];
+    float saturation[KERNEL_CHUNK];
+    float value[KERNEL_CHUNK];
+    int columns[KERNEL_CHUNK];
+    uint8_t colors[KERNEL_CHUNK * 4];
+
+    for (int y = startRow; y < endRow; ++y) {
+        const float y1 = y - data.yc_adj;
+        // nothing on this row is inside the ring
+        if (std::abs(y1) > data.radius2) {
+            continue;
+        }
+        uint8_t* row = rgba + (size_t)y * data.width * 4;
+        for (int x0 = 0; x0 < (int)data.width; x0 += KERNEL_CHUNK) {
+            const int count = std::min(KERNEL_CHUNK, (int)data.width - x0);
+
+            int i = 0;
+#ifdef SIMD4_VECTOR
+            const F4 yy = Splat(y1 * y1);
+            for (; i + 4 <= count; i += 4) {
+                const F4 x1 = Sub(Ramp(x0 + i), Splat(data.xc_adj));
+                const F4 r = Sqrt(Add(Mul(x1, x1), yy));
+                Store(radius + i, r);
+                Store(pct + i, Sub(Splat(1.0f), Div(Abs(Sub(r, Splat(data.radius_center))), Splat(data.half_width))));
+            }
+#endif
+            for (; i < count; ++i) {
+                const float x1 = x0 + i - data.xc_adj;
+                radius[i] = std::sqrt(x1 * x1 + y1 * y1);
+                pct[i] = 1.0f - std::abs(radius[i] - data.radius_center) / data.half_width;
+            }
+
+            int blended = 0;
+            for (i = 0; i < count; ++i) {
+                if (radius[i] < data.radius1 || radius[i] > data.radius2) {
+                    continue;
+                }
+                uint8_t* p = row + (x0 + i) * 4;
+                if (!data.blend) {
+                    std::memcpy(p, data.color, 4);
+                } else if (data.allowAlpha) {
+                    std::memcpy(p, data.color, 3);
+                    p[3] = (uint8_t)(255.0f * pct[i]);
+                } else {
+                    hue[blended] = data.colorHSV[0];
+                    saturation[blended] = data.colorHSV[1];
+                    value[blended] = data.colorHSV[2] * pct[i];
+                    columns[blended] = x0 + i;
+                    std::memcpy(colors + blended * 4, data.color, 4);
+                    ++blended;
+                }
+            }
+            if (blended > 0) {
+                HSVToRGBSpan(hue, saturation, value, colors, blended);
+                for (i = 0; i < blended; ++i) {
+                    std::memcpy(row + columns[i] * 4, colors + i * 4, 4);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+
+// CPU versions of the per pixel compute kernels in effects/metal for the platforms (and buffers) the Metal ones
+// don't cover. Each kernel takes the same parameters as the data struct its Metal counterpart is handed (see
+// metal/MetalEffectDataTypes.h) and fills rows startRow to endRow - 1 of a width x height RGBA buffer laid out like
+// RenderBuffer::pixels, so the effect can hand bands of rows to parallel_for. The maths is done 4 pixels at a time
+// with SSE2 or NEON, anything else and the last few pixels of a row use plain loops.
+//
+// They match the effect's scalar Render rather than the Metal shaders where the two differ, down to taking sin/cos
+// from RenderBuffer's lookup table (SinTable.h). None of them know about spatial palettes or DMX buffers, effects
+// fall back to their scalar code for those.
+
+#define MAX_KERNEL_COLORS 8
+
+struct ButterflyKernelData {
+    uint8_t colors[MAX_KERNEL_COLORS][4];
+
+    float offset;
+    int chunks;
+    int skip;
+    int curState;
+    int style;          // 1 - 5, the plasma styles aren't done here
+
+    uint32_t width;
+    uint32_t height;
+    uint16_t colorScheme; // 0 is rainbow, otherwise the palette
+    uint16_t numColors;
+};
+
+struct PlasmaKernelData {
+    float Style;
+    float Line_Density;
+    float time;
+    float sin_time_5;
+    float cos_time_3;
+    float sin_time_2;
+    uint32_t width;
+    uint32_t height;
+
+    int colorScheme;    // PLASMA_NORMAL_COLORS to PLASMA_PRESET4
+    uint8_t colors[MAX_KERNEL_COLORS][4];
+    uint16_t numColors;
+};
+
+struct ShockwaveKernelData {
+    uint32_t width;
+    uint32_t height;
+
+    int32_t xc_adj = 0;
+    int32_t yc_adj = 0;
+
+    float radius1;
+    float radius2;
+    float radius_center;
+    float half_width;
+
+    uint8_t color[4];
+    float colorHSV[3];
+    uint16_t blend;
+    uint16_t allowAlpha;
+};
+
+void ButterflyKernel(const ButterflyKernelData& data, uint8_t* rgba, int startRow, int endRow);
+void PlasmaKernel(const PlasmaKernelData& data, uint8_t* rgba, int startRow, int endRow);
+// only touches the pixels inside the ring
+void ShockwaveKernel(const ShockwaveKernelData& data, uint8_t* rgba, int startRow, int endRow);
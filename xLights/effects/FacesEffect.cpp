@@ -22,6 +22,8 @@
 #include "../UtilFunctions.h"
 #include "../xLightsMain.h" 
 #include "PicturesEffect.h"
+#include "SharedImageCache.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 
 #include <wx/tokenzr.h>
@@ -132,6 +134,26 @@ wxString FacesEffect::GetEffectString() {
     return ret.str();
 }
 
+// checks run across the job pool so faceInfo is only read with find, operator[] would insert into the model
+static std::map<std::string, std::string> GetFaceInfo(const Model* model, const std::string& definition)
+{
+    auto it = model->faceInfo.find(definition);
+    if (it == model->faceInfo.end()) {
+        return std::map<std::string, std::string>();
+    }
+    return it->second;
+}
+
+static std::string GetFaceType(const Model* model, const std::string& definition)
+{
+    auto it = model->faceInfo.find(definition);
+    if (it == model->faceInfo.end()) {
+        return "";
+    }
+    auto type = it->second.find("Type");
+    return type == it->second.end() ? "" : type->second;
+}
+
 std::list<std::string> FacesEffect::CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache) {
     wxLogNull logNo; // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
     std::list<std::string> res = RenderableEffect::CheckEffectSettings(settings, media, model, eff, renderCache);
@@ -163,7 +185,7 @@ std::list<std::string> FacesEffect::CheckEffectSettings(const SettingsMap& setti
         }
     }
 
-    wxString modelType = found ? wxString(model->faceInfo[definition.ToStdString()]["Type"].c_str()) : definition;
+    wxString modelType = found ? wxString(GetFaceType(model, definition.ToStdString()).c_str()) : definition;
     if (modelType == "") {
         modelType = definition;
     }
@@ -195,24 +217,23 @@ std::list<std::string> FacesEffect::CheckEffectSettings(const SettingsMap& setti
     }
 
     if (modelType == "Matrix") {
-        auto images = model->faceInfo[definition.ToStdString()];
+        auto images = GetFaceInfo(model, definition.ToStdString());
         for (const auto& it2 : images) {
             if (it2.first.find("Mouth") == 0) {
                 std::string picture = it2.second;
 
                 if (picture != "") {
-                    if (!FileExists(picture)) {
+                    if (!CheckSequenceCache::Instance().FileExists(picture)) {
                         res.push_back(wxString::Format("    ERR: Face effect image file not found '%s'. Model '%s', Start %s", picture, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
-                    } else if (!IsFileInShowDir(xLightsFrame::CurrentDir, picture)) {
+                    } else if (!CheckSequenceCache::Instance().IsFileInShowDir(picture)) {
                         res.push_back(wxString::Format("    WARN: Faces effect image file '%s' not under show directory. Model '%s', Start %s", picture, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
                     }
 
-                    if (FileExists(picture)) {
-                        wxImage i;
-                        i.LoadFile(picture);
-                        if (i.IsOk()) {
-                            int ih = i.GetHeight();
-                            int iw = i.GetWidth();
+                    if (CheckSequenceCache::Instance().FileExists(picture)) {
+                        SharedImageCache::ImageInfo info = SharedImageCache::Instance().GetInfo(picture);
+                        if (info.ok) {
+                            int ih = info.height;
+                            int iw = info.width;
 
 #define IMAGESIZETHRESHOLD 10
                             if (ih > IMAGESIZETHRESHOLD * model->GetDefaultBufferHt() || iw > IMAGESIZETHRESHOLD * model->GetDefaultBufferWi()) {
@@ -339,13 +360,13 @@ std::list<std::string> FacesEffect::GetFileReferences(Model* model, const Settin
             }
         }
 
-        wxString modelType = found ? wxString(model->faceInfo[definition.ToStdString()]["Type"].c_str()) : definition;
+        wxString modelType = found ? wxString(GetFaceType(model, definition.ToStdString()).c_str()) : definition;
         if (modelType == "") {
             modelType = definition;
         }
 
         if (modelType == "Matrix") {
-            auto images = model->faceInfo[definition.ToStdString()];
+            auto images = GetFaceInfo(model, definition.ToStdString());
             for (const auto& it2 : images) {
                 if (it2.first.find("Mouth") == 0) {
                     if (it2.second != "" && std::find(begin(res), end(res), it2.second) == end(res)) {
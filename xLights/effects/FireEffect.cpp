@@ -156,6 +156,7 @@ class FireRenderCache : public EffectRenderCache {
 public:
     FireRenderCache() {};
     virtual ~FireRenderCache() {};
+    virtual EffectRenderCache* Snapshot() const override { return new FireRenderCache(*this); }
 
     std::vector<int> FireBuffer;
 };
@@ -187,6 +188,12 @@ void FireEffect::SetDefaultParameters()
     SetCheckBoxValue(fp->CheckBox_Fire_GrowWithMusic, false);
 }
 
+bool FireEffect::SupportsRenderCheckpoints(const SettingsMap& settings) const
+{
+    // the music can change without the effect changing
+    return !settings.GetBool("CHECKBOX_Fire_GrowWithMusic", false);
+}
+
 // 10 <= HeightPct <= 100
 void FireEffect::Render(Effect* effect, const SettingsMap& SettingsMap, RenderBuffer& buffer)
 {
@@ -250,7 +257,7 @@ void FireEffect::Render(Effect* effect, const SettingsMap& SettingsMap, RenderBu
     }
     // build fire
     for (int x = 0; x < maxMWi; ++x) {
-        int r = x % 2 == 0 ? 190 + (rand() % 10) : 100 + (rand() % 50);
+        int r = x % 2 == 0 ? 190 + (buffer.Rand() % 10) : 100 + (buffer.Rand() % 50);
         SetFireBuffer(x, 0, r, cache->FireBuffer, maxMWi, maxMHt);
     }
     int step = 255 * 100 / curHt / HeightPct;
@@ -280,7 +287,7 @@ void FireEffect::Render(Effect* effect, const SettingsMap& SettingsMap, RenderBu
             }
             int new_index = n > 0 ? sum / n : 0;
             if (new_index > 0) {
-                new_index += (rand() % 100 < 20) ? step : -step;
+                new_index += (buffer.Rand() % 100 < 20) ? step : -step;
                 if (new_index < 0)
                     new_index = 0;
                 if (new_index >= FirePalette.size())
@@ -290,6 +297,22 @@ void FireEffect::Render(Effect* effect, const SettingsMap& SettingsMap, RenderBu
         }
     }
 
+    // a hue shift is the same for every pixel so shift the palette once rather than converting each pixel
+    xlColorVector shiftedPalette;
+    if (HueShift > 0) {
+        shiftedPalette.resize(FirePalette.size());
+        for (int i = 0; i < FirePalette.size(); ++i) {
+            HSVValue hsv = FirePalette[i];
+            hsv.hue = hsv.hue + (HueShift / 100.0);
+            if (hsv.hue > 1.0)
+                hsv.hue = 1.0;
+            shiftedPalette[i] = hsv;
+            if (buffer.allowAlpha) {
+                shiftedPalette[i].alpha = FirePalette.asAlphaColor(i).Alpha();
+            }
+        }
+    }
+
     //  Now play fire
     for (int y = 0; y < curHt; ++y) {
         for (int x = 0; x < curWi; ++x) {
@@ -302,17 +325,7 @@ void FireEffect::Render(Effect* effect, const SettingsMap& SettingsMap, RenderBu
                 std::swap(xp, yp);
             }
             if (HueShift > 0) {
-                HSVValue hsv = FirePalette[GetFireBuffer(x, y, cache->FireBuffer, maxMWi, maxMHt)];
-                hsv.hue = hsv.hue + (HueShift / 100.0);
-                if (hsv.hue > 1.0)
-                    hsv.hue = 1.0;
-                if (buffer.allowAlpha) {
-                    xlColor c(hsv);
-                    c.alpha = FirePalette.asAlphaColor(GetFireBuffer(x, y, cache->FireBuffer, maxMWi, maxMHt)).Alpha();
-                    buffer.SetPixel(xp, yp, c);
-                } else {
-                    buffer.SetPixel(xp, yp, hsv);
-                }
+                buffer.SetPixel(xp, yp, shiftedPalette[GetFireBuffer(x, y, cache->FireBuffer, maxMWi, maxMHt)]);
             } else {
                 if (buffer.allowAlpha) {
                     buffer.SetPixel(xp, yp, FirePalette.asAlphaColor(GetFireBuffer(x, y, cache->FireBuffer, maxMWi, maxMHt)));
@@ -18,6 +18,7 @@
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
 #include "../sequencer/SequenceElements.h"
+#include "ParticlePool.h"
 
 #include "../../include/fireworks-16.xpm"
 #include "../../include/fireworks-24.xpm"
@@ -56,166 +57,107 @@ xlEffectPanel *FireworksEffect::CreatePanel(wxWindow *parent) {
     return new FireworksPanel(parent);
 }
 
-class FireworkParticle
+// One explosion. Its particles live in the render cache's particle pool with param holding the index of the firework
+// so every particle in the effect is moved in a single pass.
+class Firework
 {
-    const int _maxFade = 100;
-    double _x;
-    double _y;
-    double _vx;
-    double _vy;
-    int _fade;
-    bool _gravity;
-    HSVValue _startColour;
-    int _colourIndex;
-    bool _holdColour;
-    int _width;
-    int _height;
-    double _fps;
-    int _age = 0;
-
 public:
-    FireworkParticle(int x, int y, double vx, double vy, int fade, bool gravity, int colourIndex, bool holdColour, double velocity, int width, int height, int frameMS, const PaletteClass& palette)
-    {
-        _width = width;
-        _height = height;
-        _x = x;
-        _y = y;
-        _fade = fade;
-        _gravity = gravity;
-        _colourIndex = colourIndex;
-        _holdColour = holdColour;
-
-        if (_holdColour)
-        {
-            palette.GetHSV(_colourIndex, _startColour);
-        }
-
-        _fps = 1000.0 / frameMS;
-
-        double explosionVelocity = (rand() - RAND_MAX / 2)*velocity / (RAND_MAX / 2);
-        double angle = 2 * M_PI*rand() / RAND_MAX;
-        _vx = 3.0 * vx / 100 + explosionVelocity * cos(angle);
-        _vy = 3.0 * -vy / 100 + explosionVelocity * sin(angle);
-    }
+    static const int MAX_CYCLES = 500;
 
-    virtual ~FireworkParticle() {}
+    Firework(int fade, int colourIndex, bool holdColour) : _fade(fade), _colourIndex(colourIndex), _holdColour(holdColour) {}
 
-    bool Done() const
-    {
-        return (_fade < _age * 2 || _x < 0 || _y < 0 || _x > _width || (!_gravity && _y > _height));
-    }
+    int _fade;
+    int _colourIndex;
+    bool _holdColour;
+    int _cycles = 0;
+    bool _done = false;
 
-    void Advance()
+    bool ParticleDone(float x, float y, int age, bool gravity, int width, int height) const
     {
-        _x += _vx;
-        if (_gravity)
-        {
-            _vy += 0.98 / _fps;
-        }
-        _y += -_vy;
-        _age++;
+        return (_fade < age * 2 || x < 0 || y < 0 || x > width || (!gravity && y > height));
     }
 
-    int GetX() const { return _x; }
-    int GetY() const { return _y; }
-
-    xlColor GetColour(const PaletteClass& palette, bool alpha) const
+    xlColor GetColour(const HSVValue& startColour, int age, const PaletteClass& palette, bool alpha) const
     {
-        double v = ((10.0*_fade) - _age * 20.0) / (10.0*_fade);
+        double v = ((10.0*_fade) - age * 20.0) / (10.0*_fade);
         if (v < 0.0) v = 0.0;
 
-        HSVValue cv = _startColour;
-        if (_holdColour)
+        HSVValue cv = startColour;
+        if (!_holdColour)
         {
-            if (alpha)
-            {
-                xlColor c(cv);
-                c.alpha = 255.0 *v;
-                return c;
-            }
-            else
-            {
-                cv.value = v;
-                return xlColor(cv);
-            }
+            palette.GetHSV(_colourIndex, cv);
         }
-        else
+        if (alpha)
         {
-            palette.GetHSV(_colourIndex, cv);
-            if (alpha)
-            {
-                xlColor c(cv);
-                c.alpha = 255.0 * v;
-                return c;
-            }
-            else
-            {
-                cv.value = v;
-                return xlColor(cv);
-            }
+            xlColor c(cv);
+            c.alpha = 255.0 * v;
+            return c;
         }
+        cv.value = v;
+        return xlColor(cv);
     }
 };
 
-class Firework
-{
-    const int _maxCycles = 500;
-    int _cycles = 0;
-    mutable bool _done = false;
-    std::vector<FireworkParticle> _particles;
+typedef ParticlePool<HSVValue> FireworkParticles;
 
+class FireworksRenderCache : public EffectRenderCache {
 public:
-    Firework(int particles, int x, int y, double vx, double vy, int fade, bool gravity, int colourIndex, bool holdColour, double velocity, int width, int height, int frameMS, const PaletteClass& palette)
-    {
-        _cycles = 0;
-        for (int i = 0; i < particles; i++)
-        {
-            _particles.push_back(FireworkParticle(x, y, vx, vy, fade, gravity, colourIndex, holdColour, velocity, width, height, frameMS, palette));
-        }
-    }
-
-    const std::vector<FireworkParticle>& GetParticles() const {
-        return _particles;
-    }
+    FireworksRenderCache() {};
+    virtual ~FireworksRenderCache() {};
+    virtual EffectRenderCache* Snapshot() const override { return new FireworksRenderCache(*this); }
+    int _sinceLastTriggered = 0;
+    std::vector<Firework> _fireworks;
+    FireworkParticles _particles;
+    std::vector<int> _firePeriods;
 
-    void Advance()
+    void AddFirework(int particles, int x, int y, double vx, double vy, int fade, int colourIndex, bool holdColour, double velocity, RenderBuffer& buffer)
     {
-        _cycles++;
+        int index = _fireworks.size();
+        _fireworks.push_back(Firework(fade, colourIndex, holdColour));
 
-        for (auto& it : _particles)
+        HSVValue startColour;
+        if (holdColour)
         {
-            it.Advance();
+            buffer.palette.GetHSV(colourIndex, startColour);
         }
 
-        if (Done()) _particles.clear();
-    }
-
-    bool AllGone() const
-    {
-        for (const auto& it : _particles)
+        for (int i = 0; i < particles; i++)
         {
-            if (!it.Done()) return false;
+            double explosionVelocity = (buffer.Rand() - RAND_MAX / 2)*velocity / (RAND_MAX / 2);
+            double angle = 2 * M_PI*buffer.Rand() / RAND_MAX;
+            // particles move up the buffer for a positive y velocity
+            _particles.Add(x, y,
+                3.0 * vx / 100 + explosionVelocity * cos(angle),
+                -(3.0 * -vy / 100 + explosionVelocity * sin(angle)),
+                startColour, index);
         }
-
-        _done = true;
-        return true;
     }
 
-    bool Done() const
+    // a firework is done once all its particles are or it has run too long, done fireworks lose their particles
+    void RemoveDoneFireworks(bool gravity, int width, int height)
     {
-        return _done || _cycles >= _maxCycles || AllGone();
+        std::vector<bool> alive(_fireworks.size(), false);
+        for (size_t i = 0; i < _particles.Size(); i++)
+        {
+            const Firework& fw = _fireworks[_particles.param[i]];
+            if (!fw.ParticleDone(_particles.x[i], _particles.y[i], _particles.age[i], gravity, width, height))
+            {
+                alive[_particles.param[i]] = true;
+            }
+        }
+        for (size_t i = 0; i < _fireworks.size(); i++)
+        {
+            if (!alive[i] || _fireworks[i]._cycles >= Firework::MAX_CYCLES)
+            {
+                _fireworks[i]._done = true;
+            }
+        }
+        _particles.RemoveIf([this](const FireworkParticles& particles, size_t i) {
+            return _fireworks[particles.param[i]]._done;
+        });
     }
 };
 
-class FireworksRenderCache : public EffectRenderCache {
-public:
-    FireworksRenderCache() {};
-    virtual ~FireworksRenderCache() {};
-    int _sinceLastTriggered = 0;
-    std::list<Firework> _fireworks;
-    std::vector<int> _firePeriods;
-};
-
 #define REPEATTRIGGER 20
 
 void FireworksEffect::SetDefaultParameters() {
@@ -305,8 +247,10 @@ void FireworksEffect::SetPanelTimingTracks() const
     wxPostEvent(fp, event);
 }
 
-std::pair<int,int> FireworksEffect::GetFireworkLocation(int width, int height, int overridex, int overridey)
+std::pair<int,int> FireworksEffect::GetFireworkLocation(RenderBuffer& buffer, int overridex, int overridey)
 {
+    int width = buffer.BufferWi;
+    int height = buffer.BufferHt;
     int startX;
     int startY;
     if (overridex >= 0)
@@ -317,7 +261,7 @@ std::pair<int,int> FireworksEffect::GetFireworkLocation(int width, int height, i
     {
         int x25 = static_cast<int>(0.25f * width);
         int x75 = static_cast<int>(0.75f * width);
-        if ((x75 - x25) > 0) startX = x25 + rand() % (x75 - x25); else startX = 0;
+        if ((x75 - x25) > 0) startX = x25 + buffer.Rand() % (x75 - x25); else startX = 0;
     }
 
     if (overridey >= 0)
@@ -328,11 +272,17 @@ std::pair<int,int> FireworksEffect::GetFireworkLocation(int width, int height, i
     {
         int y25 = static_cast<int>(0.25f * height);
         int y75 = static_cast<int>(0.75f * height);
-        if ((y75 - y25) > 0) startY = y25 + rand() % (y75 - y25); else startY = 0;
+        if ((y75 - y25) > 0) startY = y25 + buffer.Rand() % (y75 - y25); else startY = 0;
     }
     return { startX, startY };
 }
 
+bool FireworksEffect::SupportsRenderCheckpoints(const SettingsMap& settings) const
+{
+    // the music and timing track can change without the effect changing
+    return !settings.GetBool("CHECKBOX_Fireworks_UseMusic", false) && !settings.GetBool("CHECKBOX_FIRETIMING", false);
+}
+
 void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
     float offset = buffer.GetEffectTimeIntervalPosition();
 
@@ -386,7 +336,7 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
         if (!useMusic && !useTiming)
         {
             for (int i = 0; i < numberOfExplosions; i++) {
-                firePeriods.push_back(buffer.curEffStartPer + rand01() * (buffer.curEffEndPer - buffer.curEffStartPer));
+                firePeriods.push_back(buffer.curEffStartPer + buffer.Rand01() * (buffer.curEffEndPer - buffer.curEffStartPer));
             }
         }
 
@@ -404,16 +354,15 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
             // trigger if it was not previously triggered or has been triggered for REPEATTRIGGER frames
             if (sinceLastTriggered == 0 || sinceLastTriggered > REPEATTRIGGER)
             {
-                auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
-                int colourIndex = rand() % colorcnt;
-                fireworks.push_back(Firework(particleCount,
+                auto location = GetFireworkLocation(buffer, xLocation, yLocation);
+                int colourIndex = buffer.Rand() % colorcnt;
+                cache->AddFirework(particleCount,
                     location.first, location.second,
                     xVelocity, yVelocity,
-                    fade, gravity,
+                    fade,
                     colourIndex, holdColour,
                     particleVelocity,
-                    buffer.BufferWi, buffer.BufferHt,
-                    buffer.frameTimeInMs, buffer.palette));
+                    buffer);
             }
 
             // if music is over the trigger level for REPEATTRIGGER frames then we will trigger another firework
@@ -453,16 +402,15 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
                     if (buffer.curPeriod == el->GetEffect(j)->GetStartTimeMS() / buffer.frameTimeInMs ||
                         buffer.curPeriod == el->GetEffect(j)->GetEndTimeMS() / buffer.frameTimeInMs)
                     {
-                        auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
-                        int colourIndex = rand() % colorcnt;
-                        fireworks.push_back(Firework(particleCount,
+                        auto location = GetFireworkLocation(buffer, xLocation, yLocation);
+                        int colourIndex = buffer.Rand() % colorcnt;
+                        cache->AddFirework(particleCount,
                             location.first, location.second,
                             xVelocity, yVelocity,
-                            fade, gravity,
+                            fade,
                             colourIndex, holdColour,
                             particleVelocity,
-                            buffer.BufferWi, buffer.BufferHt,
-                            buffer.frameTimeInMs, buffer.palette));
+                            buffer);
                         break;
                     }
                 }
@@ -476,30 +424,35 @@ void FireworksEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Ren
         {
             if (it == buffer.curPeriod)
             {
-                auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
-                int colourIndex = rand() % colorcnt;
-                fireworks.push_back(Firework(particleCount,
+                auto location = GetFireworkLocation(buffer, xLocation, yLocation);
+                int colourIndex = buffer.Rand() % colorcnt;
+                cache->AddFirework(particleCount,
                     location.first, location.second,
                     xVelocity, yVelocity,
-                    fade, gravity,
+                    fade,
                     colourIndex, holdColour,
                     particleVelocity,
-                    buffer.BufferWi, buffer.BufferHt,
-                    buffer.frameTimeInMs, buffer.palette));
+                    buffer);
             }
         }
     }
 
-    for (auto& it: fireworks)
+    cache->RemoveDoneFireworks(gravity, buffer.BufferWi, buffer.BufferHt);
+
+    auto& particles = cache->_particles;
+    for (size_t i = 0; i < particles.Size(); i++)
     {
-        if (!it.Done())
-        {
-            for (auto p : it.GetParticles())
-            {
-                buffer.SetPixel(p.GetX(), p.GetY(), p.GetColour(buffer.palette, buffer.allowAlpha));
-            }
+        const Firework& fw = fireworks[particles.param[i]];
+        buffer.SetPixel((int)particles.x[i], (int)particles.y[i], fw.GetColour(particles.colour[i], particles.age[i], buffer.palette, buffer.allowAlpha));
+    }
 
-            it.Advance();
+    for (auto& it : fireworks)
+    {
+        if (!it._done)
+        {
+            it._cycles++;
         }
     }
+    float fps = 1000.0 / buffer.frameTimeInMs;
+    particles.Accelerate(0, gravity ? -0.98 / fps : 0);
 }
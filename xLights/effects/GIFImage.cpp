@@ -295,6 +295,7 @@ const wxImage& GIFImage::GetFrame(int frame)
             }
             _frameImages[i] = image;
             _frameDispose[i] = dispose;
+            _composedFrames++;
         }
     }
     return _frameImages[frame];
@@ -29,6 +29,7 @@ class GIFImage
     wxSize _gifSize;
 	long _totalTime = 0;
     int _lastFrame = 0;
+    int _composedFrames = 0;
     bool _suppressBackground = false;
     std::string _filename;
     bool _ok = false;
@@ -45,8 +46,11 @@ class GIFImage
 		const wxImage &GetFrame(int frame);
 		const wxImage &GetFrameForTime(int msec, bool loop);
         int GetMSUntilNextFrame(int msec, bool loop);
+        int GetFrameIndexForTime(int msec, bool loop) { return CalcFrameForTime(msec, loop); }
+        wxSize GetImageSize() const { return _gifSize; }
         std::string GetFilename() const { return _filename; }
         bool IsOk() const { return _ok; }
+        int GetComposedFrameCount() const { return _composedFrames; } // frames GetFrame has built and is holding on to
 
 		static bool IsGIF(const std::string& filename);
 };
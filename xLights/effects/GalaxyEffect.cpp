@@ -122,6 +122,52 @@ void CalcEndpointColor(double end_angle, double start_angle,
     }
 }
 
+// The pixels across the spiral at one angle share a hue and saturation and only fade, so they are collected and
+// converted in one go rather than converting the same colour twice a pixel
+class GalaxyLine
+{
+public:
+    void Add(int x1, int y1, int x2, int y2, float value)
+    {
+        _x1.push_back(x1);
+        _y1.push_back(y1);
+        _x2.push_back(x2);
+        _y2.push_back(y2);
+        _value.push_back(value);
+    }
+
+    void Draw(RenderBuffer& buffer, const HSVValue& hsv)
+    {
+        size_t count = _value.size();
+        if (count == 0) {
+            return;
+        }
+        _hue.assign(count, hsv.hue);
+        _saturation.assign(count, hsv.saturation);
+        _colors.assign(count, xlBLACK);
+        HSVToRGBSpan(_hue.data(), _saturation.data(), _value.data(), _colors.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            buffer.SetPixel(_x1[i], _y1[i], _colors[i]);
+            buffer.SetPixel(_x2[i], _y2[i], _colors[i]);
+        }
+        _x1.clear();
+        _y1.clear();
+        _x2.clear();
+        _y2.clear();
+        _value.clear();
+    }
+
+private:
+    std::vector<int> _x1;
+    std::vector<int> _y1;
+    std::vector<int> _x2;
+    std::vector<int> _y2;
+    std::vector<float> _value;
+    std::vector<float> _hue;
+    std::vector<float> _saturation;
+    std::vector<xlColor> _colors;
+};
+
 double GetStep(double radius)
 {
     if( radius < 5 ) {
@@ -176,6 +222,7 @@ void GalaxyEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Render
     double half_width = 1;
 
     buffer.ClearTempBuf();
+    GalaxyLine line;
 
     double last_check = (inward ? std::min(head_end_of_tail, revs) : std::max(0.0, tail_end_of_tail)) + (double)start_angle;
 
@@ -233,13 +280,13 @@ void GalaxyEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Render
                     } else {
                         hsv.value = full_brightness * color_pct2;
                         if (hsv.value > 0.0) {
-                            buffer.SetPixel(x1, y1, hsv);
-                            buffer.SetPixel(x2, y2, hsv);
+                            line.Add(x1, y1, x2, y2, hsv.value);
                         }
                     }
                     if (r >= current_radius)
                         break;
                 }
+                line.Draw(buffer, hsv);
             }
             step = GetStep(current_radius + half_width);
         }
@@ -294,13 +341,13 @@ void GalaxyEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Render
             } else {
                 hsv.value = full_brightness * color_pct2;
                 if (hsv.value > 0.0) {
-                    buffer.SetPixel(x1, y1, hsv);
-                    buffer.SetPixel(x2, y2, hsv);
+                    line.Add(x1, y1, x2, y2, hsv.value);
                 }
             }
             if (r >= current_radius)
                 break;
         }
+        line.Draw(buffer, hsv);
 
         // blend old data down into final buffer
         if (blend_edges && ((inward ? (last_check - abs(adj_angle)) : (abs(adj_angle) - last_check)) >= 90.0)) {
@@ -368,13 +415,13 @@ void GalaxyEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Render
                     } else {
                         hsv.value = full_brightness * color_pct2;
                         if (hsv.value > 0.0) {
-                            buffer.SetPixel(x1, y1, hsv);
-                            buffer.SetPixel(x2, y2, hsv);
+                            line.Add(x1, y1, x2, y2, hsv.value);
                         }
                     }
                     if (r >= current_radius)
                         break;
                 }
+                line.Draw(buffer, hsv);
             }
             step = GetStep(current_radius + half_width);
         }
@@ -49,6 +49,10 @@ public:
     virtual ~GalaxyEffect();
 
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual int DrawEffectBackground(const Effect* e, int x1, int y1, int x2, int y2,
                                      xlVertexColorAccumulator& backgrounds, xlColor* colorMask, bool ramps) override;
     virtual void SetDefaultParameters() override;
@@ -23,6 +23,7 @@
 #include "../xLightsXmlFile.h"
 #include "../xLightsMain.h" 
 #include "../UtilFunctions.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 
 #include "../../include/glediator-16.xpm"
@@ -151,11 +152,11 @@ std::list<std::string> GlediatorEffect::CheckEffectSettings(const SettingsMap& s
 
     wxString GledFilename = settings.Get("E_FILEPICKERCTRL_Glediator_Filename", "");
 
-    if (GledFilename == "" || !FileExists(GledFilename))
+    if (GledFilename == "" || !CheckSequenceCache::Instance().FileExists(GledFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    ERR: Glediator effect cant find file '%s'. Model '%s', Start %s", GledFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
-    else if (!IsFileInShowDir(xLightsFrame::CurrentDir, GledFilename.ToStdString()))
+    else if (!CheckSequenceCache::Instance().IsFileInShowDir(GledFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    WARN: Glediator effect file '%s' not under show directory. Model '%s', Start %s", GledFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
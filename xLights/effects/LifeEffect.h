@@ -19,6 +19,10 @@ public:
     virtual ~LifeEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool SupportsRenderCheckpoints(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool AppropriateOnNodes() const override { return false; }
 protected:
     virtual xlEffectPanel* CreatePanel(wxWindow* parent) override;
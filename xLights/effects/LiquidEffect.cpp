@@ -20,6 +20,9 @@
 #include "../models/Model.h"
 #include "../Parallel.h"
 
+#include <atomic>
+#include <memory>
+
 #include "../../include/liquid-16.xpm"
 #include "../../include/liquid-24.xpm"
 #include "../../include/liquid-32.xpm"
@@ -233,6 +236,11 @@ public:
         if (_world != nullptr) delete _world;
 	};
     b2World* _world;
+
+    // the particle drawn on each pixel and the particles to destroy, kept between frames so Draw doesn't allocate
+    std::unique_ptr<std::atomic_int[]> _pixelParticle;
+    size_t _pixelCount = 0;
+    std::vector<uint8_t> _lost;
 };
 
 void LiquidEffect::CreateBarrier(b2World* world, float x, float y, float width, float height)
@@ -287,7 +295,7 @@ bool LiquidEffect::LostForever(int x, int y, int w, int h, float gravityX, float
     return false;
 }
 
-void LiquidEffect::Draw(RenderBuffer& buffer, b2ParticleSystem* ps, const xlColor& color, bool mixColors, int despeckle, float gravityX, float gravityY)
+void LiquidEffect::Draw(RenderBuffer& buffer, LiquidRenderCache* cache, b2ParticleSystem* ps, const xlColor& color, bool mixColors, int despeckle, float gravityX, float gravityY)
 {
 #ifdef LE_INTERPOLATE
     size_t bufsiz = sizeof(size_t) * buffer.BufferWi * buffer.BufferHt;
@@ -366,34 +374,74 @@ void LiquidEffect::Draw(RenderBuffer& buffer, b2ParticleSystem* ps, const xlColo
     {
         const b2Vec2* positionBuffer = ps->GetPositionBuffer();
         const b2ParticleColor* colorBuffer = ps->GetColorBuffer();
-
-        for (int i = 0; i < particleCount; ++i)
+        const int width = buffer.BufferWi;
+        const int height = buffer.BufferHt;
+
+        // Find the lost particles and the particle that ends up on each pixel across the render pool. Drawn one at a
+        // time the highest numbered particle on a pixel won so keep that rule, it gives the same picture whatever
+        // the number of threads.
+        auto& lost = cache->_lost;
+        lost.assign(particleCount, 0);
+        if (cache->_pixelCount != (size_t)(width * height))
+        {
+            cache->_pixelCount = width * height;
+            cache->_pixelParticle.reset(new std::atomic_int[cache->_pixelCount]);
+        }
+        std::atomic_int* pixelParticle = cache->_pixelParticle.get();
+        for (size_t i = 0; i < cache->_pixelCount; ++i)
         {
+            pixelParticle[i].store(-1, std::memory_order_relaxed);
+        }
+        parallel_for(0, particleCount, [&](int i) {
             int x = positionBuffer[i].x;
             int y = positionBuffer[i].y;
 
-            if (LostForever(x, y, buffer.BufferWi, buffer.BufferHt, gravityX, gravityY))
+            if (LostForever(x, y, width, height, gravityX, gravityY))
+            {
+                lost[i] = 1;
+            }
+            else if (x >= 0 && x < width && y >= 0 && y < height)
+            {
+                std::atomic_int& top = pixelParticle[y * width + x];
+                int current = top.load(std::memory_order_relaxed);
+                while (current < i && !top.compare_exchange_weak(current, i, std::memory_order_relaxed))
+                {
+                }
+            }
+        }, 2000);
+
+        // destroying only flags the particle but it touches the system wide flags so do it on this thread
+        for (int i = 0; i < particleCount; ++i)
+        {
+            if (lost[i])
             {
                 ps->DestroyParticle(i);
             }
-            else
+        }
+
+        parallel_for(0, height, [&](int y) {
+            for (int x = 0; x < width; ++x)
             {
-                if (mixColors && ps->GetColorBuffer())
+                int i = pixelParticle[y * width + x].load(std::memory_order_relaxed);
+                if (i < 0) continue;
+
+                if (mixColors && colorBuffer != nullptr)
                 {
                     auto c = colorBuffer[i].GetColor();
-                    buffer.SetPixel(positionBuffer[i].x, positionBuffer[i].y, xlColor(c.r * 255, c.g * 255, c.b * 255));
+                    buffer.SetPixel(x, y, xlColor(c.r * 255, c.g * 255, c.b * 255));
                 }
                 else
                 {
-                    buffer.SetPixel(positionBuffer[i].x, positionBuffer[i].y, color);
+                    buffer.SetPixel(x, y, color);
                 }
             }
-        }
+        }, 20);
     }
 #endif
 
     if (despeckle > 0)
     {
+        // stays in place and in scan order, filled pixels feed into the ones after them
         for (size_t y = 0; y < buffer.BufferHt; ++y) {
             for (size_t x = 0; x < buffer.BufferWi; ++x) {
                 if (buffer.GetPixel(x, y) == xlBLACK) {
@@ -745,7 +793,7 @@ void LiquidEffect::Render(RenderBuffer &buffer,
     {
          xlColor color;
         buffer.palette.GetColor(0, color);
-        Draw(buffer, ps, color, holdcolor || mixcolors, despeckle, gravityX, gravityY);
+        Draw(buffer, cache, ps, color, holdcolor || mixcolors, despeckle, gravityX, gravityY);
     }
 
     // because of memory usage delete our world when rendered the last frame
@@ -753,5 +801,9 @@ void LiquidEffect::Render(RenderBuffer &buffer,
     {
         delete _world;
         _world = nullptr;
+        cache->_pixelParticle.reset();
+        cache->_pixelCount = 0;
+        cache->_lost.clear();
+        cache->_lost.shrink_to_fit();
     }
 }
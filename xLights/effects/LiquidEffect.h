@@ -20,6 +20,7 @@
 class wxString;
 class b2World;
 class b2ParticleSystem;
+class LiquidRenderCache;
 
 #define LIQUID_LIFETIME_MIN 0
 #define LIQUID_LIFETIME_MAX 1000
@@ -130,7 +131,7 @@ protected:
                 bool enabled4, int direction4, int x4, int y4, int velocity4, int flow4, int sourceSize4, bool flowMusic4,
                 const std::string& particleType, int despeckle, float gravity, int gravityAngle);
     void CreateBarrier(b2World* world, float x, float y, float width, float height);
-    void Draw(RenderBuffer& buffer, b2ParticleSystem* ps, const xlColor& color, bool mixColors, int despeckle, float gravityX, float gravityY);
+    void Draw(RenderBuffer& buffer, LiquidRenderCache* cache, b2ParticleSystem* ps, const xlColor& color, bool mixColors, int despeckle, float gravityX, float gravityY);
     bool LostForever(int x, int y, int w, int h, float gravityX, float gravityY);
     void CreateParticles(b2ParticleSystem* ps, int x, int y, int direction, int velocity, int flow, bool flowMusic, int lifetime, int width, int height, const xlColor& c, const std::string& particleType, bool mixcolors, float audioLevel, int sourceSize);
     void CreateParticleSystem(b2World* world, int lifetime, int size);
@@ -26,6 +26,7 @@
 #include "../UtilFunctions.h"
 
 #include "../Parallel.h"
+#include "ParticlePool.h"
 
 MeteorsEffect::MeteorsEffect(int id) : RenderableEffect(id, "Meteors", meteors_16, meteors_24, meteors_32, meteors_48, meteors_64)
 {
@@ -95,34 +96,18 @@ static inline int GetMeteorColorScheme(const std::string &color) {
     return 0;
 }
 
-class MeteorClass {
-public:
-
-    int x,y;
-    HSVValue hsv;
-    int h; //variable length; only used for icicle drip -DJ
-};
-
-// for radial meteor effect
-class MeteorRadialClass {
-public:
-
-    double x,y,dx,dy;
-    int cnt;
-    HSVValue hsv;
-};
-
-typedef std::list<MeteorClass> MeteorList;
-typedef std::list<MeteorRadialClass> MeteorRadialList;
+// vx/vy is the direction of travel, param is the variable length of an icicle drip -DJ
+typedef ParticlePool<HSVValue> MeteorPool;
 
 class MeteorsRenderCache : public EffectRenderCache {
 public:
     MeteorsRenderCache() {};
     virtual ~MeteorsRenderCache() {};
+    virtual EffectRenderCache* Snapshot() const override { return new MeteorsRenderCache(*this); }
 
     int effectState = 0;
-    MeteorList meteors;
-    MeteorRadialList meteorsRadial;
+    MeteorPool meteors;
+    MeteorPool meteorsRadial; // for radial meteor effect
 };
 
 
@@ -162,6 +147,12 @@ void MeteorsEffect::SetDefaultParameters() {
     SetCheckBoxValue(mp->CheckBox_FadeWithDistance, false);
 }
 
+bool MeteorsEffect::SupportsRenderCheckpoints(const SettingsMap& settings) const
+{
+    // the music can change without the effect changing
+    return !settings.GetBool("CHECKBOX_Meteors_UseMusic", false);
+}
+
 // ColorScheme: 0=rainbow, 1=range, 2=palette
 // MeteorsEffect: 0=down, 1=up, 2=left, 3=right, 4=implode, 5=explode
 void MeteorsEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
@@ -195,8 +186,8 @@ void MeteorsEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
 
     if (buffer.needToInit) {
         buffer.needToInit = false;
-        cache->meteors.clear();
-        cache->meteorsRadial.clear();
+        cache->meteors.Clear();
+        cache->meteorsRadial.Clear();
         cache->effectState = mSpeed * buffer.frameTimeInMs / 50;
     }
 
@@ -241,8 +232,8 @@ public:
     {}
 
     // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorClass& obj) {
-        return obj.x + TailLength < 0;
+    bool operator()(const MeteorPool& meteors, size_t i) {
+        return meteors.x[i] + TailLength < 0;
     }
 };
 
@@ -255,21 +246,18 @@ void MeteorsEffect::HorizontalAddMeteors(RenderBuffer& buffer, int ColorScheme,
     buffer.palette.GetHSV(1, hsv1);
     size_t colorcnt = buffer.GetColorCount();
 
-    MeteorClass m;
+    HSVValue hsv;
     for (int i = 0; i < buffer.BufferHt; i++) {
-        if (rand() % 200 < Count) {
-            m.x = buffer.BufferWi - 1;
-            m.y = i;
-
+        if (buffer.Rand() % 200 < Count) {
             switch (ColorScheme) {
             case 1:
-                buffer.SetRangeColor(hsv0, hsv1, m.hsv);
+                buffer.SetRangeColor(hsv0, hsv1, hsv);
                 break;
             case 2:
-                buffer.palette.GetHSV(rand() % colorcnt, m.hsv);
+                buffer.palette.GetHSV(buffer.Rand() % colorcnt, hsv);
                 break;
             }
-            cache->meteors.push_back(m);
+            cache->meteors.Add(buffer.BufferWi - 1, i, -1, 0, hsv);
         }
     }
 }
@@ -278,10 +266,7 @@ void MeteorsEffect::HorizontalMoveMeteors(RenderBuffer& buffer, int mspeed)
 {
     MeteorsRenderCache* cache = GetCache(buffer, id);
 
-    std::function<void(MeteorClass&, int)> f = [mspeed](MeteorClass& meteor, int n) {
-        meteor.x -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
+    cache->meteors.Move(mspeed);
 }
 
 void MeteorsEffect::HorizontalRemoveMeteors(RenderBuffer& buffer, int Length)
@@ -293,7 +278,7 @@ void MeteorsEffect::HorizontalRemoveMeteors(RenderBuffer& buffer, int Length)
         TailLength = 1;
 
     // delete old meteors
-    cache->meteors.remove_if(MeteorHasExpiredX(TailLength));
+    cache->meteors.RemoveIf(MeteorHasExpiredX(TailLength));
 }
 
 void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer& buffer, int ColorScheme, int Count, int Length, int MeteorsEffect, int SwirlIntensity, int mSpeed, int warmupFrames)
@@ -325,25 +310,28 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer& buffer, int ColorSchem
 
     // render meteors
 
-    std::function<void(MeteorClass&, int)> f = [&buffer, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme](MeteorClass& meteor, int n) {
+    MeteorPool& meteors = cache->meteors;
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme](int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
             switch (ColorScheme) {
             case 0:
-                hsv.hue = double(rand() % 1000) / 1000.0;
+                hsv.hue = double(ParticleHash(meteors.seed[n], ph, buffer.curPeriod) % 1000) / 1000.0;
                 hsv.saturation = 1.0;
                 hsv.value = 1.0;
                 break;
             default:
-                hsv = meteor.hsv;
+                hsv = meteors.colour[n];
                 break;
             }
 
-            double swirl_phase = double(meteor.x) / 5.0 + double(n) / 100.0;
+            double swirl_phase = double(mx) / 5.0 + double(meteors.seed[n]) / 100.0;
             int dy = int(double(SwirlIntensity * buffer.BufferHt) / 80.0 * buffer.sin(swirl_phase));
 
-            int x = meteor.x + ph;
-            int y = meteor.y + dy;
+            int x = mx + ph;
+            int y = my + dy;
             if (MeteorsEffect == 3)
                 x = buffer.BufferWi - x;
 
@@ -356,8 +344,7 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer& buffer, int ColorSchem
                 buffer.SetPixel(x, y, hsv);
             }
         }
-    };
-    parallel_for(cache->meteors, f, 500);
+    }, 500);
 
     HorizontalMoveMeteors(buffer, speed);
 
@@ -383,8 +370,8 @@ public:
     {}
 
     // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorClass& obj) {
-        return obj.y + TailLength < 0;
+    bool operator()(const MeteorPool& meteors, size_t i) {
+        return meteors.y[i] + TailLength < 0;
     }
 };
 
@@ -397,22 +384,19 @@ void MeteorsEffect::VerticalAddMeteors(RenderBuffer& buffer, int ColorScheme, in
     buffer.palette.GetHSV(1, hsv1);
     size_t colorcnt = buffer.GetColorCount();
 
-    MeteorClass m;
+    HSVValue hsv;
 
     for (int i = 0; i < buffer.BufferWi; i++) {
-        if (rand() % 200 < Count) {
-            m.x = i;
-            m.y = buffer.BufferHt - 1;
-
+        if (buffer.Rand() % 200 < Count) {
             switch (ColorScheme) {
             case 1:
-                    buffer.SetRangeColor(hsv0, hsv1, m.hsv);
+                    buffer.SetRangeColor(hsv0, hsv1, hsv);
                     break;
             case 2:
-                    buffer.palette.GetHSV(rand() % colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.Rand() % colorcnt, hsv);
                     break;
             }
-            cache->meteors.push_back(m);
+            cache->meteors.Add(i, buffer.BufferHt - 1, 0, -1, hsv);
         }
     }
 }
@@ -421,10 +405,7 @@ void MeteorsEffect::VerticalMoveMeteors(RenderBuffer& buffer, int mspeed)
 {
     MeteorsRenderCache* cache = GetCache(buffer, id);
 
-    std::function<void(MeteorClass&, int)> f = [mspeed](MeteorClass& meteor, int n) {
-        meteor.y -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
+    cache->meteors.Move(mspeed);
 }
 
 void MeteorsEffect::VerticalRemoveMeteors(RenderBuffer& buffer, int Length)
@@ -436,7 +417,7 @@ void MeteorsEffect::VerticalRemoveMeteors(RenderBuffer& buffer, int Length)
         TailLength = 1;
 
     // delete old meteors
-    cache->meteors.remove_if(MeteorHasExpiredY(TailLength));
+    cache->meteors.RemoveIf(MeteorHasExpiredY(TailLength));
 }
 
 void MeteorsEffect::RenderMeteorsVertical(RenderBuffer& buffer, int ColorScheme, int Count, int Length, int MeteorsEffect, int SwirlIntensity, int mSpeed, int warmupFrames)
@@ -468,26 +449,29 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer& buffer, int ColorScheme,
 
     // render meteors
 
-    std::function<void(MeteorClass&, int)> f = [&buffer, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme](MeteorClass& meteor, int n) {
+    MeteorPool& meteors = cache->meteors;
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme](int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
             switch (ColorScheme) {
             case 0:
-                hsv.hue = double(rand() % 1000) / 1000.0;
+                hsv.hue = double(ParticleHash(meteors.seed[n], ph, buffer.curPeriod) % 1000) / 1000.0;
                 hsv.saturation = 1.0;
                 hsv.value = 1.0;
                 break;
             default:
-                hsv = meteor.hsv;
+                hsv = meteors.colour[n];
                 break;
             }
 
             // we adjust x axis with some sine function if swirl1 or swirl2
             // swirling more than 25% of the buffer width doesn't look good
-            double swirl_phase = double(meteor.y) / 5.0 + double(n) / 100.0;
+            double swirl_phase = double(my) / 5.0 + double(meteors.seed[n]) / 100.0;
             int dx = int(double(SwirlIntensity * buffer.BufferWi) / 80.0 * buffer.sin(swirl_phase));
-            int x = meteor.x + dx;
-            int y = meteor.y + ph;
+            int x = mx + dx;
+            int y = my + ph;
             if (MeteorsEffect == 1)
                 y = buffer.BufferHt - y;
 
@@ -500,8 +484,7 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer& buffer, int ColorScheme,
                 buffer.SetPixel(x, y, hsv);
             }
         }
-    };
-    parallel_for(cache->meteors, f, 500);
+    }, 500);
 
     VerticalMoveMeteors(buffer, speed);
 
@@ -522,9 +505,9 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer& buffer, int ColorScheme,
 class IcicleHasExpired
 {
 public:
-    bool operator()(const MeteorClass& obj)
+    bool operator()(const MeteorPool& meteors, size_t i)
     {
-        return obj.y < -obj.h;
+        return meteors.y[i] < -meteors.param[i];
     }
 };
 
@@ -537,22 +520,20 @@ void MeteorsEffect::IcicleAddMeteors(RenderBuffer& buffer, int ColorScheme, int
     buffer.palette.GetHSV(1, hsv1);
     size_t colorcnt = buffer.GetColorCount();
 
-    MeteorClass m;
+    HSVValue hsv;
     for (int i = 0; i < buffer.BufferWi; i++) {
-        if (rand() % 200 < Count) {
-            m.x = i;
-            m.y = buffer.BufferHt - 1;
-            m.h = (rand() % (2 * buffer.BufferHt)) / 3; // somewhat variable length -DJ
+        if (buffer.Rand() % 200 < Count) {
+            int h = (buffer.Rand() % (2 * buffer.BufferHt)) / 3; // somewhat variable length -DJ
 
             switch (ColorScheme) {
             case 1:
-                    buffer.SetRangeColor(hsv0, hsv1, m.hsv);
+                    buffer.SetRangeColor(hsv0, hsv1, hsv);
                     break;
             case 2:
-                    buffer.palette.GetHSV(rand() % colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.Rand() % colorcnt, hsv);
                     break;
             }
-            cache->meteors.push_back(m);
+            cache->meteors.Add(i, buffer.BufferHt - 1, 0, -1, hsv, h);
         }
     }
 }
@@ -561,10 +542,7 @@ void MeteorsEffect::IcicleMoveMeteors(RenderBuffer& buffer, int mspeed)
 {
     MeteorsRenderCache* cache = GetCache(buffer, id);
 
-    std::function<void(MeteorClass&, int)> f = [mspeed](MeteorClass& meteor, int n) {
-        meteor.y -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
+    cache->meteors.Move(mspeed);
 }
 
 void MeteorsEffect::IcicleRemoveMeteors(RenderBuffer& buffer)
@@ -572,7 +550,7 @@ void MeteorsEffect::IcicleRemoveMeteors(RenderBuffer& buffer)
     MeteorsRenderCache* cache = GetCache(buffer, id);
 
     // delete old meteors
-    cache->meteors.remove_if(IcicleHasExpired());
+    cache->meteors.RemoveIf(IcicleHasExpired());
 }
 
 #define numents(thing) (sizeof(thing) / sizeof(thing[0]))
@@ -623,12 +601,16 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer& buffer, int ColorScheme, int
                     buffer.SetPixel(x, y + ystaggered[(x / 3) % numents(ystaggered)], c);
     }
 
-    std::function<void(MeteorClass&, int)> f = [&buffer, MeteorsEffect, TailLength, SwirlIntensity](MeteorClass& meteor, int n) {
+    MeteorPool& meteors = cache->meteors;
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity](int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
+        int mh = meteors.param[n];
         int x, y, dx;
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
-            if (!ph || (ph <= meteor.h - meteor.y))
-                hsv = meteor.hsv; // only make the end of the drip colored
+            if (!ph || (ph <= mh - my))
+                hsv = meteors.colour[n]; // only make the end of the drip colored
             else {
                 hsv.value = .4;
                 hsv.hue = hsv.saturation = 0;
@@ -636,19 +618,18 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer& buffer, int ColorScheme, int
 
             // we adjust x axis with some sine function if swirl1 or swirl2
             // swirling more than 25% of the buffer width doesn't look good
-            float swirl_phase = float(meteor.y) / 5.0f + float(n) / 100.0f;
+            float swirl_phase = float(my) / 5.0f + float(meteors.seed[n]) / 100.0f;
             dx = int(float(SwirlIntensity * buffer.BufferWi) / 80.0f * buffer.sin(swirl_phase));
 
-            x = meteor.x + dx;
-            y = meteor.y + ph;
+            x = mx + dx;
+            y = my + ph;
             if (MeteorsEffect == 1)
                 y = buffer.BufferHt - y;
-            if (y < meteor.h)
+            if (y < mh)
                 continue; // variable length icicle drips -DJ
             buffer.SetPixel(x, y, hsv);
         }
-    };
-    parallel_for(cache->meteors, f, 500);
+    }, 500);
 
     IcicleMoveMeteors(buffer, speed);
 
@@ -677,9 +658,9 @@ public:
     }
 
     // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorRadialClass& obj)
+    bool operator()(const MeteorPool& meteors, size_t i)
     {
-        return (std::abs(obj.y - cy) < 2) && (std::abs(obj.x - cx) < 2);
+        return (std::abs(meteors.y[i] - cy) < 2) && (std::abs(meteors.x[i] - cx) < 2);
     }
 };
 
@@ -705,35 +686,30 @@ void MeteorsEffect::ImplodeAddMeteors(RenderBuffer& buffer, int ColorScheme, int
     if (TailLength < 1)
         TailLength = 1;
 
-    MeteorRadialClass m;
-    m.cnt = 1;
-
+    HSVValue hsv;
     for (int i = 0; i < MinDimension; i++) {
-        if (rand() % 200 < Count) {
+        if (buffer.Rand() % 200 < Count) {
             double angle;
             if (buffer.BufferHt == 1) {
-                angle = double(rand() % 2) * M_PI;
+                angle = double(buffer.Rand() % 2) * M_PI;
             } else if (buffer.BufferWi == 1) {
-                angle = double(rand() % 2) * M_PI - (M_PI / 2.0);
+                angle = double(buffer.Rand() % 2) * M_PI - (M_PI / 2.0);
             } else {
-                angle = rand01() * 2.0 * M_PI;
+                angle = buffer.Rand01() * 2.0 * M_PI;
             }
-            m.dx = buffer.cos(angle);
-            m.dy = buffer.sin(angle);
-            // m.x = centerX + double(halfdiag + TailLength)*m.dx;
-            // m.y = centerY + double(halfdiag + TailLength)*m.dy;
-            m.x = centerX + double(maxdiag + TailLength) * m.dx;
-            m.y = centerY + double(maxdiag + TailLength) * m.dy;
+            double dx = buffer.cos(angle);
+            double dy = buffer.sin(angle);
 
             switch (ColorScheme) {
             case 1:
-                buffer.SetRangeColor(hsv0, hsv1, m.hsv);
+                buffer.SetRangeColor(hsv0, hsv1, hsv);
                 break;
             case 2:
-                buffer.palette.GetHSV(rand() % colorcnt, m.hsv);
+                buffer.palette.GetHSV(buffer.Rand() % colorcnt, hsv);
                 break;
             }
-            cache->meteorsRadial.push_back(m);
+            // start far enough out that the whole tail is off the buffer
+            cache->meteorsRadial.Add(centerX + double(maxdiag + TailLength) * dx, centerY + double(maxdiag + TailLength) * dy, dx, dy, hsv);
         }
     }
 }
@@ -751,19 +727,26 @@ void MeteorsEffect::ImplodeMoveMeteors(RenderBuffer& buffer, int mspeed, int xof
                                     std::max(sqrt((buffer.BufferWi - centerX) * (buffer.BufferWi - centerX) + (0 - centerY) * (0 - centerY)),
                                              sqrt((buffer.BufferWi - centerX) * (buffer.BufferWi - centerX) + (buffer.BufferHt - centerY) * (buffer.BufferHt - centerY)))));
 
-    std::function<void(MeteorRadialClass&, int)> f = [fadeWithDistance, centerX, centerY, maxdiag, mspeed](MeteorRadialClass& meteor, int n) {
-        float hdistance = 1.0f;
-        if (fadeWithDistance) {
-            float x = meteor.x;
-            float y = meteor.y;
-            hdistance = std::max(0.1f, (float)sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
-        }
+    MeteorPool& meteors = cache->meteorsRadial;
+    if (!fadeWithDistance) {
+        meteors.Move(-mspeed);
+        return;
+    }
 
-        meteor.x -= meteor.dx * mspeed * hdistance;
-        meteor.y -= meteor.dy * mspeed * hdistance;
-        meteor.cnt++;
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+    // meteors slow down as they get closer to the center
+    float* px = meteors.x.data();
+    float* py = meteors.y.data();
+    const float* pdx = meteors.vx.data();
+    const float* pdy = meteors.vy.data();
+    const size_t count = meteors.Size();
+    for (size_t i = 0; i < count; ++i) {
+        float x = px[i];
+        float y = py[i];
+        float hdistance = std::max(0.1f, std::sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
+        px[i] -= pdx[i] * mspeed * hdistance;
+        py[i] -= pdy[i] * mspeed * hdistance;
+        meteors.age[i]++;
+    }
 }
 
 void MeteorsEffect::ImplodeRemoveMeteors(RenderBuffer& buffer, int xoffset, int yoffset)
@@ -774,7 +757,7 @@ void MeteorsEffect::ImplodeRemoveMeteors(RenderBuffer& buffer, int xoffset, int
     int trueyoffset = yoffset * buffer.BufferHt / 2 / 100;
 
     // delete old meteors
-    cache->meteorsRadial.remove_if(MeteorHasExpiredImplode(buffer.BufferWi / 2 + truexoffset, buffer.BufferHt / 2 + trueyoffset));
+    cache->meteorsRadial.RemoveIf(MeteorHasExpiredImplode(buffer.BufferWi / 2 + truexoffset, buffer.BufferHt / 2 + trueyoffset));
 }
 
 void MeteorsEffect::RenderMeteorsImplode(RenderBuffer& buffer, int ColorScheme, int Count, int Length, int SwirlIntensity, int mSpeed, int xoffset, int yoffset, bool fadeWithDistance, int warmupFrames)
@@ -816,24 +799,29 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer& buffer, int ColorScheme,
     ImplodeAddMeteors(buffer, ColorScheme, Count, Length, xoffset, yoffset);
 
     // render meteors
-    std::function<void(MeteorRadialClass&, int)> f = [&buffer, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme](MeteorRadialClass& meteor, int n) {
+    MeteorPool& meteors = cache->meteorsRadial;
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme](int n) {
+        double mx = meteors.x[n];
+        double my = meteors.y[n];
+        double dx = meteors.vx[n];
+        double dy = meteors.vy[n];
         HSVValue hsv;
 
         for (int ph = 0; ph <= TailLength; ph++) {
             switch (ColorScheme) {
             case 0:
-                hsv.hue = double(rand() % 1000) / 1000.0;
+                hsv.hue = double(ParticleHash(meteors.seed[n], ph, buffer.curPeriod) % 1000) / 1000.0;
                 hsv.saturation = 1.0;
                 hsv.value = 1.0;
                 break;
             default:
-                hsv = meteor.hsv;
+                hsv = meteors.colour[n];
                 break;
             }
             // if we were to swirl, it would need to alter the angle here
 
-            int x = int(meteor.x - meteor.dx * double(ph));
-            int y = int(meteor.y - meteor.dy * double(ph));
+            int x = int(mx - dx * double(ph));
+            int y = int(my - dy * double(ph));
 
             // the next line cannot test for exact center! Some lines miss by 1 because of rounding.
             if ((abs(y - centerY) < 2) && (abs(x - centerX) < 2))
@@ -857,8 +845,7 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer& buffer, int ColorScheme,
                 buffer.SetPixel(x, y, hsv);
             }
         }
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+    }, 500);
 
     ImplodeMoveMeteors(buffer, speed, xoffset, yoffset, fadeWithDistance);
 
@@ -885,9 +872,9 @@ public:
     }
 
     // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorRadialClass& obj)
+    bool operator()(const MeteorPool& meteors, size_t i)
     {
-        return obj.y < 0 || obj.x < 0 || obj.y > ht || obj.x > wi;
+        return meteors.y[i] < 0 || meteors.x[i] < 0 || meteors.y[i] > ht || meteors.x[i] > wi;
     }
 };
 
@@ -905,32 +892,28 @@ void MeteorsEffect::ExplodeAddMeteors(RenderBuffer& buffer, int ColorScheme, int
 
     int MinDimension = buffer.BufferHt < buffer.BufferWi ? buffer.BufferHt : buffer.BufferWi;
 
-    MeteorRadialClass m;
-    m.x = buffer.BufferWi / 2 + truexoffset;
-    m.y = buffer.BufferHt / 2 + trueyoffset;
-    m.cnt = 1;
+    HSVValue hsv;
+    int centerX = buffer.BufferWi / 2 + truexoffset;
+    int centerY = buffer.BufferHt / 2 + trueyoffset;
     for (int i = 0; i < MinDimension; i++) {
-        if (rand() % 200 < Count) {
+        if (buffer.Rand() % 200 < Count) {
             double angle;
             if (buffer.BufferHt == 1) {
-                    angle = double(rand() % 2) * M_PI;
+                    angle = double(buffer.Rand() % 2) * M_PI;
             } else if (buffer.BufferWi == 1) {
-                    angle = double(rand() % 2) * M_PI - (M_PI / 2.0);
+                    angle = double(buffer.Rand() % 2) * M_PI - (M_PI / 2.0);
             } else {
-                    angle = rand01() * 2.0 * M_PI;
+                    angle = buffer.Rand01() * 2.0 * M_PI;
             }
-            m.dx = buffer.cos(angle);
-            m.dy = buffer.sin(angle);
-
             switch (ColorScheme) {
             case 1:
-                    buffer.SetRangeColor(hsv0, hsv1, m.hsv);
+                    buffer.SetRangeColor(hsv0, hsv1, hsv);
                     break;
             case 2:
-                    buffer.palette.GetHSV(rand() % colorcnt, m.hsv);
+                    buffer.palette.GetHSV(buffer.Rand() % colorcnt, hsv);
                     break;
             }
-            cache->meteorsRadial.push_back(m);
+            cache->meteorsRadial.Add(centerX, centerY, buffer.cos(angle), buffer.sin(angle), hsv);
         }
     }
 }
@@ -949,19 +932,26 @@ void MeteorsEffect::ExplodeMoveMeteors(RenderBuffer& buffer, int mspeed, int xof
                                     std::max(sqrt((buffer.BufferWi - centerX) * (buffer.BufferWi - centerX) + (0 - centerY) * (0 - centerY)),
                                              sqrt((buffer.BufferWi - centerX) * (buffer.BufferWi - centerX) + (buffer.BufferHt - centerY) * (buffer.BufferHt - centerY)))));
 
-    std::function<void(MeteorRadialClass&, int)> f = [fadeWithDistance, centerX, centerY, maxdiag, mspeed](MeteorRadialClass& meteor, int n) {
-        float hdistance = 1.0f;
-        if (fadeWithDistance) {
-            float x = meteor.x;
-            float y = meteor.y;
-            hdistance = std::max(0.1f, (float)sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
-        }
+    MeteorPool& meteors = cache->meteorsRadial;
+    if (!fadeWithDistance) {
+        meteors.Move(mspeed);
+        return;
+    }
 
-        meteor.x += meteor.dx * mspeed * hdistance;
-        meteor.y += meteor.dy * mspeed * hdistance;
-        meteor.cnt++;
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+    // meteors slow down as they get closer to the center
+    float* px = meteors.x.data();
+    float* py = meteors.y.data();
+    const float* pdx = meteors.vx.data();
+    const float* pdy = meteors.vy.data();
+    const size_t count = meteors.Size();
+    for (size_t i = 0; i < count; ++i) {
+        float x = px[i];
+        float y = py[i];
+        float hdistance = std::max(0.1f, std::sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
+        px[i] += pdx[i] * mspeed * hdistance;
+        py[i] += pdy[i] * mspeed * hdistance;
+        meteors.age[i]++;
+    }
 }
 
 void MeteorsEffect::ExplodeRemoveMeteors(RenderBuffer& buffer)
@@ -969,7 +959,7 @@ void MeteorsEffect::ExplodeRemoveMeteors(RenderBuffer& buffer)
     MeteorsRenderCache* cache = GetCache(buffer, id);
 
     // delete old meteors
-    cache->meteorsRadial.remove_if(MeteorHasExpiredExplode(buffer.BufferHt, buffer.BufferWi));
+    cache->meteorsRadial.RemoveIf(MeteorHasExpiredExplode(buffer.BufferHt, buffer.BufferWi));
 }
 
 void MeteorsEffect::RenderMeteorsExplode(RenderBuffer& buffer, int ColorScheme, int Count, int Length, int SwirlIntensity, int mSpeed, int xoffset, int yoffset, bool fadeWithDistance, int warmupFrames)
@@ -1015,25 +1005,30 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer& buffer, int ColorScheme,
 
     // render meteors
 
-    std::function<void(MeteorRadialClass&, int)> f = [&buffer, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme](MeteorRadialClass& meteor, int n) {
+    MeteorPool& meteors = cache->meteorsRadial;
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme](int n) {
+        double mx = meteors.x[n];
+        double my = meteors.y[n];
+        double dx = meteors.vx[n];
+        double dy = meteors.vy[n];
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
             // if (ph >= it->cnt) continue;
             switch (ColorScheme) {
             case 0:
-                hsv.hue = double(rand() % 1000) / 1000.0;
+                hsv.hue = double(ParticleHash(meteors.seed[n], ph, buffer.curPeriod) % 1000) / 1000.0;
                 hsv.saturation = 1.0;
                 hsv.value = 1.0;
                 break;
             default:
-                hsv = meteor.hsv;
+                hsv = meteors.colour[n];
                 break;
             }
 
             // if we were to swirl, it would need to alter the angle here
 
-            int x = int(meteor.x + meteor.dx * double(ph));
-            int y = int(meteor.y + meteor.dy * double(ph));
+            int x = int(mx + dx * double(ph));
+            int y = int(my + dy * double(ph));
 
             if (fadeWithDistance) {
                 // distance
@@ -1053,8 +1048,7 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer& buffer, int ColorScheme,
                 buffer.SetPixel(x, y, hsv);
             }
         }
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+    }, 500);
 
     ExplodeMoveMeteors(buffer, speed, xoffset, yoffset, fadeWithDistance);
 
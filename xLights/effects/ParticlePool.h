@@ -0,0 +1,170 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Particles for the particle style effects (Meteors, Fireworks) held as a structure of arrays. Each field lives in its
+// own contiguous array so the move passes are plain loops over floats the compiler can vectorise and the draw passes
+// can be split into index ranges. Removing a particle moves the last one into its slot so the arrays never have holes.
+// Clearing or removing keeps the capacity so once an effect has warmed up adding particles does not allocate.
+//
+// Every array is Size() long. Effects may read and write the fields directly but must only add and remove particles
+// through the pool.
+// A random looking number from a particle's seed and whatever else should change it (a tail position, the frame).
+// Draw passes run in parallel so they use this rather than the buffer's random engine, the same inputs always give
+// the same number whichever thread gets there first.
+inline uint32_t ParticleHash(uint32_t seed, uint32_t a, uint32_t b)
+{
+    uint32_t h = seed * 0x9E3779B1u ^ a * 0x85EBCA77u ^ b * 0xC2B2AE3Du;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h;
+}
+
+template <class COLOUR>
+class ParticlePool
+{
+public:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> vx;
+    std::vector<float> vy;
+    std::vector<int> age;        // frames the particle has been moved
+    std::vector<int> param;      // effect specific
+    std::vector<uint32_t> seed;  // order the particle was added in, stable when other particles are removed
+    std::vector<COLOUR> colour;
+
+    size_t Size() const { return x.size(); }
+    bool Empty() const { return x.empty(); }
+
+    void Reserve(size_t count)
+    {
+        x.reserve(count);
+        y.reserve(count);
+        vx.reserve(count);
+        vy.reserve(count);
+        age.reserve(count);
+        param.reserve(count);
+        seed.reserve(count);
+        colour.reserve(count);
+    }
+
+    // seeds start again from 0 so an effect that clears when it starts draws the same whatever ran before it
+    void Clear()
+    {
+        _added = 0;
+        x.clear();
+        y.clear();
+        vx.clear();
+        vy.clear();
+        age.clear();
+        param.clear();
+        seed.clear();
+        colour.clear();
+    }
+
+    size_t Add(float px, float py, float pvx, float pvy, const COLOUR& c, int p = 0)
+    {
+        x.push_back(px);
+        y.push_back(py);
+        vx.push_back(pvx);
+        vy.push_back(pvy);
+        age.push_back(0);
+        param.push_back(p);
+        seed.push_back(_added++);
+        colour.push_back(c);
+        return x.size() - 1;
+    }
+
+    void Remove(size_t i)
+    {
+        size_t last = x.size() - 1;
+        if (i != last) {
+            x[i] = x[last];
+            y[i] = y[last];
+            vx[i] = vx[last];
+            vy[i] = vy[last];
+            age[i] = age[last];
+            param[i] = param[last];
+            seed[i] = seed[last];
+            colour[i] = colour[last];
+        }
+        x.pop_back();
+        y.pop_back();
+        vx.pop_back();
+        vy.pop_back();
+        age.pop_back();
+        param.pop_back();
+        seed.pop_back();
+        colour.pop_back();
+    }
+
+    // pred(pool, i) returns true for particles to remove, returns how many were removed
+    template <class PRED>
+    size_t RemoveIf(PRED pred)
+    {
+        size_t removed = 0;
+        size_t i = 0;
+        while (i < x.size()) {
+            if (pred(*this, i)) {
+                // the last particle moves into i so look at i again
+                Remove(i);
+                ++removed;
+            } else {
+                ++i;
+            }
+        }
+        return removed;
+    }
+
+    // x += vx * scale, y += vy * scale
+    void Move(float scale)
+    {
+        const size_t count = x.size();
+        float* px = x.data();
+        float* py = y.data();
+        const float* pvx = vx.data();
+        const float* pvy = vy.data();
+        int* pa = age.data();
+        for (size_t i = 0; i < count; ++i) {
+            px[i] += pvx[i] * scale;
+            py[i] += pvy[i] * scale;
+            pa[i]++;
+        }
+    }
+
+    // adds the acceleration to the velocity and then moves by the new velocity
+    void Accelerate(float ax, float ay)
+    {
+        const size_t count = x.size();
+        float* px = x.data();
+        float* py = y.data();
+        float* pvx = vx.data();
+        float* pvy = vy.data();
+        int* pa = age.data();
+        for (size_t i = 0; i < count; ++i) {
+            pvx[i] += ax;
+            pvy[i] += ay;
+            px[i] += pvx[i];
+            py[i] += pvy[i];
+            pa[i]++;
+        }
+    }
+
+private:
+    uint32_t _added = 0;
+};
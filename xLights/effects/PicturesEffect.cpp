@@ -29,8 +29,10 @@
 #include "../xLightsXmlFile.h"
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 #include "GIFImage.h"
+#include "SharedImageCache.h"
 #include "../xLightsMain.h" 
 
 #include <log4cpp/Category.hh>
@@ -57,31 +59,29 @@ std::list<std::string> PicturesEffect::CheckEffectSettings(const SettingsMap& se
 
     wxString pictureFilename = settings.Get("E_FILEPICKER_Pictures_Filename", "");
 
-    if (pictureFilename == "" || !FileExists(pictureFilename))
+    if (pictureFilename == "" || !CheckSequenceCache::Instance().FileExists(pictureFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    ERR: Picture effect cant find image file '%s'. Model '%s', Start %s", pictureFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
     else
     {
-        if (!IsFileInShowDir(xLightsFrame::CurrentDir, pictureFilename.ToStdString()))
+        if (!CheckSequenceCache::Instance().IsFileInShowDir(pictureFilename.ToStdString()))
         {
             res.push_back(wxString::Format("    WARN: Picture effect image file '%s' not under show directory. Model '%s', Start %s", pictureFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         }
 
-        int imageCount = wxImage::GetImageCount(pictureFilename);
-        if (imageCount <= 0)
+        SharedImageCache::ImageInfo info = SharedImageCache::Instance().GetInfo(pictureFilename.ToStdString());
+        if (info.imageCount <= 0)
         {
             res.push_back(wxString::Format("    ERR: Picture effect '%s' contains no images. Image invalid. Model '%s', Start %s", pictureFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         }
 
         if (!renderCache)
         {
-            wxImage i;
-            i.LoadFile(pictureFilename);
-            if (i.IsOk())
+            if (info.ok)
             {
-                int ih = i.GetHeight();
-                int iw = i.GetWidth();
+                int ih = info.height;
+                int iw = info.width;
 
 #define IMAGESIZETHRESHOLD 10
                 if (ih > IMAGESIZETHRESHOLD * model->GetDefaultBufferHt() || iw > IMAGESIZETHRESHOLD * model->GetDefaultBufferWi())
@@ -248,22 +248,16 @@ typedef std::vector< std::pair<wxPoint, xlColor> > PixelVector;
 
 class PicturesRenderCache : public EffectRenderCache {
 public:
-    PicturesRenderCache() : imageCount(0), frame(0),  gifImage(nullptr), maxmovieframes(0) {};
-    virtual ~PicturesRenderCache()
-    {
-        if (gifImage != nullptr) {
-            delete gifImage;
-            gifImage = nullptr;
-        }
-    };
+    PicturesRenderCache() : imageCount(0), frame(0), imageFrame(0), maxmovieframes(0) {};
+    virtual ~PicturesRenderCache() {};
 
     wxImage image;
     wxImage rawimage;
     int imageCount;
     int frame;
+    int imageFrame; // frame of PictureName in image, always 0 unless it is an animated gif
     int maxmovieframes;
     wxString PictureName;
-    GIFImage* gifImage;
     std::vector<PixelVector> PixelsByFrame;
 };
 
@@ -535,7 +529,6 @@ void PicturesEffect::Render(RenderBuffer& buffer,
         //      ffmpeg -i XXXX.mts -s 16x50 XXXX-%d.jpg
 
         wxFile f;
-        GIFImage*& gifImage = cache->gifImage;
         std::vector<PixelVector>& PixelsByFrame = cache->PixelsByFrame;
         int& frame = cache->frame;
 
@@ -609,48 +602,23 @@ void PicturesEffect::Render(RenderBuffer& buffer,
 #ifdef LINUX
                 logger_base.debug("About to count images in bitmap %s.", (const char*)NewPictureName.c_str());
 #endif
-                cache->imageCount = wxImage::GetImageCount(NewPictureName);
+                // decoding the first frame first means the info is what was decoded rather than what the header says
+                image = SharedImageCache::Instance().GetFrame(NewPictureName.ToStdString(), 0, suppressGIFBackground);
+                SharedImageCache::ImageInfo info = SharedImageCache::Instance().GetInfo(NewPictureName.ToStdString(), suppressGIFBackground);
+                cache->imageCount = info.imageCount;
                 if (cache->imageCount <= 0) {
                     logger_base.error("Image %s reports %d frames which is invalid. Overriding it to be 1.", (const char*)NewPictureName.c_str(), cache->imageCount);
-
-                    // override it to 1
-                    cache->imageCount = 1;
                 }
-                
-                cache->PictureName = NewPictureName;
+                // a gif that would not decode is drawn as a still image
+                cache->imageCount = std::max(info.frames, 1);
 
-                if (cache->imageCount > 1) {
-#ifdef DEBUG_GIF
-                    logger_base.debug("Preparing GIF file for reading: %s", (const char*)NewPictureName.c_str());
-#endif
-                    if (gifImage != nullptr && gifImage->GetFilename() != NewPictureName) {
-                        delete gifImage;
-                        gifImage = nullptr;
-                    }
-                    if (gifImage == nullptr) {
-                        gifImage = new GIFImage(NewPictureName.ToStdString(), suppressGIFBackground);
-                    }
+                cache->PictureName = NewPictureName;
+                cache->imageFrame = 0;
 
-                    if (!gifImage->IsOk()) {
-                        delete gifImage;
-                        gifImage = nullptr;
-                        cache->imageCount = 1;
-                        if (!image.LoadFile(NewPictureName, wxBITMAP_TYPE_ANY, 0)) {
-                            logger_base.error("Error loading image file: %s.", (const char*)NewPictureName.c_str());
-                            image.Create(5, 5, true);
-                        }
-                        rawimage = image;
-                    } else {
-                        image = gifImage->GetFrame(0);
-                        rawimage = image;
-                    }
-                } else {
-                    if (!image.LoadFile(NewPictureName, wxBITMAP_TYPE_ANY, 0)) {
-                        logger_base.error("Error loading image file: %s.", (const char*)NewPictureName.c_str());
-                        image.Create(5, 5, true);
-                    }
-                    rawimage = image;
+                if (!image.IsOk()) {
+                    image.Create(5, 5, true);
                 }
+                rawimage = image;
             }
         }
         if (!noImageFile && !image.IsOk()) {
@@ -662,12 +630,12 @@ void PicturesEffect::Render(RenderBuffer& buffer,
             scale_image = true;
 
             if (loopGIF) {
-                image = gifImage->GetFrameForTime((buffer.curPeriod - buffer.curEffStartPer) * buffer.frameTimeInMs * frameRateAdj, true);
+                cache->imageFrame = SharedImageCache::Instance().GetFrameForTime(NewPictureName.ToStdString(), (buffer.curPeriod - buffer.curEffStartPer) * buffer.frameTimeInMs * frameRateAdj, true, suppressGIFBackground);
             }
             else {
-                int ii = cache->imageCount * buffer.GetEffectTimeIntervalPosition(frameRateAdj) * 0.99;
-                image = gifImage->GetFrame(ii);
+                cache->imageFrame = cache->imageCount * buffer.GetEffectTimeIntervalPosition(frameRateAdj) * 0.99;
             }
+            image = SharedImageCache::Instance().GetFrame(NewPictureName.ToStdString(), cache->imageFrame, suppressGIFBackground);
 
             rawimage = image;
 
@@ -697,13 +665,17 @@ void PicturesEffect::Render(RenderBuffer& buffer,
     int xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
 
     if (scale_to_fit == "Scale To Fit" && (BufferWi != imgwidth || BufferHt != imght)) {
-        image = rawimage;
+        // the same file at the same size is only ever scaled once
+        image = SharedImageCache::Instance().GetScaledFrame(cache->PictureName.ToStdString(), cache->imageFrame, suppressGIFBackground, BufferWi, BufferHt);
+        if (!image.IsOk()) {
+            image = rawimage;
 // work around wxWidgets image rescaling bug on windows in VS release builds
 //#ifdef __WXMSW__
-//        image.Rescale(BufferWi, BufferHt, wxIMAGE_QUALITY_BILINEAR); // I tried bicubic but it creates visual artefacts
+//            image.Rescale(BufferWi, BufferHt, wxIMAGE_QUALITY_BILINEAR); // I tried bicubic but it creates visual artefacts
 //#else
-        image.Rescale(BufferWi, BufferHt);
+            image.Rescale(BufferWi, BufferHt);
 //#endif
+        }
         imgwidth = image.GetWidth();
         imght = image.GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
@@ -716,12 +688,18 @@ void PicturesEffect::Render(RenderBuffer& buffer,
         float sc = std::min(xr, yr);
         if(scale_to_fit.find("Crop") != std::string::npos)
             sc = std::max(xr, yr);
+        int scaledWidth = image.GetWidth() * sc;
+        int scaledHeight = image.GetHeight() * sc;
+        image = SharedImageCache::Instance().GetScaledFrame(cache->PictureName.ToStdString(), cache->imageFrame, suppressGIFBackground, scaledWidth, scaledHeight);
+        if (!image.IsOk()) {
+            image = rawimage;
 // work around wxWidgets image rescaling bug on windows in VS release builds
 //#ifdef __WXMSW__
-//        image.Rescale(image.GetWidth() * sc, image.GetHeight() * sc, wxIMAGE_QUALITY_BILINEAR); // I tried bicubic but it creates visual artefacts
+//            image.Rescale(scaledWidth, scaledHeight, wxIMAGE_QUALITY_BILINEAR); // I tried bicubic but it creates visual artefacts
 //#else
-        image.Rescale(image.GetWidth() * sc, image.GetHeight() * sc);
+            image.Rescale(scaledWidth, scaledHeight);
 //#endif
+        }
         imgwidth = image.GetWidth();
         imght = image.GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
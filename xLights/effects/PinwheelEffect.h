@@ -42,6 +42,10 @@ public:
     virtual ~PinwheelEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool SupportsRadialColorCurves(const SettingsMap& SettingsMap) const override
     {
         return true;
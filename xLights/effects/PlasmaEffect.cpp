@@ -22,6 +22,9 @@
 #include "../../include/plasma-64.xpm"
 
 #include "../Parallel.h"
+#include "EffectKernels.h"
+
+#include <cstring>
 
 PlasmaEffect::PlasmaEffect(int id) : RenderableEffect(id, "Plasma", plasma_16, plasma_24, plasma_32, plasma_48, plasma_64)
 {
@@ -98,6 +101,30 @@ void PlasmaEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
     const double sin_time_2 = buffer.sin(time / 2);
     static const double pi3 = pi / 3.0;
 
+    // anything wider than a few pixels goes through the row kernel, 4 pixels at a time
+    if (buffer.BufferWi >= 4 && buffer.BufferHt >= 2 && !buffer.IsDmxBuffer()) {
+        PlasmaKernelData data;
+        data.Style = Style;
+        data.Line_Density = Line_Density;
+        data.time = time;
+        data.sin_time_5 = sin_time_5;
+        data.cos_time_3 = cos_time_3;
+        data.sin_time_2 = sin_time_2;
+        data.width = buffer.BufferWi;
+        data.height = buffer.BufferHt;
+        data.colorScheme = ColorScheme;
+        data.numColors = std::min((int)buffer.palette.Size(), MAX_KERNEL_COLORS);
+        for (int i = 0; i < data.numColors; i++) {
+            const xlColor c = buffer.palette.GetColor(i);
+            std::memcpy(data.colors[i], &c, 4);
+        }
+        uint8_t* pixels = (uint8_t*)buffer.GetPixels();
+        parallel_for(0, buffer.BufferHt, [&data, pixels](int y) {
+            PlasmaKernel(data, pixels, y, y + 1);
+        }, std::max(1, 1024 / buffer.BufferWi));
+        return;
+    }
+
     int block = buffer.BufferHt * buffer.BufferWi > 100 ? 1 : -1;
     parallel_for(0, buffer.BufferWi, [&] (int x) {
         double rx = ((float)x / (buffer.BufferWi - 1)); // rx is now in the range 0.0 to 1.0
@@ -109,6 +136,9 @@ void PlasmaEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
         // 1st equation
         double v1 = buffer.sin(rx * 10 + time);
 
+        // palette colours are blended for the whole column at once
+        std::vector<float> positions(ColorScheme == PLASMA_NORMAL_COLORS ? buffer.BufferHt : 0);
+
         for (int y=0; y<buffer.BufferHt; y++)
         {
             // reference: http://www.bidouille.org/prog/plasma
@@ -139,11 +169,8 @@ void PlasmaEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
             switch (ColorScheme)
             {
                 case PLASMA_NORMAL_COLORS:
-                    {
-                        double h = (buffer.sin (vldpi + 2 * pi3) + 1) * 0.5;
-                        buffer.GetMultiColorBlend(h,false,color);
-                    }
-                    break;
+                    positions[y] = (buffer.sin (vldpi + 2 * pi3) + 1) * 0.5;
+                    continue;
                 case PLASMA_PRESET1:
                     color.red = (buffer.sin (vldpi) + 1) * 128;
                     color.green = (buffer.cos (vldpi) + 1) * 128;
@@ -166,5 +193,15 @@ void PlasmaEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Render
             }
             buffer.SetPixel(x,y,color);
         }
+
+        if (!positions.empty())
+        {
+            std::vector<xlColor> colors(positions.size());
+            buffer.GetMultiColorBlend(positions.data(), positions.size(), false, colors.data());
+            for (int y = 0; y < buffer.BufferHt; y++)
+            {
+                buffer.SetPixel(x, y, colors[y]);
+            }
+        }
     }, block);
 }
@@ -22,6 +22,10 @@ public:
     virtual ~PlasmaEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool CanRenderPartialTimeInterval() const override
     {
         return true;
@@ -114,10 +114,28 @@ public:
         return true;
     }
     virtual bool SupportsRenderCache(const SettingsMap& settings) const;
+    // true if each frame depends only on the settings and the frame number and not on anything left over from
+    // rendering the previous frames, such effects can have several frames rendered at once
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const
+    {
+        return false;
+    }
+    // true if everything the effect carries from one frame to the next is in the buffer pixels and a render cache
+    // that can be snapshot, so a render can resume part way through the effect from a checkpoint
+    virtual bool SupportsRenderCheckpoints(const SettingsMap& settings) const
+    {
+        return false;
+    }
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) = 0;
     virtual void RenameTimingTrack(std::string oldname, std::string newname, Effect* effect)
     {}
     virtual std::list<std::string> CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache);
+    // true if CheckEffectSettings looks at effects on other models (timing tracks are already allowed for), check
+    // sequence cant then reuse its last answer just because this effect hasn't changed
+    virtual bool CheckEffectSettingsUsesOtherEffects() const
+    {
+        return false;
+    }
 
     virtual bool CanBeRandom()
     {
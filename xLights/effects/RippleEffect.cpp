@@ -14,6 +14,7 @@
 #include "../sequencer/Effect.h"
 #include "../RenderBuffer.h"
 #include "../UtilClasses.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 #include "../models/Model.h"
 #include "../xLightsMain.h"
@@ -1690,10 +1691,10 @@ std::list<std::string> RippleEffect::CheckEffectSettings(const SettingsMap& sett
     if (object == "SVG") {
         auto svgFilename = settings.Get("E_FILEPICKERCTRL_Ripple_SVG", "");
 
-        if (svgFilename == "" || !FileExists(svgFilename)) {
+        if (svgFilename == "" || !CheckSequenceCache::Instance().FileExists(svgFilename)) {
             res.push_back(wxString::Format("    ERR: Ripple effect can't find SVG file '%s'. Model '%s', Start %s", svgFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         } else {
-            if (!IsFileInShowDir(xLightsFrame::CurrentDir, svgFilename)) {
+            if (!CheckSequenceCache::Instance().IsFileInShowDir(svgFilename)) {
                 res.push_back(wxString::Format("    WARN: Ripple effect SVG file '%s' not under show directory. Model '%s', Start %s", svgFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
             }
         }
@@ -74,6 +74,7 @@
 #include "../TimingPanel.h"
 #include "OpenGLShaders.h"
 #include "UtilFunctions.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 #include "../../xSchedule/wxJSON/jsonreader.h"
 #include "graphics/opengl/DrawGLUtils.h"
@@ -82,8 +83,11 @@
 
 #include <log4cpp/Category.hh>
 
+#include <cstring>
 #include <fstream>
+#include <list>
 #include <map>
+#include <queue>
 #include <set>
 #include <mutex>
 #include <string>
@@ -216,11 +220,11 @@ std::list<std::string> ShaderEffect::CheckEffectSettings(const SettingsMap& sett
 
     wxString ifsFilename = settings.Get("E_0FILEPICKERCTRL_IFS", "");
 
-    if (ifsFilename == "" || !FileExists(ifsFilename))
+    if (ifsFilename == "" || !CheckSequenceCache::Instance().FileExists(ifsFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    ERR: Shader effect cant find file '%s'. Model '%s', Start %s", ifsFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
-    else if (!IsFileInShowDir(xLightsFrame::CurrentDir, ifsFilename.ToStdString()))
+    else if (!CheckSequenceCache::Instance().IsFileInShowDir(ifsFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    WARN: Shader effect file '%s' not under show directory. Model '%s', Start %s", ifsFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
@@ -548,6 +552,161 @@ private:
 } GL_CONTEXT_POOL;
 #endif /* __WXMSW__*/
 
+#if defined(LINUX)
+// keep eglplatform.h from dragging in Xlib and its macros
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+// On Linux the GLX contexts belong to the preview canvas and can only be used on the main thread.
+// Surfaceless EGL contexts need no window or display so they can be created on, and used from,
+// the render threads.  With Mesa this also works on machines with no GPU (llvmpipe) which lets
+// headless render servers render shaders at all.  All contexts share with a root context so the
+// compiled programs cached in ShaderRenderCache::shaderMap can be used on any of them.
+class EGLContextPool {
+public:
+    EGLContextPool() {}
+    ~EGLContextPool() {
+        if (display != EGL_NO_DISPLAY) {
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            for (auto c : allContexts) {
+                eglDestroyContext(display, c);
+            }
+            if (rootContext != EGL_NO_CONTEXT) {
+                eglDestroyContext(display, rootContext);
+            }
+            eglTerminate(display);
+        }
+    }
+
+    bool IsAvailable() {
+        std::unique_lock<std::mutex> locker(lock);
+        if (!initialized) {
+            initialized = true;
+            available = Initialize();
+        }
+        return available;
+    }
+
+    EGLContext GetContext() {
+        static log4cpp::Category& logger_opengl = log4cpp::Category::getInstance(std::string("log_opengl"));
+        if (!IsAvailable()) {
+            return EGL_NO_CONTEXT;
+        }
+        std::unique_lock<std::mutex> locker(lock);
+        if (!contexts.empty()) {
+            EGLContext ret = contexts.front();
+            contexts.pop();
+            logger_opengl.debug("Shader EGL context taken from pool 0x%llx", (uint64_t)ret);
+            return ret;
+        }
+        EGLContext ret = CreateContext(rootContext);
+        if (ret != EGL_NO_CONTEXT) {
+            allContexts.push_back(ret);
+            logger_opengl.debug("ShaderEffect Thread %d created EGL context 0x%llx.", wxThread::GetCurrentId(), (uint64_t)ret);
+        }
+        return ret;
+    }
+    void ReleaseContext(EGLContext ctx) {
+        static log4cpp::Category& logger_opengl = log4cpp::Category::getInstance(std::string("log_opengl"));
+        std::unique_lock<std::mutex> locker(lock);
+        contexts.push(ctx);
+        logger_opengl.debug("Shader EGL context released 0x%llx", (uint64_t)ctx);
+    }
+
+    bool SetCurrent(EGLContext ctx) {
+        return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx) == EGL_TRUE;
+    }
+    void UnsetCurrent() {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+private:
+    bool Initialize() {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+        auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay != nullptr) {
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        if (display == EGL_NO_DISPLAY) {
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+        EGLint major = 0;
+        EGLint minor = 0;
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+            logger_base.info("ShaderEffect - EGL not available, shaders will render on the main thread.");
+            display = EGL_NO_DISPLAY;
+            return false;
+        }
+        const char* ext = eglQueryString(display, EGL_EXTENSIONS);
+        if (ext == nullptr || strstr(ext, "EGL_KHR_surfaceless_context") == nullptr || !eglBindAPI(EGL_OPENGL_API)) {
+            logger_base.info("ShaderEffect - EGL %d.%d does not support surfaceless OpenGL contexts.", major, minor);
+            return false;
+        }
+
+        static const EGLint configAttrs[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, 8,
+            EGL_NONE
+        };
+        EGLint numConfigs = 0;
+        if (!eglChooseConfig(display, configAttrs, &config, 1, &numConfigs) || numConfigs < 1) {
+            logger_base.info("ShaderEffect - no suitable EGL config found.");
+            return false;
+        }
+
+        rootContext = CreateContext(EGL_NO_CONTEXT);
+        if (rootContext == EGL_NO_CONTEXT || !SetCurrent(rootContext)) {
+            logger_base.info("ShaderEffect - unable to create EGL OpenGL context.");
+            return false;
+        }
+        if (!OpenGLShaders::HasShaderSupport() || !OpenGLShaders::HasFramebufferObjects()) {
+            // no GLX canvas has loaded the entry points yet (eg. running without a usable display)
+            DrawGLUtils::LoadGLFunctions();
+        }
+        const GLubyte* str = glGetString(GL_VERSION);
+        const GLubyte* rend = glGetString(GL_RENDERER);
+        const GLubyte* vend = glGetString(GL_VENDOR);
+        logger_base.info("ShaderEffect - EGL %d.%d glVer:  %s  (%s)(%s)", major, minor,
+                         (const char*)str, (const char*)rend, (const char*)vend);
+        UnsetCurrent();
+        return OpenGLShaders::HasShaderSupport() && OpenGLShaders::HasFramebufferObjects();
+    }
+
+    EGLContext CreateContext(EGLContext shared) {
+        EGLint cxtAttrs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        EGLContext ctx = eglCreateContext(display, config, shared, cxtAttrs);
+        if (ctx == EGL_NO_CONTEXT) {
+            cxtAttrs[3] = 1;
+            ctx = eglCreateContext(display, config, shared, cxtAttrs);
+        }
+        return ctx;
+    }
+
+    std::mutex lock;
+    bool initialized = false;
+    bool available = false;
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLConfig config = nullptr;
+    EGLContext rootContext = EGL_NO_CONTEXT;
+    std::queue<EGLContext> contexts;
+    std::list<EGLContext> allContexts;
+} EGL_CONTEXT_POOL;
+#endif /* LINUX */
+
 
 #if defined(__WXOSX__)
 constexpr int osxSharedContextCount = 24;
@@ -665,7 +824,13 @@ public:
             }
         }
 #else
-        if (preview) {
+        if (eglContext != EGL_NO_CONTEXT) {
+            EGL_CONTEXT_POOL.SetCurrent(eglContext);
+            DestroyResources();
+            EGL_CONTEXT_POOL.UnsetCurrent();
+            EGL_CONTEXT_POOL.ReleaseContext(eglContext);
+            eglContext = EGL_NO_CONTEXT;
+        } else if (preview) {
             unsigned vertexArrayId = s_vertexArrayId;
             unsigned vertexBufferId = s_vertexBufferId;
             unsigned fbId = s_fbId;
@@ -700,6 +865,20 @@ public:
 #endif
     }
 
+    // compiled programs can only be used on contexts in the share group they were compiled in
+    std::string ShaderMapKey(const std::string& code) const {
+#if defined(__WXOSX__) || defined(__WXMSW__)
+        // every context shares with the one the others were created from
+        return code;
+#else
+        // the EGL contexts all share with the pool's root context, the GLX ones belong to their canvas
+        if (eglContext != EGL_NO_CONTEXT) {
+            return "egl|" + code;
+        }
+        return wxString::Format("glx%p|", (void*)preview).ToStdString() + code;
+#endif
+    }
+
     void SetProgramId(unsigned programId, ShaderInfo *si) {
         if (s_programId && s_shaderInfo) {
             StoreProgramId();
@@ -707,7 +886,7 @@ public:
         s_programId = programId;
         s_shaderInfo = si;
         if (_shaderConfig) {
-            s_code = _shaderConfig->GetCode();
+            s_code = ShaderMapKey(_shaderConfig->GetCode());
         }
     }
     unsigned RefreshProgramId() {
@@ -804,7 +983,8 @@ public:
 #elif defined(__WXMSW__)
     GLContextInfo *glContextInfo = nullptr;
 #else
-    xlGLCanvas *preview;
+    xlGLCanvas *preview = nullptr;
+    EGLContext eglContext = EGL_NO_CONTEXT;
 #endif
 };
 std::map<std::string, ShaderRenderCache::ShaderInfo*> ShaderRenderCache::shaderMap;
@@ -824,7 +1004,8 @@ bool ShaderEffect::CanRenderOnBackgroundThread(Effect* effect, const SettingsMap
 #elif defined(__WXMSW__)
     return useBackgroundRender;
 #else
-    return false;
+    // GLX contexts are tied to the main thread, only the surfaceless EGL contexts can go to the render threads
+    return useBackgroundRender && EGL_CONTEXT_POOL.IsAvailable();
 #endif
 }
 
@@ -842,6 +1023,10 @@ void ShaderEffect::UnsetGLContext(ShaderRenderCache* cache) {
         // release it from the thread every time so we never find ourselves in a situation where it has not been released by a thread
         cache->glContextInfo->UnsetCurrent();
     }
+#else
+    if (cache->eglContext != EGL_NO_CONTEXT) {
+        EGL_CONTEXT_POOL.UnsetCurrent();
+    }
 #endif
 }
 
@@ -1021,6 +1206,16 @@ bool ShaderEffect::SetGLContext(ShaderRenderCache *cache) {
     return true;
 #else
     ShaderPanel *p = (ShaderPanel *)panel;
+    if (cache->eglContext == EGL_NO_CONTEXT && (ShaderEffect::IsBackgroundRender() || p == nullptr || p->_preview == nullptr)) {
+        // we grab it here and release it when the cache is deleted
+        cache->eglContext = EGL_CONTEXT_POOL.GetContext();
+    }
+    if (cache->eglContext != EGL_NO_CONTEXT) {
+        return EGL_CONTEXT_POOL.SetCurrent(cache->eglContext);
+    }
+    if (p == nullptr || p->_preview == nullptr) {
+        return false;
+    }
     cache->preview = p->_preview;
     p->_preview->SetCurrentGLContext();
     return true;
@@ -1032,13 +1227,6 @@ void ShaderEffect::Render(Effect* eff, const SettingsMap& SettingsMap, RenderBuf
 {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-    // Bail out right away if we don't have the necessary OpenGL support
-    if (!OpenGLShaders::HasFramebufferObjects() || !OpenGLShaders::HasShaderSupport()) {
-        setRenderBufferAll(buffer, xlCYAN);
-        logger_base.error("ShaderEffect::Render() - missing OpenGL support!!");
-        return;
-    }
-
     ShaderRenderCache* cache = (ShaderRenderCache*)buffer.infoCache[id];
     if (cache == nullptr) {
         cache = new ShaderRenderCache();
@@ -1058,8 +1246,19 @@ void ShaderEffect::Render(Effect* eff, const SettingsMap& SettingsMap, RenderBuf
     int& s_rbHeight = cache->s_rbHeight;
     long& _timeMS = cache->_timeMS;
 
+    // the context has to be set up first, with no preview canvas (headless) it is what loads the GL entry points
     bool contextSet = SetGLContext(cache);
 
+    // Bail out if we don't have the necessary OpenGL support
+    if (!OpenGLShaders::HasFramebufferObjects() || !OpenGLShaders::HasShaderSupport()) {
+        if (contextSet) {
+            UnsetGLContext(cache);
+        }
+        setRenderBufferAll(buffer, xlCYAN);
+        logger_base.error("ShaderEffect::Render() - missing OpenGL support!!");
+        return;
+    }
+
     float oset = buffer.GetEffectTimeIntervalPosition();
     double timeRate = GetValueCurveDouble("Shader_Speed", 100, SettingsMap, oset, SHADER_SPEED_MIN, SHADER_SPEED_MAX, buffer.GetStartTimeMS(), buffer.GetEndTimeMS(), 1) / 100.0;
 
@@ -1378,8 +1577,9 @@ unsigned ShaderEffect::programIdForShaderCode(ShaderConfig* cfg, ShaderRenderCac
         return 0u;
     }
 
+    std::string key = cache->ShaderMapKey(fragmentShaderSrc);
     ShaderRenderCache::ShaderInfo *shaderInfo = nullptr;
-    auto iter = ShaderRenderCache::shaderMap.find(fragmentShaderSrc);
+    auto iter = ShaderRenderCache::shaderMap.find(key);
     if (iter != ShaderRenderCache::shaderMap.cend()) {
         shaderInfo = (*iter).second;
         while (!shaderInfo->programIds.empty()) {
@@ -1406,10 +1606,10 @@ unsigned ShaderEffect::programIdForShaderCode(ShaderConfig* cfg, ShaderRenderCac
         logger_base.debug("ShaderEffect::programIdForShaderCode() - fragment shader %s compiled successfully", (const char*)cfg->GetFilename().c_str());
         if (shaderInfo == nullptr) {
             lock.lock();
-            shaderInfo = ShaderRenderCache::shaderMap[fragmentShaderSrc];
+            shaderInfo = ShaderRenderCache::shaderMap[key];
             if (shaderInfo  == nullptr) {
                 shaderInfo = new ShaderRenderCache::ShaderInfo(programId);
-                ShaderRenderCache::shaderMap[fragmentShaderSrc] = shaderInfo;
+                ShaderRenderCache::shaderMap[key] = shaderInfo;
             }
             lock.unlock();
         }
@@ -0,0 +1,437 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "SharedImageCache.h"
+#include "GIFImage.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <wx/file.h>
+#include <wx/filefn.h>
+#include <wx/log.h>
+
+#include <log4cpp/Category.hh>
+
+static std::string InfoKey(const std::string& filename)
+{
+    return filename + "|" + std::to_string((long long)wxFileModificationTime(filename));
+}
+
+static std::string EntryKey(const std::string& filename, bool suppressGIFBackground)
+{
+    return InfoKey(filename) + (suppressGIFBackground ? "|1" : "|0");
+}
+
+static uint32_t ReadBE16(const uint8_t* p) { return ((uint32_t)p[0] << 8) | p[1]; }
+static uint32_t ReadLE16(const uint8_t* p) { return p[0] | ((uint32_t)p[1] << 8); }
+static uint32_t ReadBE32(const uint8_t* p) { return (ReadBE16(p) << 16) | ReadBE16(p + 2); }
+static uint32_t ReadLE32(const uint8_t* p) { return ReadLE16(p) | (ReadLE16(p + 2) << 16); }
+
+// skips gif data sub-blocks up to and including the terminator
+static bool SkipGIFSubBlocks(wxFile& file)
+{
+    uint8_t len = 0;
+    do {
+        if (file.Read(&len, 1) != 1 || (len != 0 && file.Seek(len, wxFromCurrent) == wxInvalidOffset)) {
+            return false;
+        }
+    } while (len != 0);
+    return true;
+}
+
+// Walks the blocks of a gif without decoding any of them. The size matches GIFImage, the extent of all the frames,
+// except for a single frame gif which wxImage loads at the size of the frame.
+static bool ReadGIFHeader(wxFile& file, SharedImageCache::ImageInfo& info)
+{
+    uint8_t hdr[13];
+    if (file.Read(hdr, sizeof(hdr)) != sizeof(hdr) || memcmp(hdr, "GIF8", 4) != 0) {
+        return false;
+    }
+    if ((hdr[10] & 0x80) != 0 && file.Seek(3 << ((hdr[10] & 0x07) + 1), wxFromCurrent) == wxInvalidOffset) {
+        return false;
+    }
+    int frames = 0;
+    int width = 0;
+    int height = 0;
+    for (;;) {
+        uint8_t block = 0;
+        if (file.Read(&block, 1) != 1) {
+            return false;
+        }
+        if (block == 0x3B) {
+            break;
+        } else if (block == 0x21) {
+            uint8_t label;
+            if (file.Read(&label, 1) != 1 || !SkipGIFSubBlocks(file)) {
+                return false;
+            }
+        } else if (block == 0x2C) {
+            uint8_t desc[9];
+            if (file.Read(desc, sizeof(desc)) != sizeof(desc)) {
+                return false;
+            }
+            int w = ReadLE16(desc + 4);
+            int h = ReadLE16(desc + 6);
+            if (frames == 0) {
+                width = w;
+                height = h;
+            }
+            info.width = std::max(info.width, (int)ReadLE16(desc) + w);
+            info.height = std::max(info.height, (int)ReadLE16(desc + 2) + h);
+            frames++;
+            if ((desc[8] & 0x80) != 0 && file.Seek(3 << ((desc[8] & 0x07) + 1), wxFromCurrent) == wxInvalidOffset) {
+                return false;
+            }
+            // the LZW minimum code size then the image data
+            if (file.Seek(1, wxFromCurrent) == wxInvalidOffset || !SkipGIFSubBlocks(file)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+    if (frames == 0) {
+        return false;
+    }
+    if (frames == 1) {
+        info.width = width;
+        info.height = height;
+    }
+    info.imageCount = frames;
+    info.frames = frames;
+    return true;
+}
+
+// the first start of frame marker has the size
+static bool ReadJPEGHeader(wxFile& file, SharedImageCache::ImageInfo& info)
+{
+    uint8_t hdr[2];
+    if (file.Read(hdr, 2) != 2 || hdr[0] != 0xFF || hdr[1] != 0xD8) {
+        return false;
+    }
+    for (;;) {
+        uint8_t marker = 0xFF;
+        while (marker == 0xFF) {
+            if (file.Read(&marker, 1) != 1) {
+                return false;
+            }
+        }
+        if (marker == 0xD8 || marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            continue;
+        }
+        if (marker == 0xD9 || marker == 0xDA) {
+            // end of image or the compressed data started without a frame header
+            return false;
+        }
+        uint8_t seg[7];
+        if (file.Read(seg, 2) != 2) {
+            return false;
+        }
+        int len = ReadBE16(seg);
+        if (len < 2) {
+            return false;
+        }
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            if (len < 7 || file.Read(seg + 2, 5) != 5) {
+                return false;
+            }
+            info.height = ReadBE16(seg + 3);
+            info.width = ReadBE16(seg + 5);
+            break;
+        }
+        if (file.Seek(len - 2, wxFromCurrent) == wxInvalidOffset) {
+            return false;
+        }
+        // the next marker
+        uint8_t ff;
+        if (file.Read(&ff, 1) != 1 || ff != 0xFF) {
+            return false;
+        }
+    }
+    info.imageCount = 1;
+    info.frames = 1;
+    return true;
+}
+
+// Size and frame count from the start of the file for the formats effects mostly use, false if the file is
+// something else or the header doesn't make sense in which case the file has to be decoded to find out
+static bool ReadImageHeader(const std::string& filename, SharedImageCache::ImageInfo& info)
+{
+    wxLogNull logNo;
+    wxFile file;
+    if (!file.Open(filename)) {
+        return false;
+    }
+
+    uint8_t hdr[26];
+    if (file.Read(hdr, sizeof(hdr)) != sizeof(hdr) || file.Seek(0) == wxInvalidOffset) {
+        return false;
+    }
+    info = SharedImageCache::ImageInfo();
+    bool ok = false;
+    if (memcmp(hdr, "\x89PNG\r\n\x1a\n", 8) == 0 && memcmp(hdr + 12, "IHDR", 4) == 0) {
+        // an animated png still loads as its first frame
+        info.width = ReadBE32(hdr + 16);
+        info.height = ReadBE32(hdr + 20);
+        info.imageCount = 1;
+        info.frames = 1;
+        ok = true;
+    } else if (hdr[0] == 'B' && hdr[1] == 'M') {
+        info.width = (int)ReadLE32(hdr + 18);
+        info.height = std::abs((int)ReadLE32(hdr + 22)); // negative for top down bitmaps
+        info.imageCount = 1;
+        info.frames = 1;
+        ok = true;
+    } else if (memcmp(hdr, "GIF8", 4) == 0) {
+        ok = ReadGIFHeader(file, info);
+    } else if (hdr[0] == 0xFF && hdr[1] == 0xD8) {
+        ok = ReadJPEGHeader(file, info);
+    }
+    info.ok = ok && info.width > 0 && info.height > 0;
+    return info.ok;
+}
+
+SharedImageCache& SharedImageCache::Instance()
+{
+    static SharedImageCache cache;
+    return cache;
+}
+
+SharedImageCache::SharedImageCache(size_t maxSizeMB)
+{
+    _maxSize = maxSizeMB * 1024 * 1024;
+}
+
+SharedImageCache::~SharedImageCache()
+{
+}
+
+SharedImageCache::ImageInfo SharedImageCache::GetInfo(const std::string& filename, bool suppressGIFBackground)
+{
+    std::string key = InfoKey(filename);
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _info.find(key);
+        if (it != _info.end()) {
+            return it->second;
+        }
+    }
+
+    // the pixels are only decoded when a frame is asked for
+    ImageInfo info;
+    if (ReadImageHeader(filename, info)) {
+        std::unique_lock<std::mutex> lock(_lock);
+        // if the file was decoded meanwhile that is the better answer
+        return _info.emplace(key, info).first->second;
+    }
+
+    auto entry = GetEntry(filename, suppressGIFBackground);
+    std::unique_lock<std::mutex> lock(entry->lock);
+    return entry->info;
+}
+
+wxImage SharedImageCache::GetFrame(const std::string& filename, int frame, bool suppressGIFBackground)
+{
+    auto entry = GetEntry(filename, suppressGIFBackground);
+    std::unique_lock<std::mutex> lock(entry->lock);
+    wxImage image = GetFrameImage(*entry, frame);
+    FramesComposed(*entry);
+    return image;
+}
+
+int SharedImageCache::GetFrameForTime(const std::string& filename, int msec, bool loop, bool suppressGIFBackground)
+{
+    auto entry = GetEntry(filename, suppressGIFBackground);
+    std::unique_lock<std::mutex> lock(entry->lock);
+    if (entry->gif == nullptr) {
+        return 0;
+    }
+    return entry->gif->GetFrameIndexForTime(msec, loop);
+}
+
+wxImage SharedImageCache::GetScaledFrame(const std::string& filename, int frame, bool suppressGIFBackground, int width, int height)
+{
+    if (width <= 0 || height <= 0) {
+        return wxImage();
+    }
+
+    auto entry = GetEntry(filename, suppressGIFBackground);
+    std::unique_lock<std::mutex> lock(entry->lock);
+    if (!entry->info.ok) {
+        return wxImage();
+    }
+    if (entry->gif == nullptr) {
+        frame = 0;
+    }
+
+    auto key = std::make_tuple(frame, width, height);
+    auto it = entry->scaled.find(key);
+    if (it != entry->scaled.end()) {
+        return it->second.Copy();
+    }
+
+    wxImage image = GetFrameImage(*entry, frame);
+    FramesComposed(*entry);
+    if (!image.IsOk()) {
+        return image;
+    }
+    image.Rescale(width, height);
+    entry->scaled[key] = image.Copy();
+    Resized(*entry, entry->size + (size_t)width * height * (image.HasAlpha() ? 4 : 3));
+    return image;
+}
+
+void SharedImageCache::Purge()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _entries.clear();
+    _info.clear();
+    _size = 0;
+}
+
+void SharedImageCache::SetMaximumSizeMB(size_t maxSizeMB)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _maxSize = maxSizeMB * 1024 * 1024;
+    Trim();
+}
+
+size_t SharedImageCache::GetSize() const
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _size;
+}
+
+// The entry for the file loaded and ready to use. Lock order is always an entry then the cache.
+std::shared_ptr<SharedImageCache::Entry> SharedImageCache::GetEntry(const std::string& filename, bool suppressGIFBackground)
+{
+    std::string key = EntryKey(filename, suppressGIFBackground);
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto& e = _entries[key];
+        if (e == nullptr) {
+            e = std::make_shared<Entry>();
+            e->key = key;
+        }
+        e->lastUsed = ++_uses;
+        entry = e;
+    }
+
+    std::unique_lock<std::mutex> lock(entry->lock);
+    if (!entry->loaded) {
+        Load(*entry, filename, suppressGIFBackground);
+        {
+            std::unique_lock<std::mutex> cacheLock(_lock);
+            _info[InfoKey(filename)] = entry->info;
+        }
+        size_t size = (size_t)entry->info.width * entry->info.height;
+        if (entry->gif != nullptr) {
+            // the decoder holds a byte a pixel for every frame, the composed frames are added as they are built
+            size *= entry->info.frames;
+        } else {
+            size *= entry->still.HasAlpha() ? 4 : 3;
+        }
+        Resized(*entry, size);
+    }
+    return entry;
+}
+
+void SharedImageCache::Load(Entry& entry, const std::string& filename, bool suppressGIFBackground)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    wxLogNull logNo; // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
+
+    entry.loaded = true;
+    entry.info.imageCount = wxImage::GetImageCount(filename);
+    if (entry.info.imageCount > 1) {
+        entry.gif = std::make_unique<GIFImage>(filename, suppressGIFBackground);
+        if (entry.gif->IsOk()) {
+            wxSize size = entry.gif->GetImageSize();
+            entry.info.ok = true;
+            entry.info.width = size.GetWidth();
+            entry.info.height = size.GetHeight();
+            entry.info.frames = entry.info.imageCount;
+            return;
+        }
+        entry.gif.reset();
+    }
+
+    if (!entry.still.LoadFile(filename, wxBITMAP_TYPE_ANY, 0)) {
+        logger_base.error("Error loading image file: %s.", (const char*)filename.c_str());
+        entry.still = wxImage();
+        return;
+    }
+    entry.info.ok = true;
+    entry.info.width = entry.still.GetWidth();
+    entry.info.height = entry.still.GetHeight();
+    entry.info.frames = 1;
+}
+
+// must hold the entry lock
+wxImage SharedImageCache::GetFrameImage(Entry& entry, int frame) const
+{
+    if (entry.gif != nullptr) {
+        if (frame < 0 || frame >= entry.info.frames) {
+            return wxImage(entry.info.width, entry.info.height);
+        }
+        return entry.gif->GetFrame(frame).Copy();
+    }
+    if (!entry.still.IsOk()) {
+        return wxImage();
+    }
+    return entry.still.Copy();
+}
+
+// must hold the entry lock, adds the gif frames built since the last call to the size
+void SharedImageCache::FramesComposed(Entry& entry)
+{
+    if (entry.gif == nullptr || entry.gif->GetComposedFrameCount() == entry.composed) {
+        return;
+    }
+    int added = entry.gif->GetComposedFrameCount() - entry.composed;
+    entry.composed += added;
+    Resized(entry, entry.size + (size_t)entry.info.width * entry.info.height * 4 * added);
+}
+
+void SharedImageCache::Resized(Entry& entry, size_t size)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _entries.find(entry.key);
+    if (it == _entries.end() || it->second.get() != &entry) {
+        // already dropped, it goes when the last user lets go
+        entry.size = size;
+        return;
+    }
+    _size = _size - entry.size + size;
+    entry.size = size;
+    // the entry is about to be used, dropping it would just mean decoding it again next time
+    Trim(&entry);
+}
+
+// must hold the lock, keep is never dropped even if it is over the limit on its own
+void SharedImageCache::Trim(const Entry* keep)
+{
+    while (_size > _maxSize) {
+        auto oldest = _entries.end();
+        for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+            if (it->second.get() != keep && (oldest == _entries.end() || it->second->lastUsed < oldest->second->lastUsed)) {
+                oldest = it;
+            }
+        }
+        if (oldest == _entries.end()) {
+            break;
+        }
+        _size -= oldest->second->size;
+        _entries.erase(oldest);
+    }
+}
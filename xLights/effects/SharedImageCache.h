@@ -0,0 +1,91 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include <wx/image.h>
+
+class GIFImage;
+
+// Decoded picture files shared by every effect that draws them (Pictures and, through it, Faces) so each file is
+// decoded once rather than once per effect and buffer. Files are keyed by path and modification time so an image
+// edited on disk is picked up. What a check needs to know about a file (size, frame count) is read from the file
+// header for PNG, JPEG, GIF and BMP so checking doesn't decode anything, it is kept apart from the pixels and
+// survives them being dropped. Pixels and scaled copies are dropped least recently used first once the
+// cache is over its size limit, but never the file being handed out so one file bigger than the limit is decoded
+// once and kept until another file is used.
+//
+// Images handed out are always copies the caller owns, wxImage reference counting is not safe across threads.
+class SharedImageCache
+{
+public:
+    struct ImageInfo
+    {
+        bool ok = false;
+        int width = 0;
+        int height = 0;
+        int imageCount = 0; // as reported by wxImage::GetImageCount
+        int frames = 0;     // frames that can be drawn, more than 1 only for animated gifs that decoded
+    };
+
+    static SharedImageCache& Instance();
+
+    SharedImageCache(size_t maxSizeMB = 256);
+    virtual ~SharedImageCache();
+
+    ImageInfo GetInfo(const std::string& filename, bool suppressGIFBackground = true);
+
+    // frame is ignored for still images, -1 gives a blank image the size of the gif
+    wxImage GetFrame(const std::string& filename, int frame, bool suppressGIFBackground);
+    int GetFrameForTime(const std::string& filename, int msec, bool loop, bool suppressGIFBackground);
+
+    // the frame rescaled as wxImage::Rescale would, the result is kept for the next caller wanting the same size
+    wxImage GetScaledFrame(const std::string& filename, int frame, bool suppressGIFBackground, int width, int height);
+
+    void Purge();
+    void SetMaximumSizeMB(size_t maxSizeMB);
+    size_t GetSize() const;
+
+private:
+    struct Entry
+    {
+        std::mutex lock;
+        std::string key;
+        bool loaded = false;
+        ImageInfo info;
+        wxImage still;
+        std::unique_ptr<GIFImage> gif;
+        std::map<std::tuple<int, int, int>, wxImage> scaled;
+        int composed = 0; // gif frames counted in size
+        size_t size = 0;
+        uint64_t lastUsed = 0;
+    };
+
+    std::shared_ptr<Entry> GetEntry(const std::string& filename, bool suppressGIFBackground);
+    void Load(Entry& entry, const std::string& filename, bool suppressGIFBackground);
+    wxImage GetFrameImage(Entry& entry, int frame) const;
+    void FramesComposed(Entry& entry);
+    void Resized(Entry& entry, size_t size);
+    void Trim(const Entry* keep = nullptr);
+
+    mutable std::mutex _lock;
+    std::map<std::string, std::shared_ptr<Entry>> _entries;
+    std::map<std::string, ImageInfo> _info;
+    size_t _size = 0;
+    size_t _maxSize = 0;
+    uint64_t _uses = 0;
+};
@@ -16,6 +16,8 @@
 #include "../UtilClasses.h"
 #include "../UtilFunctions.h"
 #include "../sequencer/Effect.h"
+#include "../Parallel.h"
+#include "EffectKernels.h"
 
 #include "../../include/shockwave-16.xpm"
 #include "../../include/shockwave-24.xpm"
@@ -136,6 +138,34 @@ void ShockwaveEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Ren
     radius2 = radius_center + half_width;
     radius1 = std::max(0.0, radius1);
 
+    // a plain colour ring goes through the row kernel, a spatial colour needs the angle of every pixel
+    if (!buffer.palette.IsSpatial(color_index) && !buffer.IsDmxBuffer()) {
+        ShockwaveKernelData data;
+        data.width = buffer.BufferWi;
+        data.height = buffer.BufferHt;
+        data.xc_adj = xc_adj;
+        data.yc_adj = yc_adj;
+        data.radius1 = radius1;
+        data.radius2 = radius2;
+        data.radius_center = radius_center;
+        data.half_width = half_width;
+        data.color[0] = color.red;
+        data.color[1] = color.green;
+        data.color[2] = color.blue;
+        data.color[3] = color.alpha;
+        hsv = color;
+        data.colorHSV[0] = hsv.hue;
+        data.colorHSV[1] = hsv.saturation;
+        data.colorHSV[2] = hsv.value;
+        data.blend = blend_edges;
+        data.allowAlpha = buffer.allowAlpha;
+        uint8_t* pixels = (uint8_t*)buffer.GetPixels();
+        parallel_for(0, buffer.BufferHt, [&data, pixels](int y) {
+            ShockwaveKernel(data, pixels, y, y + 1);
+        }, std::max(1, 1024 / std::max(buffer.BufferWi, 1)));
+        return;
+    }
+
     for (int x = 0; x < buffer.BufferWi; x++) {
         int x1 = x - xc_adj;
         for (int y = 0; y < buffer.BufferHt; y++) {
@@ -18,6 +18,7 @@
 #include "../xLightsMain.h"
 #include "assist/AssistPanel.h"
 #include "assist/SketchAssistPanel.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 
 #include "../../include/sketch-16.xpm"
@@ -87,43 +88,7 @@ void SketchEffect::Render(Effect* /*effect*/, const SettingsMap& settings, Rende
         return;
     SketchEffectSketch sketch(SketchEffectSketch::SketchFromString(sketchDef));
 
-    //
-    // RenderBuffer --> wxImage
-    //
-    int bw = buffer.BufferWi;
-    int bh = buffer.BufferHt;
-    std::vector<uint8_t> rgb(bw * 3 * bh);
-    std::vector<uint8_t> alpha(bw * bh);
-    xlColor* px = buffer.GetPixels();
-    int pxIndex = 0;
-    int rgbIndex = 0;
-    int alphaIndex = 0;
-    for (int y = 0; y < bh; ++y) {
-        for (int x = 0; x < bw; ++x, ++pxIndex) {
-            rgb[rgbIndex++] = px[pxIndex].Red();
-            rgb[rgbIndex++] = px[pxIndex].Green();
-            rgb[rgbIndex++] = px[pxIndex].Blue();
-            alpha[alphaIndex++] = px[pxIndex].Alpha();
-        }
-    }
-    wxImage img(bw, bh, rgb.data(), alpha.data(), true);
-
-    //
-    // rendering sketch via wxGraphicsContext
-    //
-    renderSketch(sketch, img, progress, 0.01 * drawPercentage, thickness, motionEnabled, 0.01 * motionPercentage, colors);
-
-    //
-    // wxImage --> RenderBuffer
-    //
-    for (int y = 0; y < bh; ++y) {
-        for (int x = 0; x < bw; ++x, ++px) {
-            px->red = img.GetRed(x, y);
-            px->green = img.GetGreen(x, y);
-            px->blue = img.GetBlue(x, y);
-            px->alpha = img.GetAlpha(x, y);
-        }
-    }
+    renderSketch(buffer, sketch, progress, 0.01 * drawPercentage, thickness, motionEnabled, 0.01 * motionPercentage, colors);
 }
 
 void SketchEffect::SetDefaultParameters()
@@ -180,13 +145,13 @@ std::list<std::string> SketchEffect::CheckEffectSettings(const SettingsMap& sett
     wxLogNull logNo; // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
     std::list<std::string> res = RenderableEffect::CheckEffectSettings(settings, media, model, eff, renderCache);
 
-    if (!xLightsFrame::IsCheckSequenceOptionDisabled("SketchImage")) {
+    if (!CheckSequenceCache::Instance().IsOptionDisabled("SketchImage")) {
         wxString filename = settings.Get("E_FILEPICKER_SketchBackground", "");
-        if (filename == "" || !FileExists(filename)) {
+        if (filename == "" || !CheckSequenceCache::Instance().FileExists(filename.ToStdString())) {
             // this is only a warning as it does not affect rendering
             res.push_back(wxString::Format("    WARN: Sketch effect cant find image file '%s'. Model '%s', Start %s", filename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         } else {
-            if (!IsFileInShowDir(xLightsFrame::CurrentDir, filename.ToStdString())) {
+            if (!CheckSequenceCache::Instance().IsFileInShowDir(filename.ToStdString())) {
                 res.push_back(wxString::Format("    WARN: Sketch effect image file '%s' not under show directory. Model '%s', Start %s", filename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
             }
         }
@@ -262,11 +227,10 @@ xlEffectPanel* SketchEffect::CreatePanel(wxWindow* parent)
     return m_panel;
 }
 
-void SketchEffect::renderSketch(const SketchEffectSketch& sketch, wxImage& img, double progress, double drawPercentage, int lineThickness, bool hasMotion, double motionPercentage, const xlColorVector& colors)
+void SketchEffect::renderSketch(RenderBuffer& buffer, const SketchEffectSketch& sketch, double progress, double drawPercentage, int lineThickness, bool hasMotion, double motionPercentage, const xlColorVector& colors)
 {
-    std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(img));
     auto paths = sketch.paths();
-    wxSize sz(img.GetSize());
+    wxSize sz(buffer.BufferWi, buffer.BufferHt);
 
     // In order for the animation to both "draw in" and "draw out" we adjust the [0,1] range...
     double maxProgress = hasMotion ? (1. + motionPercentage) : 1.;
@@ -285,39 +249,36 @@ void SketchEffect::renderSketch(const SketchEffectSketch& sketch, wxImage& img,
     // unless a new setting was added
     if (hasMotion && paths.size() == 1 && paths.front()->isClosed()) {
         auto path = paths.front();
-        wxColor color(colors[0].asWxColor());
-        wxPen pen(color, lineThickness);
-        gc->SetPen(pen);
-
-        path->drawPartialPath(gc.get(), sz, progress, progress + motionPercentage);
+        PathRasterizer& rasterizer = buffer.GetPathRasterizer();
+        path->drawPartialPath(rasterizer, sz, progress, progress + motionPercentage);
         if (progress + motionPercentage > 1.)
-            path->drawPartialPath(gc.get(), sz, 0., progress + motionPercentage - 1.);
+            path->drawPartialPath(rasterizer, sz, 0., progress + motionPercentage - 1.);
+        buffer.StrokePath(rasterizer, colors[0], lineThickness);
         return;
     }
 
     double cumulativeLength = 0.;
     int i = 0;
     for (auto iter = paths.cbegin(); iter != paths.cend(); ++iter, ++i) {
-        wxColor color(colors[i % colors.size()].asWxColor());
-        wxPen pen(color, lineThickness);
-        gc->SetPen(pen);
+        PathRasterizer& rasterizer = buffer.GetPathRasterizer();
         double pathLength = (*iter)->Length();
         double percentageAtEndOfThisPath = (cumulativeLength + pathLength) / totalLength;
 
         if (!hasMotion && percentageAtEndOfThisPath <= adjustedProgress)
-            (*iter)->drawEntirePath(gc.get(), sz);
+            (*iter)->drawEntirePath(rasterizer, sz);
         else {
             double percentageAtStartOfThisPath = cumulativeLength / totalLength;
             double percentageThroughThisPath = calcPercentage(adjustedProgress, percentageAtStartOfThisPath, percentageAtEndOfThisPath);
             if (!hasMotion)
-                (*iter)->drawPartialPath(gc.get(), sz, std::nullopt, percentageThroughThisPath);
+                (*iter)->drawPartialPath(rasterizer, sz, std::nullopt, percentageThroughThisPath);
             else {
                 double drawPercentageThroughThisPath = calcPercentage(adjustedProgress - motionPercentage, percentageAtStartOfThisPath, percentageAtEndOfThisPath);
                 drawPercentageThroughThisPath = std::clamp(drawPercentageThroughThisPath, 0., 1.);
 
-                (*iter)->drawPartialPath(gc.get(), sz, drawPercentageThroughThisPath, percentageThroughThisPath);
+                (*iter)->drawPartialPath(rasterizer, sz, drawPercentageThroughThisPath, percentageThroughThisPath);
             }
         }
+        buffer.StrokePath(rasterizer, colors[i % colors.size()], lineThickness);
         cumulativeLength += pathLength;
     }
 }
@@ -50,8 +50,8 @@ protected:
     void RemoveDefaults( const std::string& version, Effect* effect ) override;
     xlEffectPanel* CreatePanel( wxWindow* parent ) override;
 
-    void renderSketch(const SketchEffectSketch& sketch,
-                      wxImage& img, double progress,
+    void renderSketch(RenderBuffer& buffer, const SketchEffectSketch& sketch,
+                      double progress,
                       double drawPercentage, int lineThickness, bool hasMotion, double motionPercentage,
                       const xlColorVector& colors);
 
@@ -2,7 +2,7 @@
 
 #include <log4cpp/Category.hh>
 
-#include <wx/graphics.h>
+#include "../PathRasterizer.h"
 
 #include <algorithm>
 #include <iterator>
@@ -179,18 +179,18 @@ namespace
 }
 
 
-void SketchLine::DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const
+void SketchLine::DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const
 {
-    path.AddLineToPoint(sz.x * m_toPt.m_x, sz.y * m_toPt.m_y);
+    path.LineTo(sz.x * m_toPt.m_x, sz.y * m_toPt.m_y);
 }
 
-void SketchLine::DrawPartialSegment(wxGraphicsPath& path, const wxSize&sz, std::optional<double> startPercentage, double endPercentage) const
+void SketchLine::DrawPartialSegment(PathRasterizer& path, const wxSize&sz, std::optional<double> startPercentage, double endPercentage) const
 {
     if (!startPercentage.has_value()) {
         if (endPercentage <= 0. || endPercentage > 1.)
             return;
         auto pt = (1 - endPercentage) * m_fromPt + endPercentage * m_toPt;
-        path.AddLineToPoint(sz.x * pt.m_x, sz.y * pt.m_y);
+        path.LineTo(sz.x * pt.m_x, sz.y * pt.m_y);
     } else {
         double percentage = std::clamp(startPercentage.value(), 0., 1.);
         endPercentage = std::clamp(endPercentage, 0., 1.);
@@ -200,8 +200,8 @@ void SketchLine::DrawPartialSegment(wxGraphicsPath& path, const wxSize&sz, std::
         auto pt = (1 - endPercentage) * m_fromPt + endPercentage * m_toPt;
         auto startPt = (1 - percentage) * m_fromPt + percentage * m_toPt;
         
-        path.MoveToPoint(sz.x * startPt.m_x, sz.y * startPt.m_y);
-        path.AddLineToPoint(sz.x * pt.m_x, sz.y * pt.m_y);
+        path.MoveTo(sz.x * startPt.m_x, sz.y * startPt.m_y);
+        path.LineTo(sz.x * pt.m_x, sz.y * pt.m_y);
     }
 }
 
@@ -224,19 +224,19 @@ double SketchQuadraticBezier::Length() const
     return bezierLength(m_fromPt, m_cp, m_toPt);
 }
 
-void SketchQuadraticBezier::DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const
+void SketchQuadraticBezier::DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const
 {
-    path.AddQuadCurveToPoint(sz.x * m_cp.m_x, sz.y  * m_cp.m_y, sz.x * m_toPt.m_x, sz.y * m_toPt.m_y);
+    path.QuadTo(sz.x * m_cp.m_x, sz.y  * m_cp.m_y, sz.x * m_toPt.m_x, sz.y * m_toPt.m_y);
 }
 
-void SketchQuadraticBezier::DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
+void SketchQuadraticBezier::DrawPartialSegment(PathRasterizer& path, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
 {
     if (!startPercentage.has_value()) {
         auto pts = piecewiseLinearApproximation(m_fromPt, m_cp, m_toPt);
         int i = 0;
         double increment = 1. / pts.size();
         for (double t = 0.; t <= endPercentage; t += increment, ++i)
-            path.AddLineToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+            path.LineTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
     } else {
         double percentage = std::clamp(startPercentage.value(), 0., 1.);
         endPercentage = std::clamp(endPercentage, 0., 1.);
@@ -249,10 +249,10 @@ void SketchQuadraticBezier::DrawPartialSegment(wxGraphicsPath& path, const wxSiz
         bool started = false;
         for (double t = 0.; t <= endPercentage; t += increment, ++i) {
             if (t >= startPercentage && !started) {
-                path.MoveToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+                path.MoveTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
                 started = true;
             } else if (t >= startPercentage && t <= endPercentage) {
-                path.AddLineToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+                path.LineTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
             }
         }
     }
@@ -284,18 +284,18 @@ double SketchCubicBezier::Length() const
     return bezierLength(m_fromPt, m_cp1, m_cp2, m_toPt);
 }
 
- void SketchCubicBezier::DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const
+ void SketchCubicBezier::DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const
 {
-    path.AddCurveToPoint(sz.x*m_cp1.m_x, sz.y*m_cp1.m_y, sz.x*m_cp2.m_x, sz.y*m_cp2.m_y, sz.x*m_toPt.m_x, sz.y*m_toPt.m_y);
+    path.CurveTo(sz.x*m_cp1.m_x, sz.y*m_cp1.m_y, sz.x*m_cp2.m_x, sz.y*m_cp2.m_y, sz.x*m_toPt.m_x, sz.y*m_toPt.m_y);
 }
-void SketchCubicBezier::DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
+void SketchCubicBezier::DrawPartialSegment(PathRasterizer& path, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
 {
     if (!startPercentage.has_value()) {
         auto pts = piecewiseLinearApproximation(m_fromPt, m_cp1, m_cp2, m_toPt);
         int i = 0;
         double increment = 1. / pts.size();
         for (double t = 0.; t <= endPercentage; t += increment, ++i)
-            path.AddLineToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+            path.LineTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
     } else {
         double percentage = std::clamp(startPercentage.value(), 0., 1.);
         endPercentage = std::clamp(endPercentage, 0., 1.);
@@ -308,10 +308,10 @@ void SketchCubicBezier::DrawPartialSegment(wxGraphicsPath& path, const wxSize& s
         bool started = false;
         for (double t = 0.; t <= endPercentage; t += increment, ++i) {
             if (t >= startPercentage && !started) {
-                path.MoveToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+                path.MoveTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
                 started = true;
             } else if (t >= startPercentage && t <= endPercentage) {
-                path.AddLineToPoint(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
+                path.LineTo(sz.x * pts[i].m_x, sz.y * pts[i].m_y);
             }
         }
     }
@@ -358,21 +358,18 @@ void SketchEffectPath::appendSegment(std::shared_ptr<SketchPathSegment> segment)
     m_segments.push_back(segment);
 }
 
-void SketchEffectPath::drawEntirePath(wxGraphicsContext* gc, const wxSize& sz) const
+void SketchEffectPath::drawEntirePath(PathRasterizer& path, const wxSize& sz) const
 {
     if (m_segments.empty())
         return;
     auto startPt(m_segments.front()->StartPoint());
-    wxGraphicsPath path(gc->CreatePath());
-    path.MoveToPoint(sz.x * startPt.m_x, sz.y * startPt.m_y);
+    path.MoveTo(sz.x * startPt.m_x, sz.y * startPt.m_y);
 
     for (const auto& segment : m_segments)
         segment->DrawEntireSegment(path, sz);
-
-    gc->StrokePath(path);
 }
 
-void SketchEffectPath::drawPartialPath(wxGraphicsContext* gc, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
+void SketchEffectPath::drawPartialPath(PathRasterizer& path, const wxSize& sz, std::optional<double> startPercentage, double endPercentage) const
 {
     if (m_segments.empty())
         return;
@@ -382,8 +379,7 @@ void SketchEffectPath::drawPartialPath(wxGraphicsContext* gc, const wxSize& sz,
     double cumulativeLength = 0.;
 
     auto startPt(m_segments.front()->StartPoint());
-    wxGraphicsPath path(gc->CreatePath());
-    path.MoveToPoint(sz.x * startPt.m_x, sz.y * startPt.m_y);
+    path.MoveTo(sz.x * startPt.m_x, sz.y * startPt.m_y);
 
     if (!startPercentage.has_value()) {
         for (const auto& segment : m_segments) {
@@ -417,8 +413,6 @@ void SketchEffectPath::drawPartialPath(wxGraphicsContext* gc, const wxSize& sz,
             }
         }
     }
-
-    gc->StrokePath(path);
 }
 
 void SketchEffectPath::closePath(bool updateSegments, SketchCanvasPathState state)
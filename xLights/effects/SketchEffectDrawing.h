@@ -9,8 +9,7 @@
 
 #include "assist/SketchCanvasPanel.h"
 
-class wxGraphicsContext;
-class wxGraphicsPath;
+class PathRasterizer;
 
 // A segment can currently be either a line segment (start and end point)
 // or a quadratic-bezier segment (start and end point with one control point)
@@ -27,8 +26,8 @@ public:
     virtual void SetStartPoint(const wxPoint2DDouble& pt) = 0;
     [[nodiscard]] virtual wxPoint2DDouble EndPoint() const = 0;
     virtual void SetEndPoint(const wxPoint2DDouble& pt) = 0;
-    virtual void DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const = 0;
-    virtual void DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz,
+    virtual void DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const = 0;
+    virtual void DrawPartialSegment(PathRasterizer& path, const wxSize& sz,
                                     std::optional<double> startPercentage,
                                     double endPercentage) const = 0;
     [[nodiscard]] virtual bool HitTest(const wxPoint2DDouble& pt) const = 0;
@@ -47,8 +46,9 @@ public:
 
     void appendSegment(std::shared_ptr<SketchPathSegment> cmd);
     void closePath(bool updateSegments, SketchCanvasPathState state);
-    void drawEntirePath(wxGraphicsContext* gc, const wxSize& sz) const;
-    void drawPartialPath(wxGraphicsContext* gc, const wxSize& sz,
+    // these add the path to the rasterizer, stroking it is up to the caller
+    void drawEntirePath(PathRasterizer& path, const wxSize& sz) const;
+    void drawPartialPath(PathRasterizer& path, const wxSize& sz,
                          std::optional<double> startPercentage,
                          double endPercentage) const;
     void reversePath();
@@ -138,8 +138,8 @@ public:
     {
         m_toPt = pt;
     }
-    void DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const override;
-    void DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz,
+    void DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const override;
+    void DrawPartialSegment(PathRasterizer& path, const wxSize& sz,
                             std::optional<double> startPercentage,
                             double endPercentage) const override;
     bool HitTest(const wxPoint2DDouble& pt) const override;
@@ -179,8 +179,8 @@ public:
     {
         m_toPt = pt;
     }
-    void DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const override;
-    void DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz,
+    void DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const override;
+    void DrawPartialSegment(PathRasterizer& path, const wxSize& sz,
                             std::optional<double> startPercentage,
                             double endPercentage) const override;
     bool HitTest(const wxPoint2DDouble& pt) const override;
@@ -232,8 +232,8 @@ public:
     {
         m_toPt = pt;
     }
-    void DrawEntireSegment(wxGraphicsPath& path, const wxSize& sz) const override;
-    void DrawPartialSegment(wxGraphicsPath& path, const wxSize& sz,
+    void DrawEntireSegment(PathRasterizer& path, const wxSize& sz) const override;
+    void DrawPartialSegment(PathRasterizer& path, const wxSize& sz,
                             std::optional<double> startPercentage,
                             double endPercentage) const override;
     [[nodiscard]] bool HitTest(const wxPoint2DDouble& pt) const override;
@@ -25,6 +25,10 @@ public:
     virtual ~SnowflakesEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool SupportsRenderCheckpoints(const SettingsMap& settings) const override
+    {
+        return true;
+    }
 
     virtual double GetSettingVCMin(const std::string& name) const override
     {
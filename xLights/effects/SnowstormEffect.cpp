@@ -91,7 +91,7 @@ static void SnowstormAdvance(RenderBuffer& buffer, SnowstormClass& ssItem)
     const int arr[] = { 30,20,10,5,0,5,10,20,20,15,10,10,10,10,10,15 }; // 2 sets of 8 numbers, each of which add up to 100
     wxPoint adv = SnowstormVector(7);
     int i0 = ssItem.idx % 7 <= 4 ? 0 : cnt;
-    int r = rand() % 100;
+    int r = buffer.Rand() % 100;
     for (int i = 0, val = 0; i < cnt; i++)
     {
         val += arr[i0 + i];
@@ -119,6 +119,7 @@ class SnowstormRenderCache : public EffectRenderCache {
 public:
     SnowstormRenderCache() {};
     virtual ~SnowstormRenderCache() {};
+    virtual EffectRenderCache* Snapshot() const override { return new SnowstormRenderCache(*this); }
     
     int LastSnowstormCount;
     std::list<SnowstormClass> SnowstormItems;
@@ -171,11 +172,11 @@ void SnowstormEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Ren
             buffer.SetRangeColor(hsv0, hsv1, ssItem.hsv);
 
             // start in a random state
-            int r = rand() % (2 * TailLength);
+            int r = buffer.Rand() % (2 * TailLength);
             if (r > 0) {
                 wxPoint xy;
-                xy.x = rand() % buffer.BufferWi;
-                xy.y = rand() % buffer.BufferHt;
+                xy.x = buffer.Rand() % buffer.BufferWi;
+                xy.y = buffer.Rand() % buffer.BufferHt;
                 ssItem.points.push_back(xy);
             }
             if (r >= TailLength) {
@@ -206,18 +207,18 @@ void SnowstormEffect::Render(Effect* effect, const SettingsMap& SettingsMap, Ren
                 it.points.clear();  // start over
                 it.ssDecay = 0;
             }
-            else if (rand() % 20 < sSpeed) {
+            else if (buffer.Rand() % 20 < sSpeed) {
                 it.ssDecay++;
             }
         }
 
         if (it.points.empty()) {
             wxPoint xy;
-            xy.x = rand() % buffer.BufferWi;
-            xy.y = rand() % buffer.BufferHt;
+            xy.x = buffer.Rand() % buffer.BufferWi;
+            xy.y = buffer.Rand() % buffer.BufferHt;
             it.points.push_back(xy);
         }
-        else if (rand() % 20 < sSpeed) {
+        else if (buffer.Rand() % 20 < sSpeed) {
             SnowstormAdvance(buffer, it);
         }
 
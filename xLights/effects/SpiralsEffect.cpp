@@ -112,39 +112,51 @@ void SpiralsEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
 
         std::function<void(int)> spiralF = [&](int thick) {
             int strand = (strand_base + thick) % buffer.BufferWi;
-            for (int y = 0; y < buffer.BufferHt; y++) {
-                int x = (int)((strand + SpiralState / 10.0 + y * Rotation / buffer.BufferHt)) % buffer.BufferWi;
-                if (x < 0) x += buffer.BufferWi;
 
-                if (isSpacial) {
-                    buffer.palette.GetSpatialColor(ColorIdx, (float)thick / (float)SpiralThickness, (float)y / (float)buffer.BufferHt, color);
+            // colour the whole strand first so the palette blend and 3D shading each run over it in one go
+            std::vector<xlColor> colors(buffer.BufferHt, color);
+            if (Blend) {
+                std::vector<float> positions(buffer.BufferHt);
+                for (int y = 0; y < buffer.BufferHt; y++) {
+                    positions[y] = double(buffer.BufferHt - y - 1) / double(buffer.BufferHt);
                 }
-
-                if (Blend) {
-                    buffer.GetMultiColorBlend(double(buffer.BufferHt - y - 1) / double(buffer.BufferHt), false, color);
+                buffer.GetMultiColorBlend(positions.data(), positions.size(), false, colors.data());
+            } else if (isSpacial) {
+                for (int y = 0; y < buffer.BufferHt; y++) {
+                    buffer.palette.GetSpatialColor(ColorIdx, (float)thick / (float)SpiralThickness, (float)y / (float)buffer.BufferHt, colors[y]);
                 }
-                if (Show3D) {
-                    double f = 1.0;
+            }
 
-                    if (Rotation < 0) {
-                        f = double(thick + 1) / SpiralThickness;
-                    } else {
-                        f = double(SpiralThickness - thick) / SpiralThickness;
-                    }
-                    if (buffer.allowAlpha) {
-                        xlColor c(color);
+            if (Show3D) {
+                double f = 1.0;
+
+                if (Rotation < 0) {
+                    f = double(thick + 1) / SpiralThickness;
+                } else {
+                    f = double(SpiralThickness - thick) / SpiralThickness;
+                }
+                if (buffer.allowAlpha) {
+                    for (auto& c : colors) {
                         c.alpha = 255.0 * f;
-                        buffer.SetPixel(x, y, c);
-                    } else {
-                        HSVValue hsv;
-                        buffer.Color2HSV(color, hsv);
-                        hsv.value *= f;
-                        buffer.SetPixel(x, y, hsv);
                     }
                 } else {
-                    buffer.SetPixel(x, y, color);
+                    std::vector<float> hue(colors.size()), saturation(colors.size()), value(colors.size());
+                    RGBToHSVSpan(colors.data(), hue.data(), saturation.data(), value.data(), colors.size());
+                    for (auto& v : value) {
+                        v *= f;
+                    }
+                    HSVToRGBSpan(hue.data(), saturation.data(), value.data(), colors.data(), colors.size());
+                    for (auto& c : colors) {
+                        c.alpha = 255;
+                    }
                 }
             }
+
+            for (int y = 0; y < buffer.BufferHt; y++) {
+                int x = (int)((strand + SpiralState / 10.0 + y * Rotation / buffer.BufferHt)) % buffer.BufferWi;
+                if (x < 0) x += buffer.BufferWi;
+                buffer.SetPixel(x, y, colors[y]);
+            }
         };
         
         if ((!isSpacial && !Blend) && SpiralThickness > 2) {
@@ -33,6 +33,10 @@ public:
     virtual ~SpiralsEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool IsFrameIndependent(const SettingsMap& settings) const override
+    {
+        return true;
+    }
     virtual bool SupportsLinearColorCurves(const SettingsMap& SettingsMap) const override;
     virtual bool CanRenderPartialTimeInterval() const override
     {
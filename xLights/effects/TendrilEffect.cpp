@@ -16,7 +16,6 @@
 #include "../UtilClasses.h"
 #include "../AudioManager.h"
 
-#include <wx/graphics.h>
 #if wxUSE_GRAPHICS_CONTEXT == 0
   #error Please refer to README.windows to make necessary changes to wxWidgets setup.h file.
   #error You will also need to rebuild wxWidgets once the change is made.
@@ -203,14 +202,10 @@ void ATendril::Update(wxPoint* target, int tunemovement, int width, int height)
     _lastHeight = height;
 }
 
-void ATendril::Draw(PathDrawingContext* gc, xlColor colour, int thickness)
+void ATendril::Draw(RenderBuffer& buffer, xlColor colour, int thickness)
 {
-    wxColor c(colour);
-    wxPen pen(c, thickness);
-    gc->SetPen(pen);
-
-    wxGraphicsPath path = gc->CreatePath();
-    path.MoveToPoint(_nodes.front()->x, _nodes.front()->y);
+    PathRasterizer& path = buffer.GetPathRasterizer();
+    path.MoveTo(_nodes.front()->x, _nodes.front()->y);
 
     std::list<TendrilNode*>::const_iterator ci = _nodes.begin();
     ++ci; // move to second node
@@ -226,13 +221,13 @@ void ATendril::Draw(PathDrawingContext* gc, xlColor colour, int thickness)
         TendrilNode* b = *cinext;
         float x = (a->x + b->x) * 0.5;
         float y = (a->y + b->y) * 0.5;
-        path.AddQuadCurveToPoint(a->x, a->y, x, y);
+        path.QuadTo(a->x, a->y, x, y);
     }
 
     TendrilNode* a = *ci;
     TendrilNode* b = *(++ci);
-    path.AddQuadCurveToPoint(a->x, a->y, b->x, b->y);
-    gc->StrokePath(path);
+    path.QuadTo(a->x, a->y, b->x, b->y);
+    buffer.StrokePath(path, colour, thickness);
 }
 
 wxPoint* ATendril::LastLocation()
@@ -373,10 +368,10 @@ void Tendril::Update(int x, int y, int tunemovement, size_t width, size_t height
     Update(&pt, tunemovement, width, height);
 }
 
-void Tendril::Draw(PathDrawingContext* gc, xlColor colour, int thickness)
+void Tendril::Draw(RenderBuffer& buffer, xlColor colour, int thickness)
 {
     for (const auto& ci : _tendrils) {
-        ci->Draw(gc, colour, thickness);
+        ci->Draw(buffer, colour, thickness);
     }
 }
 
@@ -495,7 +490,6 @@ void TendrilEffect::Render(RenderBuffer& buffer, const std::string& movement,
                            float tension, int trails, int length, int xoffset, int yoffset, int manualx, int manualy)
 {
     float oset = buffer.GetEffectTimeIntervalPosition();
-    buffer.GetPathDrawingContext()->Clear();
 
     if (friction < 0.4f) {
         friction = 0.4f;
@@ -826,20 +820,6 @@ void TendrilEffect::Render(RenderBuffer& buffer, const std::string& movement,
     }
 
     if (_tendril != nullptr) {
-        _tendril->Draw(buffer.GetPathDrawingContext(), colour, thickness);
-    }
-    wxImage* image = buffer.GetPathDrawingContext()->FlushAndGetImage();
-    bool hasAlpha = image->HasAlpha();
-
-    xlColor c;
-    for (int y = 0; y < std::min(buffer.BufferHt, image->GetHeight()); ++y) {
-        for (int x = 0; x < std::min(buffer.BufferWi, image->GetWidth()); ++x) {
-            if (hasAlpha) {
-                c.Set(image->GetRed(x, y), image->GetGreen(x, y), image->GetBlue(x, y), image->GetAlpha(x, y));
-            } else {
-                c.Set(image->GetRed(x, y), image->GetGreen(x, y), image->GetBlue(x, y), 255);
-            }
-            buffer.SetPixel(x, y, c);
-        }
+        _tendril->Draw(buffer, colour, thickness);
     }
 }
@@ -67,7 +67,7 @@ class ATendril
 	~ATendril();
 	ATendril(float friction, int size, float dampening, float tension, float spring, const wxPoint& start);
     void Update(wxPoint* target, int tunemovement, int width, int height);
-	void Draw(PathDrawingContext* gc, xlColor colour, int thickness);
+	void Draw(RenderBuffer& buffer, xlColor colour, int thickness);
 	wxPoint* LastLocation();
 };
 
@@ -82,7 +82,7 @@ class Tendril
 	void UpdateRandomMove(int tunemovement, int width, int height);
     void Update(wxPoint* target, int tunemovement, size_t width, size_t height);
     void Update(int x, int y, int tunemovement, size_t width, size_t height);
-    void Draw(PathDrawingContext* gc, xlColor colour, int thickness);
+    void Draw(RenderBuffer& buffer, xlColor colour, int thickness);
 };
 
 class TendrilEffect : public RenderableEffect
@@ -26,6 +26,7 @@
 #include "../UtilFunctions.h"
 #include "../FontManager.h"
 #include "../xLightsMain.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 #include "../xLightsXmlFile.h"
 
@@ -60,11 +61,11 @@ std::list<std::string> TextEffect::CheckEffectSettings(const SettingsMap& settin
     {
         res.push_back(wxString::Format("    ERR: Text effect has no actual text. Model '%s', Start %s", model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
-    else if (textFilename != "" && !FileExists(textFilename))
+    else if (textFilename != "" && !CheckSequenceCache::Instance().FileExists(textFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    ERR: Text effect cant find file '%s'. Model '%s', Start %s", textFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
-    else if (textFilename != "" && !IsFileInShowDir(xLightsFrame::CurrentDir, textFilename.ToStdString()))
+    else if (textFilename != "" && !CheckSequenceCache::Instance().IsFileInShowDir(textFilename.ToStdString()))
     {
         res.push_back(wxString::Format("    WARN: Text effect file '%s' not under show directory. Model '%s', Start %s", textFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
@@ -444,6 +445,19 @@ static int TextEffectsIndex(const wxString &st) {
     return 0;
 }
 
+#ifdef LINUX
+bool TextEffect::CanRenderOnBackgroundThread(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer)
+{
+    // OS fonts are drawn via GTK/pango through the TextDrawingContext which must stay on the main thread.
+    // The xLights fonts are blitted straight from the font images so once they are loaded they
+    // can render on the render threads like any other effect
+    if (settings.Get("CHOICE_Text_Font", "Use OS Fonts") == "Use OS Fonts") {
+        return false;
+    }
+    return FontManager::IsInitialized();
+}
+#endif
+
 void TextEffect::Render(Effect *effect, const SettingsMap &SettingsMap, RenderBuffer &buffer) {
 
     // determine if we are rendering an xLights Font
@@ -1476,8 +1490,12 @@ void TextEffect::RenderXLText(Effect* effect, const SettingsMap& settings, Rende
     font_mgr.init();  // make sure font class is initialized
     wxString xl_font = settings["CHOICE_Text_Font"];
     xlFont* font = font_mgr.get_font(xl_font);
-    wxBitmap* bmp = font->get_bitmap();
-    wxImage image = bmp->ConvertToImage();
+    // use the image converted when the font was loaded, converting the bitmap here
+    // is not safe off the main thread on all platforms
+    const wxImage& image = font->get_image();
+    const unsigned char* imageData = image.GetData();
+    const int imageWidth = image.GetWidth();
+    const int imageHeight = image.GetHeight();
     int char_width = font->GetWidth();
     int char_height = font->GetHeight();
 
@@ -1627,11 +1645,9 @@ void TextEffect::RenderXLText(Effect* effect, const SettingsMap& settings, Rende
                 for (int w = 0; w < actual_width; w++) {
                     int x_pos = x_start_corner + w;
                     for (int y_pos = y_start_corner; y_pos < y_start_corner + char_height; y_pos++) {
-                        if (x_pos >= 0 && x_pos < image.GetWidth() && y_pos >= 0 && y_pos < image.GetHeight()) {
-                            int red = image.GetRed(x_pos, y_pos);
-                            int green = image.GetGreen(x_pos, y_pos);
-                            int blue = image.GetBlue(x_pos, y_pos);
-                            if (red == 255 && green == 255 && blue == 255) {
+                        if (x_pos >= 0 && x_pos < imageWidth && y_pos >= 0 && y_pos < imageHeight) {
+                            const unsigned char* px = imageData + (y_pos * imageWidth + x_pos) * 3;
+                            if (px[0] == 255 && px[1] == 255 && px[2] == 255) {
                                 if (rotate_90) {
                                     if (up) {
                                         buffer.SetPixel(y_pos - y_start_corner + OffsetLeft, (buffer.BufferHt - 1) - (actual_width - 1 - x_pos + x_start_corner + OffsetTop), c, false);
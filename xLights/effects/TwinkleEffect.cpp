@@ -24,13 +24,8 @@
 
 #include "../Parallel.h"
 
-#include <random>
 #include <cmath>
 
-static std::random_device rd;
-static std::default_random_engine eng{ rd() };
-static std::uniform_int_distribution<> dist(0, INT_MAX);
-
 TwinkleEffect::TwinkleEffect(int id) : RenderableEffect(id, "Twinkle", twinkle_16, twinkle_24, twinkle_32, twinkle_48, twinkle_64)
 {
     //ctor
@@ -59,11 +54,21 @@ class TwinkleRenderCache : public EffectRenderCache {
 public:
     TwinkleRenderCache() {};
     virtual ~TwinkleRenderCache() {};
+    virtual EffectRenderCache* Snapshot() const override {
+        TwinkleRenderCache* cache = new TwinkleRenderCache();
+        cache->strobe = strobe;
+        cache->num_lights = num_lights;
+        cache->curNumStrobe = curNumStrobe;
+        cache->lights_to_renew = (int)lights_to_renew;
+        return cache;
+    }
     
     std::vector<StrobeClass> strobe;
     int num_lights = 0;
     int curNumStrobe = 0;
     std::atomic_int lights_to_renew = 0;
+    // random duration and colour for each strobe that restarts this frame, only used while rendering a frame
+    std::vector<std::pair<int, int>> restartRandom;
 };
 
 void TwinkleEffect::SetDefaultParameters()
@@ -188,12 +193,12 @@ int TwinkleEffect::DrawEffectBackground(const Effect *e, int x1, int y1, int x2,
 static void place_twinkles(int lights_to_place, int &curIndex, std::vector<StrobeClass>& strobe, RenderBuffer& buffer,
                            int max_modulo, size_t colorcnt) {
     while (lights_to_place > 0 && (curIndex < strobe.size())) {
-        int idx = dist(eng) % (strobe.size() - curIndex) + curIndex;
+        int idx = buffer.Rand() % (strobe.size() - curIndex) + curIndex;
         if (idx != curIndex) {
             std::swap(strobe[idx], strobe[curIndex]);
         }
-        strobe[curIndex].duration = dist(eng) % max_modulo;
-        strobe[curIndex].colorindex = dist(eng) % colorcnt;
+        strobe[curIndex].duration = buffer.Rand() % max_modulo;
+        strobe[curIndex].colorindex = buffer.Rand() % colorcnt;
         strobe[curIndex].strobing = true;
         curIndex++;
         lights_to_place--;
@@ -295,7 +300,7 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
             }
             //randomize the locations
             for (int s = 0; s < strobe.size(); ++s) {
-                int r = dist(eng) % strobe.size();
+                int r = buffer.Rand() % strobe.size();
                 if (r != s) {
                     std::swap(strobe[r], strobe[s]);
                 }
@@ -308,13 +313,13 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
                     if (i % step == 1 || step == 1) {
                         int s = strobe.size();
                         strobe.resize(s + 1);
-                        strobe[s].duration = dist(eng) % max_modulo;
+                        strobe[s].duration = buffer.Rand() % max_modulo;
 
                         strobe[s].x = i;
                         strobe[s].y = 0;
                         strobe[s].isByNode = true;
 
-                        strobe[s].colorindex = dist(eng) % colorcnt;
+                        strobe[s].colorindex = buffer.Rand() % colorcnt;
                         cache->curNumStrobe++;
                     }
                 }
@@ -325,13 +330,13 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
                         if (i % step == 1 || step == 1) {
                             int s = strobe.size();
                             strobe.resize(s + 1);
-                            strobe[s].duration = dist(eng) % max_modulo;
+                            strobe[s].duration = buffer.Rand() % max_modulo;
 
                             strobe[s].x = x;
                             strobe[s].y = y;
                             strobe[s].isByNode = false;
 
-                            strobe[s].colorindex = dist(eng) % colorcnt;
+                            strobe[s].colorindex = buffer.Rand() % colorcnt;
                             cache->curNumStrobe++;
                         }
                     }
@@ -361,7 +366,18 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
         }
     }
 
-    parallel_for(0, cache->curNumStrobe, [&strobe, &buffer, max_modulo, max_modulo2, colorcnt, reRandomize, Strobe, new_algorithm, cache](int x) {
+    if (reRandomize && !new_algorithm) {
+        // the buffer's random numbers have to be drawn in strobe order, not in whatever order the threads get to them
+        cache->restartRandom.resize(cache->curNumStrobe);
+        for (int x = 0; x < cache->curNumStrobe; x++) {
+            if (strobe[x].duration + 1 == max_modulo) {
+                int d = buffer.Rand() % max_modulo2;
+                cache->restartRandom[x] = std::make_pair(d, buffer.Rand() % colorcnt);
+            }
+        }
+    }
+
+    parallel_for(0, cache->curNumStrobe, [&strobe, &buffer, max_modulo, max_modulo2, reRandomize, Strobe, new_algorithm, cache](int x) {
         strobe[x].duration++;
         if (new_algorithm) {
             if (!strobe[x].strobing) {
@@ -377,8 +393,8 @@ void TwinkleEffect::Render(Effect *effect, const SettingsMap &SettingsMap, Rende
                 cache->lights_to_renew++;
                 strobe[x].strobing = false;
             } else if (reRandomize) {
-                strobe[x].duration -= dist(eng) % max_modulo2;
-                strobe[x].colorindex = dist(eng) % colorcnt;
+                strobe[x].duration -= cache->restartRandom[x].first;
+                strobe[x].colorindex = cache->restartRandom[x].second;
             }
         }
         int i7 = strobe[x].duration;
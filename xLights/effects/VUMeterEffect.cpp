@@ -19,6 +19,7 @@
 #include "../UtilClasses.h"
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 
 #include "../../include/vumeter-16.xpm"
@@ -171,10 +172,10 @@ std::list<std::string> VUMeterEffect::CheckEffectSettings(const SettingsMap& set
     {
         auto svgFilename = settings.Get("E_FILEPICKERCTRL_SVGFile", "");
 
-        if (svgFilename == "" || !FileExists(svgFilename)) {
+        if (svgFilename == "" || !CheckSequenceCache::Instance().FileExists(svgFilename)) {
             res.push_back(wxString::Format("    ERR: VUMeter effect cant find SVG file '%s'. Model '%s', Start %s", svgFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         } else {
-            if (!IsFileInShowDir(xLightsFrame::CurrentDir, svgFilename)) {
+            if (!CheckSequenceCache::Instance().IsFileInShowDir(svgFilename)) {
                 res.push_back(wxString::Format("    WARN: VUMeter effect SVG file '%s' not under show directory. Model '%s', Start %s", svgFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
             }
         }
@@ -2069,6 +2070,11 @@ static inline uint32_t GetSVGExAlpha(uint32_t colour)
     return (colour & 0xFFFFFF);
 }
 
+static inline xlColor GetSVGColour(uint32_t colour, uint8_t alpha)
+{
+    return xlColor(GetSVGRed(colour), GetSVGGreen(colour), GetSVGBlue(colour), /*shape->opacity * */ GetSVGAlpha(colour) * alpha / 255);
+}
+
 static inline bool areSame(double a, double b, float eps)
 {
     return std::fabs(a - b) < eps;
@@ -2097,57 +2103,45 @@ void VUMeterEffect::DrawSVG(RenderBuffer& buffer, int xc, int yc, double radius,
             }
         }
     } else {
-        auto context = buffer.GetPathDrawingContext();
-        context->Clear();
-
         wxPoint2DDouble centre((float)xc, (float)yc);
         wxPoint2DDouble imageCentre((float)image->width / 2.0, (float)image->height / 2.0);
 
+        // the fill and stroke carry over to the next shape unless it sets its own
+        std::vector<std::pair<float, xlColor>> fill;
+        bool stroke = false;
+        xlColor strokeColour;
+
         for (NSVGshape* shape = image->shapes; shape != nullptr; shape = shape->next) {
             if (GetSVGExAlpha(shape->fill.color) != 0) {
-                if (shape->fill.type == 0) {
-                    context->SetBrush(wxNullBrush);
-                } else if (shape->fill.type == 1) {
-                    wxColor bc(GetSVGRed(shape->fill.color), GetSVGGreen(shape->fill.color), GetSVGBlue(shape->fill.color), /*shape->opacity * */ GetSVGAlpha(shape->fill.color) * color.alpha / 255);
-                    wxBrush brush(bc, wxBrushStyle::wxBRUSHSTYLE_SOLID);
-                    context->SetBrush(brush);
-                } else {
+                fill.clear();
+                if (shape->fill.type == 1) {
+                    fill.emplace_back(0.0f, GetSVGColour(shape->fill.color, color.alpha));
+                } else if (shape->fill.type != 0) {
                     // these are gradients and I know they are not right
-                    if (shape->fill.gradient->nstops == 2) {
-                        wxColor c1(GetSVGRed(shape->fill.gradient->stops[0].color), GetSVGGreen(shape->fill.gradient->stops[0].color), GetSVGBlue(shape->fill.gradient->stops[0].color), /*shape->opacity * */ GetSVGAlpha(shape->fill.gradient->stops[0].color) * color.alpha / 255);
-                        wxColor c2(GetSVGRed(shape->fill.gradient->stops[1].color), GetSVGGreen(shape->fill.gradient->stops[1].color), GetSVGBlue(shape->fill.gradient->stops[1].color), /*shape->opacity * */ GetSVGAlpha(shape->fill.gradient->stops[1].color) * color.alpha / 255);
-                        wxGraphicsBrush brush = context->CreateLinearGradientBrush(0, buffer.BufferHt, 0, 0, c1, c2);
-                        context->SetBrush(brush);
-                    } else {
-                        wxGraphicsGradientStops stops;
-                        for (size_t i = 0; i < shape->fill.gradient->nstops; ++i) {
-                            wxColor sc(GetSVGRed(shape->fill.gradient->stops[i].color), GetSVGGreen(shape->fill.gradient->stops[i].color), GetSVGBlue(shape->fill.gradient->stops[i].color), /*shape->opacity * */ GetSVGAlpha(shape->fill.gradient->stops[i].color) * color.alpha / 255);
-                            if (i == 0) {
-                                stops.SetStartColour(sc);
-                            } else if (i == shape->fill.gradient->nstops - 1) {
-                                stops.SetEndColour(sc);
-                            } else {
-                                stops.Add(sc, 1.0 - shape->fill.gradient->stops[i].offset);
-                            }
+                    for (size_t i = 0; i < shape->fill.gradient->nstops; ++i) {
+                        float pos = 1.0f - shape->fill.gradient->stops[i].offset;
+                        if (i == 0) {
+                            pos = 0.0f;
+                        } else if (i == shape->fill.gradient->nstops - 1) {
+                            pos = 1.0f;
                         }
-                        wxGraphicsBrush brush = context->CreateLinearGradientBrush(0, buffer.BufferHt, 0, 0, stops);
-                        context->SetBrush(brush);
+                        fill.emplace_back(pos, GetSVGColour(shape->fill.gradient->stops[i].color, color.alpha));
                     }
+                    std::stable_sort(fill.begin(), fill.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
                 }
             }
 
             if (shape->stroke.type == 0) {
-                context->SetPen(wxNullPen);
+                stroke = false;
             } else if (shape->stroke.type == 1) {
-                wxColor pc(GetSVGRed(shape->stroke.color), GetSVGGreen(shape->stroke.color), GetSVGBlue(shape->stroke.color), /*shape->opacity * */ GetSVGAlpha(shape->stroke.color) * color.alpha / 255);
-                wxPen pen(pc, thickness);
-                context->SetPen(pen);
+                stroke = true;
+                strokeColour = GetSVGColour(shape->stroke.color, color.alpha);
             } else {
                 // we dont fo gradient lines yet
             }
 
             for (NSVGpath* path = shape->paths; path != nullptr; path = path->next) {
-                wxGraphicsPath cpath = context->CreatePath();
+                PathRasterizer& cpath = buffer.GetPathRasterizer();
                 for (int i = 0; i < path->npts - 1; i += 3) {
                     float* p = &path->pts[i * 2];
                     auto ih = image->height;
@@ -2156,38 +2150,27 @@ void VUMeterEffect::DrawSVG(RenderBuffer& buffer, int xc, int yc, double radius,
                     wxPoint2DDouble cp2 = ScaleMovePoint(wxPoint2DDouble(p[4], ih - p[5]), imageCentre, centre, cache->_svgScaleBase, radius);
                     wxPoint2DDouble end = ScaleMovePoint(wxPoint2DDouble(p[6], ih - p[7]), imageCentre, centre, cache->_svgScaleBase, radius);
 
-                    if (i == 0)
-                        cpath.MoveToPoint(start);
+                    if (i == 0) cpath.MoveTo(start.m_x, start.m_y);
 
                     if (areCollinear(start, cp1, end, 0.001f) && areCollinear(start, cp2, end, 0.001f)) { // check if its a straight line
-                        cpath.AddLineToPoint(end);
+                        cpath.LineTo(end.m_x, end.m_y);
                     } else if (areSame(end.m_x, cp2.m_x, 0.001f) && areSame(end.m_y, cp2.m_y, 0.001f)) { // check if control points2 is the end
-                        cpath.AddQuadCurveToPoint(cp1.m_x, cp1.m_y, end.m_x, end.m_y);
+                        cpath.QuadTo(cp1.m_x, cp1.m_y, end.m_x, end.m_y);
                     } else {
-                        cpath.AddCurveToPoint(cp1.m_x, cp1.m_y, cp2.m_x, cp2.m_y, end.m_x, end.m_y);
+                        cpath.CurveTo(cp1.m_x, cp1.m_y, cp2.m_x, cp2.m_y, end.m_x, end.m_y);
                     }
                 }
                 if (path->closed) {
-                    cpath.CloseSubpath();
-                    context->FillPath(cpath, wxPolygonFillMode::wxODDEVEN_RULE);
+                    cpath.ClosePath();
+                    if (fill.size() == 1) {
+                        buffer.FillPath(cpath, fill.front().second, true);
+                    } else if (!fill.empty()) {
+                        buffer.FillPath(cpath, fill, true);
+                    }
                 }
-                context->StrokePath(cpath);
-            }
-        }
-
-        wxImage* image = buffer.GetPathDrawingContext()->FlushAndGetImage();
-        bool hasAlpha = image->HasAlpha();
-
-        xlColor cc;
-        for (int y = 0; y < buffer.BufferHt; ++y) {
-            for (int x = 0; x < buffer.BufferWi; ++x) {
-                if (hasAlpha) {
-                    cc = xlColor(image->GetRed(x, y), image->GetGreen(x, y), image->GetBlue(x, y), image->GetAlpha(x, y));
-                    cc = cc.AlphaBlend(buffer.GetPixel(x, y));
-                } else {
-                    cc.Set(image->GetRed(x, y), image->GetGreen(x, y), image->GetBlue(x, y), 255);
+                if (stroke) {
+                    buffer.StrokePath(cpath, strokeColour, thickness);
                 }
-                buffer.SetPixel(x, y, cc);
             }
         }
     }
@@ -24,6 +24,7 @@
 #include "../xLightsMain.h" 
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
+#include "../CheckSequenceCache.h"
 #include "../ExternalHooks.h"
 
 #include <log4cpp/Category.hh>
@@ -48,30 +49,30 @@ std::list<std::string> VideoEffect::CheckEffectSettings(const SettingsMap& setti
         }
     }
 
-    if (filename == "" || !FileExists(filename))
+    if (filename == "" || !CheckSequenceCache::Instance().FileExists(filename.ToStdString()))
     {
         res.push_back(wxString::Format("    ERR: Video effect video file '%s' does not exist. Model '%s', Start %s", filename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
     }
     else
     {
-        if (!IsFileInShowDir(xLightsFrame::CurrentDir, filename.ToStdString()))
+        if (!CheckSequenceCache::Instance().IsFileInShowDir(filename.ToStdString()))
         {
             res.push_back(wxString::Format("    WARN: Video effect video file '%s' not under show directory. Model '%s', Start %s", filename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         }
 
-        VideoReader* videoreader = new VideoReader(filename.ToStdString(), 100, 100, false, true, true);
-        if (videoreader == nullptr || videoreader->GetLengthMS() == 0)
+        CheckSequenceCache::VideoInfo video = CheckSequenceCache::Instance().GetVideoInfo(filename.ToStdString());
+        if (!video.ok)
         {
             res.push_back(wxString::Format("    ERR: Video effect video file '%s' could not be understood. Format may not be supported. Model '%s', Start %s", filename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         }
-        else if (videoreader != nullptr)
+        else
         {
             double starttime = settings.GetDouble("E_TEXTCTRL_Video_Starttime", 0.0);
             wxString treatment = settings.Get("E_CHOICE_Video_DurationTreatment", "Normal");
 
             if (treatment == "Normal")
             {
-                int videoduration = videoreader->GetLengthMS() - starttime;
+                int videoduration = video.lengthMS - starttime;
                 int effectduration = eff->GetEndTimeMS() - eff->GetStartTimeMS();
                 if (videoduration < effectduration)
                 {
@@ -81,8 +82,8 @@ std::list<std::string> VideoEffect::CheckEffectSettings(const SettingsMap& setti
 
             if (!renderCache)
             {
-                int vh = videoreader->GetHeight();
-                int vw = videoreader->GetHeight();
+                int vh = video.height;
+                int vw = video.width;
 
 #define VIDEOSIZETHRESHOLD 10
                 if (vh > VIDEOSIZETHRESHOLD * model->GetDefaultBufferHt() || vw > VIDEOSIZETHRESHOLD * model->GetDefaultBufferWi())
@@ -92,11 +93,6 @@ std::list<std::string> VideoEffect::CheckEffectSettings(const SettingsMap& setti
                 }
             }
         }
-
-        if (videoreader != nullptr)
-        {
-            delete videoreader;
-        }
     }
 
     wxString bufferstyle = settings.Get("B_CHOICE_BufferStyle", "Default");
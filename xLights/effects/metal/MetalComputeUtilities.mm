@@ -252,8 +252,9 @@ bool MetalPixelBufferComputeData::doBlendLayers(PixelBufferClass *pixelBuffer, i
     
     xlColor *colors = (xlColor*)(tmpBufferBlend.contents);
     int nc = pixelBuffer->layers[saveLayer]->buffer.GetNodeCount();
+    auto &nodes = pixelBuffer->layers[saveLayer]->buffer.Nodes.Edit();
     for (int x = 0;  x < nc; x++) {
-        pixelBuffer->layers[saveLayer]->buffer.Nodes[x]->SetColor(colors[x]);
+        nodes[x]->SetColor(colors[x]);
     }
     return true;
 }
@@ -520,7 +521,7 @@ void MetalRenderBufferComputeData::bufferResized() {
         getPixelBuffer(false);
     }
     int indexCount = renderBuffer->Nodes.size();
-    for (auto &n : renderBuffer->Nodes) {
+    for (const auto &n : renderBuffer->Nodes) {
         if (n->Coords.size() > 1) {
             indexCount += n->Coords.size() + 1;
         }
@@ -537,7 +538,7 @@ void MetalRenderBufferComputeData::bufferResized() {
     }
     int idx = 0;
     int extraIdx = renderBuffer->Nodes.size();
-    for (auto &n : renderBuffer->Nodes) {
+    for (const auto &n : renderBuffer->Nodes) {
         if (n->Coords.size() > 1) {
             indexes[idx] = extraIdx | 0x10000000;
             int countIdx = extraIdx++;
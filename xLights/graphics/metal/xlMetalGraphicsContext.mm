@@ -527,6 +527,16 @@ public:
             colors[idx] = ((simd_uchar4){c.red, c.green, c.blue, c.alpha});
         }
     }
+    virtual void SetColors(uint32_t start, const xlColor *c, uint32_t count) override {
+        if (bufferColors && start + count <= cbufferCount) {
+            simd_uchar4 *dest = &bufferColors[start];
+            for (uint32_t x = 0; x < count; ++x) {
+                dest[x] = (simd_uchar4){c[x].red, c[x].green, c[x].blue, c[x].alpha};
+            }
+        } else {
+            xlVertexIndexedColorAccumulator::SetColors(start, c, count);
+        }
+    }
 
     virtual void Finalize(bool mcv, bool mcc) override {
         finalized = true;
@@ -1394,6 +1394,12 @@ public:
     virtual void SetColor(uint32_t idx, const xlColor &c) override {
         colors[idx] = c;
     }
+    virtual void SetColors(uint32_t start, const xlColor *c, uint32_t count) override {
+        if (start + count > colors.size()) {
+            colors.resize(start + count);
+        }
+        std::copy(c, c + count, colors.begin() + start);
+    }
     
     // mark this as ready to be copied to graphics card, after finalize,
     // vertices cannot be added, but if mayChange is set, the vertex/color
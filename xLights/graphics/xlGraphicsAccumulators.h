@@ -117,6 +117,11 @@ public:
     virtual void SetColorCount(int c) {}
     virtual uint32_t GetColorCount() { return 0; }
     virtual void SetColor(uint32_t idx, const xlColor &c) {}
+    virtual void SetColors(uint32_t start, const xlColor *c, uint32_t count) {
+        for (uint32_t x = 0; x < count; ++x) {
+            SetColor(start + x, c[x]);
+        }
+    }
     
     // mark this as ready to be copied to graphics card, after finalize,
     // vertices cannot be added, but if mayChange is set, the vertex/color
@@ -58,6 +58,7 @@
 #include "../xSchedule/wxJSON/jsonreader.h"
 
 #include <algorithm>
+#include <typeinfo>
 
 #define MOST_STRINGS_WE_EXPECT 480
 #define MOST_CONTROLLER_PORTS_WE_EXPECT 128
@@ -2919,6 +2920,7 @@ void Model::SetFromXml(wxXmlNode* ModelNode, bool zb)
     ModelXml = ModelNode;
     StrobeRate = 0;
     Nodes.clear();
+    ClearRenderBufferNodeCache();
 
     clearUnusedProtocolProperties(GetControllerConnection());
 
@@ -3809,6 +3811,92 @@ const std::string Model::AdjustBufferStyle(const std::string &style) const {
 }
 
 
+// 3D layouts are projected through the camera and the house preview so they are only reusable while neither has moved
+static std::string GetCameraState(const std::string& camera)
+{
+    std::string state;
+    if (camera == "2D" || xLightsApp::GetFrame() == nullptr) {
+        return state;
+    }
+    PreviewCamera* pcamera = xLightsApp::GetFrame()->viewpoint_mgr.GetNamedCamera3D(camera);
+    ModelPreview* modelPreview = xLightsApp::GetFrame()->GetHousePreview();
+    if (pcamera != nullptr) {
+        const glm::mat4& view = pcamera->GetViewMatrix();
+        state.append((const char*)&view[0][0], sizeof(glm::mat4));
+    }
+    if (modelPreview != nullptr) {
+        const glm::mat4& proj = modelPreview->GetProjMatrix();
+        state.append((const char*)&proj[0][0], sizeof(glm::mat4));
+    }
+    return state;
+}
+
+// a group's nodes come from its members which can change without the group's own change count moving, at least until
+// CheckForChanges gets to run on the main thread
+static unsigned long GetMemberChangeCount(const Model* model)
+{
+    unsigned long count = 0;
+    const ModelGroup* grp = dynamic_cast<const ModelGroup*>(model);
+    if (grp != nullptr) {
+        for (const auto& it : grp->Models()) {
+            count += it->GetChangeCount() + GetMemberChangeCount(it);
+        }
+    }
+    return count;
+}
+
+void Model::InitRenderBufferNodesCached(const std::string& type, const std::string& camera,
+                                        const std::string& transform,
+                                        RenderBufferNodes& newNodes, int& bufferWi, int& bufferHt, int stagger, bool deep) const
+{
+    // appending to existing nodes changes the resulting layout so that cant use the cache
+    if (!newNodes.empty()) {
+        InitRenderBufferNodes(type, camera, transform, newNodes.Edit(), bufferWi, bufferHt, stagger, deep);
+        return;
+    }
+
+    const ModelGroup* grp = dynamic_cast<const ModelGroup*>(this);
+    if (grp != nullptr) {
+        // same as InitRenderBufferNodes would do, it has to happen before the change count is compared
+        grp->CheckForChanges();
+    }
+    unsigned long memberChangeCount = GetMemberChangeCount(this);
+
+    std::string key = type + "|" + transform + "|" + camera + "|" + std::to_string(stagger) + (deep ? "|Deep" : "");
+    std::string cameraState = GetCameraState(camera);
+    std::shared_ptr<const RenderBufferNodeCacheEntry> entry;
+    {
+        std::unique_lock<std::mutex> lock(renderBufferNodeCacheLock);
+        auto it = renderBufferNodeCache.find(key);
+        if (it != renderBufferNodeCache.end() && it->second->changeCount == GetChangeCount() && it->second->memberChangeCount == memberChangeCount && it->second->modelNodeCount == Nodes.size() &&
+            it->second->cameraState == cameraState) {
+            entry = it->second;
+        }
+    }
+    if (entry == nullptr) {
+        auto e = std::make_shared<RenderBufferNodeCacheEntry>();
+        e->changeCount = GetChangeCount();
+        e->memberChangeCount = memberChangeCount;
+        e->modelNodeCount = Nodes.size();
+        e->cameraState = cameraState;
+        InitRenderBufferNodes(type, camera, transform, e->nodes, e->bufferWi, e->bufferHt, stagger, deep);
+        std::unique_lock<std::mutex> lock(renderBufferNodeCacheLock);
+        renderBufferNodeCache[key] = e;
+        entry = e;
+    }
+
+    // shared, the render buffer takes its own copy if it ever needs to change them
+    newNodes.Share(std::shared_ptr<const RenderBufferNodes::NodeVector>(entry, &entry->nodes));
+    bufferWi = entry->bufferWi;
+    bufferHt = entry->bufferHt;
+}
+
+void Model::ClearRenderBufferNodeCache() const
+{
+    std::unique_lock<std::mutex> lock(renderBufferNodeCacheLock);
+    renderBufferNodeCache.clear();
+}
+
 void Model::InitRenderBufferNodes(const std::string& type, const std::string& camera,
                                   const std::string& transform,
                                   std::vector<NodeBaseClassPtr>& newNodes, int& bufferWi, int& bufferHt, int stagger, bool deep) const
@@ -5266,7 +5354,14 @@ void Model::DisplayModelOnWindow(ModelPreview* preview, xlGraphicsContext* ctx,
             }
         });
     }
-    for (int n = 0; n < NodeCount; ++n) {
+    // colours may already have been gathered straight from the frame data
+    bool gathered = c == nullptr && previewFrameColorsSet && highlightpixel <= 0 && !highlightFirst &&
+                    previewFrameColors.size() == (_pixelStyle == PIXEL_STYLE::PIXEL_STYLE_BLENDED_CIRCLE ? NodeCount * 2 : NodeCount);
+    previewFrameColorsSet = false;
+    if (gathered) {
+        cache->vica->SetColors(0, previewFrameColors.data(), previewFrameColors.size());
+    }
+    for (int n = 0; n < NodeCount && !gathered; ++n) {
         if (n + 1 == highlightpixel) {
             color = xlMAGENTA;
         } else if (highlightFirst && Nodes.size() > 1) {
@@ -5347,6 +5442,68 @@ void Model::DisplayModelOnWindow(ModelPreview* preview, xlGraphicsContext* ctx,
     }
 }
 
+void Model::BuildPreviewGather()
+{
+    previewGather.clear();
+    previewGatherChangeCount = changeCount;
+    previewGatherNodeCount = Nodes.size();
+
+    std::vector<uint32_t> gather;
+    gather.reserve(Nodes.size() * 3);
+    for (const auto& it : Nodes) {
+        const NodeBaseClass* node = it.get();
+        // only plain rgb nodes, other node types map their channels to colours themselves
+        if (typeid(*node) != typeid(NodeBaseClass) || node->GetChanCount() != 3 ||
+            (node->model != nullptr && (node->model->modelDimmingCurve != nullptr || node->model->StrobeRate != 0))) {
+            return;
+        }
+        for (int x = 0; x < 3; ++x) {
+            if (node->GetChannelOffset(x) == 255) {
+                return;
+            }
+            gather.push_back(node->ActChan + node->GetChannelOffset(x));
+        }
+    }
+    previewGather = std::move(gather);
+}
+
+bool Model::SetPreviewColorsFromFrame(const unsigned char* data)
+{
+    previewFrameColorsSet = false;
+    if (previewGatherChangeCount != changeCount || previewGatherNodeCount != Nodes.size()) {
+        BuildPreviewGather();
+    }
+    size_t nodeCount = Nodes.size();
+    if (nodeCount == 0 || previewGather.size() != nodeCount * 3) {
+        return false;
+    }
+
+    bool blended = _pixelStyle == PIXEL_STYLE::PIXEL_STYLE_BLENDED_CIRCLE;
+    previewFrameColors.resize(blended ? nodeCount * 2 : nodeCount);
+    xlColor* colors = previewFrameColors.data();
+    const uint32_t* gather = previewGather.data();
+    bool transparent = transparency != 0 || blackTransparency != 0;
+    for (size_t n = 0; n < nodeCount; ++n, gather += 3) {
+        xlColor& color = colors[n];
+        color.Set(data[gather[0]], data[gather[1]], data[gather[2]]);
+        // keep the nodes current for anything that draws from them later
+        Nodes[n]->NodeBaseClass::SetColor(color);
+        if (transparent) {
+            ApplyTransparency(color, transparency, blackTransparency);
+        } else {
+            color.alpha = 255;
+        }
+    }
+    if (blended) {
+        for (size_t n = 0; n < nodeCount; ++n) {
+            colors[n + nodeCount] = colors[n];
+            colors[n + nodeCount].alpha = 0;
+        }
+    }
+    previewFrameColorsSet = true;
+    return true;
+}
+
 float Model::GetPreviewDimScale(ModelPreview* preview, int& w, int& h)
 {
     preview->GetSize(&w, &h);
@@ -15,6 +15,8 @@
 #include <vector>
 #include <list>
 #include <tuple>
+#include <memory>
+#include <mutex>
 
 #include "ModelScreenLocation.h"
 #include "BoxedScreenLocation.h"
@@ -143,7 +145,9 @@ public:
     int GetPixelSize() const { return pixelSize; }
     void SetPixelSize(int size);
     void SetTransparency(int t);
+    int GetTransparency() const { return transparency; }
     void SetBlackTransparency(int t);
+    int GetBlackTransparency() const { return blackTransparency; }
     void ApplyDimensions(const std::string& units, float width, float height, float depth, float& min_x, float& max_x, float& min_y, float& max_y);
     void ExportDimensions(wxFile& f) const;
 
@@ -180,6 +184,11 @@ public:
     virtual void GetBufferSize(const std::string& type, const std::string& camera, const std::string& transform, int& BufferWi, int& BufferHi, int stagger) const;
     virtual void InitRenderBufferNodes(const std::string& type, const std::string& camera, const std::string& transform,
         std::vector<NodeBaseClassPtr>& Nodes, int& BufferWi, int& BufferHi, int stagger, bool deep = false) const;
+    // Same as InitRenderBufferNodes but the computed layout is kept per buffer style, transform and camera and later
+    // buffers share it until they need to change their nodes
+    void InitRenderBufferNodesCached(const std::string& type, const std::string& camera, const std::string& transform,
+        RenderBufferNodes& Nodes, int& BufferWi, int& BufferHi, int stagger, bool deep = false) const;
+    void ClearRenderBufferNodeCache() const;
     const ModelManager& GetModelManager() const { return modelManager; }
     virtual bool SupportsXlightsModel() { return false; }
     static Model* GetXlightsModel(Model* model, std::string& last_model, xLightsFrame* xlights, bool& cancelled, bool download, wxProgressDialog* prog, int low, int high, ModelPreview* modelPreview);
@@ -258,6 +267,27 @@ protected:
     std::vector<NodeBaseClassPtr> Nodes;
     const ModelManager& modelManager;
 
+    // render buffer layouts by buffer style, entries are never modified once built so can be shared between threads
+    struct RenderBufferNodeCacheEntry {
+        std::vector<NodeBaseClassPtr> nodes;
+        int bufferWi = 0;
+        int bufferHt = 0;
+        unsigned long changeCount = 0;
+        unsigned long memberChangeCount = 0;
+        size_t modelNodeCount = 0;
+        std::string cameraState;
+    };
+    mutable std::mutex renderBufferNodeCacheLock;
+    mutable std::map<std::string, std::shared_ptr<const RenderBufferNodeCacheEntry>> renderBufferNodeCache;
+
+    // three channel offsets per node into the frame data, empty if the model cant use the table
+    void BuildPreviewGather();
+    std::vector<uint32_t> previewGather;
+    unsigned long previewGatherChangeCount = 0;
+    size_t previewGatherNodeCount = (size_t)-1;
+    std::vector<xlColor> previewFrameColors;
+    bool previewFrameColorsSet = false;
+
     int FindNodeAtXY(int bufx, int bufy);
     virtual void InitModel();
     virtual int CalcCannelsPerString();
@@ -430,6 +460,9 @@ public:
                                       bool highlightFirst = false, int highlightpixel = 0,
                                       float *boundingBox = nullptr);
     virtual void DisplayEffectOnWindow(ModelPreview* preview, double pointSize);
+    // Loads the frame's node colours through a channel table built once per layout, returns false if the
+    // model has node types, dimming or strobing that need the per node SetNodeChannelValues path
+    bool SetPreviewColorsFromFrame(const unsigned char* data);
 
 
 
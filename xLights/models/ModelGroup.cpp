@@ -568,6 +568,7 @@ bool ModelGroup::Reset(bool zeroBased) {
         defaultBufferStyle = HORIZ_PER_MODEL;
     }
     Nodes.clear();
+    ClearRenderBufferNodeCache();
     models.clear();
     activeModels.clear();
     modelNames.clear();
@@ -101,6 +101,15 @@ public:
         return new NodeBaseClass(*this);
     }
 
+    // puts back what a render can change on a node cloned from n, cheaper than cloning it again
+    void ResetFrom(const NodeBaseClass& n)
+    {
+        Coords = n.Coords;
+        for (int x = 0; x < 3; x++) {
+            c[x] = n.c[x];
+        }
+    }
+
     // only for use in initializing the custom model
     void AddBufCoord(unsigned short x, unsigned short y)
     {
@@ -149,6 +158,12 @@ public:
         return chanCnt;
     }
 
+    // offset of the red/green/blue value from ActChan, 255 if the node has no such channel
+    uint8_t GetChannelOffset(int colour) const
+    {
+        return offsets[colour];
+    }
+
     bool IsVisible() const
     {
         return !Coords.empty();
@@ -527,3 +542,81 @@ private:
 };
 
 typedef std::unique_ptr<NodeBaseClass> NodeBaseClassPtr;
+
+// The nodes of a render buffer. Buffers laid out from a model's cached layout share the cached nodes and only take
+// their own copy the first time something needs to change them (sub buffers, node colours) so reading goes through
+// the const accessors and anything that modifies a node has to get the nodes from Edit().
+// A copy is kept when the buffer is cleared or shared again so a layer that is laid out again every frame (variable
+// sub buffers) and then written to only resets the copy rather than cloning every node each frame.
+class RenderBufferNodes
+{
+public:
+    typedef std::vector<NodeBaseClassPtr> NodeVector;
+
+    class const_iterator
+    {
+    public:
+        const_iterator(NodeVector::const_iterator it) : _it(it) {}
+        const NodeBaseClass* operator*() const { return _it->get(); }
+        const_iterator& operator++() { ++_it; return *this; }
+        bool operator!=(const const_iterator& other) const { return _it != other._it; }
+    private:
+        NodeVector::const_iterator _it;
+    };
+
+    size_t size() const { return Get().size(); }
+    bool empty() const { return Get().empty(); }
+    const NodeBaseClass* operator[](size_t i) const { return Get()[i].get(); }
+    const_iterator begin() const { return const_iterator(Get().begin()); }
+    const_iterator end() const { return const_iterator(Get().end()); }
+
+    // not thread safe the first time it is called on shared nodes, call it before handing the nodes to a parallel_for
+    NodeVector& Edit()
+    {
+        if (_shared != nullptr) {
+            if (_spareSource == _shared && _spare.size() == _shared->size()) {
+                _own.swap(_spare);
+                for (size_t i = 0; i < _own.size(); ++i) {
+                    _own[i]->ResetFrom(*(*_shared)[i]);
+                }
+            } else {
+                _own.clear();
+                _own.reserve(_shared->size());
+                for (const auto& it : *_shared) {
+                    _own.push_back(NodeBaseClassPtr(it->clone()));
+                }
+            }
+            _ownSource = _shared;
+            _shared = nullptr;
+            _spare.clear();
+            _spareSource = nullptr;
+        }
+        return _own;
+    }
+    // the nodes must never be modified by anyone while they are shared
+    void Share(std::shared_ptr<const NodeVector> nodes)
+    {
+        clear();
+        _shared = nodes;
+    }
+    void clear()
+    {
+        if (_ownSource != nullptr) {
+            _spare.swap(_own);
+            _spareSource = _ownSource;
+            _ownSource = nullptr;
+        }
+        _own.clear();
+        _shared = nullptr;
+    }
+
+private:
+    const NodeVector& Get() const { return _shared != nullptr ? *_shared : _own; }
+
+    NodeVector _own;
+    std::shared_ptr<const NodeVector> _shared;
+    // what _own was cloned from if it was, and the copy put aside by clear
+    std::shared_ptr<const NodeVector> _ownSource;
+    NodeVector _spare;
+    std::shared_ptr<const NodeVector> _spareSource;
+};
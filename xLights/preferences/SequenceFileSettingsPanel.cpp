@@ -46,6 +46,8 @@ const long SequenceFileSettingsPanel::ID_BUTTON_ADDMEDIA = wxNewId();
 const long SequenceFileSettingsPanel::ID_BUTTON_REMOVE_MEDIA = wxNewId();
 const long SequenceFileSettingsPanel::ID_STATICTEXT2 = wxNewId();
 const long SequenceFileSettingsPanel::ID_CHOICE_VIEW_DEFAULT = wxNewId();
+const long SequenceFileSettingsPanel::ID_CHECKBOX4 = wxNewId();
+const long SequenceFileSettingsPanel::ID_CHECKBOX7 = wxNewId();
 //*)
 
 BEGIN_EVENT_TABLE(SequenceFileSettingsPanel,wxPanel)
@@ -165,6 +167,14 @@ SequenceFileSettingsPanel::SequenceFileSettingsPanel(wxWindow* parent,xLightsFra
 	ViewDefaultChoice->SetMinSize(wxSize(200,-1));
 	ViewDefaultChoice->SetToolTip(_("This option is used to select which models will populate the master view when a new sequence is created."));
 	GridBagSizer1->Add(ViewDefaultChoice, wxGBPosition(3, 1), wxDefaultSpan, wxALL|wxEXPAND, 5);
+	SnapshotCheckBox = new wxCheckBox(this, ID_CHECKBOX4, _("Snapshot Sequences for Faster Opening"), wxDefaultPosition, wxDefaultSize, 0, wxDefaultValidator, _T("ID_CHECKBOX4"));
+	SnapshotCheckBox->SetValue(false);
+	SnapshotCheckBox->SetToolTip(_("Keeps a binary copy (.xsqsnap) of the effects next to each sequence so unchanged sequences open faster."));
+	GridBagSizer1->Add(SnapshotCheckBox, wxGBPosition(11, 0), wxGBSpan(1, 2), wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
+	ParallelFrameRenderCheckBox = new wxCheckBox(this, ID_CHECKBOX7, _("Render Frame Independent Effects in Parallel"), wxDefaultPosition, wxDefaultSize, 0, wxDefaultValidator, _T("ID_CHECKBOX7"));
+	ParallelFrameRenderCheckBox->SetValue(false);
+	ParallelFrameRenderCheckBox->SetToolTip(_("Renders the frames of effects that do not depend on earlier frames, such as Bars, Butterfly and Plasma, several at a time."));
+	GridBagSizer1->Add(ParallelFrameRenderCheckBox, wxGBPosition(12, 0), wxGBSpan(1, 2), wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
 	SetSizer(GridBagSizer1);
 	GridBagSizer1->Fit(this);
 	GridBagSizer1->SetSizeHints(this);
@@ -185,6 +195,8 @@ SequenceFileSettingsPanel::SequenceFileSettingsPanel(wxWindow* parent,xLightsFra
 	Connect(ID_BUTTON_ADDMEDIA,wxEVT_COMMAND_BUTTON_CLICKED,(wxObjectEventFunction)&SequenceFileSettingsPanel::OnAddMediaButtonClick);
 	Connect(ID_BUTTON_REMOVE_MEDIA,wxEVT_COMMAND_BUTTON_CLICKED,(wxObjectEventFunction)&SequenceFileSettingsPanel::OnRemoveMediaButtonClick);
 	Connect(ID_CHOICE_VIEW_DEFAULT,wxEVT_COMMAND_CHOICE_SELECTED,(wxObjectEventFunction)&SequenceFileSettingsPanel::OnViewDefaultChoiceSelect);
+	Connect(ID_CHECKBOX4,wxEVT_COMMAND_CHECKBOX_CLICKED,(wxObjectEventFunction)&SequenceFileSettingsPanel::OnSnapshotCheckBoxClick);
+	Connect(ID_CHECKBOX7,wxEVT_COMMAND_CHECKBOX_CLICKED,(wxObjectEventFunction)&SequenceFileSettingsPanel::OnParallelFrameRenderCheckBoxClick);
 	//*)
 
 	GridBagSizer1->Fit(this);
@@ -207,6 +219,8 @@ bool SequenceFileSettingsPanel::TransferDataFromWindow() {
     frame->SetSaveFseqOnSave(FSEQSaveCheckBox->IsChecked());
     frame->SetModelBlendDefaultOff(ModelBlendDefaultChoice->GetSelection());
     frame->SetLowDefinitionRender(CheckBox_LowDefinitionRender->IsChecked());
+    frame->SetSnapshotSequences(SnapshotCheckBox->IsChecked());
+    frame->SetParallelFrameRender(ParallelFrameRenderCheckBox->IsChecked());
 
     switch (AutoSaveIntervalChoice->GetSelection()) {
         case 0:
@@ -360,6 +374,8 @@ bool SequenceFileSettingsPanel::TransferDataToWindow() {
     CheckBox_RenderCache->SetValue(cb);
     DirPickerCtrl_RenderCache->SetPath(folder);
     CheckBox_LowDefinitionRender->SetValue(frame->IsLowDefinitionRender());
+    SnapshotCheckBox->SetValue(frame->IsSnapshotSequences());
+    ParallelFrameRenderCheckBox->SetValue(frame->IsParallelFrameRender());
     Choice_MaximumRenderCache->SetStringSelection(EncodeMaxRenderCache(frame->RenderCacheMaximumSizeMB()));
 
     ViewDefaultChoice->Clear();
@@ -540,3 +556,17 @@ void SequenceFileSettingsPanel::OnChoice_MaximumRenderCacheSelect(wxCommandEvent
         TransferDataFromWindow();
     }
 }
+
+void SequenceFileSettingsPanel::OnSnapshotCheckBoxClick(wxCommandEvent& event)
+{
+    if (wxPreferencesEditor::ShouldApplyChangesImmediately()) {
+        TransferDataFromWindow();
+    }
+}
+
+void SequenceFileSettingsPanel::OnParallelFrameRenderCheckBoxClick(wxCommandEvent& event)
+{
+    if (wxPreferencesEditor::ShouldApplyChangesImmediately()) {
+        TransferDataFromWindow();
+    }
+}
@@ -44,7 +44,9 @@ class SequenceFileSettingsPanel: public wxPanel
 		wxCheckBox* CheckBox_LowDefinitionRender;
 		wxCheckBox* CheckBox_RenderCache;
 		wxCheckBox* FSEQSaveCheckBox;
+		wxCheckBox* ParallelFrameRenderCheckBox;
 		wxCheckBox* RenderOnSaveCheckBox;
+		wxCheckBox* SnapshotCheckBox;
 		wxChoice* AutoSaveIntervalChoice;
 		wxChoice* Choice_MaximumRenderCache;
 		wxChoice* FSEQVersionChoice;
@@ -84,6 +86,8 @@ class SequenceFileSettingsPanel: public wxPanel
 		static const long ID_BUTTON_REMOVE_MEDIA;
 		static const long ID_STATICTEXT2;
 		static const long ID_CHOICE_VIEW_DEFAULT;
+		static const long ID_CHECKBOX4;
+		static const long ID_CHECKBOX7;
 		//*)
 
 	private:
@@ -109,6 +113,8 @@ class SequenceFileSettingsPanel: public wxPanel
 		void OnViewDefaultChoiceSelect(wxCommandEvent& event);
 		void OnCheckBox_LowDefinitionRenderClick(wxCommandEvent& event);
 		void OnChoice_MaximumRenderCacheSelect(wxCommandEvent& event);
+		void OnSnapshotCheckBoxClick(wxCommandEvent& event);
+		void OnParallelFrameRenderCheckBoxClick(wxCommandEvent& event);
 		//*)
 
 		DECLARE_EVENT_TABLE()
@@ -190,12 +190,27 @@ Effect::Effect(const Effect& ef)
 Effect::Effect(EffectManager* effectManager, EffectLayer* parent,int id, const std::string & name, const std::string &settings, const std::string &palette, int startTimeMS, int endTimeMS, int Selected, bool Protected, bool importing) :
     mID(id), mParentLayer(parent) , mEffectIndex(-1), mName(nullptr),
       mStartTime(startTimeMS), mEndTime(endTimeMS), mSelected(Selected), mTagged(false), mProtected(Protected), mCache(nullptr)
+{
+    mSettings.Parse(effectManager, settings, name);
+    mPaletteMap.Parse(effectManager, palette, name);
+    Initialise(parent, name, importing);
+}
+
+Effect::Effect(EffectLayer* parent, int id, const std::string& name, const SettingsMap& settings, const SettingsMap& palette, int startTimeMS, int endTimeMS, int Selected, bool Protected, bool importing) :
+    mID(id), mParentLayer(parent), mEffectIndex(-1), mName(nullptr),
+    mStartTime(startTimeMS), mEndTime(endTimeMS), mSelected(Selected), mTagged(false), mProtected(Protected), mCache(nullptr)
+{
+    mSettings = settings;
+    mPaletteMap = palette;
+    Initialise(parent, name, importing);
+}
+
+void Effect::Initialise(EffectLayer* parent, const std::string& name, bool importing)
 {
     //static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     mColorMask = xlColor::NilColor();
     mEffectIndex = (parent->GetParentElement() == nullptr) ? -1 : parent->GetParentElement()->GetSequenceElements()->GetEffectManager().GetEffectIndex(name);
-    mSettings.Parse(effectManager, settings, name);
 
     Element* parentElement = parent->GetParentElement();
     if (!importing && parentElement != nullptr) {
@@ -239,7 +254,6 @@ Effect::Effect(EffectManager* effectManager, EffectLayer* parent,int id, const s
         mName = new std::string(name);
     }
 
-    mPaletteMap.Parse(effectManager, palette, name);
     ParseColorMap(mPaletteMap, mColors, mCC);
 }
 
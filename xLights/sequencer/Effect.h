@@ -62,10 +62,14 @@ class Effect
 
     Effect() {}  //don't allow default or copy constructor
     static void ParseColorMap(const SettingsMap &mPaletteMap, xlColorVector &mColors, xlColorCurveVector& mCC);
+    void Initialise(EffectLayer* parent, const std::string& name, bool importing);
 
 public:
     Effect(EffectManager* effectManager, EffectLayer* parent, int id, const std::string & name, const std::string &settings, const std::string &palette,
         int startTimeMS, int endTimeMS, int Selected, bool Protected, bool importing = false);
+    // settings and palette already parsed, used when loading so shared strings are only parsed once
+    Effect(EffectLayer* parent, int id, const std::string& name, const SettingsMap& settings, const SettingsMap& palette,
+        int startTimeMS, int endTimeMS, int Selected, bool Protected, bool importing = false);
     Effect(const Effect& e);
     virtual ~Effect();
 
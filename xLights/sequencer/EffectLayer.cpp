@@ -207,6 +207,39 @@ Effect* EffectLayer::AddEffect(int id, const std::string &n, const std::string &
 {
     std::unique_lock<std::recursive_mutex> locker(acquireLockWaitForRender());
     std::string name(n);
+    EffectManager* em = PrepareToAddEffect(name, startTimeMS, endTimeMS);
+    if (em == nullptr) return nullptr;
+
+    Effect* e = new Effect(em, this, id, name, settings, palette, startTimeMS, endTimeMS, Selected, Protected, importing);
+    wxASSERT(e != nullptr);
+    mEffects.push_back(e);
+    if (!suppress_sort) {
+        SortEffects();
+    }
+    IncrementChangeCount(startTimeMS, endTimeMS);
+    return e;
+}
+
+Effect* EffectLayer::AddEffect(int id, const std::string& n, const SettingsMap& settings, const SettingsMap& palette,
+                               int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort, bool importing)
+{
+    std::unique_lock<std::recursive_mutex> locker(acquireLockWaitForRender());
+    std::string name(n);
+    if (PrepareToAddEffect(name, startTimeMS, endTimeMS) == nullptr) return nullptr;
+
+    Effect* e = new Effect(this, id, name, settings, palette, startTimeMS, endTimeMS, Selected, Protected, importing);
+    wxASSERT(e != nullptr);
+    mEffects.push_back(e);
+    if (!suppress_sort) {
+        SortEffects();
+    }
+    IncrementChangeCount(startTimeMS, endTimeMS);
+    return e;
+}
+
+// Validates an effect about to be added, returns the effect manager to use or nullptr if the effect should not be added
+EffectManager* EffectLayer::PrepareToAddEffect(std::string& name, int& startTimeMS, int endTimeMS)
+{
     EffectManager* em = nullptr;
     if (GetParentElement() != nullptr) {
         em = &(GetParentElement()->GetSequenceElements()->GetEffectManager());
@@ -240,15 +273,7 @@ Effect* EffectLayer::AddEffect(int id, const std::string &n, const std::string &
 
     // make sure they dont hang over the left side
     if (startTimeMS < 0) startTimeMS = 0;
-
-    Effect* e = new Effect(em, this, id, name, settings, palette, startTimeMS, endTimeMS, Selected, Protected, importing);
-    wxASSERT(e != nullptr);
-    mEffects.push_back(e);
-    if (!suppress_sort) {
-        SortEffects();
-    }
-    IncrementChangeCount(startTimeMS, endTimeMS);
-    return e;
+    return em;
 }
 
 void EffectLayer::NumberEffects()
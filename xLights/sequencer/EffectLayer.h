@@ -37,6 +37,8 @@ class EffectLayer
 
         Effect *AddEffect(int id, const std::string &name, const std::string &settings, const std::string &palette,
                           int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort = false, bool importing = false);
+        Effect *AddEffect(int id, const std::string &name, const SettingsMap &settings, const SettingsMap &palette,
+                          int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort = false, bool importing = false);
         Effect* GetEffect(int index) const;
         const std::vector<Effect*>& GetEffects() const { return mEffects; }
         Effect* GetEffectByTime(int ms);
@@ -125,11 +127,12 @@ class EffectLayer
 
         void CleanupAfterRender();
         void NumberEffects();
+        void SortEffects();
     protected:
     private:
         std::unique_lock<std::recursive_mutex> acquireLockWaitForRender();
+        EffectManager* PrepareToAddEffect(std::string& name, int& startTimeMS, int endTimeMS);
     
-        void SortEffects();
         void PlayEffect(Effect* effect);
 
         static std::atomic_int exclusive_index;
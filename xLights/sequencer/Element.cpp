@@ -476,13 +476,15 @@ int StrandElement::GetEffectCount() const {
 ModelElement::ModelElement(SequenceElements *l, const std::string &name, bool selected)
 :   Element(l, name),
     mSelected(selected),
-    waitCount(0)
+    waitCount(0),
+    renderGeneration(0)
 {
 }
 
 ModelElement::ModelElement(const std::string &name)
     : Element(nullptr, name),
-    waitCount(0)
+    waitCount(0),
+    renderGeneration(0)
 {
 }
 
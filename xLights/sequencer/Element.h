@@ -279,6 +279,9 @@ class ModelElement : public Element
         int GetWaitCount() const { return waitCount; }
         void IncWaitCount() { waitCount++; }
         int DecWaitCount() { return --waitCount; }
+        // bumped by each render job as it starts so an older job can tell it has been overtaken
+        int StartRender() { return ++renderGeneration; }
+        int GetRenderGeneration() const { return renderGeneration; }
 
         StrandElement *GetStrand(int strand, bool create = false);
         StrandElement *GetStrand(int strand) const;
@@ -293,5 +296,6 @@ class ModelElement : public Element
         std::vector<SubModelElement*> mSubModels;
         std::vector<StrandElement*> mStrands;
         std::atomic_int waitCount;
+        std::atomic_int renderGeneration;
 };
 
@@ -14,8 +14,12 @@
 #include <wx/filename.h>
 
 #include <algorithm>
+#include <functional>
+#include <memory>
 
 #include "SequenceElements.h"
+#include "SequenceSnapshot.h"
+#include "XsqEffectStore.h"
 #include "TimeLine.h"
 #include "../xLightsMain.h"
 #include "../LyricsDialog.h"
@@ -27,6 +31,7 @@
 #include "../SequenceViewManager.h"
 #include "../JukeboxPanel.h"
 #include "../TraceLog.h"
+#include "../Parallel.h"
 #include "../UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -639,87 +644,287 @@ void SequenceElements::MoveElement(int index,int destinationIndex)
     SortElements();
 }
 
+// Name the effect will be created with, AddEffect turns unnamed effects on models into Off effects
+static std::string LoadedEffectName(const std::string& name, bool onModel)
+{
+    if (name.empty() && onModel) {
+        return "Off";
+    }
+    return name;
+}
+
+// An effect read from a layer, either still a node in the document or pulled out by the streaming loader
+class LoadedEffect
+{
+public:
+    LoadedEffect(wxXmlNode* node) :
+        _node(node) {}
+    LoadedEffect(const XsqEffectStore::Effect* effect) :
+        _effect(effect) {}
+
+    wxString GetAttribute(const std::string& name, const wxString& def = STR_EMPTY) const
+    {
+        if (_node != nullptr) {
+            return _node->GetAttribute(name, def);
+        }
+        const std::string* v = _effect->GetAttribute(name);
+        return v == nullptr ? def : wxString::FromUTF8(*v);
+    }
+    bool GetAttribute(const std::string& name, wxString* value) const
+    {
+        if (_node != nullptr) {
+            return _node->GetAttribute(name, value);
+        }
+        const std::string* v = _effect->GetAttribute(name);
+        if (v == nullptr) {
+            return false;
+        }
+        *value = wxString::FromUTF8(*v);
+        return true;
+    }
+    wxString GetNodeContent() const
+    {
+        if (_node != nullptr) {
+            return _node->GetNodeContent();
+        }
+        return _effect->content == nullptr ? wxString() : wxString::FromUTF8(*_effect->content);
+    }
+
+private:
+    wxXmlNode* _node = nullptr;
+    const XsqEffectStore::Effect* _effect = nullptr;
+};
+
+// effects the streaming loader took out of this layer node, if any
+static const std::vector<XsqEffectStore::Effect>* GetStoredEffects(const XsqEffectStore& effectStore, wxXmlNode* layerNode)
+{
+    wxString idx;
+    if (!layerNode->GetAttribute(XsqEffectStore::LAYER_ATTRIBUTE, &idx)) {
+        return nullptr;
+    }
+    return effectStore.GetLayer(wxAtoi(idx));
+}
+
+static bool HasEffectFiles(const std::string& settings)
+{
+    return settings.find("E_FILEPICKER_Pictures_Filename") != std::string::npos || settings.find("E_FILEPICKER_Glediator_Filename") != std::string::npos;
+}
+
+// points picture and glediator file names at wherever the file can be found now
+static std::string FixEffectFiles(const std::string& settings)
+{
+    if (settings.find("E_FILEPICKER_Pictures_Filename") != std::string::npos) {
+        return FixEffectFileParameter("E_FILEPICKER_Pictures_Filename", settings, "").ToStdString();
+    } else if (settings.find("E_FILEPICKER_Glediator_Filename") != std::string::npos) {
+        return FixEffectFileParameter("E_FILEPICKER_Glediator_Filename", settings, "").ToStdString();
+    }
+    return settings;
+}
+
+// The snapshot holds settings with the file names already fixed and the fix depends on which files exist, so its key
+// carries the fixed form of every shared settings string that names a file. This is the same probing a normal load does.
+static std::string EffectFilesKey(const std::vector<std::string>& effectStrings)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < effectStrings.size(); ++i) {
+        if (!HasEffectFiles(effectStrings[i])) {
+            continue;
+        }
+        std::string fixed = std::to_string(i) + "=" + FixEffectFiles(effectStrings[i]);
+        for (char c : fixed) {
+            hash ^= (uint8_t)c;
+            hash *= 1099511628211ULL;
+        }
+        hash ^= 0xFF;
+        hash *= 1099511628211ULL;
+    }
+    return wxString::Format("%016llx", (unsigned long long)hash).ToStdString();
+}
+
+void SequenceElements::ParseSharedEffectStrings(wxXmlNode* elementEffectsNode,
+    const XsqEffectStore& effectStore,
+    const std::vector<std::string>& effectStrings,
+    const std::vector<std::string>& colorPalettes,
+    ParsedEffectStrings& parsedSettings,
+    ParsedEffectStrings& parsedPalettes)
+{
+    // gather the distinct table entries in use, the settings string fixups touch a shared
+    // file map so they are done here once per entry rather than on the parsing threads
+    std::map<int, std::string> fixedSettings;
+    auto collectEffect = [&](const LoadedEffect& effect, bool onModel) {
+        std::string effectName = LoadedEffectName(effect.GetAttribute(STR_NAME).ToStdString(), onModel);
+        if (effect.GetAttribute(STR_REF) != STR_EMPTY) {
+            int ref = wxAtoi(effect.GetAttribute(STR_REF));
+            if (ref >= 0 && ref < (int)effectStrings.size()) {
+                if (fixedSettings.find(ref) == fixedSettings.end()) {
+                    fixedSettings[ref] = FixEffectFiles(effectStrings[ref]);
+                }
+                parsedSettings[std::make_pair(ref, effectName)];
+            }
+        }
+        wxString tmp;
+        long palette = -1;
+        if (effect.GetAttribute(STR_PALETTE, &tmp) && tmp.ToLong(&palette) && palette >= 0 && palette < (long)colorPalettes.size()) {
+            parsedPalettes[std::make_pair((int)palette, effectName)];
+        }
+    };
+    std::function<void(wxXmlNode*, bool)> collect = [&](wxXmlNode* layerNode, bool onModel) {
+        const auto* stored = GetStoredEffects(effectStore, layerNode);
+        if (stored != nullptr) {
+            for (const auto& effect : *stored) {
+                collectEffect(LoadedEffect(&effect), onModel);
+            }
+        }
+        for (wxXmlNode* effect = layerNode->GetChildren(); effect != nullptr; effect = effect->GetNext()) {
+            if (effect->GetName() == STR_EFFECT) {
+                collectEffect(LoadedEffect(effect), onModel);
+            } else if (effect->GetName() == STR_NODE && layerNode->GetName() == STR_STRAND) {
+                collect(effect, false);
+            }
+        }
+    };
+    for (wxXmlNode* elementNode = elementEffectsNode->GetChildren(); elementNode != nullptr; elementNode = elementNode->GetNext()) {
+        if (elementNode->GetName() == STR_ELEMENT && elementNode->GetAttribute(STR_TYPE) != STR_TIMING) {
+            for (wxXmlNode* effectLayerNode = elementNode->GetChildren(); effectLayerNode != nullptr; effectLayerNode = effectLayerNode->GetNext()) {
+                collect(effectLayerNode, effectLayerNode->GetName() == STR_EFFECTLAYER);
+            }
+        }
+    }
+
+    // the parsing itself is independent per entry so spread it over the pool
+    std::vector<std::pair<const std::pair<int, std::string>, SettingsMap>*> work;
+    work.reserve(parsedSettings.size() + parsedPalettes.size());
+    for (auto& it : parsedSettings) {
+        work.push_back(&it);
+    }
+    int paletteStart = (int)work.size();
+    for (auto& it : parsedPalettes) {
+        work.push_back(&it);
+    }
+    EffectManager* em = &GetEffectManager();
+    parallel_for(0, work.size(), [&](int i) {
+        auto* w = work[i];
+        if (i < paletteStart) {
+            w->second.Parse(em, fixedSettings[w->first.first], w->first.second);
+        } else {
+            w->second.Parse(em, colorPalettes[w->first.first], w->first.second);
+        }
+    }, 50);
+}
+
 int SequenceElements::LoadEffects(EffectLayer* effectLayer,
     const std::string& type,
     wxXmlNode* effectLayerNode,
+    const XsqEffectStore& effectStore,
     const std::vector<std::string>& effectStrings,
     const std::vector<std::string>& colorPalettes,
+    const ParsedEffectStrings& parsedSettings,
+    const ParsedEffectStrings& parsedPalettes,
     bool importing)
 {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
-    int loaded = 0;
-    for (wxXmlNode* effect = effectLayerNode->GetChildren(); effect != nullptr; effect = effect->GetNext()) {
-        if (effect->GetName() == STR_EFFECT) {
-            std::string effectName;
-            std::string settings;
-            int id = 0;
-            long palette = -1;
-
-            // Start time
-            double startTime;
-            effect->GetAttribute(STR_STARTTIME).ToDouble(&startTime);
-            startTime = TimeLine::RoundToMultipleOfPeriod(startTime, mFrequency);
-            // End time
-            double endTime;
-            effect->GetAttribute(STR_ENDTIME).ToDouble(&endTime);
-            endTime = TimeLine::RoundToMultipleOfPeriod(endTime, mFrequency);
-
-            if (startTime >= endTime) {
-                // effects should not have negative or zero duration ... if they do we drop them
-                logger_base.warn("Effect dropped as its start time was greater than or equal to its end time : '%s' : %s Layer %d Start %d End %d.", 
-                    (const char*)effect->GetAttribute(STR_NAME).c_str(), 
-                    (const char*)effectLayer->GetParentElement()->GetName().c_str(), 
-                    effectLayer->GetLayerNumber(), 
-                    (int)(startTime / 1000), 
-                    (int)(endTime / 1000));
-            } else
-            {
-                // Protected
-                bool bProtected = effect->GetAttribute(STR_PROTECTED) == '1' ? true : false;
-                if (type != STR_TIMING) {
-                    // Name
-                    effectName = effect->GetAttribute(STR_NAME);
-                    // ID
-                    id = wxAtoi(effect->GetAttribute(STR_ID, STR_ZERO));
-                    if (effect->GetAttribute(STR_REF) != STR_EMPTY) {
-                        int ref = wxAtoi(effect->GetAttribute(STR_REF));
-                        if (ref >= effectStrings.size()) {
-                            logger_base.warn("Effect string not found for effect %s between %d and %d. Settings ignored.", (const char*)effectName.c_str(), (int)startTime, (int)endTime);
-                            settings = "";
-                        } else {
-                            settings = effectStrings[ref];
-                        }
-                    } else {
-                        settings = ToStdString(effect->GetNodeContent());
-                    }
-
-                    if (settings.find("E_FILEPICKER_Pictures_Filename") != std::string::npos) {
-                        settings = FixEffectFileParameter("E_FILEPICKER_Pictures_Filename", settings, "");
-                    } else if (settings.find("E_FILEPICKER_Glediator_Filename") != std::string::npos) {
-                        settings = FixEffectFileParameter("E_FILEPICKER_Glediator_Filename", settings, "");
-                    }
-
-                    wxString tmp;
-                    if (effect->GetAttribute(STR_PALETTE, &tmp)) {
-                        tmp.ToLong(&palette);
+    auto loadEffect = [&](const LoadedEffect& effect) {
+        std::string effectName;
+        std::string settings;
+        int id = 0;
+        long palette = -1;
+        long ref = -1;
+
+        // Start time
+        double startTime;
+        effect.GetAttribute(STR_STARTTIME).ToDouble(&startTime);
+        startTime = TimeLine::RoundToMultipleOfPeriod(startTime, mFrequency);
+        // End time
+        double endTime;
+        effect.GetAttribute(STR_ENDTIME).ToDouble(&endTime);
+        endTime = TimeLine::RoundToMultipleOfPeriod(endTime, mFrequency);
+
+        if (startTime >= endTime) {
+            // effects should not have negative or zero duration ... if they do we drop them
+            logger_base.warn("Effect dropped as its start time was greater than or equal to its end time : '%s' : %s Layer %d Start %d End %d.", 
+                (const char*)effect.GetAttribute(STR_NAME).c_str(), 
+                (const char*)effectLayer->GetParentElement()->GetName().c_str(), 
+                effectLayer->GetLayerNumber(), 
+                (int)(startTime / 1000), 
+                (int)(endTime / 1000));
+        } else
+        {
+            // Protected
+            bool bProtected = effect.GetAttribute(STR_PROTECTED) == '1' ? true : false;
+            if (type != STR_TIMING) {
+                // Name
+                effectName = effect.GetAttribute(STR_NAME);
+                // ID
+                id = wxAtoi(effect.GetAttribute(STR_ID, STR_ZERO));
+                if (effect.GetAttribute(STR_REF) != STR_EMPTY) {
+                    ref = wxAtoi(effect.GetAttribute(STR_REF));
+                    if (ref >= (long)effectStrings.size()) {
+                        logger_base.warn("Effect string not found for effect %s between %d and %d. Settings ignored.", (const char*)effectName.c_str(), (int)startTime, (int)endTime);
+                        settings = "";
+                        ref = -1;
                     }
                 } else {
-                    // store timing labels in name attribute
-                    effectName = UnXmlSafe(effect->GetAttribute(STR_LABEL));
+                    settings = ToStdString(effect.GetNodeContent());
+                    if (HasEffectFiles(settings)) {
+                        settings = FixEffectFiles(settings);
+                        _inlineEffectFiles = true;
+                    }
                 }
-                std::string pal = STR_EMPTY;
-                if (palette != -1) {
-                    pal = colorPalettes[palette];
+
+                wxString tmp;
+                if (effect.GetAttribute(STR_PALETTE, &tmp)) {
+                    tmp.ToLong(&palette);
                 }
-                if (effectName != "Random") { // we dont load random effects ... they should not be there
+            } else {
+                // store timing labels in name attribute
+                effectName = UnXmlSafe(effect.GetAttribute(STR_LABEL));
+            }
+            std::string pal = STR_EMPTY;
+            if (palette != -1) {
+                pal = colorPalettes[palette];
+            }
+            if (effectName != "Random") { // we dont load random effects ... they should not be there
+                // use the shared pre-parsed settings/palette where we have them, sorting is done once the layer is loaded
+                std::string parsedName = LoadedEffectName(effectName, effectLayer->GetParentElement() != nullptr && effectLayer->GetParentElement()->GetType() == ElementType::ELEMENT_TYPE_MODEL);
+                static const SettingsMap emptyMap;
+                auto ps = ref == -1 ? parsedSettings.end() : parsedSettings.find(std::make_pair((int)ref, parsedName));
+                auto pp = palette == -1 ? parsedPalettes.end() : parsedPalettes.find(std::make_pair((int)palette, parsedName));
+                if (ref == -1 && palette == -1) {
                     effectLayer->AddEffect(id, effectName, settings, pal,
-                                           startTime, endTime, EFFECT_NOT_SELECTED, bProtected, false, importing);
+                                           startTime, endTime, EFFECT_NOT_SELECTED, bProtected, true, importing);
+                } else if ((ref == -1 || ps != parsedSettings.end()) && (palette == -1 || pp != parsedPalettes.end())) {
+                    SettingsMap inlineSettings;
+                    if (ref == -1) {
+                        inlineSettings.Parse(&GetEffectManager(), settings, parsedName);
+                    }
+                    effectLayer->AddEffect(id, effectName, ref == -1 ? inlineSettings : ps->second, palette == -1 ? emptyMap : pp->second,
+                                           startTime, endTime, EFFECT_NOT_SELECTED, bProtected, true, importing);
                 } else {
-                    logger_base.warn("Random effect not loaded on element %s layer %d (%0.02f-%0.02f)", (const char*)effectLayer->GetParentElement()->GetName().c_str(), effectLayer->GetLayerNumber(), startTime / 1000, endTime / 1000);
+                    if (ref != -1) {
+                        settings = FixEffectFiles(effectStrings[ref]);
+                    }
+                    effectLayer->AddEffect(id, effectName, settings, pal,
+                                           startTime, endTime, EFFECT_NOT_SELECTED, bProtected, true, importing);
                 }
+            } else {
+                logger_base.warn("Random effect not loaded on element %s layer %d (%0.02f-%0.02f)", (const char*)effectLayer->GetParentElement()->GetName().c_str(), effectLayer->GetLayerNumber(), startTime / 1000, endTime / 1000);
             }
         }
+    };
+
+    int loaded = 0;
+    const auto* stored = GetStoredEffects(effectStore, effectLayerNode);
+    if (stored != nullptr) {
+        for (const auto& effect : *stored) {
+            loadEffect(LoadedEffect(&effect));
+            loaded++;
+        }
+    }
+    for (wxXmlNode* effect = effectLayerNode->GetChildren(); effect != nullptr; effect = effect->GetNext()) {
+        if (effect->GetName() == STR_EFFECT) {
+            loadEffect(LoadedEffect(effect));
+        }
         else if (effect->GetName() == STR_NODE && effectLayerNode->GetName() == STR_STRAND) {
             StrandElement* se = (StrandElement*)effectLayer->GetParentElement();
             EffectLayer* neffectLayer = se->GetNodeLayer(wxAtoi(effect->GetAttribute(STR_INDEX)), true);
@@ -727,10 +932,11 @@ int SequenceElements::LoadEffects(EffectLayer* effectLayer,
                 ((NodeLayer*)neffectLayer)->SetName(effect->GetAttribute(STR_NAME).ToStdString());
             }
 
-            LoadEffects(neffectLayer, type, effect, effectStrings, colorPalettes);
+            LoadEffects(neffectLayer, type, effect, effectStore, effectStrings, colorPalettes, parsedSettings, parsedPalettes);
         }
         loaded++;
     }
+    effectLayer->SortEffects();
     return loaded;
 }
 
@@ -738,10 +944,16 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
 {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
+    // the load timings logged at the end are the benchmark for the shared settings parsing
+    wxStopWatch sw;
+    long parseMS = 0;
+    int effectsLoaded = 0;
+
     renderDependency.clear();
 
     mFilename = xml_file;
     wxXmlDocument& seqDocument = xml_file.GetXmlDocument();
+    const XsqEffectStore& effectStore = xml_file.GetEffectStore();
 
     wxXmlNode* root = seqDocument.GetRoot();
     std::vector<std::string> effectStrings;
@@ -750,6 +962,16 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
     Clear();
     TraceLog::AddTraceMessage("   Cleared");
     supportsModelBlending = xml_file.supportsModelBlending();
+    _inlineEffectFiles = false;
+
+    // only snapshot sequences read straight from their own xsq, not imports or backups
+    std::unique_ptr<SequenceSnapshot> snapshot;
+    bool snapshotRestored = false;
+    if (!importing && xframe != nullptr && xframe->IsSnapshotSequences() &&
+        xml_file.GetExt().Lower() == "xsq" && xml_file.GetLoadedFile() == xml_file.GetFullPath()) {
+        snapshot = std::make_unique<SequenceSnapshot>(xml_file.GetFullPath().ToStdString(), ShowDir.ToStdString(), (int)mFrequency);
+    }
+
     for (wxXmlNode* e = root->GetChildren(); e != nullptr; e = e->GetNext()) {
         TraceLog::PushTraceContext();
         TraceLog::AddTraceMessage("Processing " + e->GetName());
@@ -828,7 +1050,28 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
             }
         } else if (e->GetName() == "Jukebox") {
             xframe->LoadJukebox(e);
+        } else if (e->GetName() == "ElementEffects" && snapshot != nullptr && snapshot->Restore(*this, EffectFilesKey(effectStrings))) {
+            snapshotRestored = true;
+            for (wxXmlNode* elementNode = e->GetChildren(); elementNode != nullptr; elementNode = elementNode->GetNext()) {
+                if (elementNode->GetName() == STR_ELEMENT) {
+                    auto nm = elementNode->GetAttribute(STR_NAME).Trim(true).Trim(false);
+                    if (elementNode->GetAttribute(STR_NAME) != nm) {
+                        elementNode->DeleteAttribute(STR_NAME);
+                        elementNode->AddAttribute(STR_NAME, nm);
+                    }
+                }
+            }
         } else if (e->GetName() == "ElementEffects") {
+            // the loader leaves the model effects out when it expects the snapshot to supply them
+            if (xml_file.HasDeferredEffects() && !xml_file.LoadDeferredEffects()) {
+                logger_base.error("Unable to read the effects of %s.", (const char*)xml_file.GetFullPath().c_str());
+            }
+            ParsedEffectStrings parsedSettings;
+            ParsedEffectStrings parsedPalettes;
+            long parseStart = sw.Time();
+            ParseSharedEffectStrings(e, effectStore, effectStrings, colorPalettes, parsedSettings, parsedPalettes);
+            parseMS += sw.Time() - parseStart;
+
             int count = 0;
             for (wxXmlNode* elementNode = e->GetChildren(); elementNode != NULL; elementNode = elementNode->GetNext()) {
                 if (elementNode->GetName() == STR_ELEMENT) {
@@ -836,6 +1079,10 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
                         for (wxXmlNode* effect = effectLayerNode->GetChildren(); effect != nullptr; effect = effect->GetNext()) {
                             count++;
                         }
+                        const auto* stored = GetStoredEffects(effectStore, effectLayerNode);
+                        if (stored != nullptr) {
+                            count += (int)stored->size();
+                        }
                     }
                 }
             }
@@ -908,7 +1155,9 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
                                     }
                                 }
                                 if (effectLayer != nullptr) {
-                                    loaded += LoadEffects(effectLayer, elementNode->GetAttribute(STR_TYPE).ToStdString(), effectLayerNode, effectStrings, colorPalettes, importing);
+                                    int layerLoaded = LoadEffects(effectLayer, elementNode->GetAttribute(STR_TYPE).ToStdString(), effectLayerNode, effectStore, effectStrings, colorPalettes, parsedSettings, parsedPalettes, importing);
+                                    loaded += layerLoaded;
+                                    effectsLoaded += layerLoaded;
                                     if (count) {
                                         GetXLightsFrame()->SetStatusText(wxString::Format("Effects Loaded: %i%%.", loaded * 100 / count));
                                     }
@@ -932,7 +1181,21 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
         }
     }
 
-    logger_base.debug("Sequencer file loaded.");
+    if (snapshot != nullptr && !snapshotRestored) {
+        if (_inlineEffectFiles) {
+            // file names in settings that aren't in the EffectDB aren't covered by the key
+            logger_base.debug("Sequence not snapshotted as it has effect files outside the EffectDB.");
+        } else {
+            snapshot->Save(*this, EffectFilesKey(effectStrings));
+        }
+    }
+
+    if (snapshotRestored) {
+        logger_base.debug("Sequencer file loaded from its snapshot in %ldms.", sw.Time());
+    } else {
+        logger_base.debug("Sequencer file loaded: %d effects in %ldms, %ldms of it parsing %d shared settings strings and %d palettes.",
+                          effectsLoaded, sw.Time(), parseMS, (int)effectStrings.size(), (int)colorPalettes.size());
+    }
 
     return true;
 }
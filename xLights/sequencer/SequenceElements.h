@@ -14,6 +14,7 @@
 #include "Element.h"
 #include "wx/wx.h"
 #include <vector>
+#include <map>
 #include <set>
 #include <string>
 #include <mutex>
@@ -22,6 +23,7 @@
 #include "UndoManager.h"
 
 class xLightsXmlFile;  // forward declaration needed due to circular dependency
+class XsqEffectStore;
 class SequenceViewManager;
 class TimeLine;
 
@@ -210,11 +212,23 @@ public:
     xLightsFrame *GetXLightsFrame() const { return xframe; };
 protected:
 private:
+    // EffectDB settings and ColorPalettes entries parsed once per (table index, effect name) and
+    // then shared by every effect that references them
+    typedef std::map<std::pair<int, std::string>, SettingsMap> ParsedEffectStrings;
+    void ParseSharedEffectStrings(wxXmlNode* elementEffectsNode,
+        const XsqEffectStore& effectStore,
+        const std::vector<std::string>& effectStrings,
+        const std::vector<std::string>& colorPalettes,
+        ParsedEffectStrings& parsedSettings,
+        ParsedEffectStrings& parsedPalettes);
     int LoadEffects(EffectLayer *layer,
         const std::string &type,
         wxXmlNode *effectLayerNode,
+        const XsqEffectStore& effectStore,
         const std::vector<std::string> & effectStrings,
         const std::vector<std::string> & colorPalettes,
+        const ParsedEffectStrings& parsedSettings,
+        const ParsedEffectStrings& parsedPalettes,
         bool importing = false);
     static bool SortElementsByIndex(const Element *element1, const Element *element2)
     {
@@ -249,6 +263,7 @@ private:
     bool hasPapagayoTiming;
     int mSequenceEndMS;
     bool supportsModelBlending;
+    bool _inlineEffectFiles = false; // the load fixed file names in settings outside the EffectDB
 
     wxFileName mFilename;
 
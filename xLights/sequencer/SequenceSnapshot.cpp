@@ -0,0 +1,581 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <wx/file.h>
+#include <wx/filename.h>
+
+#include <cstring>
+#include <map>
+
+#include "SequenceSnapshot.h"
+#include "SequenceElements.h"
+#include "Effect.h"
+#include "EffectLayer.h"
+#include "Element.h"
+#include "../UtilClasses.h"
+#include "../xLightsMain.h"
+#include "../models/Model.h"
+#include "../xLightsVersion.h"
+
+#include <log4cpp/Category.hh>
+
+// bump this whenever the layout below changes
+#define SNAPSHOT_FORMAT_VERSION 2
+static const char SNAPSHOT_MAGIC[8] = { 'X', 'L', 'S', 'Q', 'S', 'N', 'A', 'P' };
+
+// Layout, all integers are 32 bit little endian
+//    magic, format version, key
+//    string table : count, { length, bytes }
+//    settings maps : count, { pair count, { key string, value string } }
+//    elements : count, { name string, fixed timing, layers, sub element count, { type, index, name string, layers, node count, { index, name string, layer } } }
+//    layers : count, { layer index, effect count, { id, name string, start, end, protected, settings map, palette map } }
+
+namespace
+{
+    struct SnapshotEffect
+    {
+        int id = 0;
+        uint32_t name = 0;
+        int startTimeMS = 0;
+        int endTimeMS = 0;
+        bool isProtected = false;
+        uint32_t settings = 0;
+        uint32_t palette = 0;
+    };
+
+    struct SnapshotLayer
+    {
+        int index = 0;
+        std::vector<SnapshotEffect> effects;
+    };
+
+    struct SnapshotNode
+    {
+        int index = 0;
+        uint32_t name = 0;
+        SnapshotLayer layer;
+    };
+
+    struct SnapshotSubElement
+    {
+        bool strand = false;
+        int index = 0;
+        uint32_t name = 0;
+        std::vector<SnapshotLayer> layers;
+        std::vector<SnapshotNode> nodes;
+    };
+
+    struct SnapshotElement
+    {
+        uint32_t name = 0;
+        int fixedTiming = 0;
+        std::vector<SnapshotLayer> layers;
+        std::vector<SnapshotSubElement> subElements;
+    };
+
+    class SnapshotWriter
+    {
+    public:
+        void Write32(std::vector<uint8_t>& buf, uint32_t v) const
+        {
+            buf.push_back(v & 0xFF);
+            buf.push_back((v >> 8) & 0xFF);
+            buf.push_back((v >> 16) & 0xFF);
+            buf.push_back((v >> 24) & 0xFF);
+        }
+        void WriteString(std::vector<uint8_t>& buf, const std::string& s) const
+        {
+            Write32(buf, s.size());
+            buf.insert(buf.end(), s.begin(), s.end());
+        }
+
+        uint32_t Intern(const std::string& s)
+        {
+            auto it = _stringIndex.find(s);
+            if (it != _stringIndex.end()) {
+                return it->second;
+            }
+            uint32_t idx = _strings.size();
+            _strings.push_back(s);
+            _stringIndex[s] = idx;
+            return idx;
+        }
+        uint32_t Intern(const SettingsMap& map)
+        {
+            std::vector<uint32_t> entry;
+            entry.reserve(map.size() * 2);
+            for (const auto& it : map) {
+                entry.push_back(Intern(it.first));
+                entry.push_back(Intern(it.second));
+            }
+            auto it = _mapIndex.find(entry);
+            if (it != _mapIndex.end()) {
+                return it->second;
+            }
+            uint32_t idx = _maps.size();
+            _maps.push_back(entry);
+            _mapIndex[entry] = idx;
+            return idx;
+        }
+
+        void WriteLayer(EffectLayer* layer, int index)
+        {
+            Write32(_body, index);
+            Write32(_body, layer->GetEffectCount());
+            for (int i = 0; i < layer->GetEffectCount(); ++i) {
+                Effect* e = layer->GetEffect(i);
+                Write32(_body, e->GetID());
+                Write32(_body, Intern(e->GetEffectName()));
+                Write32(_body, e->GetStartTimeMS());
+                Write32(_body, e->GetEndTimeMS());
+                Write32(_body, e->GetProtected() ? 1 : 0);
+                Write32(_body, Intern(e->GetSettings()));
+                Write32(_body, Intern(e->GetPaletteMap()));
+            }
+        }
+
+        std::vector<uint8_t>& Body() { return _body; }
+
+        std::vector<uint8_t> Finish(const std::string& key) const
+        {
+            std::vector<uint8_t> out;
+            out.insert(out.end(), SNAPSHOT_MAGIC, SNAPSHOT_MAGIC + sizeof(SNAPSHOT_MAGIC));
+            Write32(out, SNAPSHOT_FORMAT_VERSION);
+            WriteString(out, key);
+            Write32(out, _strings.size());
+            for (const auto& s : _strings) {
+                WriteString(out, s);
+            }
+            Write32(out, _maps.size());
+            for (const auto& m : _maps) {
+                Write32(out, m.size() / 2);
+                for (auto v : m) {
+                    Write32(out, v);
+                }
+            }
+            out.insert(out.end(), _body.begin(), _body.end());
+            return out;
+        }
+
+    private:
+        std::vector<std::string> _strings;
+        std::map<std::string, uint32_t> _stringIndex;
+        std::vector<std::vector<uint32_t>> _maps;
+        std::map<std::vector<uint32_t>, uint32_t> _mapIndex;
+        std::vector<uint8_t> _body;
+    };
+
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(const std::vector<uint8_t>& data) :
+            _pos(data.data()), _end(data.data() + data.size())
+        {}
+
+        bool IsOK() const { return _ok; }
+        void Fail() { _ok = false; }
+
+        uint32_t Read32()
+        {
+            if (!_ok || _end - _pos < 4) {
+                _ok = false;
+                return 0;
+            }
+            uint32_t v = (uint32_t)_pos[0] | ((uint32_t)_pos[1] << 8) | ((uint32_t)_pos[2] << 16) | ((uint32_t)_pos[3] << 24);
+            _pos += 4;
+            return v;
+        }
+        // reads a count, rejecting anything that could not possibly fit in the remaining data
+        uint32_t ReadCount(size_t minItemSize)
+        {
+            uint32_t c = Read32();
+            if (_ok && c > (size_t)(_end - _pos) / minItemSize) {
+                _ok = false;
+                return 0;
+            }
+            return c;
+        }
+        std::string ReadString()
+        {
+            uint32_t len = ReadCount(1);
+            if (!_ok) {
+                return "";
+            }
+            std::string s((const char*)_pos, len);
+            _pos += len;
+            return s;
+        }
+        bool ReadMagic()
+        {
+            if (_end - _pos < (int)sizeof(SNAPSHOT_MAGIC) || memcmp(_pos, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+                _ok = false;
+                return false;
+            }
+            _pos += sizeof(SNAPSHOT_MAGIC);
+            return true;
+        }
+        bool AtEnd() const { return _pos == _end; }
+
+        void ReadLayer(SnapshotLayer& layer, uint32_t strings, uint32_t maps)
+        {
+            layer.index = Read32();
+            uint32_t count = ReadCount(28);
+            layer.effects.resize(count);
+            for (auto& e : layer.effects) {
+                e.id = Read32();
+                e.name = Read32();
+                e.startTimeMS = Read32();
+                e.endTimeMS = Read32();
+                e.isProtected = Read32() != 0;
+                e.settings = Read32();
+                e.palette = Read32();
+                if (e.name >= strings || e.settings >= maps || e.palette >= maps) {
+                    _ok = false;
+                }
+            }
+        }
+
+    private:
+        const uint8_t* _pos;
+        const uint8_t* _end;
+        bool _ok = true;
+    };
+
+    void RestoreLayer(EffectLayer* layer, const SnapshotLayer& sl, const std::vector<std::string>& strings, const std::vector<SettingsMap>& maps)
+    {
+        for (const auto& e : sl.effects) {
+            layer->AddEffect(e.id, strings[e.name], maps[e.settings], maps[e.palette],
+                             e.startTimeMS, e.endTimeMS, EFFECT_NOT_SELECTED, e.isProtected, true);
+        }
+        layer->SortEffects();
+    }
+
+    // the xsq itself is only checked by size and modification time, hashing the whole file cost as much as parsing it
+    std::string FileKey(const std::string& sequenceFile)
+    {
+        wxFileName fn(sequenceFile);
+        if (!fn.FileExists()) {
+            return "";
+        }
+        return wxString::Format("%s|%s|%s",
+                                xlights_version_string,
+                                fn.GetSize().ToString(),
+                                fn.GetModificationTime().GetValue().ToString())
+            .ToStdString();
+    }
+
+    void HashString(uint64_t& hash, const std::string& s)
+    {
+        for (char c : s) {
+            hash ^= (uint8_t)c;
+            hash *= 1099511628211ULL;
+        }
+        hash ^= 0xFF; // separator so "ab","c" and "a","bc" differ
+        hash *= 1099511628211ULL;
+    }
+
+    void HashModel(uint64_t& hash, const Model* m)
+    {
+        HashString(hash, m->GetFullName());
+        for (const auto& s : m->GetBufferStyles()) {
+            HashString(hash, s);
+        }
+        for (const auto& sm : m->GetSubModels()) {
+            HashModel(hash, sm);
+        }
+    }
+
+    // Loading an effect adjusts its buffer style to one its model supports (Effect::FixBuffer) and the snapshot holds
+    // the adjusted settings, so it is only good for the layout it was made with.  This covers everything
+    // Model::AdjustBufferStyle looks at.
+    std::string LayoutKey(SequenceElements& elements)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const auto& it : elements.GetXLightsFrame()->AllModels) {
+            HashModel(hash, it.second);
+        }
+        return wxString::Format("%016llx", (unsigned long long)hash).ToStdString();
+    }
+}
+
+SequenceSnapshot::SequenceSnapshot(const std::string& sequenceFile, const std::string& showDir, int frequency) :
+    _sequenceFile(sequenceFile), _snapshotFile(GetSnapshotFile(sequenceFile))
+{
+    _key = BuildKey(showDir, frequency);
+}
+
+std::string SequenceSnapshot::GetSnapshotFile(const std::string& sequenceFile)
+{
+    wxFileName fn(sequenceFile);
+    fn.SetExt("xsqsnap");
+    return fn.GetFullPath().ToStdString();
+}
+
+std::string SequenceSnapshot::BuildKey(const std::string& showDir, int frequency) const
+{
+    std::string key = FileKey(_sequenceFile);
+    if (key.empty()) {
+        return "";
+    }
+    return key + wxString::Format("|%s|%d", showDir, frequency).ToStdString();
+}
+
+bool SequenceSnapshot::IsCurrent(const std::string& sequenceFile)
+{
+    std::string key = FileKey(sequenceFile);
+    wxFile f;
+    if (key.empty() || !wxFileName::FileExists(GetSnapshotFile(sequenceFile)) || !f.Open(GetSnapshotFile(sequenceFile))) {
+        return false;
+    }
+
+    // only the header is read, magic, format version, key length and enough of the key to cover the file part
+    std::vector<uint8_t> data(sizeof(SNAPSHOT_MAGIC) + 8 + key.size() + 1);
+    if (f.Read(data.data(), data.size()) != (ssize_t)data.size()) {
+        return false;
+    }
+    SnapshotReader reader(data);
+    if (!reader.ReadMagic() || reader.Read32() != SNAPSHOT_FORMAT_VERSION || reader.Read32() <= key.size()) {
+        return false;
+    }
+    key += "|";
+    return memcmp(data.data() + sizeof(SNAPSHOT_MAGIC) + 8, key.data(), key.size()) == 0;
+}
+
+bool SequenceSnapshot::Restore(SequenceElements& elements, const std::string& filesKey)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_key.empty() || !wxFileName::FileExists(_snapshotFile)) {
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    {
+        wxFile f;
+        if (!f.Open(_snapshotFile)) {
+            return false;
+        }
+        data.resize(f.Length());
+        if (f.Read(data.data(), data.size()) != (ssize_t)data.size()) {
+            return false;
+        }
+    }
+
+    SnapshotReader reader(data);
+    if (!reader.ReadMagic() || reader.Read32() != SNAPSHOT_FORMAT_VERSION || reader.ReadString() != _key + "|" + LayoutKey(elements) + "|" + filesKey) {
+        logger_base.debug("Sequence snapshot %s is stale, loading from xml.", (const char*)_snapshotFile.c_str());
+        return false;
+    }
+
+    std::vector<std::string> strings(reader.ReadCount(4));
+    for (auto& s : strings) {
+        s = reader.ReadString();
+    }
+    std::vector<SettingsMap> maps(reader.ReadCount(4));
+    for (auto& m : maps) {
+        uint32_t pairs = reader.ReadCount(8);
+        for (uint32_t i = 0; i < pairs && reader.IsOK(); ++i) {
+            uint32_t k = reader.Read32();
+            uint32_t v = reader.Read32();
+            if (k >= strings.size() || v >= strings.size()) {
+                reader.Fail();
+            } else {
+                m[strings[k]] = strings[v];
+            }
+        }
+    }
+
+    // decode everything before touching the sequence so a damaged file cannot leave it half loaded
+    std::vector<SnapshotElement> snapshotElements(reader.ReadCount(16));
+    for (auto& se : snapshotElements) {
+        se.name = reader.Read32();
+        se.fixedTiming = reader.Read32();
+        se.layers.resize(reader.ReadCount(8));
+        for (auto& l : se.layers) {
+            reader.ReadLayer(l, strings.size(), maps.size());
+        }
+        se.subElements.resize(reader.ReadCount(20));
+        for (auto& sub : se.subElements) {
+            sub.strand = reader.Read32() != 0;
+            sub.index = reader.Read32();
+            sub.name = reader.Read32();
+            sub.layers.resize(reader.ReadCount(8));
+            for (auto& l : sub.layers) {
+                reader.ReadLayer(l, strings.size(), maps.size());
+            }
+            sub.nodes.resize(reader.ReadCount(16));
+            for (auto& n : sub.nodes) {
+                n.index = reader.Read32();
+                n.name = reader.Read32();
+                reader.ReadLayer(n.layer, strings.size(), maps.size());
+                if (n.name >= strings.size()) {
+                    reader.Fail();
+                }
+            }
+            if (sub.name >= strings.size()) {
+                reader.Fail();
+            }
+        }
+        if (se.name >= strings.size()) {
+            reader.Fail();
+        }
+        if (!reader.IsOK()) {
+            break;
+        }
+    }
+    if (!reader.IsOK() || !reader.AtEnd()) {
+        logger_base.warn("Sequence snapshot %s is damaged, loading from xml.", (const char*)_snapshotFile.c_str());
+        return false;
+    }
+
+    for (const auto& se : snapshotElements) {
+        Element* element = elements.GetElement(strings[se.name]);
+        if (element == nullptr) {
+            wxASSERT(false);
+            continue;
+        }
+        if (se.fixedTiming > 0 && dynamic_cast<TimingElement*>(element) != nullptr) {
+            dynamic_cast<TimingElement*>(element)->SetFixedTiming(se.fixedTiming);
+        }
+        for (const auto& l : se.layers) {
+            RestoreLayer(element->AddEffectLayer(), l, strings, maps);
+        }
+        if (se.fixedTiming > 0 && element->GetEffectLayerCount() > 0) {
+            element->GetEffectLayer(0)->NumberEffects();
+        }
+
+        ModelElement* me = dynamic_cast<ModelElement*>(element);
+        if (me == nullptr) {
+            continue;
+        }
+        for (const auto& sub : se.subElements) {
+            SubModelElement* sme = nullptr;
+            if (sub.strand) {
+                StrandElement* strand = me->GetStrand(sub.index, true);
+                if (!strings[sub.name].empty()) {
+                    strand->SetName(strings[sub.name]);
+                }
+                for (const auto& n : sub.nodes) {
+                    NodeLayer* nl = strand->GetNodeLayer(n.index, true);
+                    if (!strings[n.name].empty()) {
+                        nl->SetName(strings[n.name]);
+                    }
+                    RestoreLayer(nl, n.layer, strings, maps);
+                }
+                sme = strand;
+            } else {
+                sme = me->GetSubModel(strings[sub.name], true);
+            }
+            for (const auto& l : sub.layers) {
+                while (l.index >= (int)sme->GetEffectLayerCount()) {
+                    sme->AddEffectLayer();
+                }
+                RestoreLayer(sme->GetEffectLayer(l.index), l, strings, maps);
+            }
+        }
+    }
+
+    logger_base.debug("Sequence effects restored from snapshot %s.", (const char*)_snapshotFile.c_str());
+    return true;
+}
+
+bool SequenceSnapshot::Save(SequenceElements& elements, const std::string& filesKey)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (_key.empty()) {
+        return false;
+    }
+
+    // the same elements, layers and node layers the xsq save writes
+    SnapshotWriter writer;
+    auto& body = writer.Body();
+    writer.Write32(body, elements.GetElementCount());
+    for (size_t x = 0; x < elements.GetElementCount(); ++x) {
+        Element* element = elements.GetElement(x);
+        TimingElement* te = dynamic_cast<TimingElement*>(element);
+        writer.Write32(body, writer.Intern(element->GetName()));
+        writer.Write32(body, te == nullptr ? 0 : te->GetFixedTiming());
+        writer.Write32(body, element->GetEffectLayerCount());
+        for (size_t l = 0; l < element->GetEffectLayerCount(); ++l) {
+            writer.WriteLayer(element->GetEffectLayer(l), l);
+        }
+
+        ModelElement* me = dynamic_cast<ModelElement*>(element);
+        std::vector<SubModelElement*> subs;
+        if (me != nullptr) {
+            for (int s = 0; s < me->GetSubModelAndStrandCount(); ++s) {
+                SubModelElement* sme = me->GetSubModel(s);
+                StrandElement* strand = dynamic_cast<StrandElement*>(sme);
+                bool used = false;
+                for (size_t l = 0; l < sme->GetEffectLayerCount() && !used; ++l) {
+                    used = sme->GetEffectLayer(l)->GetEffectCount() != 0;
+                }
+                for (int n = 0; strand != nullptr && n < strand->GetNodeLayerCount() && !used; ++n) {
+                    used = strand->GetNodeLayer(n)->GetEffectCount() != 0;
+                }
+                if (used) {
+                    subs.push_back(sme);
+                }
+            }
+        }
+        writer.Write32(body, subs.size());
+        for (const auto& sme : subs) {
+            StrandElement* strand = dynamic_cast<StrandElement*>(sme);
+            writer.Write32(body, strand == nullptr ? 0 : 1);
+            writer.Write32(body, strand == nullptr ? 0 : strand->GetStrand());
+            writer.Write32(body, writer.Intern(sme->GetName()));
+            std::vector<int> layers;
+            for (size_t l = 0; l < sme->GetEffectLayerCount(); ++l) {
+                if (sme->GetEffectLayer(l)->GetEffectCount() != 0) {
+                    layers.push_back(l);
+                }
+            }
+            writer.Write32(body, layers.size());
+            for (auto l : layers) {
+                writer.WriteLayer(sme->GetEffectLayer(l), l);
+            }
+            std::vector<int> nodes;
+            for (int n = 0; strand != nullptr && n < strand->GetNodeLayerCount(); ++n) {
+                if (strand->GetNodeLayer(n)->GetEffectCount() != 0) {
+                    nodes.push_back(n);
+                }
+            }
+            writer.Write32(body, nodes.size());
+            for (auto n : nodes) {
+                NodeLayer* nl = strand->GetNodeLayer(n);
+                writer.Write32(body, n);
+                writer.Write32(body, writer.Intern(nl->GetName()));
+                writer.WriteLayer(nl, 0);
+            }
+        }
+    }
+
+    std::vector<uint8_t> data = writer.Finish(_key + "|" + LayoutKey(elements) + "|" + filesKey);
+
+    // write to a temporary file first so a partially written snapshot is never picked up
+    std::string tmp = _snapshotFile + ".tmp";
+    {
+        wxFile f;
+        if (!f.Create(tmp, true) || f.Write(data.data(), data.size()) != data.size()) {
+            logger_base.warn("Unable to write sequence snapshot %s.", (const char*)tmp.c_str());
+            f.Close();
+            wxRemoveFile(tmp);
+            return false;
+        }
+    }
+    if (!wxRenameFile(tmp, _snapshotFile, true)) {
+        logger_base.warn("Unable to write sequence snapshot %s.", (const char*)_snapshotFile.c_str());
+        wxRemoveFile(tmp);
+        return false;
+    }
+    logger_base.debug("Sequence snapshot %s written, %d bytes.", (const char*)_snapshotFile.c_str(), (int)data.size());
+    return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class SequenceElements;
+class EffectLayer;
+
+// Binary sidecar file holding the effect layers of a sequence as they were built from the xsq ElementEffects.
+//
+// The snapshot is keyed on the xsq size and modification time as well as the xLights version, show folder, sequence
+// frequency, the buffer styles each model in the layout supports and where the picture and glediator files the effects
+// refer to were found. When all of these still match the effect layers can be rebuilt directly from the already parsed
+// settings and palettes rather than walking the effect xml and parsing every settings string.
+// Anything that does not match simply means the snapshot is ignored and rewritten after the normal load.
+class SequenceSnapshot
+{
+public:
+    SequenceSnapshot(const std::string& sequenceFile, const std::string& showDir, int frequency);
+    virtual ~SequenceSnapshot() {}
+
+    // Rebuilds the effect layers of elements already created from DisplayElements, returns false if the snapshot is
+    // missing or stale in which case nothing has been changed. filesKey is the caller's record of how the effect file
+    // names resolved against what is on disk now (SequenceElements::EffectFilesKey).
+    bool Restore(SequenceElements& elements, const std::string& filesKey);
+    bool Save(SequenceElements& elements, const std::string& filesKey);
+
+    static std::string GetSnapshotFile(const std::string& sequenceFile);
+
+    // Reads just the snapshot header to see if it was made from the xsq as it is now, so the loader can skip the
+    // model effects before the document is built. Restore still checks the rest of the key.
+    static bool IsCurrent(const std::string& sequenceFile);
+
+private:
+    std::string _sequenceFile;
+    std::string _snapshotFile;
+    std::string _key;
+
+    std::string BuildKey(const std::string& showDir, int frequency) const;
+};
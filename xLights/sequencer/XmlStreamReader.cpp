@@ -0,0 +1,245 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "XmlStreamReader.h"
+
+#include <cstdlib>
+#include <cstring>
+
+static void AppendUTF8(std::string& out, unsigned long c)
+{
+    if (c < 0x80) {
+        out += (char)c;
+    } else if (c < 0x800) {
+        out += (char)(0xC0 | (c >> 6));
+        out += (char)(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+        out += (char)(0xE0 | (c >> 12));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    } else {
+        out += (char)(0xF0 | (c >> 18));
+        out += (char)(0x80 | ((c >> 12) & 0x3F));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    }
+}
+
+void XmlStreamReader::Decode(std::string_view in, std::string& out, bool attribute)
+{
+    out.clear();
+    out.reserve(in.size());
+    for (size_t i = 0; i < in.size(); i++) {
+        char c = in[i];
+        if (c == '&') {
+            size_t semi = in.find(';', i);
+            if (semi != std::string_view::npos) {
+                std::string_view ent = in.substr(i + 1, semi - i - 1);
+                bool known = true;
+                if (ent == "lt") {
+                    out += '<';
+                } else if (ent == "gt") {
+                    out += '>';
+                } else if (ent == "amp") {
+                    out += '&';
+                } else if (ent == "quot") {
+                    out += '"';
+                } else if (ent == "apos") {
+                    out += '\'';
+                } else if (ent.size() > 1 && ent[0] == '#') {
+                    std::string num(ent.substr(1));
+                    unsigned long v = (num[0] == 'x' || num[0] == 'X') ? strtoul(num.c_str() + 1, nullptr, 16) : strtoul(num.c_str(), nullptr, 10);
+                    AppendUTF8(out, v);
+                } else {
+                    known = false;
+                }
+                if (known) {
+                    i = semi;
+                    continue;
+                }
+            }
+            out += c;
+        } else if (c == '\r') {
+            // \r\n and lone \r both become \n, attributes then turn it into a space like any other whitespace
+            if (i + 1 < in.size() && in[i + 1] == '\n') {
+                i++;
+            }
+            out += attribute ? ' ' : '\n';
+        } else if (attribute && (c == '\n' || c == '\t')) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+}
+
+static bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool IsNameEnd(char c)
+{
+    return IsSpace(c) || c == '/' || c == '>' || c == '=';
+}
+
+bool XmlStreamReader::Parse(std::string_view xml, Handler& handler, std::string& error)
+{
+    std::vector<std::string_view> open;
+    std::vector<Attribute> attributes;
+    std::string text;
+    size_t pos = 0;
+    size_t len = xml.size();
+
+    auto fail = [&](const char* msg) {
+        error = std::string(msg) + " at offset " + std::to_string(pos);
+        return false;
+    };
+
+    // skip a utf8 bom
+    if (len >= 3 && (unsigned char)xml[0] == 0xEF && (unsigned char)xml[1] == 0xBB && (unsigned char)xml[2] == 0xBF) {
+        pos = 3;
+    }
+
+    while (pos < len) {
+        if (xml[pos] != '<') {
+            size_t next = xml.find('<', pos);
+            if (next == std::string_view::npos) {
+                next = len;
+            }
+            if (!open.empty()) {
+                Decode(xml.substr(pos, next - pos), text, false);
+                handler.Text(text);
+            }
+            pos = next;
+            continue;
+        }
+        if (xml.compare(pos, 4, "<!--") == 0) {
+            size_t end = xml.find("-->", pos + 4);
+            if (end == std::string_view::npos) {
+                return fail("Unterminated comment");
+            }
+            pos = end + 3;
+        } else if (xml.compare(pos, 9, "<![CDATA[") == 0) {
+            size_t end = xml.find("]]>", pos + 9);
+            if (end == std::string_view::npos) {
+                return fail("Unterminated CDATA");
+            }
+            text.assign(xml.substr(pos + 9, end - pos - 9));
+            handler.Text(text);
+            pos = end + 3;
+        } else if (xml.compare(pos, 2, "<?") == 0) {
+            size_t end = xml.find("?>", pos + 2);
+            if (end == std::string_view::npos) {
+                return fail("Unterminated processing instruction");
+            }
+            pos = end + 2;
+        } else if (xml.compare(pos, 2, "<!") == 0) {
+            size_t end = xml.find('>', pos + 2);
+            if (end == std::string_view::npos) {
+                return fail("Unterminated declaration");
+            }
+            pos = end + 1;
+        } else if (xml.compare(pos, 2, "</") == 0) {
+            size_t start = pos;
+            size_t nameStart = pos + 2;
+            size_t end = xml.find('>', nameStart);
+            if (end == std::string_view::npos) {
+                return fail("Unterminated end tag");
+            }
+            size_t nameEnd = nameStart;
+            while (nameEnd < end && !IsSpace(xml[nameEnd])) {
+                nameEnd++;
+            }
+            std::string_view name = xml.substr(nameStart, nameEnd - nameStart);
+            if (open.empty() || open.back() != name) {
+                return fail("Mismatched end tag");
+            }
+            open.pop_back();
+            pos = end + 1;
+            handler.EndElement(name, start, pos);
+        } else {
+            size_t start = pos;
+            size_t p = pos + 1;
+            while (p < len && !IsNameEnd(xml[p])) {
+                p++;
+            }
+            std::string_view name = xml.substr(pos + 1, p - pos - 1);
+            if (name.empty()) {
+                return fail("Missing element name");
+            }
+            attributes.clear();
+            bool empty = false;
+            for (;;) {
+                while (p < len && IsSpace(xml[p])) {
+                    p++;
+                }
+                if (p >= len) {
+                    pos = p;
+                    return fail("Unterminated start tag");
+                }
+                if (xml[p] == '>') {
+                    p++;
+                    break;
+                }
+                if (xml[p] == '/') {
+                    if (p + 1 >= len || xml[p + 1] != '>') {
+                        pos = p;
+                        return fail("Bad empty element");
+                    }
+                    empty = true;
+                    p += 2;
+                    break;
+                }
+                size_t attrStart = p;
+                while (p < len && !IsNameEnd(xml[p])) {
+                    p++;
+                }
+                std::string_view attrName = xml.substr(attrStart, p - attrStart);
+                while (p < len && IsSpace(xml[p])) {
+                    p++;
+                }
+                if (attrName.empty() || p >= len || xml[p] != '=') {
+                    pos = p;
+                    return fail("Bad attribute");
+                }
+                p++;
+                while (p < len && IsSpace(xml[p])) {
+                    p++;
+                }
+                if (p >= len || (xml[p] != '"' && xml[p] != '\'')) {
+                    pos = p;
+                    return fail("Unquoted attribute");
+                }
+                char quote = xml[p];
+                size_t valueEnd = xml.find(quote, p + 1);
+                if (valueEnd == std::string_view::npos) {
+                    pos = p;
+                    return fail("Unterminated attribute");
+                }
+                attributes.emplace_back();
+                attributes.back().name = attrName;
+                Decode(xml.substr(p + 1, valueEnd - p - 1), attributes.back().value, true);
+                p = valueEnd + 1;
+            }
+            pos = p;
+            handler.StartElement(name, attributes, start, pos);
+            if (empty) {
+                handler.EndElement(name, pos, pos);
+            } else {
+                open.push_back(name);
+            }
+        }
+    }
+    if (!open.empty()) {
+        return fail("Unclosed element");
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Minimal streaming xml reader for the files xLights writes itself. It walks the text once and hands each start tag,
+// end tag and piece of text to a handler along with where it sits in the text, nothing is kept once the handler
+// returns. Entities are decoded and line endings in text are normalised the same way the wx/expat loader does.
+// Doctypes, comments and processing instructions are skipped.
+class XmlStreamReader
+{
+public:
+    struct Attribute {
+        std::string_view name;
+        std::string value;
+    };
+
+    class Handler
+    {
+    public:
+        virtual ~Handler() {}
+        // start is the offset of the '<', tagEnd is just past the '>'
+        virtual void StartElement(std::string_view name, const std::vector<Attribute>& attributes, size_t start, size_t tagEnd) = 0;
+        // for an empty element start and end are both the end of its start tag
+        virtual void EndElement(std::string_view name, size_t start, size_t end) = 0;
+        virtual void Text(const std::string& text) {}
+    };
+
+    // returns false and sets error if the xml is not well formed
+    static bool Parse(std::string_view xml, Handler& handler, std::string& error);
+
+    static void Decode(std::string_view in, std::string& out, bool attribute);
+};
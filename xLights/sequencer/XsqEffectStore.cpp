@@ -0,0 +1,319 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "XsqEffectStore.h"
+#include "XmlStreamReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+const std::string* XsqEffectStore::Effect::GetAttribute(std::string_view name) const
+{
+    for (const auto& it : attributes) {
+        if (*it.first == name) {
+            return it.second;
+        }
+    }
+    return nullptr;
+}
+
+const std::string* XsqEffectStore::Intern(const std::string& s)
+{
+    return &*_strings.insert(s).first;
+}
+
+const std::vector<XsqEffectStore::Effect>* XsqEffectStore::GetLayer(int index) const
+{
+    if (index < 0 || index >= (int)_layers.size()) {
+        return nullptr;
+    }
+    return &_layers[index];
+}
+
+size_t XsqEffectStore::GetEffectCount() const
+{
+    size_t count = 0;
+    for (const auto& l : _layers) {
+        count += l.size();
+    }
+    return count;
+}
+
+void XsqEffectStore::Clear()
+{
+    _layers.clear();
+    _layers.shrink_to_fit();
+    _strings.clear();
+}
+
+namespace
+{
+    struct Edit {
+        size_t start;
+        size_t end;
+        std::string insert;
+    };
+
+    class StripHandler : public XmlStreamReader::Handler
+    {
+    public:
+        StripHandler(std::vector<std::vector<XsqEffectStore::Effect>>& layers, std::function<const std::string*(const std::string&)> intern, bool keepEffects) :
+            _layers(layers), _intern(intern), _keepEffects(keepEffects)
+        {
+        }
+
+        void StartElement(std::string_view name, const std::vector<XmlStreamReader::Attribute>& attributes, size_t start, size_t tagEnd) override
+        {
+            int depth = (int)_stack.size();
+            if (depth == 0) {
+                _isXsq = name == "xsequence";
+                for (const auto& a : attributes) {
+                    if (a.name == "FixedPointTiming") {
+                        _fixedPoint = true;
+                    }
+                }
+            } else if (depth == 1 && name == "CompressedData") {
+                _compressed = true;
+            }
+
+            bool inModel = _stack.size() >= 3 && _stack[1].name == "ElementEffects" && _stack[2].name == "Element" && _stack[2].model;
+            if (inModel && name == "Effect" && _stack.size() >= 4) {
+                Frame& parent = _stack.back();
+                if (parent.layer == -1) {
+                    parent.layer = (int)_layers.size();
+                    _layers.emplace_back();
+                    // the '>' of the parent start tag, the parent can't be empty as it has this effect in it
+                    _edits.push_back({ parent.tagEnd - 1, parent.tagEnd - 1, std::string(" ") + XsqEffectStore::LAYER_ATTRIBUTE + "=\"" + std::to_string(parent.layer) + "\"" });
+                }
+                if (_keepEffects) {
+                    XsqEffectStore::Effect effect;
+                    effect.attributes.reserve(attributes.size());
+                    for (const auto& a : attributes) {
+                        _scratch.assign(a.name);
+                        effect.attributes.emplace_back(_intern(_scratch), _intern(a.value));
+                    }
+                    _layers[parent.layer].push_back(std::move(effect));
+                }
+                _effectStart = start;
+                _effectText.clear();
+                _inEffect = true;
+            }
+
+            Frame f;
+            f.name = name;
+            f.tagEnd = tagEnd;
+            if (depth == 2 && _stack[1].name == "ElementEffects" && name == "Element") {
+                f.model = true;
+                for (const auto& a : attributes) {
+                    if (a.name == "type" && a.value == "timing") {
+                        f.model = false;
+                    }
+                }
+            }
+            _stack.push_back(f);
+        }
+
+        void EndElement(std::string_view name, size_t start, size_t end) override
+        {
+            if (_inEffect && name == "Effect") {
+                if (_keepEffects && !_effectText.empty()) {
+                    _layers[_stack[_stack.size() - 2].layer].back().content = _intern(_effectText);
+                }
+                _edits.push_back({ _effectStart, end, std::string() });
+                _inEffect = false;
+            }
+            _stack.pop_back();
+        }
+
+        void Text(const std::string& text) override
+        {
+            if (_inEffect && _keepEffects) {
+                _effectText += text;
+            }
+        }
+
+        bool IsUsable() const
+        {
+            return _isXsq && _fixedPoint && !_compressed;
+        }
+
+        std::vector<Edit>& GetEdits() { return _edits; }
+
+    private:
+        struct Frame {
+            std::string_view name;
+            size_t tagEnd = 0;
+            bool model = false;
+            int layer = -1;
+        };
+
+        std::vector<std::vector<XsqEffectStore::Effect>>& _layers;
+        std::function<const std::string*(const std::string&)> _intern;
+        std::vector<Frame> _stack;
+        std::vector<Edit> _edits;
+        std::string _scratch;
+        std::string _effectText;
+        size_t _effectStart = 0;
+        bool _keepEffects = true;
+        bool _inEffect = false;
+        bool _isXsq = false;
+        bool _fixedPoint = false;
+        bool _compressed = false;
+    };
+}
+
+bool XsqEffectStore::Strip(std::string_view xml, std::string& slim, bool keepEffects)
+{
+    Clear();
+    StripHandler handler(_layers, [this](const std::string& s) { return Intern(s); }, keepEffects);
+    std::string error;
+    if (!XmlStreamReader::Parse(xml, handler, error) || !handler.IsUsable()) {
+        Clear();
+        return false;
+    }
+
+    // a strand's attribute insert can be found after the effects of its nodes, so put the edits back in text order
+    auto& edits = handler.GetEdits();
+    std::stable_sort(edits.begin(), edits.end(), [](const Edit& a, const Edit& b) { return a.start < b.start; });
+    slim.clear();
+    slim.reserve(xml.size() / 4);
+    size_t pos = 0;
+    for (const auto& e : edits) {
+        size_t start = e.start;
+        if (e.insert.empty()) {
+            // take the indent in front of a removed effect with it
+            while (start > pos && (xml[start - 1] == ' ' || xml[start - 1] == '\t' || xml[start - 1] == '\n' || xml[start - 1] == '\r')) {
+                start--;
+            }
+        }
+        slim.append(xml.substr(pos, start - pos));
+        slim.append(e.insert);
+        pos = e.end;
+    }
+    slim.append(xml.substr(pos));
+    return true;
+}
+
+static void Encode(const std::string& in, std::string& out, bool attribute)
+{
+    for (char c : in) {
+        switch (c) {
+        case '<':
+            out += "&lt;";
+            break;
+        case '>':
+            out += "&gt;";
+            break;
+        case '&':
+            out += "&amp;";
+            break;
+        case '"':
+            if (attribute) {
+                out += "&quot;";
+            } else {
+                out += c;
+            }
+            break;
+        case '\n':
+            if (attribute) {
+                out += "&#10;";
+            } else {
+                out += c;
+            }
+            break;
+        default:
+            out += c;
+            break;
+        }
+    }
+}
+
+namespace
+{
+    class RestoreHandler : public XmlStreamReader::Handler
+    {
+    public:
+        RestoreHandler(const XsqEffectStore& store, std::string_view slim, std::string& xml) :
+            _store(store), _slim(slim), _xml(xml)
+        {
+        }
+
+        void StartElement(std::string_view name, const std::vector<XmlStreamReader::Attribute>& attributes, size_t start, size_t tagEnd) override
+        {
+            int layer = -1;
+            size_t attrPos = std::string_view::npos;
+            for (const auto& a : attributes) {
+                if (a.name == XsqEffectStore::LAYER_ATTRIBUTE) {
+                    layer = std::atoi(a.value.c_str());
+                    // the attribute Strip added is always the last thing in the tag
+                    attrPos = _slim.rfind(std::string(" ") + XsqEffectStore::LAYER_ATTRIBUTE + "=", tagEnd);
+                }
+            }
+            if (layer == -1) {
+                return;
+            }
+            const auto* effects = _store.GetLayer(layer);
+            if (effects == nullptr || attrPos == std::string_view::npos || attrPos < start) {
+                _ok = false;
+                return;
+            }
+            _xml.append(_slim.substr(_pos, attrPos - _pos));
+            _xml += '>';
+            for (const auto& e : *effects) {
+                _xml += "<Effect";
+                for (const auto& a : e.attributes) {
+                    _xml += ' ';
+                    _xml += *a.first;
+                    _xml += "=\"";
+                    Encode(*a.second, _xml, true);
+                    _xml += '"';
+                }
+                if (e.content == nullptr) {
+                    _xml += "/>";
+                } else {
+                    _xml += '>';
+                    Encode(*e.content, _xml, false);
+                    _xml += "</Effect>";
+                }
+            }
+            _pos = tagEnd;
+        }
+
+        void EndElement(std::string_view name, size_t start, size_t end) override {}
+
+        void Finish()
+        {
+            _xml.append(_slim.substr(_pos));
+        }
+
+        bool IsOK() const { return _ok; }
+
+    private:
+        const XsqEffectStore& _store;
+        std::string_view _slim;
+        std::string& _xml;
+        size_t _pos = 0;
+        bool _ok = true;
+    };
+}
+
+bool XsqEffectStore::Restore(std::string_view slim, std::string& xml) const
+{
+    xml.clear();
+    xml.reserve(slim.size() * 4);
+    RestoreHandler handler(*this, slim, xml);
+    std::string error;
+    if (!XmlStreamReader::Parse(slim, handler, error) || !handler.IsOK()) {
+        return false;
+    }
+    handler.Finish();
+    return true;
+}
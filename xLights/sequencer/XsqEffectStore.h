@@ -0,0 +1,59 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Effects of the model elements in an xsq, read with the streaming reader instead of being built into the xml document.
+//
+// Strip takes the xsq text and hands back the same text without the model Effect nodes. Each layer node that lost its
+// effects gets an xlfx attribute holding the index of its effects here, so the document built from the slimmed text
+// keeps every element, layer, strand and node but none of the effects which are the bulk of a big sequence. Every
+// attribute name, value and settings string is interned so the thousands of effects sharing names, times and refs
+// only hold pointers. Timing elements are left alone as the rest of xLightsXmlFile edits them in the document.
+class XsqEffectStore
+{
+public:
+    struct Effect {
+        std::vector<std::pair<const std::string*, const std::string*>> attributes;
+        const std::string* content = nullptr;
+
+        const std::string* GetAttribute(std::string_view name) const;
+    };
+
+    static constexpr const char* LAYER_ATTRIBUTE = "xlfx";
+
+    // returns false, leaving the store empty, if the text is not an xsq this can handle (compressed, not fixed point
+    // timing or not well formed) in which case the caller should load the whole document as before.
+    // With keepEffects false the effects are dropped rather than stored, for when a snapshot is going to supply them,
+    // the slimmed text comes out the same either way so a later Strip of the same file can fill the store in.
+    bool Strip(std::string_view xml, std::string& slim, bool keepEffects = true);
+
+    // puts the effects back into slimmed text, the reverse of Strip
+    bool Restore(std::string_view slim, std::string& xml) const;
+
+    const std::vector<Effect>* GetLayer(int index) const;
+    size_t GetLayerCount() const { return _layers.size(); }
+    size_t GetEffectCount() const;
+    size_t GetStringCount() const { return _strings.size(); }
+    bool IsEmpty() const { return _layers.empty(); }
+    void Clear();
+
+private:
+    const std::string* Intern(const std::string& s);
+
+    std::vector<std::vector<Effect>> _layers;
+    std::unordered_set<std::string> _strings;
+};
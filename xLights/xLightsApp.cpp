@@ -482,6 +482,7 @@ bool xLightsApp::OnInit()
     {
         { wxCMD_LINE_SWITCH, "h", "help", "displays help on the command line parameters", wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
         { wxCMD_LINE_SWITCH, "r", "render", "render files and exit"},
+        { wxCMD_LINE_OPTION, "t", "threads", "number of cpus to size the render threads for", wxCMD_LINE_VAL_NUMBER },
         { wxCMD_LINE_SWITCH, "cs", "checksequence", "run check sequence and exit" },
         { wxCMD_LINE_OPTION, "m", "media", "specify media directory"},
         { wxCMD_LINE_OPTION, "s", "show", "specify show directory" },
@@ -585,6 +586,10 @@ bool xLightsApp::OnInit()
             ab = 2;
         }
 
+        if (parser.Found("t", &renderCPUs)) {
+            logger_base.info("-t: Render threads sized for %d cpus.", (int)renderCPUs);
+        }
+
         if (parser.Found("m", &mediaDir)) {
             logger_base.info("-m: Media directory set to %s.", (const char *)mediaDir.c_str());
             info += _("Setting media directory to ") + mediaDir + "\n";
@@ -634,7 +639,10 @@ bool xLightsApp::OnInit()
         if (Frame->CurrentDir == "") {
             logger_base.info("Show directory not set");
         }
-    	Frame->Show();
+        // a render only run never needs the window so leave it hidden
+        if (!renderOnlyMode) {
+            Frame->Show();
+        }
     	SetTopWindow(Frame);
     }
     //*)
@@ -690,3 +698,4 @@ bool xLightsApp::ProcessIdle() {
 wxString xLightsApp::mediaDir;
 wxString xLightsApp::showDir;
 wxArrayString xLightsApp::sequenceFiles;
+long xLightsApp::renderCPUs = 0;
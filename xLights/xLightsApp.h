@@ -36,6 +36,7 @@ public:
     static wxString showDir;
     static wxString mediaDir;
     static wxArrayString sequenceFiles;
+    static long renderCPUs;
     static xLightsFrame* __frame;
 
     #ifdef __WXOSX__
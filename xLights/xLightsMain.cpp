@@ -69,6 +69,7 @@
 #include "ModelPreview.h"
 #include "ModelRemap.h"
 #include "MultiControllerUploadDialog.h"
+#include "OffscreenPreviewRenderer.h"
 #include "Parallel.h"
 #include "PathGenerationDialog.h"
 #include "PixelTestDialog.h"
@@ -100,6 +101,8 @@
 #include "effects/FacesEffect.h"
 #include "effects/RenderableEffect.h"
 #include "effects/ShaderEffect.h"
+#include "CheckSequenceCache.h"
+#include "effects/SharedImageCache.h"
 #include "effects/StateEffect.h"
 #include "graphics/opengl/xlGLCanvas.h"
 #include "models/ModelGroup.h"
@@ -1537,6 +1540,12 @@ xLightsFrame::xLightsFrame(wxWindow* parent, int ab, wxWindowID id, bool renderO
     config->Read("xLightsLowDefinitionRender", &_lowDefinitionRender, false);
     logger_base.debug("Low Defintion Render: %s.", toStr(_lowDefinitionRender));
 
+    config->Read("xLightsSnapshotSequences", &_snapshotSequences, false);
+    logger_base.debug("Snapshot Sequences: %s.", toStr(_snapshotSequences));
+
+    config->Read("xLightsParallelFrameRender", &_parallelFrameRender, false);
+    logger_base.debug("Parallel Frame Render: %s.", toStr(_parallelFrameRender));
+
     config->Read("xLightsSnapToTimingMarks", &_snapToTimingMarks, false);
     logger_base.debug("Snap To Timing Marks: %s.", toStr(_snapToTimingMarks));
 
@@ -1921,8 +1930,10 @@ xLightsFrame::xLightsFrame(wxWindow* parent, int ab, wxWindowID id, bool renderO
         // if we have over 12GB of memory, creating more threads shouldn't be an issue
         multiplier *= 2;
     }
-    int threadCount = wxThread::GetCPUCount() * multiplier;
-    if (threadCount < 20) {
+    // batch renders running side by side are each handed their share of the cpus with -t
+    int cpus = xLightsApp::renderCPUs > 0 ? (int)xLightsApp::renderCPUs : wxThread::GetCPUCount();
+    int threadCount = cpus * multiplier;
+    if (threadCount < 20 && xLightsApp::renderCPUs <= 0) {
         threadCount = 20;
     }
     jobPool.Start(threadCount);
@@ -2107,6 +2118,8 @@ xLightsFrame::~xLightsFrame()
     config->Write("xLightsHidePresetPreview", _hidePresetPreview);
     config->Write("xLightsModelBlendDefaultOff", _modelBlendDefaultOff);
     config->Write("xLightsLowDefinitionRender", _lowDefinitionRender);
+    config->Write("xLightsSnapshotSequences", _snapshotSequences);
+    config->Write("xLightsParallelFrameRender", _parallelFrameRender);
     config->Write("xLightsTimelineZooming", _timelineZooming);
     config->Write("xLightsSnapToTimingMarks", _snapToTimingMarks);
     config->Write("xLightsFSEQVersion", _fseqVersion);
@@ -3296,7 +3309,7 @@ void xLightsFrame::OnMenuItem_File_Export_VideoSelected(wxCommandEvent& event)
     ExportVideoPreview(pExportDlg.GetPath());
 }
 
-bool xLightsFrame::ExportVideoPreview(wxString const& path)
+bool xLightsFrame::ExportVideoPreview(wxString const& path, bool offscreen)
 {
     int frameCount = _seqData.NumFrames();
 
@@ -3307,8 +3320,9 @@ bool xLightsFrame::ExportVideoPreview(wxString const& path)
     // Ensure all pending work is done before we do anything
     DoAllWork();
 
+    // the offscreen renderer only needs the layout, not a visible preview window
     wxAuiPaneInfo& pi = m_mgr->GetPane("HousePreview");
-    bool visible = pi.IsShown();
+    bool visible = pi.IsShown() || offscreen;
     if (!visible) {
         pi.Show();
         m_mgr->Update();
@@ -3334,6 +3348,25 @@ bool xLightsFrame::ExportVideoPreview(wxString const& path)
     contentScaleFactor = 1.;
 #endif // WIN32
 
+    std::unique_ptr<OffscreenPreviewRenderer> offscreenRenderer;
+    if (offscreen) {
+        // render at the layout's own resolution, padded to even dimensions for the encoder
+        int virtualWidth = 0;
+        int virtualHeight = 0;
+        housePreview->GetVirtualCanvasSize(virtualWidth, virtualHeight);
+        if (virtualWidth > 0 && virtualHeight > 0) {
+            width = virtualWidth;
+            height = virtualHeight;
+        }
+        width += width % 2;
+        height += height % 2;
+        contentScaleFactor = 1.;
+        offscreenRenderer = std::make_unique<OffscreenPreviewRenderer>(width, height, virtualWidth, virtualHeight, GetDisplay2DCenter0());
+        offscreenRenderer->SetBackground(housePreview->GetBackgroundImage().ToStdString(), housePreview->GetScaleBackgroundImage(),
+                                         housePreview->GetBackgroundBrightness(), housePreview->GetBackgroundAlpha());
+        offscreenRenderer->Prepare(housePreview->GetModels());
+    }
+
     int audioChannelCount = 0;
     int audioSampleRate = 0;
     AudioManager* audioMgr = CurrentSeqXmlFile->GetMedia();
@@ -3374,7 +3407,21 @@ bool xLightsFrame::ExportVideoPreview(wxString const& path)
             housePreview->Render(frameIndex * this->_seqData.FrameTime(), data, false);
             return housePreview->getFrameForExport(width * contentScaleFactor, height * contentScaleFactor, f, buf, bufSize);
         };
-        videoExporter.setGetVideoCallback(videoLambda);
+        auto offscreenLambda = [=, &offscreenRenderer](AVFrame* f, uint8_t* buf, int bufSize, unsigned frameIndex) {
+            if (bufSize < width * height * 3) {
+                return false;
+            }
+            const SequenceData::FrameData& frameData(this->_seqData[frameIndex]);
+            offscreenRenderer->Render(frameData[0], buf);
+            return true;
+        };
+        if (offscreenRenderer) {
+            // the offscreen renderer fills RGB24 which is converted, it has no VideoToolbox image to hand over
+            videoExporter.setSoftwareEncoder(true);
+            videoExporter.setGetVideoCallback(offscreenLambda);
+        } else {
+            videoExporter.setGetVideoCallback(videoLambda);
+        }
 
         exportStatus = videoExporter.Export(_appProgress.get());
     } catch (const std::runtime_error& re) {
@@ -6225,6 +6272,7 @@ std::string xLightsFrame::CheckSequence(bool displayInEditor, bool writeToFile)
         std::list<std::pair<std::string, std::string>> states;
         std::list<std::string> viewPoints;
         bool usesShader = false;
+        CheckAllEffectSettings();
         for (size_t i = 0; i < _sequenceElements.GetElementCount(MASTER_VIEW); i++) {
             Element* e = _sequenceElements.GetElement(i);
             if (e->GetType() != ElementType::ELEMENT_TYPE_TIMING) {
@@ -6257,6 +6305,7 @@ std::string xLightsFrame::CheckSequence(bool displayInEditor, bool writeToFile)
                 }
             }
         }
+        _checkEffectSettings.clear();
 
 #ifndef __WXOSX__
         if (usesShader) {
@@ -6530,8 +6579,14 @@ void xLightsFrame::CheckEffect(Effect* ef, wxFile& f, size_t& errcount, size_t&
             warncount++;
         }
 
-        bool renderCache = _enableRenderCache == "Enabled" || (_enableRenderCache == "Locked Only" && ef->IsLocked());
-        std::list<std::string> warnings = re->CheckEffectSettings(sm, CurrentSeqXmlFile->GetMedia(), AllModels.GetModel(modelName), ef, renderCache);
+        std::list<std::string> warnings;
+        auto checked = _checkEffectSettings.find(ef);
+        if (checked != _checkEffectSettings.end()) {
+            warnings = checked->second;
+        } else {
+            bool renderCache = _enableRenderCache == "Enabled" || (_enableRenderCache == "Locked Only" && ef->IsLocked());
+            warnings = re->CheckEffectSettings(sm, CurrentSeqXmlFile->GetMedia(), AllModels.GetModel(modelName), ef, renderCache);
+        }
         for (const auto& s : warnings) {
             LogAndWrite(f, s);
             if (s.find("WARN:") != std::string::npos) {
@@ -6583,6 +6638,108 @@ void xLightsFrame::CheckEffect(Effect* ef, wxFile& f, size_t& errcount, size_t&
     }
 }
 
+// CheckEffectSettings is where the slow checks are (files, images, videos) so it is run for every effect up front
+// across the job pool. Effects that haven't changed since the last check get what it found then. CheckEffect reports
+// the results in sequence order so the log reads as it always has.
+void xLightsFrame::CheckAllEffectSettings()
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    struct EffectCheck
+    {
+        Effect* effect;
+        std::string modelName;
+        std::list<std::string> result;
+    };
+    std::vector<EffectCheck> checks;
+    auto addLayers = [&checks](Element* e, const std::string& modelName) {
+        for (const auto& el : e->GetEffectLayers()) {
+            for (const auto& ef : el->GetEffects()) {
+                if (ef->GetEffectIndex() >= 0 && ef->GetEffectName() != "Random") {
+                    checks.push_back({ ef, modelName, {} });
+                }
+            }
+        }
+    };
+
+    // anything an effect's checks can look at other than its own settings and files
+    AudioManager* media = CurrentSeqXmlFile->GetMedia();
+    std::string context = std::to_string(modelsChangeCount) + "|" + std::to_string(CurrentSeqXmlFile->GetFrameMS()) + "|" + (media == nullptr ? "" : media->FileName());
+
+    // the check options effects look at, read here as the effects can't get at wxConfig from the pool
+    static const std::vector<std::string> effectOptions = { "SketchImage" };
+    std::map<std::string, bool> disabledOptions;
+    for (const auto& option : effectOptions) {
+        disabledOptions[option] = IsCheckSequenceOptionDisabled(option);
+        context += "|" + option + ":" + (disabledOptions[option] ? "1" : "0");
+    }
+
+    for (size_t i = 0; i < _sequenceElements.GetElementCount(MASTER_VIEW); i++) {
+        Element* e = _sequenceElements.GetElement(i);
+        if (e->GetType() == ElementType::ELEMENT_TYPE_TIMING) {
+            context += "|" + e->GetName() + ":" + std::to_string(e->getChangeCount()) + ":" + std::to_string(e->GetEffectLayerCount());
+            continue;
+        }
+        addLayers(e, e->GetName());
+        if (e->GetType() == ElementType::ELEMENT_TYPE_MODEL) {
+            ModelElement* me = dynamic_cast<ModelElement*>(e);
+            for (size_t j = 0; j < me->GetStrandCount(); ++j) {
+                StrandElement* se = me->GetStrand(j);
+                addLayers(se, e->GetName());
+                for (size_t k = 0; k < se->GetNodeLayerCount(); ++k) {
+                    for (const auto& ef : se->GetNodeLayer(k)->GetEffects()) {
+                        if (ef->GetEffectIndex() >= 0) {
+                            checks.push_back({ ef, e->GetName(), {} });
+                        }
+                    }
+                }
+            }
+            for (size_t j = 0; j < me->GetSubModelAndStrandCount(); ++j) {
+                Element* sme = me->GetSubModel(j);
+                if (sme->GetType() == ElementType::ELEMENT_TYPE_SUBMODEL) {
+                    addLayers(sme, e->GetName());
+                }
+            }
+        }
+    }
+
+    CheckSequenceCache& cache = CheckSequenceCache::Instance();
+    cache.StartCheck(CurrentDir.ToStdString(), context);
+    for (const auto& it : disabledOptions) {
+        cache.SetOptionDisabled(it.first, it.second);
+    }
+
+    std::atomic_int reused(0);
+    parallel_for(0, checks.size(), [&](int i) {
+        EffectCheck& check = checks[i];
+        Effect* ef = check.effect;
+        RenderableEffect* re = effectManager[ef->GetEffectIndex()];
+        Model* model = AllModels.GetModel(check.modelName);
+        bool renderCache = _enableRenderCache == "Enabled" || (_enableRenderCache == "Locked Only" && ef->IsLocked());
+
+        if (re->CheckEffectSettingsUsesOtherEffects()) {
+            check.result = re->CheckEffectSettings(ef->GetSettings(), media, model, ef, renderCache);
+            return;
+        }
+
+        std::string signature = ef->GetEffectName() + "|" + check.modelName + "|" + std::to_string(ef->GetStartTimeMS()) + "|" + std::to_string(ef->GetEndTimeMS()) + "|" +
+                                (renderCache ? "1" : "0") + "|" + ef->GetSettingsAsString() + "|" + ef->GetPaletteAsString();
+        std::list<std::string> files = re->GetFileReferences(model, ef->GetSettings());
+        if (cache.GetEffectResult(signature, files, check.result)) {
+            reused++;
+            return;
+        }
+        check.result = re->CheckEffectSettings(ef->GetSettings(), media, model, ef, renderCache);
+        cache.SetEffectResult(signature, files, check.result);
+    });
+
+    logger_base.debug("CheckSequence: checked settings on %d effects, %d were unchanged since the last check.", (int)checks.size(), (int)reused);
+
+    for (auto& check : checks) {
+        _checkEffectSettings[check.effect] = std::move(check.result);
+    }
+}
+
 void xLightsFrame::CheckElement(Element* e, wxFile& f, size_t& errcount, size_t& warncount, const std::string& name, const std::string& modelName,
                                 bool& videoCacheWarning, bool& disabledEffects, std::list<std::pair<std::string, std::string>>& faces,
                                 std::list<std::pair<std::string, std::string>>& states, std::list<std::string>& viewPoints, bool& usesShader,
@@ -9073,6 +9230,9 @@ void xLightsFrame::OnMenuItemUserDictSelected(wxCommandEvent& event)
 void xLightsFrame::OnMenuItem_PurgeRenderCacheSelected(wxCommandEvent& event)
 {
     _renderCache.Purge(&_sequenceElements, true);
+    _renderCheckpoints.Purge();
+    SharedImageCache::Instance().Purge();
+    CheckSequenceCache::Instance().Purge();
 }
 
 void xLightsFrame::SetEnableRenderCache(const wxString& t)
@@ -79,6 +79,8 @@
 #include "xLightsXmlFile.h"
 #include "sequencer/EffectsGrid.h"
 #include "RenderCache.h"
+#include "RenderCheckpoints.h"
+#include "RenderTaskGraph.h"
 #include "outputs/ZCPP.h"
 #include "OutputModelManager.h"
 #include "models/Model.h"
@@ -324,6 +326,8 @@ public:
     int TxOverflowTotal = 0;
     std::mutex saveLock;
     RenderCache _renderCache;
+    RenderCheckpointStore _renderCheckpoints;
+    std::map<const Effect*, std::list<std::string>> _checkEffectSettings; // CheckEffectSettings results while a check sequence runs
     std::atomic_bool _exiting;
     #ifdef __WXMSW__
     // windows has issues if we create it later
@@ -409,7 +413,7 @@ public:
     void PopTraceContext();
     void AddTraceMessage(const std::string &msg);
     void ClearTraceMessages();
-    bool ExportVideoPreview(wxString const& path);
+    bool ExportVideoPreview(wxString const& path, bool offscreen = false);
 
 	void SetAudioControls();
     void ImportXLights(const wxFileName &filename, std::string const& mapFile = std::string());
@@ -1087,7 +1091,18 @@ public:
     bool _smallWaveform = false;
     bool _modelBlendDefaultOff = true;
     bool _lowDefinitionRender = false;
+    bool _snapshotSequences = false;
+    bool _parallelFrameRender = false;
     bool _saveLowDefinitionRender = false; // saves the value of the low definition render during batch render when it may be temporarily overridden
+    struct BatchRenderTiming {
+        std::string sequence;
+        float loadSecs = 0.0f;
+        float renderSecs = 0.0f;
+        float writeSecs = 0.0f;
+    };
+    std::vector<BatchRenderTiming> _batchRenderTimings;     // per sequence timings of the batch render in progress
+    std::vector<BatchRenderTiming> _lastBatchRenderTimings; // per sequence timings of the last completed batch render
+    std::vector<RenderTaskTiming> _lastRenderTaskTimings;   // per task timings of the last completed render
     bool _snapToTimingMarks = true;
     bool _autoSavePerspecive = true;
     bool _ignoreVendorModelRecommendations = false;
@@ -1244,6 +1259,22 @@ public:
     {
         return _lowDefinitionRender;
     }
+    void SetSnapshotSequences(bool b)
+    {
+        _snapshotSequences = b;
+    }
+    bool IsSnapshotSequences() const
+    {
+        return _snapshotSequences;
+    }
+    void SetParallelFrameRender(bool b)
+    {
+        _parallelFrameRender = b;
+    }
+    bool IsParallelFrameRender() const
+    {
+        return _parallelFrameRender;
+    }
     const wxString &EnableRenderCache() const { return _enableRenderCache; }
     void SetEnableRenderCache(const wxString &t);
     void SetRenderCacheMaximumSizeMB(size_t maxSizeMB);
@@ -1464,6 +1495,7 @@ public:
     std::string GetSelectedLayoutPanelPreview() const;
     void UpdateRenderStatus();
     void LogRenderStatus();
+    void SaveRenderTaskTimings(RenderTaskGraph* graph);
     bool RenderEffectFromMap(bool suppress, Effect *effect, int layer, int period, SettingsMap& SettingsMap,
                              PixelBufferClass &buffer, bool &ResetEffectState,
                              bool bgThread = false, RenderEvent *event = nullptr);
@@ -1531,6 +1563,8 @@ protected:
     static constexpr int RENDER_ALREADY_RETRIED = 2;
     void OpenRenderAndSaveSequencesF(const wxArrayString &filenames, int flags);
     void OpenRenderAndSaveSequences(const wxArrayString& filenames, bool exitOnDone, bool alreadyRetried = false);
+    const std::vector<BatchRenderTiming>& GetLastBatchRenderTimings() const { return _lastBatchRenderTimings; }
+    const std::vector<RenderTaskTiming>& GetLastRenderTaskTimings() const { return _lastRenderTaskTimings; }
     void OpenAndCheckSequence(const wxArrayString& origFilenames, bool exitOnDone);
     std::string OpenAndCheckSequence(const std::string& origFilenames);
     void AddAllModelsToSequence();
@@ -1815,6 +1849,7 @@ private:
     bool CleanupSequenceFileLocations();
     void CheckElement(Element* e, wxFile& f, size_t& errcount, size_t& warncount, const std::string& name, const std::string& modelName, bool& videoCacheWarning, bool& disabledEffects, std::list<std::pair<std::string, std::string>>& faces, std::list<std::pair<std::string, std::string>>& states, std::list<std::string>& viewPoints, bool& usesShader, std::list<std::string>& allfiles);
     void CheckEffect(Effect* ef, wxFile& f, size_t& errcount, size_t& warncount, const std::string& name, const std::string& modelName, bool node, bool& videoCacheWarning, bool& disabledEffects, std::list<std::pair<std::string, std::string>>& faces, std::list<std::pair<std::string, std::string>>& states, std::list<std::string>& viewPoints);
+    void CheckAllEffectSettings();
     bool CheckStart(wxFile& f, const std::string& startmodel, std::list<std::string>& seen, std::string& nextmodel);
     void ValidateWindow();
     void DoDonate();
@@ -30,6 +30,7 @@
 #include "xLightsVersion.h"
 #include "UtilFunctions.h"
 #include "sequencer/TimeLine.h"
+#include "sequencer/SequenceSnapshot.h"
 #include "Vixen3.h"
 #include "ExternalHooks.h"
 
@@ -1048,6 +1049,72 @@ void xLightsXmlFile::ConvertToFixedPointTiming()
     }
 }
 
+// Model effects are most of a big sequence so they are read with the streaming reader into the effect store and
+// the document is only built from what is left. Anything the store can't take is loaded whole as before.
+// When the snapshot is current the effects aren't even stored, the snapshot has them already built.
+bool xLightsXmlFile::LoadDocument(const wxString& filename)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    effectStore.Clear();
+    deferred_effects = false;
+    if (!NeedsTimesCorrected()) {
+        bool defer = filename == GetFullPath() && GetExt().Lower() == "xsq" && SequenceSnapshot::IsCurrent(filename.ToStdString());
+        std::string slim;
+        {
+            wxFile f;
+            std::string xml;
+            if (f.Open(filename)) {
+                xml.resize(f.Length());
+                if (xml.empty() || f.Read(&xml[0], xml.size()) != (ssize_t)xml.size() || !effectStore.Strip(xml, slim, !defer)) {
+                    slim.clear();
+                }
+            }
+        }
+        if (!effectStore.IsEmpty()) {
+            wxMemoryInputStream in(slim.data(), slim.size());
+            if (seqDocument.Load(in)) {
+                if (defer) {
+                    deferred_effects = true;
+                    deferred_slim_size = slim.size();
+                    logger_base.debug("LoadSequence: model effects left to the sequence snapshot.");
+                } else {
+                    logger_base.debug("LoadSequence: %d effects read by the streaming loader, %d distinct strings.",
+                                      (int)effectStore.GetEffectCount(), (int)effectStore.GetStringCount());
+                }
+                return true;
+            }
+            effectStore.Clear();
+        }
+    }
+    return seqDocument.Load(filename);
+}
+
+bool xLightsXmlFile::LoadDeferredEffects()
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!deferred_effects) {
+        return true;
+    }
+    deferred_effects = false;
+
+    // the document already has the xlfx indexes so only the store is wanted, the slimmed text is the same as before
+    // unless the file changed underneath us
+    std::string xml;
+    std::string slim;
+    wxFile f;
+    if (f.Open(loaded_file)) {
+        xml.resize(f.Length());
+        if (!xml.empty() && f.Read(&xml[0], xml.size()) == (ssize_t)xml.size() && effectStore.Strip(xml, slim) && slim.size() == deferred_slim_size) {
+            logger_base.debug("LoadSequence: snapshot not used, %d effects read by the streaming loader.", (int)effectStore.GetEffectCount());
+            return true;
+        }
+    }
+    effectStore.Clear();
+    return false;
+}
+
 bool xLightsXmlFile::LoadSequence(const wxString& ShowDir, bool ignore_audio, const wxFileName &realFilename)
 {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -1057,11 +1124,12 @@ bool xLightsXmlFile::LoadSequence(const wxString& ShowDir, bool ignore_audio, co
         logger_base.info("LoadSequence: Loading sequence " + GetFullPath());
     }
 
-    if (!seqDocument.Load(realFilename.GetFullPath())) {
+    if (!LoadDocument(realFilename.GetFullPath())) {
         logger_base.error("LoadSequence: XML file load failed.");
         return false;
     }
     is_open = true;
+    loaded_file = realFilename.GetFullPath();
 
     wxXmlNode* root = seqDocument.GetRoot();
     for (wxXmlNode* e = root->GetChildren(); e != nullptr; e = e->GetNext()) {
@@ -2674,6 +2742,9 @@ void xLightsXmlFile::Save(SequenceElements& seq_elements)
     wxXmlNode* data_layer = AddChildXmlNode(root, "DataLayers");
     wxXmlNode* display_node = AddChildXmlNode(root, "DisplayElements");
     wxXmlNode* elements_node = AddChildXmlNode(root, "ElementEffects");
+    // the effects are all written back into the document below
+    effectStore.Clear();
+    deferred_effects = false;
     wxXmlNode* last_view_node = AddChildXmlNode(root, "lastView");
     wxXmlNode* timing_tags_node = AddChildXmlNode(root, "TimingTags");
 
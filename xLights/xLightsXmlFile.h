@@ -13,6 +13,7 @@
 #include <wx/filename.h>
 #include <wx/xml/xml.h>
 #include "sequencer/SequenceElements.h"
+#include "sequencer/XsqEffectStore.h"
 #include "DataLayer.h"
 #include "AudioManager.h"
 #include "Vixen3.h"
@@ -54,6 +55,18 @@ public:
     {
         return seqDocument;
     }
+    // model effects the streaming loader kept out of the document, see XsqEffectStore
+    const XsqEffectStore& GetEffectStore() const
+    {
+        return effectStore;
+    }
+    // true when the model effects were left out of both the document and the store as the sequence snapshot was
+    // current, if the snapshot can't be used after all LoadDeferredEffects reads them in
+    bool HasDeferredEffects() const
+    {
+        return deferred_effects;
+    }
+    bool LoadDeferredEffects();
     DataLayerSet& GetDataLayers()
     {
         return mDataLayers;
@@ -151,6 +164,11 @@ public:
     {
         return is_open;
     }
+    // the file the xml was actually read from, differs from the sequence path when opening a backup
+    const wxString& GetLoadedFile() const
+    {
+        return loaded_file;
+    }
     bool HasAudioMedia() const
     {
         return audio != nullptr;
@@ -197,6 +215,7 @@ public:
 
 private:
     wxXmlDocument seqDocument;
+    XsqEffectStore effectStore;
     wxArrayString models;
     std::array<wxString, (int)HEADER_INFO_TYPES::NUM_TYPES> header_info;
     wxArrayString timing_list;
@@ -207,7 +226,10 @@ private:
     wxString seq_timing;
     wxString image_dir;
     bool supports_model_blending = false;
+    bool deferred_effects = false;
+    size_t deferred_slim_size = 0;
     bool is_open = false;
+    wxString loaded_file;
     bool was_converted = false;
     bool sequence_loaded = false; // flag to indicate the sequencer has been loaded with this xml data
     DataLayerSet mDataLayers;
@@ -215,6 +237,7 @@ private:
 
     void CreateNew();
     bool LoadSequence(const wxString& ShowDir, bool ignore_audio, const wxFileName &realFilename);
+    bool LoadDocument(const wxString& filename);
     bool LoadV3Sequence();
     bool Save();
     bool SaveCopy() const;
@@ -11,19 +11,51 @@
 
 #include "Blend.h"
 
-//#define SIMD
+#include <algorithm>
+#include <cstring>
+
+// SSE2 is always there on x64 and NEON on arm64 so neither needs a runtime check. Everything else uses the
+// plain loops which also finish off whatever is left over after the last full vector.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLEND_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define BLEND_NEON
+#include <arm_neon.h>
+#endif
 
-#ifdef SIMD
-#include "emmintrin.h"
-#define ALIGNMENT (128 / 8)
+#ifdef BLEND_SSE2
+#define BLEND_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define BLEND_STORE(p, v) _mm_storeu_si128((__m128i*)(p), v)
 
-int GetMisalignedBytes(uint8_t* b1, uint8_t* b2)
+// Sets every byte of a pixel to 0xFF where all three channels of the pixel are zero for the 16 pixels at p.
+// Pixels don't line up with the 16 byte registers so the zero flags are anded with the two bytes before them,
+// leaving the answer in the last byte of each pixel, which is then copied back over the first two.
+static inline void BlackPixelMask(const uint8_t* p, __m128i& m0, __m128i& m1, __m128i& m2)
 {
-    int m1 = (size_t)b1 % ALIGNMENT;
-    int m2 = (size_t)b2 % ALIGNMENT;
-
-    if (m1 == m2) return m1;
-    return -1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i last0 = _mm_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m128i last1 = _mm_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    const __m128i last2 = _mm_setr_epi8(-1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1);
+
+    __m128i z0 = _mm_cmpeq_epi8(BLEND_LOAD(p), zero);
+    __m128i z1 = _mm_cmpeq_epi8(BLEND_LOAD(p + 16), zero);
+    __m128i z2 = _mm_cmpeq_epi8(BLEND_LOAD(p + 32), zero);
+
+    __m128i t0 = _mm_and_si128(z0, _mm_and_si128(_mm_slli_si128(z0, 1), _mm_slli_si128(z0, 2)));
+    __m128i t1 = _mm_and_si128(z1, _mm_and_si128(_mm_or_si128(_mm_slli_si128(z1, 1), _mm_srli_si128(z0, 15)),
+                                                  _mm_or_si128(_mm_slli_si128(z1, 2), _mm_srli_si128(z0, 14))));
+    __m128i t2 = _mm_and_si128(z2, _mm_and_si128(_mm_or_si128(_mm_slli_si128(z2, 1), _mm_srli_si128(z1, 15)),
+                                                  _mm_or_si128(_mm_slli_si128(z2, 2), _mm_srli_si128(z1, 14))));
+    t0 = _mm_and_si128(t0, last0);
+    t1 = _mm_and_si128(t1, last1);
+    t2 = _mm_and_si128(t2, last2);
+
+    m0 = _mm_or_si128(t0, _mm_or_si128(_mm_or_si128(_mm_srli_si128(t0, 1), _mm_slli_si128(t1, 15)),
+                                       _mm_or_si128(_mm_srli_si128(t0, 2), _mm_slli_si128(t1, 14))));
+    m1 = _mm_or_si128(t1, _mm_or_si128(_mm_or_si128(_mm_srli_si128(t1, 1), _mm_slli_si128(t2, 15)),
+                                       _mm_or_si128(_mm_srli_si128(t1, 2), _mm_slli_si128(t2, 14))));
+    m2 = _mm_or_si128(t2, _mm_or_si128(_mm_srli_si128(t2, 1), _mm_srli_si128(t2, 2)));
 }
 #endif
 
@@ -160,118 +192,79 @@ void Overwrite(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 
 void OverwriteIfZero(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(buffer + i) == 0x00)
-            {
-                *(buffer + i) = *(blendBuffer + i);
-            }
-        }
-
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(b, zero); // sets FF where B is zero
-            __m128i newv = _mm_and_si128(mask, bb); // grab bb where B has zero
-            __m128i r = _mm_or_si128(b, newv); // merge them
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(buffer + offset) == 0)
-            {
-                *(buffer + offset) = *(blendBuffer + offset);
-            }
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= channels; i += 16) {
+        __m128i b = BLEND_LOAD(buffer + i);
+        __m128i bb = BLEND_LOAD(blendBuffer + i);
+        BLEND_STORE(buffer + i, _mm_or_si128(b, _mm_and_si128(_mm_cmpeq_epi8(b, zero), bb)));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        uint8x16_t b = vld1q_u8(buffer + i);
+        uint8x16_t bb = vld1q_u8(blendBuffer + i);
+        vst1q_u8(buffer + i, vbslq_u8(vceqq_u8(b, vdupq_n_u8(0)), bb, b));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            if (*(buffer + i) == 0x00)
-            {
-                *(buffer + i) = *(blendBuffer + i);
-            }
+    for (; i < channels; ++i) {
+        if (buffer[i] == 0x00) {
+            buffer[i] = blendBuffer[i];
         }
     }
 }
 
 void Mask(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(blendBuffer + i) > 0)
-            {
-                *(buffer + i) = 0x00;
-            }
-        }
-
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
-
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
-            __m128i r = _mm_and_si128(mask, b); // and the mask
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(blendBuffer + offset) > 0)
-            {
-                *(buffer + offset) = 0x00;
-            }
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= channels; i += 16) {
+        __m128i b = BLEND_LOAD(buffer + i);
+        __m128i bb = BLEND_LOAD(blendBuffer + i);
+        BLEND_STORE(buffer + i, _mm_and_si128(_mm_cmpeq_epi8(bb, zero), b));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        uint8x16_t b = vld1q_u8(buffer + i);
+        uint8x16_t bb = vld1q_u8(blendBuffer + i);
+        vst1q_u8(buffer + i, vandq_u8(vceqq_u8(bb, vdupq_n_u8(0)), b));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            if (*(blendBuffer + i) > 0)
-            {
-                *(buffer + i) = 0x00;
-            }
+    for (; i < channels; ++i) {
+        if (blendBuffer[i] > 0) {
+            buffer[i] = 0x00;
         }
     }
 }
 
 void MaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
-    {
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8_t* p = buffer + i * 3;
+        __m128i m0, m1, m2;
+        BlackPixelMask(blendBuffer + i * 3, m0, m1, m2);
+        BLEND_STORE(p, _mm_and_si128(m0, BLEND_LOAD(p)));
+        BLEND_STORE(p + 16, _mm_and_si128(m1, BLEND_LOAD(p + 16)));
+        BLEND_STORE(p + 32, _mm_and_si128(m2, BLEND_LOAD(p + 32)));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8x16x3_t b = vld3q_u8(buffer + i * 3);
+        uint8x16x3_t bb = vld3q_u8(blendBuffer + i * 3);
+        uint8x16_t black = vceqq_u8(vorrq_u8(vorrq_u8(bb.val[0], bb.val[1]), bb.val[2]), vdupq_n_u8(0));
+        b.val[0] = vandq_u8(black, b.val[0]);
+        b.val[1] = vandq_u8(black, b.val[1]);
+        b.val[2] = vandq_u8(black, b.val[2]);
+        vst3q_u8(buffer + i * 3, b);
+    }
+#endif
+    for (; i < pixels; ++i) {
         uint8_t* p = blendBuffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
-        if (sum > 0)
-        {
+        if (sum > 0) {
             uint8_t* pp = buffer + i * 3;
             *pp = 0x00;
             *(pp + 1) = 0x00;
@@ -282,64 +275,55 @@ void MaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 
 void Unmask(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            if (*(blendBuffer + i) == 0)
-            {
-                *(buffer + i) = 0x00;
-            }
-        }
-
-        __m128i zero = _mm_setr_epi32(0, 0, 0, 0);
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i mask = _mm_cmpeq_epi8(bb, zero); // sets FF where BB is zero
-            __m128i r = _mm_andnot_si128(mask, b); // invert the mask and then and it
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = misaligned + i + simd * ALIGNMENT;
-            if (*(blendBuffer + offset) == 0)
-            {
-                *(buffer + offset) = 0x00;
-            }
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= channels; i += 16) {
+        __m128i b = BLEND_LOAD(buffer + i);
+        __m128i bb = BLEND_LOAD(blendBuffer + i);
+        BLEND_STORE(buffer + i, _mm_andnot_si128(_mm_cmpeq_epi8(bb, zero), b));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        uint8x16_t b = vld1q_u8(buffer + i);
+        uint8x16_t bb = vld1q_u8(blendBuffer + i);
+        vst1q_u8(buffer + i, vbicq_u8(b, vceqq_u8(bb, vdupq_n_u8(0))));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            if (*(blendBuffer + i) == 0)
-            {
-                *(buffer + i) = 0x00;
-            }
+    for (; i < channels; ++i) {
+        if (blendBuffer[i] == 0) {
+            buffer[i] = 0x00;
         }
     }
 }
 
 void UnmaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
-    {
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8_t* p = buffer + i * 3;
+        __m128i m0, m1, m2;
+        BlackPixelMask(blendBuffer + i * 3, m0, m1, m2);
+        BLEND_STORE(p, _mm_andnot_si128(m0, BLEND_LOAD(p)));
+        BLEND_STORE(p + 16, _mm_andnot_si128(m1, BLEND_LOAD(p + 16)));
+        BLEND_STORE(p + 32, _mm_andnot_si128(m2, BLEND_LOAD(p + 32)));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8x16x3_t b = vld3q_u8(buffer + i * 3);
+        uint8x16x3_t bb = vld3q_u8(blendBuffer + i * 3);
+        uint8x16_t black = vceqq_u8(vorrq_u8(vorrq_u8(bb.val[0], bb.val[1]), bb.val[2]), vdupq_n_u8(0));
+        b.val[0] = vbicq_u8(b.val[0], black);
+        b.val[1] = vbicq_u8(b.val[1], black);
+        b.val[2] = vbicq_u8(b.val[2], black);
+        vst3q_u8(buffer + i * 3, b);
+    }
+#endif
+    for (; i < pixels; ++i) {
         uint8_t* p = blendBuffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
-        if (sum == 0)
-        {
+        if (sum == 0) {
             uint8_t* pp = buffer + i * 3;
             *pp = 0x00;
             *(pp + 1) = 0x00;
@@ -350,137 +334,89 @@ void UnmaskPixel(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 
 void Average(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = (uint8_t)(((int)*(buffer + i) + (int)*(blendBuffer + i)) / 2);
-        }
-
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_avg_epu8(b, bb);
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = (uint8_t)(((int)*(buffer + offset) + (int)*(blendBuffer + offset)) / 2);
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    // _mm_avg_epu8 rounds up, take off the odd bit to match the integer divide below
+    const __m128i one = _mm_set1_epi8(1);
+    for (; i + 16 <= channels; i += 16) {
+        __m128i b = BLEND_LOAD(buffer + i);
+        __m128i bb = BLEND_LOAD(blendBuffer + i);
+        __m128i r = _mm_sub_epi8(_mm_avg_epu8(b, bb), _mm_and_si128(_mm_xor_si128(b, bb), one));
+        BLEND_STORE(buffer + i, r);
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        vst1q_u8(buffer + i, vhaddq_u8(vld1q_u8(buffer + i), vld1q_u8(blendBuffer + i)));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = (uint8_t)(((int)*(buffer + i) + (int)*(blendBuffer + i)) / 2);
-        }
+    for (; i < channels; ++i) {
+        buffer[i] = (uint8_t)(((int)buffer[i] + (int)blendBuffer[i]) / 2);
     }
 }
 
 void Maximum(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = std::max(*(buffer + i), *(blendBuffer + i));
-        }
-
-        // do the aligned pieces using SIMD instructions ... up to 16 times faster
-        int simd = (channels - misaligned) / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_max_epu8(b, bb);
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-                                }
-
-        // do the residual part at the end where we dont have enough bytes to process
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = std::max(*(buffer + offset), *(blendBuffer + offset));
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= channels; i += 16) {
+        BLEND_STORE(buffer + i, _mm_max_epu8(BLEND_LOAD(buffer + i), BLEND_LOAD(blendBuffer + i)));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        vst1q_u8(buffer + i, vmaxq_u8(vld1q_u8(buffer + i), vld1q_u8(blendBuffer + i)));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = std::max(*(buffer + i), *(blendBuffer + i));
-        }
+    for (; i < channels; ++i) {
+        buffer[i] = std::max(buffer[i], blendBuffer[i]);
     }
 }
 
 void Minimum(uint8_t* buffer, uint8_t* blendBuffer, size_t channels)
 {
-#ifdef SIMD
-    int misaligned = GetMisalignedBytes(buffer, blendBuffer);
-
-    if (misaligned >= 0 && (channels - misaligned) >= ALIGNMENT) // we can only use SIMD if misalignment is the same for both buffers and we have the minimum number of bytes to do
-    {
-        // do the misaligned
-        for (size_t i = 0; i < misaligned; ++i)
-        {
-            *(buffer + i) = std::min(*(buffer + i), *(blendBuffer + i));
-        }
-
-        int simd = channels / ALIGNMENT;
-        for (size_t i = 0; i < simd; ++i)
-        {
-            size_t offset = misaligned + i * ALIGNMENT;
-            __m128i b = _mm_load_si128((__m128i*)(buffer + offset));
-            __m128i bb = _mm_load_si128((__m128i*)(blendBuffer + offset));
-
-            __m128i r = _mm_min_epu8(b, bb);
-
-            _mm_store_si128((__m128i*)(buffer + offset), r);
-        }
-
-        // do the residual
-        for (size_t i = 0; i < channels % ALIGNMENT; ++i)
-        {
-            size_t offset = i + misaligned + simd * ALIGNMENT;
-            *(buffer + offset) = std::min(*(buffer + offset), *(blendBuffer + offset));
-        }
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= channels; i += 16) {
+        BLEND_STORE(buffer + i, _mm_min_epu8(BLEND_LOAD(buffer + i), BLEND_LOAD(blendBuffer + i)));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= channels; i += 16) {
+        vst1q_u8(buffer + i, vminq_u8(vld1q_u8(buffer + i), vld1q_u8(blendBuffer + i)));
     }
-    else
 #endif
-    {
-        for (size_t i = 0; i < channels; ++i)
-        {
-            *(buffer + i) = std::min(*(buffer + i), *(blendBuffer + i));
-        }
+    for (; i < channels; ++i) {
+        buffer[i] = std::min(buffer[i], blendBuffer[i]);
     }
 }
 
 void OverwriteIfBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
-    {
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8_t* p = buffer + i * 3;
+        uint8_t* pp = blendBuffer + i * 3;
+        __m128i m0, m1, m2;
+        BlackPixelMask(p, m0, m1, m2);
+        // black pixels are all zero so or-ing in the blend values is enough
+        BLEND_STORE(p, _mm_or_si128(BLEND_LOAD(p), _mm_and_si128(m0, BLEND_LOAD(pp))));
+        BLEND_STORE(p + 16, _mm_or_si128(BLEND_LOAD(p + 16), _mm_and_si128(m1, BLEND_LOAD(pp + 16))));
+        BLEND_STORE(p + 32, _mm_or_si128(BLEND_LOAD(p + 32), _mm_and_si128(m2, BLEND_LOAD(pp + 32))));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8x16x3_t b = vld3q_u8(buffer + i * 3);
+        uint8x16x3_t bb = vld3q_u8(blendBuffer + i * 3);
+        uint8x16_t black = vceqq_u8(vorrq_u8(vorrq_u8(b.val[0], b.val[1]), b.val[2]), vdupq_n_u8(0));
+        b.val[0] = vbslq_u8(black, bb.val[0], b.val[0]);
+        b.val[1] = vbslq_u8(black, bb.val[1], b.val[1]);
+        b.val[2] = vbslq_u8(black, bb.val[2], b.val[2]);
+        vst3q_u8(buffer + i * 3, b);
+    }
+#endif
+    for (; i < pixels; ++i) {
         uint8_t* p = buffer + i * 3;
         auto sum = *p + *(p + 1) + *(p + 2);
-        if (sum == 0)
-        {
+        if (sum == 0) {
             uint8_t* pp = blendBuffer + i * 3;
             *p = *pp;
             *(p + 1) = *(pp + 1);
@@ -491,12 +427,32 @@ void OverwriteIfBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 
 void OverwriteSkipBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    for (size_t i = 0; i < pixels; ++i)
-    {
+    size_t i = 0;
+#if defined(BLEND_SSE2)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8_t* p = buffer + i * 3;
+        uint8_t* pp = blendBuffer + i * 3;
+        __m128i m0, m1, m2;
+        BlackPixelMask(pp, m0, m1, m2);
+        BLEND_STORE(p, _mm_or_si128(_mm_and_si128(m0, BLEND_LOAD(p)), _mm_andnot_si128(m0, BLEND_LOAD(pp))));
+        BLEND_STORE(p + 16, _mm_or_si128(_mm_and_si128(m1, BLEND_LOAD(p + 16)), _mm_andnot_si128(m1, BLEND_LOAD(pp + 16))));
+        BLEND_STORE(p + 32, _mm_or_si128(_mm_and_si128(m2, BLEND_LOAD(p + 32)), _mm_andnot_si128(m2, BLEND_LOAD(pp + 32))));
+    }
+#elif defined(BLEND_NEON)
+    for (; i + 16 <= pixels; i += 16) {
+        uint8x16x3_t b = vld3q_u8(buffer + i * 3);
+        uint8x16x3_t bb = vld3q_u8(blendBuffer + i * 3);
+        uint8x16_t black = vceqq_u8(vorrq_u8(vorrq_u8(bb.val[0], bb.val[1]), bb.val[2]), vdupq_n_u8(0));
+        b.val[0] = vbslq_u8(black, b.val[0], bb.val[0]);
+        b.val[1] = vbslq_u8(black, b.val[1], bb.val[1]);
+        b.val[2] = vbslq_u8(black, b.val[2], bb.val[2]);
+        vst3q_u8(buffer + i * 3, b);
+    }
+#endif
+    for (; i < pixels; ++i) {
         uint8_t* pp = blendBuffer + i * 3;
         auto sum = *pp + *(pp + 1) + *(pp + 2);
-        if (sum > 0)
-        {
+        if (sum > 0) {
             uint8_t* p = buffer + i * 3;
             *p = *pp;
             *(p + 1) = *(pp + 1);
@@ -508,14 +464,34 @@ void OverwriteSkipBlack(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 // apply the input data as if it was (inputvalue / 255) * currentvalue ... ie a brightness
 void Brightness(uint8_t* buffer, uint8_t* blendBuffer, size_t pixels)
 {
-    uint8_t* p = buffer;
-    uint8_t* pp = blendBuffer;
-    for (size_t i = 0; i < pixels * 3; ++i)         {
-        if (*pp == 0)             {
-            *p = 0;
-        }
-        else if (*pp != 255)             {
-            *p = ((int)*p * (int)*pp) / 255;
-        }
+    size_t channels = pixels * 3;
+    size_t i = 0;
+    // x / 255 == (x + 1 + (x >> 8)) >> 8 for every product of two bytes
+#if defined(BLEND_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    for (; i + 16 <= channels; i += 16) {
+        __m128i b = BLEND_LOAD(buffer + i);
+        __m128i bb = BLEND_LOAD(blendBuffer + i);
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(bb, zero));
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(bb, zero));
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+        BLEND_STORE(buffer + i, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(BLEND_NEON)
+    const uint16x8_t one = vdupq_n_u16(1);
+    for (; i + 16 <= channels; i += 16) {
+        uint8x16_t b = vld1q_u8(buffer + i);
+        uint8x16_t bb = vld1q_u8(blendBuffer + i);
+        uint16x8_t lo = vmull_u8(vget_low_u8(b), vget_low_u8(bb));
+        uint16x8_t hi = vmull_u8(vget_high_u8(b), vget_high_u8(bb));
+        lo = vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8));
+        hi = vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8));
+        vst1q_u8(buffer + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+#endif
+    for (; i < channels; ++i) {
+        buffer[i] = ((int)buffer[i] * (int)blendBuffer[i]) / 255;
     }
 }
@@ -633,7 +633,9 @@ void PlayListItemFSEQVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_
                         adjustedMS -= videoLength;
                     }
 
-                    _window->SetImage(CachedVideoReader::FadeImage(_cachedVideoReader->GetNextFrame(adjustedMS), brightness));
+                    int width, height;
+                    const uint8_t* frame = _cachedVideoReader->GetNextFrame(adjustedMS, brightness, width, height);
+                    _window->SetImageData(frame, width, height);
                 }
             }
             else {
@@ -644,7 +646,9 @@ void PlayListItemFSEQVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_
                     }
 
                     AVFrame* img = _videoReader->GetNextFrame(adjustedMS, framems);
-                    _window->SetImage(CachedVideoReader::FadeImage(CachedVideoReader::CreateImageFromFrame(img, _size), brightness));
+                    int width, height;
+                    CachedVideoReader::CopyFrame(img, _size, brightness, _frameBuffer, width, height);
+                    _window->SetImageData(_frameBuffer.data(), width, height);
                 }
             }
         }
@@ -11,6 +11,7 @@
  **************************************************************/
 
 #include <string>
+#include <vector>
 
 #include "PlayListItem.h"
 #include "../Blend.h"
@@ -50,6 +51,7 @@ protected:
     bool _cacheVideo = false;
     VideoReader* _videoReader = nullptr;
     CachedVideoReader* _cachedVideoReader = nullptr;
+    std::vector<uint8_t> _frameBuffer;
     std::string _cachedAudioFilename;
     long _fadeInMS = 0;
     long _fadeOutMS = 0;
@@ -295,7 +295,9 @@ void PlayListItemVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_t fr
                         adjustedMS -= videoLength;
                     }
 
-                    if (_window != nullptr) _window->SetImage(CachedVideoReader::FadeImage(_cachedVideoReader->GetNextFrame(adjustedMS), brightness));
+                    int width, height;
+                    const uint8_t* frame = _cachedVideoReader->GetNextFrame(adjustedMS, brightness, width, height);
+                    if (_window != nullptr) _window->SetImageData(frame, width, height);
                 }
             }
             else {
@@ -306,7 +308,9 @@ void PlayListItemVideo::Frame(uint8_t* buffer, size_t size, size_t ms, size_t fr
                     }
 
                     AVFrame* img = _videoReader->GetNextFrame(adjustedMS, framems);
-                    if (_window != nullptr) _window->SetImage(CachedVideoReader::FadeImage(CachedVideoReader::CreateImageFromFrame(img, _size), brightness));
+                    int width, height;
+                    CachedVideoReader::CopyFrame(img, _size, brightness, _frameBuffer, width, height);
+                    if (_window != nullptr) _window->SetImageData(_frameBuffer.data(), width, height);
                 }
             }
         }
@@ -11,6 +11,7 @@
  **************************************************************/
 
 #include <string>
+#include <vector>
 
 #include "PlayListItem.h"
 
@@ -36,6 +37,7 @@ protected:
     bool _loopVideo = false;
     VideoReader* _videoReader = nullptr;
     CachedVideoReader* _cachedVideoReader = nullptr;
+    std::vector<uint8_t> _frameBuffer;
     size_t _durationMS = 0;
     PlayerWindow* _window = nullptr;
     PlayerFrame* _frame = nullptr;
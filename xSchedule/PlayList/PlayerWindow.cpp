@@ -74,6 +74,9 @@ PlayerWindow::PlayerWindow(wxWindow* parent, bool topMost, wxImageResizeQuality
 
 PlayerWindow::~PlayerWindow()
 {
+    if (_swsCtx != nullptr) {
+        sws_freeContext(_swsCtx);
+    }
 }
 
 bool PlayerWindow::PrepareImage()
@@ -102,8 +105,6 @@ bool PlayerWindow::PrepareImage()
                     }
                 }
                 else {
-                    // THIS DOES NOT WORK YET ... NOT SURE WHY
-                    wxASSERT(false);
                     if (_image.GetWidth() != width || _image.GetHeight() != height) {
                         _image.Destroy();
                         _image = wxImage(width, height);
@@ -111,7 +112,7 @@ bool PlayerWindow::PrepareImage()
 
                     if (srcWidth != width || srcHeight != height) {
 
-                        SwsContext* swsCtx = sws_getContext(srcWidth, srcHeight, AVPixelFormat::AV_PIX_FMT_RGB24,
+                        _swsCtx = sws_getCachedContext(_swsCtx, srcWidth, srcHeight, AVPixelFormat::AV_PIX_FMT_RGB24,
                             width, height, AVPixelFormat::AV_PIX_FMT_RGB24,
                             _swsQuality, nullptr, nullptr, nullptr);
 
@@ -120,12 +121,13 @@ bool PlayerWindow::PrepareImage()
                         const uint8_t* srcPtr = (uint8_t*)_inputImage.GetData();
                         uint8_t* const dstPtr = (uint8_t*)_image.GetData();
 
-                        sws_scale(swsCtx,
-                            &srcPtr, &srcRow,
-                            0, height,
-                            &dstPtr, &dstRow);
-
-                        sws_freeContext(swsCtx);
+                        // the slice height is in source rows
+                        if (_swsCtx != nullptr) {
+                            sws_scale(_swsCtx,
+                                &srcPtr, &srcRow,
+                                0, srcHeight,
+                                &dstPtr, &dstRow);
+                        }
                     }
                     else {
                         _image.Destroy();
@@ -170,6 +172,28 @@ void PlayerWindow::SetImage(const wxImage& image)
     }
 }
 
+void PlayerWindow::SetImageData(const uint8_t* data, int width, int height)
+{
+    if (data == nullptr || width <= 0 || height <= 0) return;
+
+    std::unique_lock<std::timed_mutex> lock(_mutex);
+
+    size_t size = (size_t)width * height * 3;
+    bool changed = true;
+    if (_inputImage.IsOk() && _inputImage.GetWidth() == width && _inputImage.GetHeight() == height) {
+        changed = memcmp(_inputImage.GetData(), data, size) != 0;
+    } else {
+        _inputImage.Destroy();
+        _inputImage = wxImage(width, height, false);
+    }
+
+    if (changed) {
+        memcpy(_inputImage.GetData(), data, size);
+        _imageChanged = true;
+        Refresh(false); // force a paint on the main thread
+    }
+}
+
 void PlayerWindow::Paint(wxPaintEvent& event)
 {
     wxASSERT(wxThread::IsMain());
@@ -17,6 +17,8 @@
 #include <mutex>
 #include <atomic>
 
+struct SwsContext;
+
 class PlayerWindow: public wxFrame
 {
     wxImage _image;
@@ -28,6 +30,7 @@ class PlayerWindow: public wxFrame
     int _swsQuality;
     std::timed_mutex _mutex;
     std::atomic_bool _imageChanged;
+    SwsContext* _swsCtx = nullptr;
 
     bool PrepareImage();
 
@@ -36,6 +39,8 @@ class PlayerWindow: public wxFrame
 		PlayerWindow(wxWindow* parent, bool topMost, wxImageResizeQuality quality = wxIMAGE_QUALITY_HIGH, int swsQuality = -1, wxWindowID id=wxID_ANY,const wxPoint& pos=wxDefaultPosition,const wxSize& size=wxDefaultSize);
 		virtual ~PlayerWindow();
         void SetImage(const wxImage& image);
+        // same as SetImage but straight from RGB24 data, avoids building a wxImage per frame
+        void SetImageData(const uint8_t* data, int width, int height);
 
 	private:
 
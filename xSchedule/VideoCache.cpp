@@ -12,6 +12,9 @@
 #include "../xLights/VideoReader.h"
 #include "../xLights/UtilFunctions.h"
 
+#include <cstring>
+#include <iterator>
+
 #include <log4cpp/Category.hh>
 
 //#define VIDEO_EXTRALOGGING
@@ -124,7 +127,8 @@ public:
             long currentStart = GetCurrentStart();
             if (lastStart != currentStart)
             {
-                _cvr->PurgeCachePriorTo(currentStart);
+                // after a loop or a seek backwards the frames ahead of the new start are no use either
+                _cvr->PurgeCacheOutside(currentStart, currentStart + _maxFrames * _frameMS);
 
                 lastStart = currentStart;
                 long end = std::min((long)currentStart + _maxFrames * _frameMS, (long)_videoReader->GetLengthMS());
@@ -140,7 +144,7 @@ public:
                         wxStopWatch sw;
 
                         //_videoReader->Seek(i);
-                        _cvr->CacheImage(i, CachedVideoReader::CreateImageFromFrame(_videoReader->GetNextFrame(i), _size));
+                        _cvr->CacheFrame(i, _videoReader->GetNextFrame(i));
 
                         if (sw.Time() > _frameMS)
                         {
@@ -252,12 +256,14 @@ CachedVideoReader::~CachedVideoReader()
 #endif
 
         _cache.clear();
+        _free.clear();
+        _pool.clear();
     }
 }
 
 #define TIMEOUT(a) a / 2
 
-void CachedVideoReader::CacheImage(long millisecond, const wxImage& image)
+void CachedVideoReader::CacheFrame(long millisecond, AVFrame* frame)
 {
 #ifdef VIDEO_EXTRALOGGING
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -267,10 +273,43 @@ void CachedVideoReader::CacheImage(long millisecond, const wxImage& image)
     auto it = _cache.find(millisecond);
     if (it == _cache.end())
     {
+        CachedVideoFrame* f = nullptr;
+        if (!_free.empty())
+        {
+            f = _free.back();
+            _free.pop_back();
+        }
+        else if ((int)_pool.size() < _maxItems + 1)
+        {
+            // the pool only grows until it covers the read ahead window, after that frames are recycled
+            _pool.push_back(std::make_unique<CachedVideoFrame>());
+            f = _pool.back().get();
+        }
+        else if (!_cache.empty())
+        {
+            // the window has moved faster than it has been purged, the frame farthest from this one is the least use
+            auto farthest = _cache.begin();
+            if (_cache.rbegin()->first - millisecond > millisecond - farthest->first)
+            {
+                farthest = std::prev(_cache.end());
+            }
+#ifdef VIDEO_EXTRALOGGING
+            logger_base.debug("No free frame buffer to cache time %ld, reusing the one for %ld.", millisecond, farthest->first);
+#endif
+            f = farthest->second;
+            _cache.erase(farthest);
+        }
+        else
+        {
+            return;
+        }
+
 #ifdef VIDEO_EXTRALOGGING
         logger_base.debug("Cached image for time %ld.", millisecond);
 #endif
-        _cache[millisecond] = image.Copy();
+        // once the buffers have reached the frame size the copy never reallocates
+        CopyFrame(frame, _size, 100, f->data, f->width, f->height);
+        _cache[millisecond] = f;
     }
     else
     {
@@ -286,13 +325,14 @@ void CachedVideoReader::SetLengthMS(long lengthMS)
     _lengthMS = lengthMS;
 }
 
-wxImage CachedVideoReader::GetNextFrame(long ms)
+const uint8_t* CachedVideoReader::GetNextFrame(long ms, int brightness, int& width, int& height)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     if (_thread == nullptr || ms > _lengthMS)
     {
-        return wxImage(_size);
+        CopyFrame(nullptr, _size, 0, _output, width, height);
+        return _output.data();
     }
 
     // round ms to frame boundary
@@ -305,7 +345,12 @@ wxImage CachedVideoReader::GetNextFrame(long ms)
         auto it = _cache.find(ms);
         if (it != _cache.end())
         {
-            return it->second.Copy();
+            const CachedVideoFrame* f = it->second;
+            _output.resize(f->data.size());
+            FadeFrame(f->data.data(), _output.data(), f->data.size(), brightness);
+            width = f->width;
+            height = f->height;
+            return _output.data();
         }
     }
 
@@ -324,62 +369,70 @@ wxImage CachedVideoReader::GetNextFrame(long ms)
                 auto it = _cache.find(ms);
                 if (it != _cache.end())
                 {
-                    return it->second.Copy();
+                    const CachedVideoFrame* f = it->second;
+                    _output.resize(f->data.size());
+                    FadeFrame(f->data.data(), _output.data(), f->data.size(), brightness);
+                    width = f->width;
+                    height = f->height;
+                    return _output.data();
                 }
             }
         }
     }
 
     logger_base.debug("Video %s (%dx%d) tried to get frame %d from cache but it wasnt there :(", (const char *)_videoFile.c_str(), _size.GetWidth(), _size.GetHeight(), ms);
-    return wxImage(_size);
+    CopyFrame(nullptr, _size, 0, _output, width, height);
+    return _output.data();
 }
 
-wxImage CachedVideoReader::CreateImageFromFrame(AVFrame* frame, const wxSize& size)
+void CachedVideoReader::FadeFrame(const uint8_t* src, uint8_t* dst, size_t size, int brightness)
 {
-    if (frame != nullptr)
+    if (brightness >= 100)
     {
-        wxImage img(frame->width, frame->height, (unsigned char *)frame->data[0], true);
-        img.SetType(wxBitmapType::wxBITMAP_TYPE_BMP);
-        return img;
+        memcpy(dst, src, size);
+    }
+    else if (brightness <= 0)
+    {
+        memset(dst, 0, size);
     }
     else
     {
-        wxImage img(size.x, size.y, true);
-        return img;
+        // (v * brightness * 5243) >> 19 is exactly v * brightness / 100 for 8 bit v and brightness <= 100
+        // and unlike a lookup table it compiles to vector multiplies
+        uint32_t mult = brightness * 5243;
+        for (size_t i = 0; i < size; ++i)
+        {
+            dst[i] = (uint8_t)((src[i] * mult) >> 19);
+        }
     }
 }
 
-wxImage CachedVideoReader::FadeImage(const wxImage& image, int brightness)
+void CachedVideoReader::CopyFrame(AVFrame* frame, const wxSize& size, int brightness, std::vector<uint8_t>& buffer, int& width, int& height)
 {
-    unsigned char btable[256];
-
-    wxImage faded;
+    if (frame == nullptr)
+    {
+        width = size.x;
+        height = size.y;
+        buffer.resize((size_t)width * height * 3);
+        memset(buffer.data(), 0, buffer.size());
+        return;
+    }
 
-    if (!image.IsOk() || brightness == 0)
+    width = frame->width;
+    height = frame->height;
+    size_t rowSize = (size_t)width * 3;
+    buffer.resize(rowSize * height);
+    if (frame->linesize[0] == (int)rowSize)
     {
-        // create a blank image if it is invalid or faded to black
-        faded.Create(image.GetWidth(), image.GetHeight());
+        FadeFrame(frame->data[0], buffer.data(), buffer.size(), brightness);
     }
     else
     {
-        faded = image.Copy();
-        if (brightness != 100)
+        for (int y = 0; y < height; ++y)
         {
-            for (int i = 0; i < 256; i++)
-            {
-                btable[i] = i * brightness / 100;
-            }
-
-            unsigned char * pdata = faded.GetData();
-
-            for (int i = 0; i < faded.GetWidth() * faded.GetHeight() * 3; i++)
-            {
-                *(pdata + i) = btable[*(pdata + i)];
-            }
+            FadeFrame(frame->data[0] + (size_t)y * frame->linesize[0], buffer.data() + y * rowSize, rowSize, brightness);
         }
     }
-
-    return faded;
 }
 
 bool CachedVideoReader::HasFrame(long millisecond)
@@ -390,17 +443,18 @@ bool CachedVideoReader::HasFrame(long millisecond)
 }
 
 #define CALCCACHESIZE(a) 5 * 1000 / a
-void CachedVideoReader::PurgeCachePriorTo(long start)
+void CachedVideoReader::PurgeCacheOutside(long start, long end)
 {
     std::unique_lock<std::mutex> locker(_cacheAccess);
 
     auto it = _cache.begin();
     while (it != _cache.end())
     {
-        if (it->first < start)
+        if (it->first < start || it->first >= end)
         {
             auto next = it;
             ++next;
+            _free.push_back(it->second);
             _cache.erase(it);
             it = next;
         }
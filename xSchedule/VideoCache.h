@@ -14,6 +14,8 @@
 #include <wx/wx.h>
 #include <string>
 #include <map>
+#include <memory>
+#include <vector>
 #include "../xLights/JobPool.h"
 
 class VideoReader;
@@ -21,9 +23,20 @@ class VideoCacheItem;
 class CVRThread;
 struct AVFrame;
 
+// A decoded RGB24 frame. These are allocated once and recycled through the reader's free list.
+struct CachedVideoFrame
+{
+    std::vector<uint8_t> data;
+    int width = 0;
+    int height = 0;
+};
+
 class CachedVideoReader
 {
-    std::map<long, wxImage> _cache;
+    std::map<long, CachedVideoFrame*> _cache;
+    std::vector<std::unique_ptr<CachedVideoFrame>> _pool;
+    std::vector<CachedVideoFrame*> _free;
+    std::vector<uint8_t> _output;
     std::mutex _cacheAccess;
     int _maxItems;
     CVRThread* _thread;
@@ -37,16 +50,20 @@ public:
     CachedVideoReader(const std::string& videoFile, long startMillisecond, int frameTime, const wxSize& size, bool keepAspectRatio);
     virtual ~CachedVideoReader();
 
-    static wxImage CreateImageFromFrame(AVFrame* frame, const wxSize& size);
-    static wxImage FadeImage(const wxImage& image, int brightness);
+    // dst = src * brightness / 100 for brightness 0-100
+    static void FadeFrame(const uint8_t* src, uint8_t* dst, size_t size, int brightness);
+    // Copies a decoded frame into buffer applying the brightness. A null frame gives a black frame of size.
+    static void CopyFrame(AVFrame* frame, const wxSize& size, int brightness, std::vector<uint8_t>& buffer, int& width, int& height);
 
     bool HasFrame(long millisecond);
-    void CacheImage(long millisecond, const wxImage& image);
+    void CacheFrame(long millisecond, AVFrame* frame);
     void SetLengthMS(long lengthMS);
     void Done();
-    void PurgeCachePriorTo(long start);
+    // frees every cached frame before start or at/after end so the pool is always there for the read ahead window
+    void PurgeCacheOutside(long start, long end);
 
     long GetLengthMS() const { return _lengthMS; };
-    wxImage GetNextFrame(long ms);
+    // Returns the faded frame for ms. The data belongs to the reader and is only valid until the next call.
+    const uint8_t* GetNextFrame(long ms, int brightness, int& width, int& height);
 };
 
@@ -16,6 +16,12 @@
 #include "../xLights/outputs/OutputManager.h"
 #include "ScheduleOptions.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
 extern "C"
 {
     #include <libswscale/swscale.h>
@@ -23,6 +29,204 @@ extern "C"
 
 #include <log4cpp/Category.hh>
 
+// Turns the channel data of a virtual matrix into the image shown in its window. The frame thread just hands
+// over a copy of the channels and carries on, conversion, rotation and scaling all happen here. If a new frame
+// arrives before the previous one has been drawn the older one is dropped.
+class VirtualMatrixThread : public wxThread
+{
+    PlayerWindow* _window;
+    size_t _width;
+    size_t _height;
+    int _channelsPerPixel;
+    VMROTATION _rotation;
+    wxSize _outSize;
+    wxImageResizeQuality _quality;
+    int _swsQuality;
+
+    std::mutex _lock;
+    std::condition_variable _signal;
+    std::vector<uint8_t> _pending;
+    bool _hasPending = false;
+    bool _stop = false;
+
+    // only touched by the thread
+    std::vector<uint8_t> _channels;
+    std::vector<uint8_t> _rgb;
+    std::vector<uint8_t> _rotated;
+    std::vector<uint8_t> _scaled;
+    SwsContext* _swsCtx = nullptr;
+
+    int GetSwsFlags(int srcWidth, int dstWidth) const
+    {
+        if (_swsQuality >= 0) return _swsQuality;
+        switch (_quality) {
+        case wxIMAGE_QUALITY_NEAREST:
+            return SWS_POINT;
+        case wxIMAGE_QUALITY_BILINEAR:
+            return SWS_BILINEAR;
+        case wxIMAGE_QUALITY_BICUBIC:
+            return SWS_BICUBIC;
+        case wxIMAGE_QUALITY_BOX_AVERAGE:
+            return SWS_AREA;
+        default:
+            // like wxIMAGE_QUALITY_HIGH, bicubic going up and box average going down
+            return dstWidth > srcWidth ? SWS_BICUBIC : SWS_AREA;
+        }
+    }
+
+    void ConvertToRGB()
+    {
+        size_t pixels = _width * _height;
+        _rgb.resize(pixels * 3);
+        if (_channelsPerPixel == 3) {
+            memcpy(_rgb.data(), _channels.data(), pixels * 3);
+            return;
+        }
+        // when the white channel is on it replaces the colour, written without branches so it vectorises
+        const uint8_t* s = _channels.data();
+        uint8_t* d = _rgb.data();
+        for (size_t p = 0; p < pixels; ++p, s += 4, d += 3) {
+            uint8_t w = s[3];
+            uint8_t m = (uint8_t)-(w != 0);
+            d[0] = (s[0] & ~m) | (w & m);
+            d[1] = (s[1] & ~m) | (w & m);
+            d[2] = (s[2] & ~m) | (w & m);
+        }
+    }
+
+    // rotates or mirrors _rgb the same way as the wxImage Rotate90 and Mirror calls used to
+    const uint8_t* Rotate(size_t& width, size_t& height)
+    {
+        width = _width;
+        height = _height;
+        if (_rotation == VMROTATION::VM_NORMAL) {
+            return _rgb.data();
+        }
+        _rotated.resize(_rgb.size());
+        const uint8_t* src = _rgb.data();
+        uint8_t* dst = _rotated.data();
+        size_t rowSize = _width * 3;
+
+        switch (_rotation) {
+        case VMROTATION::VM_FLIP_HORIZONTAL:
+            for (size_t y = 0; y < _height; ++y) {
+                const uint8_t* s = src + y * rowSize;
+                uint8_t* d = dst + y * rowSize + rowSize - 3;
+                for (size_t x = 0; x < _width; ++x, s += 3, d -= 3) {
+                    d[0] = s[0];
+                    d[1] = s[1];
+                    d[2] = s[2];
+                }
+            }
+            break;
+        case VMROTATION::VM_FLIP_VERTICAL:
+            for (size_t y = 0; y < _height; ++y) {
+                memcpy(dst + (_height - 1 - y) * rowSize, src + y * rowSize, rowSize);
+            }
+            break;
+        default:
+            // 90 is clockwise so (x, y) ends up at (h - 1 - y, x), 270 puts it at (y, w - 1 - x)
+            width = _height;
+            height = _width;
+            for (size_t y = 0; y < _height; ++y) {
+                const uint8_t* s = src + y * rowSize;
+                for (size_t x = 0; x < _width; ++x, s += 3) {
+                    size_t dx = _rotation == VMROTATION::VM_90 ? _height - 1 - y : y;
+                    size_t dy = _rotation == VMROTATION::VM_90 ? x : _width - 1 - x;
+                    uint8_t* d = dst + (dy * width + dx) * 3;
+                    d[0] = s[0];
+                    d[1] = s[1];
+                    d[2] = s[2];
+                }
+            }
+            break;
+        }
+        return dst;
+    }
+
+    void Render()
+    {
+        size_t width = 0;
+        size_t height = 0;
+        ConvertToRGB();
+        const uint8_t* image = Rotate(width, height);
+
+        int outWidth = _outSize.GetWidth();
+        int outHeight = _outSize.GetHeight();
+        if (outWidth > 0 && outHeight > 0 && (outWidth != (int)width || outHeight != (int)height)) {
+            _swsCtx = sws_getCachedContext(_swsCtx, width, height, AVPixelFormat::AV_PIX_FMT_RGB24,
+                                           outWidth, outHeight, AVPixelFormat::AV_PIX_FMT_RGB24,
+                                           GetSwsFlags(width, outWidth), nullptr, nullptr, nullptr);
+            if (_swsCtx != nullptr) {
+                _scaled.resize((size_t)outWidth * outHeight * 3);
+                const int srcRow = width * 3;
+                const int dstRow = outWidth * 3;
+                uint8_t* dst = _scaled.data();
+                sws_scale(_swsCtx, &image, &srcRow, 0, height, &dst, &dstRow);
+                image = dst;
+                width = outWidth;
+                height = outHeight;
+            }
+        }
+        _window->SetImageData(image, width, height);
+    }
+
+public:
+    VirtualMatrixThread(PlayerWindow* window, size_t width, size_t height, int channelsPerPixel, VMROTATION rotation, wxSize outSize, wxImageResizeQuality quality, int swsQuality) :
+        wxThread(wxTHREAD_JOINABLE), _window(window), _width(width), _height(height), _channelsPerPixel(channelsPerPixel), _rotation(rotation), _outSize(outSize), _quality(quality), _swsQuality(swsQuality)
+    {
+        _pending.resize(width * height * channelsPerPixel);
+    }
+
+    virtual ~VirtualMatrixThread()
+    {
+        if (_swsCtx != nullptr) {
+            sws_freeContext(_swsCtx);
+        }
+    }
+
+    // copies the channels, anything past size is treated as off
+    void SetFrame(const uint8_t* data, size_t size)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            size = std::min(size, _pending.size());
+            if (size > 0) {
+                memcpy(_pending.data(), data, size);
+            }
+            memset(_pending.data() + size, 0x00, _pending.size() - size);
+            _hasPending = true;
+        }
+        _signal.notify_one();
+    }
+
+    void Stop()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _stop = true;
+        }
+        _signal.notify_one();
+    }
+
+    virtual void* Entry() override
+    {
+        _channels.resize(_pending.size());
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_lock);
+                _signal.wait(lock, [this] { return _stop || _hasPending; });
+                if (_stop) break;
+                _channels.swap(_pending);
+                _pending.resize(_channels.size());
+                _hasPending = false;
+            }
+            Render();
+        }
+        return nullptr;
+    }
+};
+
 VirtualMatrix::VirtualMatrix(OutputManager* outputManager, int width, int height, bool topMost, VMROTATION rotation, VMPIXELCHANNELS pixelChannels, wxImageResizeQuality quality, int swsQuality, const std::string& startChannel, const std::string& name, wxSize size, wxPoint loc, bool useMatrixSize, int matrixMultiplier)
 {
     _suppress = false;
@@ -333,100 +537,29 @@ std::string VirtualMatrix::DecodeScalingQuality(wxImageResizeQuality quality, in
     return "Normal";
 }
 
-void VirtualMatrix::AllOff()
+VirtualMatrix::~VirtualMatrix()
 {
-    if (!_image.IsOk()) return;
-    if (_window == nullptr) return;
+    StopThread();
+}
 
-    _image.Clear();
+void VirtualMatrix::AllOff()
+{
+    if (_thread == nullptr) return;
 
-    if (_rotation == VMROTATION::VM_NORMAL)
-    {
-        _window->SetImage(_image);
-    }
-    else if (_rotation == VMROTATION::VM_FLIP_HORIZONTAL) {
-        wxImage rot = _image.Mirror(true);
-        _window->SetImage(rot);
-    }
-    else if (_rotation == VMROTATION::VM_FLIP_VERTICAL) {
-        wxImage rot = _image.Mirror(false);
-        _window->SetImage(rot);
-    }
-    else if (_rotation == VMROTATION::VM_90)
-    {
-        wxImage rot = _image.Rotate90();
-        _window->SetImage(rot);
-    }
-    else
-    {
-        wxImage rot = _image.Rotate90(false);
-        _window->SetImage(rot);
-    }
+    _thread->SetFrame(nullptr, 0);
 }
 
 void VirtualMatrix::Frame(uint8_t*buffer, size_t size)
 {
-    if (!_image.IsOk()) return;
-    if (_window == nullptr) return;
+    if (_thread == nullptr) return;
 
     // If there is no width or height there is nothing to draw
     if (_width == 0 || _height == 0) return;
 
     long sc = _outputManager->DecodeStartChannel(_startChannel);
+    if (sc < 1 || (size_t)sc > size) return;
 
-    const int channelsPerPixel = GetPixelChannelsCount();
-    size_t end = _width * _height * channelsPerPixel < size - (sc - 1) ? _width * _height * channelsPerPixel : size - (sc - 1);
-
-    for (size_t i = 0; i < end; i += channelsPerPixel)
-    {
-        uint8_t* pb = buffer + (sc - 1) + i;
-        uint8_t r = *pb;
-        uint8_t g = 0;
-        if (i + 1 < end)
-        {
-            g = *(pb + 1);
-        }
-        uint8_t b = 0;
-        if (i + 2 < end)
-        {
-            b = *(pb + 2);
-        }
-        if (channelsPerPixel > 3)
-        {
-            uint8_t w = 0;
-            if (i + 3 < end) {
-                w = *(pb + 3);
-            }
-            if (w != 0)
-            {
-                r = g = b = w;
-            }
-        }
-        _image.SetRGB((i / channelsPerPixel) % _width, i / channelsPerPixel / _width, r, g, b);
-    }
-
-    if (_rotation == VMROTATION::VM_NORMAL)
-    {
-        _window->SetImage(_image);
-    }
-    else if (_rotation == VMROTATION::VM_FLIP_HORIZONTAL) {
-        wxImage rot = _image.Mirror(true);
-        _window->SetImage(rot);
-    }
-    else if (_rotation == VMROTATION::VM_FLIP_VERTICAL) {
-        wxImage rot = _image.Mirror(false);
-        _window->SetImage(rot);
-    }
-    else if (_rotation == VMROTATION::VM_90)
-    {
-        wxImage rot = _image.Rotate90();
-        _window->SetImage(rot);
-    }
-    else
-    {
-        wxImage rot = _image.Rotate90(false);
-        _window->SetImage(rot);
-    }
+    _thread->SetFrame(buffer + (sc - 1), size - (sc - 1));
 }
 
 void VirtualMatrix::Start()
@@ -450,7 +583,28 @@ void VirtualMatrix::Start()
         _window->Hide();
     }
 
-    _image = wxImage(_width, _height);
+    StopThread();
+    if (_width != 0 && _height != 0)
+    {
+        _thread = new VirtualMatrixThread(_window, _width, _height, GetPixelChannelsCount(), _rotation, _size, _quality, _swsQuality);
+        if (_thread->Run() != wxTHREAD_NO_ERROR)
+        {
+            logger_base.error("Virtual matrix %s failed to start its render thread.", (const char *)_name.c_str());
+            delete _thread;
+            _thread = nullptr;
+        }
+    }
+}
+
+void VirtualMatrix::StopThread()
+{
+    if (_thread != nullptr)
+    {
+        _thread->Stop();
+        _thread->Wait();
+        delete _thread;
+        _thread = nullptr;
+    }
 }
 
 void VirtualMatrix::Stop()
@@ -458,6 +612,9 @@ void VirtualMatrix::Stop()
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.debug("Virtual matrix stopped %s.", (const char *)_name.c_str());
 
+    // the thread draws into the window so it has to go first
+    StopThread();
+
     // destroy the window
     if (_window != nullptr)
     {
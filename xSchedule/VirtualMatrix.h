@@ -17,6 +17,7 @@
 class wxXmlNode;
 class OutputManager;
 class ScheduleOptions;
+class VirtualMatrixThread;
 
 typedef enum {VM_NORMAL, VM_90, VM_270, VM_FLIP_HORIZONTAL, VM_FLIP_VERTICAL } VMROTATION;
 typedef enum {RGB, RGBW } VMPIXELCHANNELS;
@@ -37,12 +38,14 @@ class VirtualMatrix
     VMROTATION _rotation;
     VMPIXELCHANNELS _pixelChannels;
     std::string _startChannel;
-    wxImage _image;
     wxImageResizeQuality _quality;
     int _swsQuality;
     PlayerWindow* _window;
+    VirtualMatrixThread* _thread = nullptr;
     bool _suppress;
 
+    void StopThread();
+
 public:
 
 		static VMROTATION EncodeRotation(const std::string rotation);
@@ -56,7 +59,7 @@ public:
         VirtualMatrix(OutputManager* outputManager, int width, int height, bool topMost, VMROTATION rotation, VMPIXELCHANNELS pixelChannels, wxImageResizeQuality quality, int swsQuality, const std::string& startChannel, const std::string& name, wxSize size, wxPoint loc, bool useMatrixSize, int matrixMultiplier);
         VirtualMatrix(OutputManager* outputManager, int width, int height, bool topMost, const std::string& rotation, const std::string& pixelChannels, const std::string& quality, const std::string& startChannel, const std::string& name, wxSize size, wxPoint loc, bool useMatrixSize, int matrixMultiplier);
         VirtualMatrix(OutputManager* outputManager, ScheduleOptions* options);
-        virtual ~VirtualMatrix() {}
+        virtual ~VirtualMatrix();
         void Frame(uint8_t*buffer, size_t size);
         void AllOff();
         void Start();
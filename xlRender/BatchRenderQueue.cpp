@@ -0,0 +1,99 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "BatchRenderQueue.h"
+
+#include <algorithm>
+#include <fstream>
+
+BatchRenderQueue::BatchRenderQueue(int maxJobs, uint64_t memoryBudgetMB) :
+    _maxJobs(std::max(maxJobs, 1)), _memoryBudget(memoryBudgetMB)
+{
+}
+
+void BatchRenderQueue::Add(const std::string& sequence, uint64_t memoryMB)
+{
+    Job job;
+    job.sequence = sequence;
+    job.memoryMB = memoryMB;
+    _jobs.push_back(job);
+    _sorted = false;
+}
+
+void BatchRenderQueue::Sort()
+{
+    // only ever sorted before anything has started so the indexes handed out stay valid
+    std::stable_sort(_jobs.begin(), _jobs.end(), [](const Job& a, const Job& b) { return a.memoryMB > b.memoryMB; });
+    _sorted = true;
+}
+
+int BatchRenderQueue::Start()
+{
+    if (!_sorted && _running == 0) {
+        Sort();
+    }
+    if (_running >= _maxJobs) {
+        return -1;
+    }
+    for (size_t i = 0; i < _jobs.size(); i++) {
+        Job& job = _jobs[i];
+        if (job.running || job.done) {
+            continue;
+        }
+        if (_running == 0 || _memoryInUse + job.memoryMB <= _memoryBudget) {
+            job.running = true;
+            _running++;
+            _memoryInUse += job.memoryMB;
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+void BatchRenderQueue::Finish(int job)
+{
+    Job& j = _jobs[job];
+    if (!j.running) {
+        return;
+    }
+    j.running = false;
+    j.done = true;
+    _running--;
+    _memoryInUse -= j.memoryMB;
+}
+
+bool BatchRenderQueue::IsDone() const
+{
+    return std::all_of(_jobs.begin(), _jobs.end(), [](const Job& j) { return j.done; });
+}
+
+static uint32_t ReadLE32(const unsigned char* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t BatchRenderQueue::EstimateMemoryMB(const std::string& fseqFile, uint64_t baseMB, uint64_t defaultMB)
+{
+    std::ifstream in(fseqFile, std::ios::binary);
+    if (!in) {
+        return defaultMB;
+    }
+    // v1 and v2 headers both have the channel count at 10 and the frame count at 14
+    unsigned char header[18];
+    if (!in.read((char*)header, sizeof(header))) {
+        return defaultMB;
+    }
+    if ((header[0] != 'P' && header[0] != 'F') || header[1] != 'S' || header[2] != 'E' || header[3] != 'Q') {
+        return defaultMB;
+    }
+    uint64_t channels = ReadLE32(&header[10]);
+    uint64_t frames = ReadLE32(&header[14]);
+    return baseMB + (channels * frames + 1024 * 1024 - 1) / (1024 * 1024);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Decides which sequences of a batch render can run at the same time. Each sequence carries an estimate of the
+// memory its render needs and a sequence only starts if it fits in what is left of the memory budget and there is a
+// free job slot. Bigger sequences go first so the long ones are not left running alone at the end. A sequence that
+// is bigger than the whole budget still runs, but only when nothing else is running.
+class BatchRenderQueue {
+public:
+    struct Job {
+        std::string sequence;
+        uint64_t memoryMB = 0;
+        bool running = false;
+        bool done = false;
+    };
+
+    BatchRenderQueue(int maxJobs, uint64_t memoryBudgetMB);
+
+    void Add(const std::string& sequence, uint64_t memoryMB);
+
+    // returns the index of the next job to start or -1 if nothing can start right now
+    int Start();
+    void Finish(int job);
+
+    bool IsDone() const;
+    int GetRunningCount() const { return _running; }
+    uint64_t GetMemoryInUseMB() const { return _memoryInUse; }
+    const Job& GetJob(int job) const { return _jobs[job]; }
+    size_t GetJobCount() const { return _jobs.size(); }
+
+    // estimate from the sequence's existing fseq, the render holds a channels x frames buffer on top of
+    // baseMB for the show's models. Falls back to defaultMB if there is no readable fseq.
+    static uint64_t EstimateMemoryMB(const std::string& fseqFile, uint64_t baseMB, uint64_t defaultMB);
+
+private:
+    void Sort();
+
+    std::vector<Job> _jobs;
+    int _maxJobs;
+    uint64_t _memoryBudget;
+    int _running = 0;
+    uint64_t _memoryInUse = 0;
+    bool _sorted = true;
+};
@@ -0,0 +1,162 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/xLightsSequencer/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/xLightsSequencer/xLights/blob/master/License.txt
+ **************************************************************/
+
+// For compilers that support precompilation, includes "wx/wx.h".
+#include "wx/wxprec.h"
+
+// for all others, include the necessary headers (this file is usually all you
+// need because it includes almost all "standard" wxWidgets headers)
+#ifndef WX_PRECOMP
+    #include "wx/wx.h"
+#endif
+
+#include <wx/app.h>
+#include <wx/cmdline.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
+#include <wx/utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BatchRenderQueue.h"
+
+// Renders a batch of sequences by running several "xLights -r" renders side by side. Each render is its own
+// process with the window hidden so sequences do not share any of the frame's state, the queue keeps the number
+// running and their estimated memory inside the budget and each one gets its share of the cpus.
+
+struct RenderResult {
+    int exitCode = 0;
+    double secs = 0;
+};
+
+static wxString Quote(const wxString& s)
+{
+    return "\"" + s + "\"";
+}
+
+int main(int argc, char **argv)
+{
+    wxApp::CheckBuildOptions(WX_BUILD_OPTIONS_SIGNATURE, "program");
+
+    wxInitializer initializer;
+    if (!initializer) {
+        fprintf(stderr, "Failed to initialize the wxWidgets library, aborting.\n");
+        return 1;
+    }
+
+    static const wxCmdLineEntryDesc cmdLineDesc[] = {
+        { wxCMD_LINE_SWITCH, "h", "help", "displays help on the command line parameters", wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
+        { wxCMD_LINE_OPTION, "s", "show", "show directory", wxCMD_LINE_VAL_STRING, wxCMD_LINE_OPTION_MANDATORY },
+        { wxCMD_LINE_OPTION, "m", "media", "media directory" },
+        { wxCMD_LINE_OPTION, "x", "xlights", "xLights executable to render with" },
+        { wxCMD_LINE_OPTION, "j", "jobs", "sequences to render at the same time", wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "t", "threads", "cpus shared by all the renders", wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "M", "memory", "memory budget for all the renders in MB", wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_OPTION, "b", "base", "memory each render needs for the layout in MB", wxCMD_LINE_VAL_NUMBER },
+        { wxCMD_LINE_PARAM, "", "", "sequence file", wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_MULTIPLE },
+        { wxCMD_LINE_NONE }
+    };
+
+    wxCmdLineParser parser(cmdLineDesc, argc, argv);
+    if (parser.Parse() != 0) {
+        return 1;
+    }
+
+    wxString showDir;
+    parser.Found("s", &showDir);
+    wxString mediaDir;
+    parser.Found("m", &mediaDir);
+
+    wxString xlights;
+    if (!parser.Found("x", &xlights)) {
+        wxFileName fn(wxStandardPaths::Get().GetExecutablePath());
+        fn.SetName("xLights");
+        xlights = fn.GetFullPath();
+    }
+
+    long cpus = wxThread::GetCPUCount();
+    parser.Found("t", &cpus);
+    long jobs = std::max(1L, cpus / 4);
+    parser.Found("j", &jobs);
+    jobs = std::max(1L, jobs);
+
+    long memory = -1;
+    if (!parser.Found("M", &memory)) {
+        wxMemorySize freeMem = wxGetFreeMemory();
+        memory = freeMem > 0 ? (long)((freeMem / (1024 * 1024) * 3 / 4).GetValue()) : 4096;
+    }
+    long baseMB = 512;
+    parser.Found("b", &baseMB);
+
+    BatchRenderQueue queue(jobs, memory);
+    for (size_t i = 0; i < parser.GetParamCount(); i++) {
+        wxFileName fseq(parser.GetParam(i));
+        fseq.SetExt("fseq");
+        queue.Add(parser.GetParam(i).ToStdString(),
+                  BatchRenderQueue::EstimateMemoryMB(fseq.GetFullPath().ToStdString(), baseMB, baseMB + 256));
+    }
+
+    long cpusPerRender = std::max(1L, cpus / jobs);
+    printf("Rendering %d sequences, %d at a time, %d cpus each, %dMB memory budget.\n",
+           (int)queue.GetJobCount(), (int)jobs, (int)cpusPerRender, (int)memory);
+
+    std::mutex lock;
+    std::condition_variable signal;
+    std::vector<RenderResult> results(queue.GetJobCount());
+    std::vector<std::thread> threads;
+    auto batchStart = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> locker(lock);
+    while (!queue.IsDone()) {
+        int job;
+        while ((job = queue.Start()) != -1) {
+            wxString cmd = Quote(xlights) + " -r -s " + Quote(showDir);
+            if (!mediaDir.IsEmpty()) {
+                cmd += " -m " + Quote(mediaDir);
+            }
+            cmd += wxString::Format(" -t %d ", (int)cpusPerRender) + Quote(queue.GetJob(job).sequence);
+            printf("Starting %s (%dMB)\n", queue.GetJob(job).sequence.c_str(), (int)queue.GetJob(job).memoryMB);
+            std::string command = cmd.ToStdString();
+            threads.emplace_back([&, job, command]() {
+                auto start = std::chrono::steady_clock::now();
+                int rc = std::system(command.c_str());
+                auto end = std::chrono::steady_clock::now();
+                std::unique_lock<std::mutex> l(lock);
+                results[job].exitCode = rc;
+                results[job].secs = std::chrono::duration<double>(end - start).count();
+                queue.Finish(job);
+                signal.notify_all();
+            });
+        }
+        signal.wait(locker);
+    }
+    locker.unlock();
+    for (auto& t : threads) {
+        t.join();
+    }
+    double batchSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+    int failed = 0;
+    for (size_t i = 0; i < queue.GetJobCount(); i++) {
+        printf("    %s  %0.3fs%s\n", queue.GetJob(i).sequence.c_str(), results[i].secs, results[i].exitCode == 0 ? "" : "  FAILED");
+        if (results[i].exitCode != 0) {
+            failed++;
+        }
+    }
+    printf("Batch render of %d sequences took %0.3fs.\n", (int)queue.GetJobCount(), batchSecs);
+
+    return failed == 0 ? 0 : 1;
+}